@@ -7,15 +7,23 @@
 #include "siopm_channel_base.h"
 
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/math.hpp>
 #include "chip/siopm_sound_chip.h"
 #include "chip/siopm_stream.h"
+#include "chip/siopm_voice_program.h"
+#include "utils/allocation_util.h"
 #include "utils/godot_util.h"
+#include "utils/trace_util.h"
 
 #define COPY_TL_TABLE(m_target, m_source)                        \
 	for (int _i = 0; _i < SiOPMRefTable::TL_TABLE_SIZE; _i++) {  \
 		m_target[_i] = m_source[_i];                             \
 	}
 
+void SiOPMChannelBase::set_channel_program(const SiOPMVoiceProgram *p_program, bool p_with_volume, bool p_with_modulation) {
+	set_channel_params(p_program->get_params(), p_with_volume, p_with_modulation);
+}
+
 int SiOPMChannelBase::get_master_volume() const {
 	return _volumes[0] * 128;
 }
@@ -105,8 +113,9 @@ void SiOPMChannelBase::initialize_lfo(int p_waveform, Vector<int> p_custom_wave_
 
 void SiOPMChannelBase::set_lfo_cycle_time(double p_ms) {
 	_lfo_timer = 0;
-	// 0.17294117647058824 = 44100/(1000*255)
-	_lfo_timer_step = ((int)(SiOPMRefTable::LFO_TIMER_INITIAL/(p_ms * 0.17294117647058824))) << _table->sample_rate_pitch_shift;
+	// = 0.17294117647058824@44.1kHz
+	double samples_per_step = _table->sampling_rate / (1000.0 * 255);
+	_lfo_timer_step = (int)(SiOPMRefTable::LFO_TIMER_INITIAL/(p_ms * samples_per_step));
 	_lfo_timer_step_buffer = _lfo_timer_step;
 }
 
@@ -341,11 +350,92 @@ void SiOPMChannelBase::_apply_sv_filter(SinglyLinkedList<int>::Element *p_buffer
 	_filter_eg_residue = _filter_eg_step - length;
 }
 
+void SiOPMChannelBase::_advance_sv_filter(int p_length) {
+	// Same as above, but only for the envelope.
+	int step = _filter_eg_residue;
+	int length = p_length;
+	while (length >= step) {
+		length -= step;
+
+		_cutoff_frequency += _filter_eg_cutoff_inc;
+		if (_cutoff_frequency == _filter_eg_next) {
+			_shift_sv_filter_state(_filter_eg_state + 1);
+		}
+
+		step = _filter_eg_step;
+	}
+
+	_filter_eg_residue = _filter_eg_step - length;
+}
+
+// Virtual voices.
+
+double SiOPMChannelBase::_total_level_to_gain(int p_offset) {
+	if (p_offset >= SiOPMRefTable::ENV_BOTTOM) {
+		return 0;
+	}
+
+	// Every (LOG_TABLE_RESOLUTION / 4) steps of the envelope halve the output.
+	return Math::pow(2.0, -(double)p_offset / (SiOPMRefTable::LOG_TABLE_RESOLUTION >> 2));
+}
+
+double SiOPMChannelBase::_get_effective_gain() const {
+	if (_mute) {
+		return 0;
+	}
+
+	double volume = _volumes[0];
+	if (_has_effect_send) {
+		for (int i = 1; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+			volume = MAX(volume, _volumes[i]);
+		}
+	}
+
+	return volume * _offset_gain;
+}
+
+bool SiOPMChannelBase::_update_virtual_state() {
+	const double threshold = _sound_chip->get_virtual_voice_threshold();
+
+	// Channels writing into pipes are heard through other channels, so they are always synthesized.
+	if (threshold <= 0 || _output_mode != OutputMode::OUTPUT_STANDARD) {
+		_is_virtual = false;
+		return false;
+	}
+
+	const bool was_virtual = _is_virtual;
+	_is_virtual = _get_effective_gain() < threshold;
+
+	if (was_virtual && !_is_virtual) {
+		// The filter hasn't seen any signal in a while, restart it from silence.
+		_filter_variables[0] = 0;
+		_filter_variables[1] = 0;
+		_filter_variables[2] = 0;
+	}
+
+	return _is_virtual;
+}
+
+void SiOPMChannelBase::_process_virtual(int p_length) {
+	_no_process(p_length);
+
+	if (_filter_on) {
+		_advance_sv_filter(p_length);
+	}
+}
+
 void SiOPMChannelBase::buffer(int p_length) {
+	SION_TRACE_SCOPE("SiOPMChannelBase::buffer");
+	SION_ALLOC_FREE_SCOPE("SiOPMChannelBase::buffer");
+
 	if (_is_idling) {
 		buffer_no_process(p_length);
 		return;
 	}
+	if (_update_virtual_state()) {
+		buffer_virtual(p_length);
+		return;
+	}
 
 	// Preserve the start of the output pipe.
 	SinglyLinkedList<int>::Element *mono_out = _out_pipe->get();
@@ -376,6 +466,10 @@ void SiOPMChannelBase::buffer(int p_length) {
 			SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
 			stream->write(mono_out, _buffer_index, p_length, _volumes[0], _pan);
 		}
+
+		if (_tap_stream) {
+			_tap_stream->write(mono_out, _buffer_index, p_length, 1, _pan);
+		}
 	}
 
 	_buffer_index += p_length;
@@ -386,6 +480,11 @@ void SiOPMChannelBase::buffer_no_process(int p_length) {
 	_buffer_index += p_length;
 }
 
+void SiOPMChannelBase::buffer_virtual(int p_length) {
+	_process_virtual(p_length);
+	_buffer_index += p_length;
+}
+
 //
 
 void SiOPMChannelBase::initialize(SiOPMChannelBase *p_prev, int p_buffer_index) {
@@ -396,10 +495,12 @@ void SiOPMChannelBase::initialize(SiOPMChannelBase *p_prev, int p_buffer_index)
 			_volumes.write[i] = p_prev->_volumes[i];
 			_streams.write[i] = p_prev->_streams[i];
 		}
+		_tap_stream = p_prev->_tap_stream;
 
 		_pan = p_prev->_pan;
 		_has_effect_send = p_prev->_has_effect_send;
 		_mute = p_prev->_mute;
+		_offset_gain = p_prev->_offset_gain;
 		COPY_TL_TABLE(_velocity_table, p_prev->_velocity_table);
 		COPY_TL_TABLE(_expression_table, p_prev->_expression_table);
 	} else if (!p_prev) {
@@ -409,10 +510,12 @@ void SiOPMChannelBase::initialize(SiOPMChannelBase *p_prev, int p_buffer_index)
 			_volumes.write[i] = 0;
 			_streams.write[i] = nullptr;
 		}
+		_tap_stream = nullptr;
 
 		_pan = 64;
 		_has_effect_send = false;
 		_mute = false;
+		_offset_gain = 1;
 		COPY_TL_TABLE(_velocity_table, _table->eg_total_level_tables[SiOPMRefTable::VM_LINEAR]);
 		COPY_TL_TABLE(_expression_table, _table->eg_total_level_tables[SiOPMRefTable::VM_LINEAR]);
 	}
@@ -420,6 +523,7 @@ void SiOPMChannelBase::initialize(SiOPMChannelBase *p_prev, int p_buffer_index)
 	// Buffer index.
 	_is_note_on = false;
 	_is_idling = true;
+	_is_virtual = false;
 	_buffer_index = p_buffer_index;
 
 	// LFO.
@@ -445,6 +549,7 @@ void SiOPMChannelBase::initialize(SiOPMChannelBase *p_prev, int p_buffer_index)
 void SiOPMChannelBase::reset() {
 	_is_note_on = false;
 	_is_idling = true;
+	_is_virtual = false;
 }
 
 String SiOPMChannelBase::_to_string() const {
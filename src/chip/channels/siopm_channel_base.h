@@ -20,6 +20,7 @@ using namespace godot;
 class SiOPMChannelParams;
 class SiOPMSoundChip;
 class SiOPMStream;
+class SiOPMVoiceProgram;
 class SiOPMWaveBase;
 
 // SiOPM sound channel base class.
@@ -96,6 +97,8 @@ protected:
 
 	Vector<SiOPMStream *> _streams;
 	Vector<double> _volumes;
+	// Receives the output before stream send levels, see SiONAnalysisTap.
+	SiOPMStream *_tap_stream = nullptr;
 	bool _is_idling = true;
 	int _pan = 64;
 	bool _has_effect_send = false;
@@ -103,6 +106,19 @@ protected:
 	int _velocity_table[SiOPMRefTable::TL_TABLE_SIZE];
 	int _expression_table[SiOPMRefTable::TL_TABLE_SIZE];
 
+	// Virtual voices.
+
+	// Virtual channels keep their state running, but don't synthesize anything.
+	bool _is_virtual = false;
+	// Linear gain of the current expression and velocity.
+	double _offset_gain = 1;
+
+	static double _total_level_to_gain(int p_offset);
+	virtual double _get_effective_gain() const;
+	bool _update_virtual_state();
+	// Advances envelopes, phases, and pipes without producing any output.
+	virtual void _process_virtual(int p_length);
+
 	// Low pass filter.
 
 	bool _filter_on = false;
@@ -133,6 +149,7 @@ protected:
 	void _apply_ring_modulation(SinglyLinkedList<int>::Element *p_buffer_start, int p_length);
 	// NOTE: Original code would implicitly use the filter variables if nothing was passed as the 3rd argument. We make this explicit.
 	void _apply_sv_filter(SinglyLinkedList<int>::Element *p_buffer_start, int p_length, double (&r_variables)[3]);
+	void _advance_sv_filter(int p_length);
 	void _reset_sv_filter_state();
 	bool _try_shift_sv_filter_state(int p_state);
 	void _shift_sv_filter_state(int p_state);
@@ -142,6 +159,8 @@ public:
 
 	virtual void get_channel_params(const Ref<SiOPMChannelParams> &p_params) const {}
 	virtual void set_channel_params(const Ref<SiOPMChannelParams> &p_params, bool p_with_volume, bool p_with_modulation = true) {}
+	// Channels without a fast path fall back to set_channel_params() with the program's source params.
+	virtual void set_channel_program(const SiOPMVoiceProgram *p_program, bool p_with_volume, bool p_with_modulation = true);
 
 	virtual void set_wave_data(const Ref<SiOPMWaveBase> &p_wave_data) {}
 	virtual void set_channel_number(int p_value) {}
@@ -179,6 +198,7 @@ public:
 	virtual int get_buffer_index() const { return _buffer_index; }
 	virtual bool is_note_on() const { return _is_note_on; }
 	virtual bool is_idling() const { return _is_idling; }
+	virtual bool is_virtual() const { return _is_virtual; }
 
 	virtual bool is_filter_active() const { return _filter_on; }
 	virtual int get_filter_type() const { return _filter_type; }
@@ -189,6 +209,8 @@ public:
 	virtual void set_all_stream_send_levels(Vector<int> p_levels);
 	virtual void set_stream_buffer(int p_stream_num, SiOPMStream *p_stream = nullptr);
 	virtual void set_stream_send(int p_stream_num, double p_volume);
+	SiOPMStream *get_tap_stream() const { return _tap_stream; }
+	void set_tap_stream(SiOPMStream *p_stream) { _tap_stream = p_stream; }
 	virtual double get_stream_send(int p_stream_num);
 	virtual void offset_volume(int p_expression, int p_velocity) {}
 
@@ -221,6 +243,7 @@ public:
 	virtual void reset_channel_buffer_status();
 	virtual void buffer(int p_length);
 	virtual void buffer_no_process(int p_length);
+	virtual void buffer_virtual(int p_length);
 
 	//
 
@@ -10,6 +10,7 @@
 #include "chip/channels/siopm_operator.h"
 #include "chip/siopm_channel_params.h"
 #include "chip/siopm_sound_chip.h"
+#include "chip/siopm_voice_program.h"
 #include "chip/wave/siopm_wave_pcm_data.h"
 #include "chip/wave/siopm_wave_pcm_table.h"
 #include "chip/wave/siopm_wave_table.h"
@@ -155,6 +156,43 @@ void SiOPMChannelFM::set_channel_params(const Ref<SiOPMChannelParams> &p_params,
 	}
 }
 
+void SiOPMChannelFM::set_channel_program(const SiOPMVoiceProgram *p_program, bool p_with_volume, bool p_with_modulation) {
+	if (p_program->get_operator_count() == 0) {
+		return;
+	}
+
+	set_algorithm(p_program->get_operator_count(), p_program->is_analog_like(), p_program->get_algorithm());
+	set_frequency_ratio(p_program->get_frequency_ratio());
+	set_feedback(p_program->get_feedback(), p_program->get_feedback_connection());
+
+	if (p_with_modulation) {
+		initialize_lfo(p_program->get_lfo_wave_shape());
+		_set_lfo_timer(p_program->get_lfo_frequency_step());
+
+		set_amplitude_modulation(p_program->get_amplitude_modulation_depth());
+		set_pitch_modulation(p_program->get_pitch_modulation_depth());
+	}
+
+	if (p_with_volume) {
+		for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+			_volumes.write[i] = p_program->get_volume(i);
+		}
+
+		_has_effect_send = p_program->has_effect_send();
+		_pan = p_program->get_pan();
+	}
+
+	_filter_type = p_program->get_filter_type();
+	set_sv_filter(
+			p_program->get_filter_param(0), p_program->get_filter_param(1),
+			p_program->get_filter_param(2), p_program->get_filter_param(3), p_program->get_filter_param(4), p_program->get_filter_param(5),
+			p_program->get_filter_param(6), p_program->get_filter_param(7), p_program->get_filter_param(8), p_program->get_filter_param(9));
+
+	for (int i = 0; i < _operator_count; i++) {
+		_operators[i]->set_operator_state(p_program->get_operator_state(i));
+	}
+}
+
 void SiOPMChannelFM::set_params_by_value(int p_ar, int p_dr, int p_sr, int p_rr, int p_sl, int p_tl, int p_ksr, int p_ksl, int p_mul, int p_dt1, int p_dt2, int p_ams, int p_phase, int p_fix_note) {
 #define SET_OP_PARAM(m_setter, m_value)      \
 	if (m_value != INT32_MIN) {              \
@@ -678,6 +716,7 @@ void SiOPMChannelFM::set_envelope_reset(bool p_reset) {
 void SiOPMChannelFM::offset_volume(int p_expression, int p_velocity) {
 	int expression_index = p_expression << 1;
 	int offset = _expression_table[expression_index] + _velocity_table[p_velocity];
+	_offset_gain = _total_level_to_gain(offset);
 
 	for (int i = 0; i < _operator_count; i++) {
 		SiOPMOperator *op = _operators[i];
@@ -1167,7 +1206,7 @@ void SiOPMChannelFM::_process_pcm_lfo_off(int p_length) {
 				}
 			}
 
-			int log_idx = ope0->get_wave_value(t);
+			int log_idx = ope0->get_pcm_wave_value(t);
 			log_idx += ope0->get_eg_output();
 			output = _table->log_table[log_idx];
 
@@ -1229,7 +1268,7 @@ void SiOPMChannelFM::_process_pcm_lfo_on(int p_length) {
 				}
 			}
 
-			int log_idx = ope0->get_wave_value(t);
+			int log_idx = ope0->get_pcm_wave_value(t);
 			log_idx += ope0->get_eg_output() + (_amplitude_modulation_output_level>>ope0->get_amplitude_modulation_shift());
 			output = _table->log_table[log_idx];
 
@@ -1440,6 +1479,40 @@ void SiOPMChannelFM::note_off() {
 	SiOPMChannelBase::note_off();
 }
 
+void SiOPMChannelFM::_process_virtual(int p_length) {
+	// Only envelopes and phases are kept running, modulation and waveforms are skipped entirely.
+	for (int i = 0; i < p_length; i++) {
+		if (_lfo_on) {
+			_update_lfo(_operator_count);
+		}
+
+		for (int j = 0; j < _operator_count; j++) {
+			SiOPMOperator *op = _operators[j];
+			op->tick_eg(_eg_timer_initial);
+			op->tick_pulse_generator();
+		}
+
+		// PCM phase is not wrapped by the wave table, so it must follow the loop.
+		if (_process_function_type == PROCESS_PCM) {
+			SiOPMOperator *ope0 = _operators[0];
+			int t = ope0->get_phase() >> ope0->get_wave_fixed_bits();
+
+			if (t >= ope0->get_pcm_end_point()) {
+				if (ope0->get_pcm_loop_point() == -1) {
+					ope0->set_eg_state(SiOPMOperator::EG_OFF);
+					ope0->update_eg_output();
+					break;
+				} else {
+					int phase_diff = (ope0->get_pcm_end_point() - ope0->get_pcm_loop_point()) << ope0->get_wave_fixed_bits();
+					ope0->adjust_phase(-phase_diff);
+				}
+			}
+		}
+	}
+
+	SiOPMChannelBase::_process_virtual(p_length);
+}
+
 void SiOPMChannelFM::reset_channel_buffer_status() {
 	_buffer_index = 0;
 	_is_idling = true;
@@ -1471,6 +1544,7 @@ void SiOPMChannelFM::reset() {
 
 	_is_note_on = false;
 	_is_idling = true;
+	_is_virtual = false;
 }
 
 String SiOPMChannelFM::_to_string() const {
@@ -102,6 +102,8 @@ class SiOPMChannelFM : public SiOPMChannelBase {
 	void _process_ring(int p_length);
 	void _process_sync(int p_length);
 
+	virtual void _process_virtual(int p_length) override;
+
 protected:
 	static void _bind_methods();
 
@@ -124,6 +126,7 @@ public:
 
 	virtual void get_channel_params(const Ref<SiOPMChannelParams> &p_params) const override;
 	virtual void set_channel_params(const Ref<SiOPMChannelParams> &p_params, bool p_with_volume, bool p_with_modulation = true) override;
+	virtual void set_channel_program(const SiOPMVoiceProgram *p_program, bool p_with_volume, bool p_with_modulation = true) override;
 	void set_params_by_value(int p_ar, int p_dr, int p_sr, int p_rr, int p_sl, int p_tl, int p_ksr, int p_ksl, int p_mul, int p_dt1, int p_dt2, int p_ams, int p_phase, int p_fix_note);
 
 	virtual void set_wave_data(const Ref<SiOPMWaveBase> &p_wave_data) override;
@@ -14,6 +14,8 @@
 #include "chip/wave/siopm_wave_table.h"
 #include "sequencer/simml_ref_table.h"
 #include "sequencer/simml_voice.h"
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
 
 void SiOPMChannelKS::set_karplus_strong_params(int p_attack_rate, int p_decay_rate, int p_total_level, int p_fixed_pitch, int p_wave_shape, int p_tension) {
 	int wave_shape = p_wave_shape;
@@ -44,7 +46,7 @@ void SiOPMChannelKS::set_parameters(Vector<int> p_params) {
 
 			Ref<SiMMLVoice> voice = SiMMLRefTable::get_instance()->get_voice(_ks_seed_index);
 			if (voice.is_valid()) {
-				set_channel_params(voice->get_channel_params(), false);
+				set_channel_program(voice->get_program(), false);
 			}
 		} break;
 
@@ -98,6 +100,7 @@ void SiOPMChannelKS::set_fixed_pitch(int p_value) {
 void SiOPMChannelKS::offset_volume(int p_expression, int p_velocity) {
 	_expression = p_expression * 0.0078125;
 	SiOPMChannelFM::offset_volume(128, p_velocity);
+	_offset_gain *= _expression;
 }
 
 // LFO control.
@@ -174,10 +177,18 @@ void SiOPMChannelKS::_apply_karplus_strong(SinglyLinkedList<int>::Element *p_buf
 // This methods is, for the most part, a carbon copy of SiOPMChannelBase::buffer. Perhaps there is a way to
 // reduce code duplication here and make the differences pluggable.
 void SiOPMChannelKS::buffer(int p_length) {
+	SION_TRACE_SCOPE("SiOPMChannelKS::buffer");
+	SION_ALLOC_FREE_SCOPE("SiOPMChannelKS::buffer");
+
 	if (_is_idling) {
 		buffer_no_process(p_length);
 		return;
 	}
+	if (_update_virtual_state()) {
+		// The delay line is left as is, and continues ringing when the channel becomes audible again.
+		buffer_virtual(p_length);
+		return;
+	}
 
 	// Preserve the start of the output pipe.
 	SinglyLinkedList<int>::Element *mono_out = _out_pipe->get();
@@ -211,6 +222,10 @@ void SiOPMChannelKS::buffer(int p_length) {
 			SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
 			stream->write(mono_out, _buffer_index, p_length, _volumes[0] * _expression, _pan);
 		}
+
+		if (_tap_stream) {
+			_tap_stream->write(mono_out, _buffer_index, p_length, _expression, _pan);
+		}
 	}
 
 	_buffer_index += p_length;
@@ -12,6 +12,8 @@
 #include "chip/siopm_stream.h"
 #include "chip/wave/siopm_wave_pcm_data.h"
 #include "chip/wave/siopm_wave_pcm_table.h"
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
 
 void SiOPMChannelPCM::get_channel_params(const Ref<SiOPMChannelParams> &p_params) const {
 	p_params->set_operator_count(1);
@@ -213,6 +215,7 @@ void SiOPMChannelPCM::set_envelope_reset(bool p_reset) {
 void SiOPMChannelPCM::offset_volume(int p_expression, int p_velocity) {
 	int expression_index = p_expression << 1;
 	int offset = _expression_table[expression_index] + _velocity_table[p_velocity];
+	_offset_gain = _total_level_to_gain(offset);
 
 	_operator->offset_total_level(offset);
 }
@@ -347,7 +350,7 @@ void SiOPMChannelPCM::_process_operator_mono(int p_length, bool p_mix) {
 				}
 			}
 
-			int log_idx = ope0->get_wave_value(t);
+			int log_idx = ope0->get_pcm_wave_value(t);
 			log_idx += ope0->get_eg_output() + (_amplitude_modulation_output_level >> ope0->get_amplitude_modulation_shift());
 			output = _table->log_table[log_idx];
 		}
@@ -363,6 +366,35 @@ void SiOPMChannelPCM::_process_operator_mono(int p_length, bool p_mix) {
 	_out_pipe->set(out_pipe);
 }
 
+void SiOPMChannelPCM::_process_virtual(int p_length) {
+	SiOPMOperator *ope0 = _operator;
+
+	if (ope0->get_pcm_end_point() > 0) {
+		for (int i = 0; i < p_length; i++) {
+			_update_lfo();
+			ope0->tick_eg(_eg_timer_initial);
+			ope0->tick_pulse_generator();
+
+			int t = ope0->get_phase() >> SiOPMOperator::PCM_WAVE_FIXED_BITS;
+			if (t >= ope0->get_pcm_end_point()) {
+				if (ope0->get_pcm_loop_point() == -1) {
+					ope0->set_eg_state(SiOPMOperator::EG_OFF);
+					ope0->update_eg_output();
+					break;
+				} else {
+					int phase_diff = (ope0->get_pcm_end_point() - ope0->get_pcm_loop_point()) << SiOPMOperator::PCM_WAVE_FIXED_BITS;
+					ope0->adjust_phase(-phase_diff);
+				}
+			}
+		}
+	}
+
+	_no_process(p_length);
+	if (_filter_on) {
+		_advance_sv_filter(p_length);
+	}
+}
+
 void SiOPMChannelPCM::_process_operator_stereo(int p_length, bool p_mix) {
 	SinglyLinkedList<int>::Element *base_pipe = (p_mix ? _out_pipe : _sound_chip->get_zero_buffer())->get();
 	SinglyLinkedList<int>::Element *out_pipe  = _out_pipe->get();
@@ -427,7 +459,7 @@ void SiOPMChannelPCM::_process_operator_stereo(int p_length, bool p_mix) {
 			// Left output.
 			{
 				t <<= 1;
-				int log_idx = ope0->get_wave_value(t);
+				int log_idx = ope0->get_pcm_wave_value(t);
 				log_idx += ope0->get_eg_output() + (_amplitude_modulation_output_level >> ope0->get_amplitude_modulation_shift());
 				output_left = _table->log_table[log_idx];
 			}
@@ -435,7 +467,7 @@ void SiOPMChannelPCM::_process_operator_stereo(int p_length, bool p_mix) {
 			// Right output.
 			{
 				t++;
-				int log_idx = ope0->get_wave_value(t);
+				int log_idx = ope0->get_pcm_wave_value(t);
 				log_idx += ope0->get_eg_output() + (_amplitude_modulation_output_level >> ope0->get_amplitude_modulation_shift());
 				output_right = _table->log_table[log_idx];
 			}
@@ -474,6 +506,10 @@ void SiOPMChannelPCM::_write_stream_mono(SinglyLinkedList<int>::Element *p_outpu
 		SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
 		stream->write(p_output, _buffer_index, p_length, _volumes[0] * volume_coef, pan);
 	}
+
+	if (_tap_stream) {
+		_tap_stream->write(p_output, _buffer_index, p_length, volume_coef, pan);
+	}
 }
 
 void SiOPMChannelPCM::_write_stream_stereo(SinglyLinkedList<int>::Element *p_output_left, SinglyLinkedList<int>::Element *p_output_right, int p_length) {
@@ -493,6 +529,10 @@ void SiOPMChannelPCM::_write_stream_stereo(SinglyLinkedList<int>::Element *p_out
 		SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
 		stream->write_stereo(p_output_left, p_output_right, _buffer_index, p_length, _volumes[0] * volume_coef, pan);
 	}
+
+	if (_tap_stream) {
+		_tap_stream->write_stereo(p_output_left, p_output_right, _buffer_index, p_length, volume_coef, pan);
+	}
 }
 
 void SiOPMChannelPCM::note_on() {
@@ -516,10 +556,17 @@ void SiOPMChannelPCM::reset_channel_buffer_status() {
 }
 
 void SiOPMChannelPCM::buffer(int p_length) {
+	SION_TRACE_SCOPE("SiOPMChannelPCM::buffer");
+	SION_ALLOC_FREE_SCOPE("SiOPMChannelPCM::buffer");
+
 	if (_is_idling) {
 		buffer_no_process(p_length);
 		return;
 	}
+	if (_update_virtual_state()) {
+		buffer_virtual(p_length);
+		return;
+	}
 
 	if (_operator->get_pcm_channel_num() == 1) {
 		// Preserve the start of the output pipe.
@@ -581,6 +628,7 @@ void SiOPMChannelPCM::reset() {
 	_operator->reset();
 	_is_note_on = false;
 	_is_idling = true;
+	_is_virtual = false;
 }
 
 String SiOPMChannelPCM::_to_string() const {
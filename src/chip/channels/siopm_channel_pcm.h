@@ -49,6 +49,7 @@ class SiOPMChannelPCM : public SiOPMChannelBase {
 	void _update_lfo();
 	void _process_operator_mono(int p_length, bool p_mix);
 	void _process_operator_stereo(int p_length, bool p_mix);
+	virtual void _process_virtual(int p_length) override;
 
 	void _write_stream_mono(SinglyLinkedList<int>::Element *p_output, int p_length);
 	void _write_stream_stereo(SinglyLinkedList<int>::Element *p_output_left, SinglyLinkedList<int>::Element *p_output_right, int p_length);
@@ -6,13 +6,18 @@
 
 #include "siopm_channel_sampler.h"
 
+#include <cstring>
+#include <godot_cpp/core/math.hpp>
 #include "sion_enums.h"
 #include "chip/siopm_channel_params.h"
 #include "chip/siopm_sound_chip.h"
 #include "chip/siopm_stream.h"
 #include "chip/wave/siopm_wave_base.h"
 #include "chip/wave/siopm_wave_sampler_data.h"
+#include "chip/wave/siopm_wave_sampler_reader.h"
 #include "chip/wave/siopm_wave_sampler_table.h"
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
 
 void SiOPMChannelSampler::get_channel_params(const Ref<SiOPMChannelParams> &p_params) const {
 	for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
@@ -44,6 +49,12 @@ void SiOPMChannelSampler::set_channel_params(const Ref<SiOPMChannelParams> &p_pa
 }
 
 void SiOPMChannelSampler::set_wave_data(const Ref<SiOPMWaveBase> &p_wave_data) {
+	// A streamed note can't carry on with different data.
+	if (_sample_reader.is_valid() && _sample_reader->get_owner() != p_wave_data.ptr()) {
+		_release_sample_reader();
+		_is_idling = true;
+	}
+
 	_sampler_table = p_wave_data;
 	_sample_data = p_wave_data;
 }
@@ -53,10 +64,11 @@ void SiOPMChannelSampler::set_types(int p_pg_type, SiONPitchTableType p_pt_type)
 }
 
 int SiOPMChannelSampler::get_pitch() const {
-	return _wave_number << 6;
+	return _pitch_index;
 }
 
 void SiOPMChannelSampler::set_pitch(int p_value) {
+	_pitch_index = p_value;
 	_wave_number = p_value >> 6;
 }
 
@@ -68,6 +80,7 @@ void SiOPMChannelSampler::set_phase(int p_value) {
 
 void SiOPMChannelSampler::offset_volume(int p_expression, int p_velocity) {
 	_expression = p_expression * p_velocity * 0.00006103515625; // 1/16384
+	_offset_gain = _expression;
 }
 
 // Processing.
@@ -77,13 +90,35 @@ void SiOPMChannelSampler::note_on() {
 		return;
 	}
 
+	// The reader belongs to the previous sample, which may be let go of below.
+	_release_sample_reader();
+
 	if (_sampler_table.is_valid()) {
 		_sample_data = _sampler_table->get_sample(_wave_number & 127);
 	}
+	if (_sample_data.is_valid() && _sample_data->is_loading()) {
+		// Not decoded yet, nothing to play.
+		_is_idling = true;
+		_is_note_on = false;
+		return;
+	}
 	if (_sample_data.is_valid() && _sample_start_phase != 255) {
 		_sample_index = _sample_data->get_initial_sample_index(_sample_start_phase * 0.00390625); // 1/256
 		_sample_pan = CLAMP(_pan + _sample_data->get_pan(), 0, 128);
 	}
+	if (_sample_data.is_valid() && _sample_data->is_streamed()) {
+		_sample_reader = _sample_data->acquire_stream_reader();
+		if (_sample_reader.is_null()) {
+			// Every reader of this sample is playing already.
+			_is_idling = true;
+			_is_note_on = false;
+			return;
+		}
+		_sample_reader->start(_sample_index);
+	}
+	if (_sample_data.is_valid() && _sample_data->is_pitched()) {
+		_start_pitched();
+	}
 
 	_is_idling = (_sample_data == nullptr);
 	_is_note_on = !_is_idling;
@@ -95,18 +130,291 @@ void SiOPMChannelSampler::note_off() {
 	}
 
 	_is_note_on = false;
+	_stop_sample();
+}
+
+void SiOPMChannelSampler::_release_sample_reader() {
+	if (_sample_reader.is_null()) {
+		return;
+	}
+
+	_sample_reader->stop();
+	_sample_reader->get_owner()->release_stream_reader(_sample_reader);
+	_sample_reader = Ref<SiOPMWaveSamplerReader>();
+}
+
+void SiOPMChannelSampler::_stop_sample() {
 	_is_idling = true;
 
+	_release_sample_reader();
 	if (_sampler_table.is_valid()) {
 		_sample_data = Ref<SiOPMWaveSamplerData>();
 	}
 }
 
+void SiOPMChannelSampler::_process_virtual(int p_length) {
+	if (_sample_data->is_pitched()) {
+		_buffer_pitched(p_length, false);
+		return;
+	}
+	if (_sample_data->is_streamed()) {
+		// Keep the reader going, so the sample is in the right place when it becomes audible.
+		if (_sample_reader->read(nullptr, p_length) < p_length) {
+			_stop_sample();
+		}
+		return;
+	}
+
+	// Same as below, but without writing anything.
+	int residue = p_length;
+	while (residue > 0) {
+		int remaining = _sample_data->get_end_point() - _sample_index;
+		int processed = MIN(residue, remaining);
+
+		_sample_index += processed;
+		residue -= processed;
+
+		if (residue > 0) {
+			if (_sample_data->get_loop_point() >= 0) {
+				if (_sample_data->get_loop_point() > _sample_data->get_start_point()) {
+					_sample_index = _sample_data->get_loop_point();
+				} else {
+					_sample_index = _sample_data->get_start_point();
+				}
+			} else {
+				_stop_sample();
+				break;
+			}
+		}
+	}
+}
+
+template <typename T>
+void SiOPMChannelSampler::_write_to_streams(const T *p_data, int p_data_index, int p_length) {
+	if (_has_effect_send) {
+		for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+			if (_volumes[i] > 0) {
+				SiOPMStream *stream = _streams[i] ? _streams[i] : _sound_chip->get_stream_slot(i);
+				if (stream) {
+					double volume = _volumes[i] * _expression * _sound_chip->get_sampler_volume();
+					stream->write_from_samples(p_data, p_data_index, _buffer_index, p_length, volume, _sample_pan, _sample_data->get_channel_count());
+				}
+			}
+		}
+	} else {
+		SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
+
+		double volume = _volumes[0] * _expression * _sound_chip->get_sampler_volume();
+		stream->write_from_samples(p_data, p_data_index, _buffer_index, p_length, volume, _sample_pan, _sample_data->get_channel_count());
+	}
+
+	if (_tap_stream) {
+		double volume = _expression * _sound_chip->get_sampler_volume();
+		_tap_stream->write_from_samples(p_data, p_data_index, _buffer_index, p_length, volume, _sample_pan, _sample_data->get_channel_count());
+	}
+}
+
+void SiOPMChannelSampler::_buffer_streamed(int p_length) {
+	const int required_size = p_length * _sample_data->get_channel_count();
+	if (_stream_buffer.size() < required_size) {
+		// Buffer length has changed since the channel was created.
+		_stream_buffer.resize(required_size);
+	}
+
+	const int processed = _sample_reader->read(_stream_buffer.ptrw(), p_length);
+	if (processed > 0) {
+		_write_to_streams(_stream_buffer.ptr(), 0, processed);
+	}
+
+	// Looping is handled by the reader, so a short read means the sample has ended.
+	if (processed < p_length) {
+		_stop_sample();
+	}
+
+	_buffer_index += p_length;
+}
+
+// Pitched playback.
+
+void SiOPMChannelSampler::_start_pitched() {
+	const SiONSamplerQuality quality = _sample_data->get_resampling_quality();
+	const int latency = SiOPMWaveSamplerResampler::get_latency(quality);
+
+	// Enough for a full buffer at the highest rate, so nothing is allocated while playing.
+	const int capacity = (int)Math::ceil(_sound_chip->get_buffer_length() * SiOPMWaveSamplerResampler::MAX_RATE) + SiOPMWaveSamplerResampler::MAX_TAP_COUNT * 2;
+	for (int c = 0; c < 2; c++) {
+		if (_resample_source[c].size() < capacity) {
+			_resample_source[c].resize(capacity);
+		}
+
+		// The first frame of the sample is preceded by silence, so the kernel is centered on it.
+		memset(_resample_source[c].ptrw(), 0, sizeof(float) * latency);
+	}
+
+	_resample_source_count = latency;
+	_resample_position = 0;
+	_resample_source_ended = false;
+	_resample_source_end = 0;
+}
+
+void SiOPMChannelSampler::_pull_pitched_frames(int p_frames) {
+	const int channel_count = _sample_data->get_channel_count();
+	float *left = _resample_source[0].ptrw() + _resample_source_count;
+	float *right = (channel_count == 2 ? _resample_source[1].ptrw() + _resample_source_count : nullptr);
+
+	int offset = 0;
+	int residue = p_frames;
+
+	if (_sample_data->is_streamed()) {
+		// Higher rates need more frames than fit into the stream buffer, so they are read in chunks.
+		const int chunk_capacity = _stream_buffer.size() / channel_count;
+		while (residue > 0 && !_resample_source_ended) {
+			const int frames = MIN(residue, chunk_capacity);
+
+			// Looping is handled by the reader, so a short read means the sample has ended.
+			const int processed = _sample_reader->read(_stream_buffer.ptrw(), frames);
+			const double *stream_ptr = _stream_buffer.ptr();
+			for (int i = 0; i < processed; i++) {
+				if (right) {
+					left[offset + i] = (float)stream_ptr[i << 1];
+					right[offset + i] = (float)stream_ptr[(i << 1) + 1];
+				} else {
+					left[offset + i] = (float)stream_ptr[i];
+				}
+			}
+
+			offset += processed;
+			residue -= processed;
+			if (processed < frames) {
+				_resample_source_ended = true;
+				_resample_source_end = _resample_source_count + offset;
+			}
+		}
+	}
+
+	bool looped = false;
+	while (residue > 0 && !_resample_source_ended) {
+		const int remaining = _sample_data->get_end_point() - _sample_index;
+		const int processed = MIN(residue, remaining);
+		if (processed > 0) {
+			_sample_data->read_frames_planar(_sample_index, processed, left + offset, right ? right + offset : nullptr);
+
+			_sample_index += processed;
+			offset += processed;
+			residue -= processed;
+			looped = false;
+		}
+
+		// Same looping rules as for unpitched samples, see buffer(). A loop with nothing in it ends the sample.
+		if (residue > 0) {
+			if (_sample_data->get_loop_point() >= 0 && !looped) {
+				looped = true;
+				if (_sample_data->get_loop_point() > _sample_data->get_start_point()) {
+					_sample_index = _sample_data->get_loop_point();
+				} else {
+					_sample_index = _sample_data->get_start_point();
+				}
+			} else {
+				_resample_source_ended = true;
+				_resample_source_end = _resample_source_count + offset;
+			}
+		}
+	}
+
+	if (residue > 0) {
+		memset(left + offset, 0, sizeof(float) * residue);
+		if (right) {
+			memset(right + offset, 0, sizeof(float) * residue);
+		}
+	}
+
+	_resample_source_count += p_frames;
+}
+
+void SiOPMChannelSampler::_buffer_pitched(int p_length, bool p_write) {
+	const int channel_count = _sample_data->get_channel_count();
+	const SiONSamplerQuality quality = _sample_data->get_resampling_quality();
+	const int tap_count = SiOPMWaveSamplerResampler::get_tap_count(quality);
+
+	// Pitch is re-evaluated every buffer, so bends and portamento apply to playing notes.
+	const double semitones = (_pitch_index - (_sample_data->get_root_note() << 6)) / 64.0;
+	const double rate = CLAMP(Math::pow(2.0, semitones / 12.0), SiOPMWaveSamplerResampler::MIN_RATE, SiOPMWaveSamplerResampler::MAX_RATE);
+	const uint64_t step = (uint64_t)(rate * SiOPMWaveSamplerResampler::FRACTION_ONE);
+
+	// Make sure the kernel has everything it needs for the last frame of this buffer.
+	const int last_frame = (int)((_resample_position + step * (p_length - 1)) >> SiOPMWaveSamplerResampler::FRACTION_BITS);
+	const int required_count = last_frame + tap_count;
+	if (required_count > _resample_source_count) {
+		if (required_count > _resample_source[0].size()) {
+			// Buffer length has changed since the note has started.
+			_resample_source[0].resize(required_count);
+			_resample_source[1].resize(required_count);
+		}
+
+		_pull_pitched_frames(required_count - _resample_source_count);
+	}
+
+	if (p_write) {
+		const int required_size = p_length * channel_count;
+		if (_stream_buffer.size() < required_size) {
+			_stream_buffer.resize(required_size);
+		}
+
+		for (int c = 0; c < channel_count; c++) {
+			SiOPMWaveSamplerResampler::process(quality, _resample_source[c].ptr(), _resample_position, step, p_length, _stream_buffer.ptrw() + c, channel_count);
+		}
+		_write_to_streams(_stream_buffer.ptr(), 0, p_length);
+	}
+
+	// Drop frames which the kernel has moved past.
+	const uint64_t end_position = _resample_position + step * p_length;
+	const int consumed = MIN((int)(end_position >> SiOPMWaveSamplerResampler::FRACTION_BITS), _resample_source_count);
+	const int kept = _resample_source_count - consumed;
+	for (int c = 0; c < channel_count; c++) {
+		float *source_ptr = _resample_source[c].ptrw();
+		memmove(source_ptr, source_ptr + consumed, sizeof(float) * kept);
+	}
+
+	_resample_position = end_position - ((uint64_t)consumed << SiOPMWaveSamplerResampler::FRACTION_BITS);
+	_resample_source_count = kept;
+
+	if (_resample_source_ended) {
+		_resample_source_end -= consumed;
+
+		// Stop once the kernel only sees the padding.
+		if ((int64_t)(_resample_position >> SiOPMWaveSamplerResampler::FRACTION_BITS) >= _resample_source_end) {
+			_stop_sample();
+		}
+	}
+}
+
+//
+
 void SiOPMChannelSampler::buffer(int p_length) {
-	if (_is_idling || _sample_data == nullptr || _sample_data->get_length() <= 0 || _mute) {
+	SION_TRACE_SCOPE("SiOPMChannelSampler::buffer");
+	SION_ALLOC_FREE_SCOPE("SiOPMChannelSampler::buffer");
+
+	if (_is_idling || _sample_data == nullptr || _sample_data->get_length() <= 0) {
+		buffer_no_process(p_length);
+		return;
+	}
+	if (_update_virtual_state()) {
+		buffer_virtual(p_length);
+		return;
+	}
+	if (_mute) {
 		buffer_no_process(p_length);
 		return;
 	}
+	if (_sample_data->is_pitched()) {
+		_buffer_pitched(p_length, true);
+		_buffer_index += p_length;
+		return;
+	}
+	if (_sample_data->is_streamed()) {
+		_buffer_streamed(p_length);
+		return;
+	}
 
 	// Stream extracted data.
 	int residue = p_length;
@@ -114,23 +422,10 @@ void SiOPMChannelSampler::buffer(int p_length) {
 		int remaining = _sample_data->get_end_point() - _sample_index;
 		int processed = MIN(residue, remaining);
 
-		if (_has_effect_send) {
-			for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
-				if (_volumes[i] > 0) {
-					SiOPMStream *stream = _streams[i] ? _streams[i] : _sound_chip->get_stream_slot(i);
-					if (stream) {
-						double volume = _volumes[i] * _expression * _sound_chip->get_sampler_volume();
-						Vector<double> wave_data = _sample_data->get_wave_data();
-						stream->write_from_vector(&wave_data, _sample_index, _buffer_index, processed, volume, _sample_pan, _sample_data->get_channel_count());
-					}
-				}
-			}
+		if (_sample_data->get_format() == SAMPLE_FORMAT_INT16) {
+			_write_to_streams(_sample_data->get_int16_data_ptr(), _sample_index, processed);
 		} else {
-			SiOPMStream *stream = _streams[0] ? _streams[0] : _sound_chip->get_output_stream();
-
-			double volume = _volumes[0] * _expression * _sound_chip->get_sampler_volume();
-			Vector<double> wave_data = _sample_data->get_wave_data();
-			stream->write_from_vector(&wave_data, _sample_index, _buffer_index, processed, volume, _sample_pan, _sample_data->get_channel_count());
+			_write_to_streams(_sample_data->get_float_data_ptr(), _sample_index, processed);
 		}
 
 		_sample_index += processed;
@@ -145,10 +440,7 @@ void SiOPMChannelSampler::buffer(int p_length) {
 					_sample_index = _sample_data->get_start_point();
 				}
 			} else {
-				_is_idling = true;
-				if (_sampler_table.is_valid()) {
-					_sample_data = Ref<SiOPMWaveSamplerData>();
-				}
+				_stop_sample();
 				break;
 			}
 		}
@@ -171,11 +463,14 @@ void SiOPMChannelSampler::initialize(SiOPMChannelBase *p_prev, int p_buffer_inde
 void SiOPMChannelSampler::reset() {
 	_is_note_on = false;
 	_is_idling = true;
+	_is_virtual = false;
 
 	_bank_number = 0;
 	_wave_number = -1;
+	_pitch_index = 0;
 	_expression = 1;
 
+	_release_sample_reader();
 	_sampler_table = _table->sampler_tables[0];
 	_sample_data = Ref<SiOPMWaveSamplerData>();
 
@@ -194,5 +489,10 @@ String SiOPMChannelSampler::_to_string() const {
 }
 
 SiOPMChannelSampler::SiOPMChannelSampler(SiOPMSoundChip *p_chip) : SiOPMChannelBase(p_chip) {
-	// Empty.
+	// Streamed samples are read one buffer at a time, so nothing is allocated when they start playing.
+	_stream_buffer.resize(_sound_chip->get_buffer_length() * 2);
+}
+
+SiOPMChannelSampler::~SiOPMChannelSampler() {
+	_release_sample_reader();
 }
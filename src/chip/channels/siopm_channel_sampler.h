@@ -7,6 +7,7 @@
 #ifndef SIOPM_CHANNEL_SAMPLER_H
 #define SIOPM_CHANNEL_SAMPLER_H
 
+#include <cstdint>
 #include "chip/channels/siopm_channel_base.h"
 
 enum SiONPitchTableType : unsigned int;
@@ -14,6 +15,7 @@ class SiOPMChannelParams;
 class SiOPMSoundChip;
 class SiOPMWaveBase;
 class SiOPMWaveSamplerData;
+class SiOPMWaveSamplerReader;
 class SiOPMWaveSamplerTable;
 
 class SiOPMChannelSampler : public SiOPMChannelBase {
@@ -21,6 +23,8 @@ class SiOPMChannelSampler : public SiOPMChannelBase {
 
 	int _bank_number = 0;
 	int _wave_number = -1;
+	// Full pitch index, including the fine part. Used by pitched samples.
+	int _pitch_index = 0;
 	double _expression = 1;
 
 	Ref<SiOPMWaveSamplerTable> _sampler_table;
@@ -30,6 +34,31 @@ class SiOPMChannelSampler : public SiOPMChannelBase {
 	// Pan of the current note.
 	int _sample_pan = 0;
 
+	// Streamed samples are read through a reader, into a buffer of the same layout as in-memory samples.
+	// Readers are borrowed from the sample while a note is playing.
+	Ref<SiOPMWaveSamplerReader> _sample_reader;
+	Vector<double> _stream_buffer;
+
+	// Pitched samples are collected into planar source buffers, which are then resampled. The buffers
+	// keep enough frames in front of the playback position for the resampling kernel.
+	Vector<float> _resample_source[2];
+	int _resample_source_count = 0;
+	uint64_t _resample_position = 0;
+	// Once the sample ends, the buffers are padded with silence until the kernel passes the last frame.
+	bool _resample_source_ended = false;
+	int _resample_source_end = 0;
+
+	template <typename T>
+	void _write_to_streams(const T *p_data, int p_data_index, int p_length);
+	void _buffer_streamed(int p_length);
+	void _start_pitched();
+	void _pull_pitched_frames(int p_frames);
+	void _buffer_pitched(int p_length, bool p_write);
+	void _stop_sample();
+	void _release_sample_reader();
+
+	virtual void _process_virtual(int p_length) override;
+
 protected:
 	static void _bind_methods() {}
 
@@ -66,6 +95,7 @@ public:
 	virtual void reset() override;
 
 	SiOPMChannelSampler(SiOPMSoundChip *p_chip = nullptr);
+	~SiOPMChannelSampler();
 };
 
 #endif // SIOPM_CHANNEL_SAMPLER_H
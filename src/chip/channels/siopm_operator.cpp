@@ -175,7 +175,7 @@ void SiOPMOperator::_update_phase_step(int p_step) {
 	_phase_step = p_step;
 	_phase_step += _table->dt1_table[_detune1][_key_code];
 	_phase_step *= _fine_multiple;
-	_phase_step >>= (7 - _table->sample_rate_pitch_shift);  // 44kHz:1/128, 22kHz:1/256
+	_phase_step >>= 7; // Pitch tables are already scaled by the sampling rate.
 }
 
 void SiOPMOperator::set_pulse_generator_type(int p_type) {
@@ -199,6 +199,11 @@ int SiOPMOperator::get_wave_value(int p_index) const {
 	return _wave_table[p_index];
 }
 
+int SiOPMOperator::get_pcm_wave_value(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, _pcm_wavelet.size(), -1);
+	return _pcm_wavelet[p_index];
+}
+
 void SiOPMOperator::set_fixed_pitch_index(int p_value) {
 	if (p_value > 0) {
 		_pitch_index = p_value;
@@ -487,6 +492,61 @@ void SiOPMOperator::set_operator_params(const Ref<SiOPMOperatorParams> &p_params
 	_update_pitch();
 }
 
+void SiOPMOperator::set_operator_state(const SiOPMVoiceProgram::OperatorState &p_state) {
+	// Equivalent to set_operator_params(), but with every value already resolved
+	// by SiOPMVoiceProgram. Keep both in sync.
+
+	if (p_state.is_user_wave_table) {
+		set_pulse_generator_type(p_state.pg_type);
+		set_pitch_table_type(p_state.pt_type);
+	} else {
+		_pg_type = p_state.pg_type;
+		_pt_type = p_state.pt_type;
+		_wave_table = p_state.wave_table;
+		_wave_fixed_bits = p_state.wave_fixed_bits;
+		_wave_phase_step_shift = p_state.wave_phase_step_shift;
+		_pitch_table = p_state.pitch_table;
+		_pitch_table_filter = p_state.pitch_table_filter;
+	}
+
+	_key_on_phase = p_state.key_on_phase;
+
+	// The SSG attack switch depends on the previous SSG type, same as in set_operator_params().
+	set_attack_rate(p_state.attack_rate);
+	_decay_rate = p_state.decay_rate;
+	_sustain_rate = p_state.sustain_rate;
+	_release_rate = p_state.release_rate;
+
+	_key_scaling_rate = p_state.key_scaling_rate;
+	_key_scaling_level = p_state.key_scaling_level;
+	_eg_key_scale_level_rshift = p_state.eg_key_scale_level_rshift;
+	_amplitude_modulation_shift = p_state.amplitude_modulation_shift;
+
+	_fine_multiple = p_state.fine_multiple;
+	_fm_shift = p_state.fm_shift;
+	_detune1 = p_state.detune1;
+	_pitch_index_shift = p_state.pitch_index_shift;
+
+	_mute = p_state.mute;
+	_ssg_type = p_state.ssg_type;
+	_eg_state_table_index = p_state.eg_state_table_index;
+	_envelope_reset_on_attack = p_state.envelope_reset_on_attack;
+
+	_pitch_fixed = p_state.pitch_fixed;
+	if (_pitch_fixed) {
+		_pitch_index = p_state.pitch_index;
+		_key_code = p_state.key_code;
+	}
+	_eg_key_scale_rate = _key_code >> _key_scaling_rate;
+
+	_sustain_level = p_state.sustain_level;
+	_eg_sustain_level = p_state.eg_sustain_level;
+	_total_level = p_state.total_level;
+
+	_update_total_level();
+	_update_pitch();
+}
+
 void SiOPMOperator::get_operator_params(const Ref<SiOPMOperatorParams> &r_params) {
 	r_params->set_pulse_generator_type(_pg_type);
 	r_params->set_pitch_table_type(_pt_type);
@@ -525,7 +585,7 @@ void SiOPMOperator::set_pcm_data(const Ref<SiOPMWavePCMData> &p_pcm_data) {
 		_pg_type = SiONPulseGeneratorType::PULSE_USER_PCM;
 		_pt_type = SiONPitchTableType::PITCH_TABLE_PCM;
 
-		_wave_table = p_pcm_data->get_wavelet();
+		_pcm_wavelet = p_pcm_data->get_wavelet();
 		_wave_fixed_bits = PCM_WAVE_FIXED_BITS;
 
 		_pcm_channel_num = p_pcm_data->get_channel_count();
@@ -536,6 +596,7 @@ void SiOPMOperator::set_pcm_data(const Ref<SiOPMWavePCMData> &p_pcm_data) {
 		_key_on_phase = _pcm_start_point << PCM_WAVE_FIXED_BITS;
 	} else {
 		// Quick initialization for SiOPMChannelPCM.
+		_pcm_wavelet = Vector<int16_t>();
 		_pcm_end_point = _pcm_loop_point = 0;
 		_pcm_loop_point = -1;
 	}
@@ -10,6 +10,7 @@
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include "sion_enums.h"
+#include "chip/siopm_voice_program.h"
 #include "templates/singly_linked_list.h"
 
 using namespace godot;
@@ -90,6 +91,8 @@ private:
 	int _pg_type = SiONPulseGeneratorType::PULSE_SINE;
 	SiONPitchTableType _pt_type = SiONPitchTableType::PITCH_TABLE_OPM;
 	Vector<int> _wave_table;
+	// PCM data is kept in its compact form.
+	Vector<int16_t> _pcm_wavelet;
 	// Phase shift.
 	int _wave_fixed_bits = 0;
 	// Phase step shift.
@@ -238,6 +241,7 @@ public:
 	void set_pitch_table_type(SiONPitchTableType p_type);
 
 	int get_wave_value(int p_index) const;
+	int get_pcm_wave_value(int p_index) const;
 	int get_wave_fixed_bits() const { return _wave_fixed_bits; }
 
 	int get_phase() const { return _phase; }
@@ -309,6 +313,7 @@ public:
 
 	void set_operator_params(const Ref<SiOPMOperatorParams> &p_params);
 	void get_operator_params(const Ref<SiOPMOperatorParams> &r_params);
+	void set_operator_state(const SiOPMVoiceProgram::OperatorState &p_state);
 	void set_wave_table(const Ref<SiOPMWaveTable> &p_wave_table);
 	void set_pcm_data(const Ref<SiOPMWavePCMData> &p_pcm_data);
 
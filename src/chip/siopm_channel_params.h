@@ -22,6 +22,7 @@ class SiOPMChannelParams : public RefCounted {
 	GDCLASS(SiOPMChannelParams, RefCounted)
 
 	friend class TranslatorUtil;
+	friend class SiOPMVoiceProgram;
 
 public:
 	static const int MAX_OPERATORS = 4;
@@ -19,6 +19,7 @@ class SiOPMOperatorParams : public RefCounted {
 
 	friend class SiOPMChannelParams;
 	friend class TranslatorUtil;
+	friend class SiOPMVoiceProgram;
 
 public:
 	// Explanations sourced from https://mml-guide.readthedocs.io/pmd/ssgeg/.
@@ -12,25 +12,48 @@
 
 using namespace godot;
 
-SiOPMRefTable *SiOPMRefTable::_instance = nullptr;
+std::atomic<SiOPMRefTable *> SiOPMRefTable::_instance = { nullptr };
+std::mutex SiOPMRefTable::_instance_mutex;
+std::atomic<uint32_t> SiOPMRefTable::_generation_counter = { 0 };
 
 const double SiOPMRefTable::NOISE_WAVE_OUTPUT  = 1;
 const double SiOPMRefTable::SQUARE_WAVE_OUTPUT = 1;
 const double SiOPMRefTable::OUTPUT_MAX         = 0.5;
 
-void SiOPMRefTable::initialize() {
-	if (_instance) {
+SiOPMRefTable *SiOPMRefTable::_create_instance() {
+	std::lock_guard<std::mutex> lock(_instance_mutex);
+
+	// Another thread could've been faster.
+	SiOPMRefTable *instance = _instance.load(std::memory_order_acquire);
+	if (!instance) {
+		instance = memnew(SiOPMRefTable());
+		_instance.store(instance, std::memory_order_release);
+	}
+
+	return instance;
+}
+
+void SiOPMRefTable::initialize(int p_sampling_rate) {
+	std::lock_guard<std::mutex> lock(_instance_mutex);
+
+	SiOPMRefTable *instance = _instance.load(std::memory_order_acquire);
+	if (!instance) {
+		instance = memnew(SiOPMRefTable(p_sampling_rate));
+		_instance.store(instance, std::memory_order_release);
 		return;
 	}
 
-	// Sets the instance internally.
-	memnew(SiOPMRefTable());
+	if (instance->sampling_rate != p_sampling_rate) {
+		instance->_set_sampling_rate(p_sampling_rate);
+	}
 }
 
 void SiOPMRefTable::finalize() {
-	if (_instance) {
-		memdelete(_instance);
-		_instance = nullptr;
+	std::lock_guard<std::mutex> lock(_instance_mutex);
+
+	SiOPMRefTable *instance = _instance.exchange(nullptr, std::memory_order_acq_rel);
+	if (instance) {
+		memdelete(instance);
 	}
 }
 
@@ -83,11 +106,13 @@ void SiOPMRefTable::register_wave_table(int p_index, const Ref<SiOPMWaveTable> &
 	}
 }
 
-Ref<SiOPMWaveSamplerData> SiOPMRefTable::register_sampler_data(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count) {
+Ref<SiOPMWaveSamplerData> SiOPMRefTable::register_sampler_data(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count, int p_root_note, int p_key_range_to, SiONSamplerQuality p_quality) {
 	Ref<SiOPMWaveSamplerData> sampler_data = memnew(SiOPMWaveSamplerData(p_data, p_ignore_note_off, p_pan, p_src_channel_count, p_channel_count));
+	sampler_data->set_root_note(p_root_note);
+	sampler_data->set_resampling_quality(p_quality);
 
 	int bank = (p_index >> NOTE_BITS) & (SAMPLER_TABLE_MAX - 1);
-	sampler_tables[bank]->set_sample(sampler_data, p_index & (SAMPLER_DATA_MAX - 1));
+	sampler_tables[bank]->set_sample(sampler_data, p_index & (SAMPLER_DATA_MAX - 1), p_key_range_to);
 
 	return sampler_data;
 }
@@ -164,15 +189,26 @@ void SiOPMRefTable::clear_sampler_table_stencil(int p_index) {
 //
 
 void SiOPMRefTable::_set_constants(int p_fm_clock, double p_psg_clock, int p_sampling_rate) {
-	ERR_FAIL_COND_MSG((p_sampling_rate != 44100 && p_sampling_rate != 22050), vformat("SiOPMRefTable: Invalid sampling rate '%d', only 44100 and 22050 are allowed.", p_sampling_rate));
+	ERR_FAIL_COND_MSG((p_sampling_rate < MIN_SAMPLING_RATE || p_sampling_rate > MAX_SAMPLING_RATE), vformat("SiOPMRefTable: Invalid sampling rate '%d', must be between %d and %d.", p_sampling_rate, MIN_SAMPLING_RATE, MAX_SAMPLING_RATE));
 
 	fm_clock = p_fm_clock;
 	psg_clock = p_psg_clock;
 	sampling_rate  = p_sampling_rate;
-	sample_rate_pitch_shift = (sampling_rate == 44100 ? 0 : 1);
 	clock_ratio = ((fm_clock / 64) << CLOCK_RATIO_BITS) / sampling_rate;
 }
 
+void SiOPMRefTable::_set_sampling_rate(int p_sampling_rate) {
+	_set_constants(fm_clock, psg_clock, p_sampling_rate);
+
+	// Wave samples don't depend on the rate, and custom tables and voices must survive.
+	_create_eg_tables();
+	_create_pg_tables();
+	_create_lfo_tables();
+	_create_filter_tables();
+
+	_generation = _generation_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 void SiOPMRefTable::_create_eg_tables() {
 	// Table selector & timer steps for rates.
 	{
@@ -1246,22 +1282,21 @@ void SiOPMRefTable::_create_filter_tables() {
 	filter_cutoff_table[128] = 1;
 	filter_feedback_table[128] = filter_cutoff_table[128]; // Original code assigns the value to itself here. Probably meant this instead.
 
+	const double eg_rate_coef = 3.0 / ((fm_clock / 64.0) / sampling_rate); // = 2.36514@44.1kHz
+
 	filter_eg_rate[0] = 0;
 	for (int i = 1; i < 60; i++) {
 		double shift = (double)(1 << (14 - (i >> 2)));
 		double liner = (double)((i & 3) * 0.125 + 0.5);
-		filter_eg_rate[i] = (int)(2.36514 * shift * liner + 0.5); // 2.36514 = 3 / ((fm_clock/64)/sampling_rate)
+		filter_eg_rate[i] = (int)(eg_rate_coef * shift * liner + 0.5);
 	}
 	for (int i = 60; i < 64; i++) {
 		filter_eg_rate[i] = 1;
 	}
 }
 
-SiOPMRefTable::SiOPMRefTable(int p_fm_clock, double p_psg_clock, int p_sampling_rate) {
-	if (!_instance) {
-		_instance = this; // Do this early so it can be self-referenced.
-	}
-
+SiOPMRefTable::SiOPMRefTable(int p_sampling_rate, int p_fm_clock, double p_psg_clock) {
+	// The instance is only published once it's complete, so nothing here may call get_instance().
 	_set_constants(p_fm_clock, p_psg_clock, p_sampling_rate);
 
 	_create_eg_tables();
@@ -1269,6 +1304,8 @@ SiOPMRefTable::SiOPMRefTable(int p_fm_clock, double p_psg_clock, int p_sampling_
 	_create_wave_samples();
 	_create_lfo_tables();
 	_create_filter_tables();
+
+	_generation = _generation_counter.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
 SiOPMRefTable::~SiOPMRefTable() {
@@ -7,6 +7,8 @@
 #ifndef SIOPM_REF_TABLE_H
 #define SIOPM_REF_TABLE_H
 
+#include <atomic>
+#include <mutex>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/vector.hpp>
@@ -23,7 +25,17 @@ using namespace godot;
 // Reference data object for the processor and related operations.
 class SiOPMRefTable {
 
-	static SiOPMRefTable *_instance;
+	// Tables are generated on first use rather than when the extension is loaded, so the editor
+	// and projects which never start the synthesizer don't pay for them.
+	static std::atomic<SiOPMRefTable *> _instance;
+	static std::mutex _instance_mutex;
+
+	static SiOPMRefTable *_create_instance();
+
+	// Shared between instances, so tables regenerated after finalize() never reuse a generation.
+	static std::atomic<uint32_t> _generation_counter;
+	// Changes whenever the rate-dependent tables are regenerated.
+	uint32_t _generation = 0;
 
 	// Wave samples.
 
@@ -39,6 +51,8 @@ class SiOPMRefTable {
 	//
 
 	void _set_constants(int p_fm_clock, double p_psg_clock, int p_sampling_rate);
+	// Regenerates the tables which depend on the sampling rate.
+	void _set_sampling_rate(int p_sampling_rate);
 
 	void _create_eg_tables();
 	void _create_pg_tables();
@@ -48,14 +62,26 @@ class SiOPMRefTable {
 	void _create_filter_tables();
 
 public:
-	static SiOPMRefTable *get_instance() { return _instance; }
-	static void initialize();
+	static SiOPMRefTable *get_instance() {
+		SiOPMRefTable *instance = _instance.load(std::memory_order_acquire);
+		return (instance ? instance : _create_instance());
+	}
+	// Generates the tables ahead of time, e.g. to avoid doing it on the audio thread. If the tables
+	// already exist for a different sampling rate, the rate-dependent ones are regenerated.
+	static void initialize(int p_sampling_rate = DEFAULT_SAMPLING_RATE);
 	static void finalize();
 
 	static int calculate_log_table_index(double p_number);
 
+	// Anything derived from the tables, e.g. compiled voice programs, is stale once this changes.
+	uint32_t get_generation() const { return _generation; }
+
 	//
 
+	static const int DEFAULT_SAMPLING_RATE = 44100;
+	static const int MIN_SAMPLING_RATE     = 8000;
+	static const int MAX_SAMPLING_RATE     = 192000;
+
 	static const int ENV_BITS             = 10;   // Envelope output bit size.
 	static const int ENV_TIMER_BITS       = 24;   // Envelope timer resolution bit size.
 	static const int SAMPLING_TABLE_BITS  = 10;   // Sine wave table entries = 2 ^ SAMPLING_TABLE_BITS = 1024
@@ -130,8 +156,6 @@ public:
 	double psg_clock = 0;
 	// (fm_clock/64/sampling_rate) << CLOCK_RATIO_BITS
 	int clock_ratio = 1;
-	// 44100Hz=0, 22050Hz=1
-	int sample_rate_pitch_shift = 0;
 
 	// int->double ratio on pulse data
 	double i2n = OUTPUT_MAX/(double)(1 << LOG_VOLUME_BITS);
@@ -264,7 +288,7 @@ public:
 
 	void reset_all_user_tables();
 	void register_wave_table(int p_index, const Ref<SiOPMWaveTable> &p_table);
-	Ref<SiOPMWaveSamplerData> register_sampler_data(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count);
+	Ref<SiOPMWaveSamplerData> register_sampler_data(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count, int p_root_note = -1, int p_key_range_to = -1, SiONSamplerQuality p_quality = SAMPLER_QUALITY_MEDIUM);
 
 	Ref<SiOPMWaveTable> get_wave_table(int p_index);
 	Ref<SiOPMWavePCMTable> get_pcm_data(int p_index);
@@ -283,7 +307,7 @@ public:
 	//
 
 	// TODO: Define parameters as constants?
-	SiOPMRefTable(int p_fm_clock = 3580000, double p_psg_clock = 1789772.5, int p_sampling_rate = 44100);
+	SiOPMRefTable(int p_sampling_rate = DEFAULT_SAMPLING_RATE, int p_fm_clock = 3580000, double p_psg_clock = 1789772.5);
 	~SiOPMRefTable();
 };
 
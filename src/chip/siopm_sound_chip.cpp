@@ -19,6 +19,23 @@ int SiOPMSoundChip::get_channel_count() const {
 	return output_stream->get_channel_count();
 }
 
+int SiOPMSoundChip::add_output_bus() {
+	SiOPMStream *bus = memnew(SiOPMStream);
+	bus->resize(_buffer_length << 1);
+	_output_buses.push_back(bus);
+
+	return _output_buses.size();
+}
+
+SiOPMStream *SiOPMSoundChip::get_output_bus(int p_bus) const {
+	if (p_bus == 0) {
+		return output_stream;
+	}
+
+	ERR_FAIL_INDEX_V(p_bus - 1, _output_buses.size(), nullptr);
+	return _output_buses[p_bus - 1];
+}
+
 SinglyLinkedList<int> *SiOPMSoundChip::get_pipe(int p_pipe_num, int p_index) {
 	ERR_FAIL_INDEX_V(p_pipe_num, _pipe_buffers.size(), nullptr);
 
@@ -32,6 +49,9 @@ SinglyLinkedList<int> *SiOPMSoundChip::get_pipe(int p_pipe_num, int p_index) {
 
 void SiOPMSoundChip::begin_process() {
 	output_stream->clear();
+	for (SiOPMStream *bus : _output_buses) {
+		bus->clear();
+	}
 }
 
 void SiOPMSoundChip::end_process() {
@@ -40,6 +60,13 @@ void SiOPMSoundChip::end_process() {
 	if (_bitrate != 0) {
 		output_stream->quantize(_bitrate);
 	}
+
+	for (SiOPMStream *bus : _output_buses) {
+		bus->limit();
+		if (_bitrate != 0) {
+			bus->quantize(_bitrate);
+		}
+	}
 }
 
 //
@@ -57,6 +84,9 @@ void SiOPMSoundChip::initialize(int p_channel_count, int p_bitrate, int p_buffer
 	if (_buffer_length != p_buffer_length) {
 		_buffer_length = p_buffer_length;
 		output_stream->resize(_buffer_length << 1);
+		for (SiOPMStream *bus : _output_buses) {
+			bus->resize(_buffer_length << 1);
+		}
 
 		for (int i = 0; i < PIPE_SIZE; i++) {
 			if (_pipe_buffers[i]) {
@@ -97,6 +127,9 @@ SiOPMSoundChip::SiOPMSoundChip() {
 
 SiOPMSoundChip::~SiOPMSoundChip() {
 	memdelete(output_stream);
+	for (SiOPMStream *bus : _output_buses) {
+		memdelete(bus);
+	}
 
 	memdelete(zero_buffer);
 	for (int i = 0; i < PIPE_SIZE; i++) {
@@ -24,6 +24,8 @@ class SiOPMSoundChip : public Object {
 	SinglyLinkedList<int> *zero_buffer = nullptr;
 
 	SiOPMStream *output_stream = nullptr;
+	// Additional outputs rendered alongside the main one. Not affected by effects.
+	Vector<SiOPMStream *> _output_buses;
 	// Expected to be of STREAM_SEND_SIZE size.
 	Vector<SiOPMStream *> stream_slot;
 	double pcm_volume = 4;
@@ -32,6 +34,9 @@ class SiOPMSoundChip : public Object {
 	int _buffer_length = 0;
 	int _bitrate = 0;
 
+	// Channels with an effective gain below this value are virtualized. Zero disables virtualization.
+	double _virtual_voice_threshold = 0;
+
 	// Expected to be of PIPE_SIZE size.
 	Vector<SinglyLinkedList<int> *> _pipe_buffers;
 
@@ -49,6 +54,11 @@ public:
 	Vector<double> *get_output_buffer_ptr();
 	int get_channel_count() const;
 
+	// Bus 0 is the main output stream.
+	int add_output_bus();
+	SiOPMStream *get_output_bus(int p_bus) const;
+	int get_output_bus_count() const { return _output_buses.size() + 1; }
+
 	SiOPMStream *get_stream_slot(int p_slot) const { return stream_slot[p_slot]; }
 	void set_stream_slot(int p_slot, SiOPMStream *p_value) { stream_slot.write[p_slot] = p_value; }
 
@@ -58,6 +68,9 @@ public:
 	int get_buffer_length() const { return _buffer_length; }
 	int get_bitrate() const { return _bitrate; }
 
+	double get_virtual_voice_threshold() const { return _virtual_voice_threshold; }
+	void set_virtual_voice_threshold(double p_threshold) { _virtual_voice_threshold = p_threshold; }
+
 	SinglyLinkedList<int> *get_pipe(int p_pipe_num, int p_index = 0);
 
 	void begin_process();
@@ -104,8 +104,16 @@ void SiOPMStream::write_stereo(SinglyLinkedList<int>::Element *p_left_start, Sin
 	}
 }
 
-void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count) {
-	double volume = p_volume;
+// Compact sample data is mixed as is, without expanding it to doubles first.
+
+static inline double _get_sample_scale(const double *) { return 1.0; }
+static inline double _get_sample_scale(const float *) { return 1.0; }
+static inline double _get_sample_scale(const int16_t *) { return 1.0 / 32767.0; } // Max int16.
+
+template <typename T>
+void SiOPMStream::write_from_samples(const T *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count) {
+	double volume = p_volume * _get_sample_scale(p_data);
+	double *buffer_ptr = buffer.ptrw();
 
 	if (channels == 2) {
 		double (&pan_table)[129] = SiOPMRefTable::get_instance()->pan_table;
@@ -116,10 +124,10 @@ void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, in
 			int buffer_size = (p_start_data + p_length) << 1;
 
 			for (int j = p_start_data << 1, i = p_start_buffer << 1; j < buffer_size;) {
-				buffer.write[i] += (*p_data)[j] * volume_left;
+				buffer_ptr[i] += p_data[j] * volume_left;
 				j++;
 				i++;
-				buffer.write[i] += (*p_data)[j] * volume_right;
+				buffer_ptr[i] += p_data[j] * volume_right;
 				j++;
 				i++;
 			}
@@ -129,9 +137,9 @@ void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, in
 			int buffer_size = p_start_data + p_length;
 
 			for (int j = p_start_data, i = p_start_buffer << 1; j < buffer_size; j++) {
-				buffer.write[i] += (*p_data)[j] * volume_left;
+				buffer_ptr[i] += p_data[j] * volume_left;
 				i++;
-				buffer.write[i] += (*p_data)[j] * volume_right;
+				buffer_ptr[i] += p_data[j] * volume_right;
 				i++;
 			}
 		}
@@ -141,9 +149,10 @@ void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, in
 			int buffer_size = (p_start_data + p_length) << 1;
 
 			for (int j = p_start_data << 1, i = p_start_buffer << 1; j < buffer_size;) {
-				buffer.write[i] += ((*p_data)[j] + (*p_data)[j + 1]) * volume;
+				double value = ((double)p_data[j] + p_data[j + 1]) * volume;
+				buffer_ptr[i] += value;
 				i++;
-				buffer.write[i] += ((*p_data)[j] + (*p_data)[j + 1]) * volume;
+				buffer_ptr[i] += value;
 				i++;
 				j += 2;
 			}
@@ -151,11 +160,19 @@ void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, in
 			int buffer_size = p_start_data + p_length;
 
 			for (int j = p_start_data, i = p_start_buffer << 1; j < buffer_size; j++) {
-				buffer.write[i] += (*p_data)[j] * volume;
+				buffer_ptr[i] += p_data[j] * volume;
 				i++;
-				buffer.write[i] += (*p_data)[j] * volume;
+				buffer_ptr[i] += p_data[j] * volume;
 				i++;
 			}
 		}
 	}
 }
+
+template void SiOPMStream::write_from_samples<double>(const double *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count);
+template void SiOPMStream::write_from_samples<float>(const float *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count);
+template void SiOPMStream::write_from_samples<int16_t>(const int16_t *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count);
+
+void SiOPMStream::write_from_vector(Vector<double> *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count) {
+	write_from_samples(p_data->ptr(), p_start_data, p_start_buffer, p_length, p_volume, p_pan, p_sample_channel_count);
+}
@@ -7,6 +7,7 @@
 #ifndef SIOPM_STREAM_H
 #define SIOPM_STREAM_H
 
+#include <cstdint>
 #include <godot_cpp/templates/vector.hpp>
 #include "templates/singly_linked_list.h"
 
@@ -32,6 +33,9 @@ public:
 
 	void write(SinglyLinkedList<int>::Element *p_data_start, int p_offset, int p_length, double p_volume, int p_pan);
 	void write_stereo(SinglyLinkedList<int>::Element *p_left_start, SinglyLinkedList<int>::Element *p_right_start, int p_offset, int p_length, double p_volume, int p_pan);
+	// Supports double, float, and int16_t samples. Integer samples are scaled down to the [-1, 1] range.
+	template <typename T>
+	void write_from_samples(const T *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count);
 	void write_from_vector(Vector<double> *p_data, int p_start_data, int p_start_buffer, int p_length, double p_volume, int p_pan, int p_sample_channel_count);
 
 	SiOPMStream() {}
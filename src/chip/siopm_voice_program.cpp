@@ -0,0 +1,235 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "siopm_voice_program.h"
+
+#include <cstring>
+#include "chip/siopm_operator_params.h"
+#include "chip/siopm_ref_table.h"
+#include "chip/wave/siopm_wave_table.h"
+
+bool SiOPMVoiceProgram::is_user_wave_table(int p_pg_type) {
+	if (p_pg_type >= SiONPulseGeneratorType::PULSE_CUSTOM) {
+		return true;
+	}
+
+	// User defined MA-3 waves, see SiOPMRefTable::register_wave_table().
+	const int ma3_index = p_pg_type - SiONPulseGeneratorType::PULSE_MA3_SINE;
+	return ma3_index == 15 || ma3_index == 23 || ma3_index == 31;
+}
+
+int SiOPMVoiceProgram::_make_key(const Ref<SiOPMChannelParams> &p_params, int (&r_key)[KEY_SIZE]) const {
+	int index = 0;
+
+	r_key[index++] = p_params->operator_count;
+	r_key[index++] = p_params->analog_like ? 1 : 0;
+	r_key[index++] = p_params->algorithm;
+	r_key[index++] = p_params->feedback;
+	r_key[index++] = p_params->feedback_connection;
+	r_key[index++] = p_params->envelope_frequency_ratio;
+	r_key[index++] = p_params->lfo_wave_shape;
+	r_key[index++] = p_params->lfo_frequency_step;
+	r_key[index++] = p_params->amplitude_modulation_depth;
+	r_key[index++] = p_params->pitch_modulation_depth;
+	r_key[index++] = p_params->pan;
+	r_key[index++] = p_params->filter_type;
+	r_key[index++] = p_params->filter_cutoff;
+	r_key[index++] = p_params->filter_resonance;
+	r_key[index++] = p_params->filter_attack_rate;
+	r_key[index++] = p_params->filter_decay_rate1;
+	r_key[index++] = p_params->filter_decay_rate2;
+	r_key[index++] = p_params->filter_release_rate;
+	r_key[index++] = p_params->filter_decay_offset1;
+	r_key[index++] = p_params->filter_decay_offset2;
+	r_key[index++] = p_params->filter_sustain_offset;
+	r_key[index++] = p_params->filter_release_offset;
+
+	int i = 0;
+	for (const Ref<SiOPMOperatorParams> &op_params : p_params->operator_params) {
+		if (i >= p_params->operator_count) {
+			break;
+		}
+
+		r_key[index++] = op_params->pulse_generator_type;
+		r_key[index++] = op_params->pitch_table_type;
+		r_key[index++] = op_params->attack_rate;
+		r_key[index++] = op_params->decay_rate;
+		r_key[index++] = op_params->sustain_rate;
+		r_key[index++] = op_params->release_rate;
+		r_key[index++] = op_params->sustain_level;
+		r_key[index++] = op_params->total_level;
+		r_key[index++] = op_params->key_scaling_rate;
+		r_key[index++] = op_params->key_scaling_level;
+		r_key[index++] = op_params->fine_multiple;
+		r_key[index++] = op_params->detune1;
+		r_key[index++] = op_params->detune2;
+		r_key[index++] = op_params->amplitude_modulation_shift;
+		r_key[index++] = op_params->initial_phase;
+		r_key[index++] = op_params->fixed_pitch;
+		r_key[index++] = op_params->mute ? 1 : 0;
+		r_key[index++] = op_params->ssg_envelope_control;
+		r_key[index++] = op_params->frequency_modulation_level;
+		r_key[index++] = op_params->envelope_reset_on_attack ? 1 : 0;
+		i++;
+	}
+
+	return index;
+}
+
+void SiOPMVoiceProgram::_compile(const Ref<SiOPMChannelParams> &p_params) {
+	SiOPMRefTable *table = SiOPMRefTable::get_instance();
+
+	_params = p_params;
+
+	_operator_count = p_params->operator_count;
+	_analog_like = p_params->analog_like;
+	_algorithm = p_params->algorithm;
+	_feedback = p_params->feedback;
+	_feedback_connection = p_params->feedback_connection;
+	_frequency_ratio = p_params->envelope_frequency_ratio;
+
+	_lfo_wave_shape = p_params->lfo_wave_shape;
+	_lfo_frequency_step = p_params->lfo_frequency_step;
+	_amplitude_modulation_depth = p_params->amplitude_modulation_depth;
+	_pitch_modulation_depth = p_params->pitch_modulation_depth;
+
+	_has_effect_send = false;
+	for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+		_volumes[i] = p_params->master_volumes[i];
+		if (i > 0 && _volumes[i] > 0) {
+			_has_effect_send = true;
+		}
+	}
+	_pan = p_params->pan;
+
+	_filter_type = p_params->filter_type;
+	_filter_params[0] = p_params->filter_cutoff;
+	_filter_params[1] = p_params->filter_resonance;
+	_filter_params[2] = p_params->filter_attack_rate;
+	_filter_params[3] = p_params->filter_decay_rate1;
+	_filter_params[4] = p_params->filter_decay_rate2;
+	_filter_params[5] = p_params->filter_release_rate;
+	_filter_params[6] = p_params->filter_decay_offset1;
+	_filter_params[7] = p_params->filter_decay_offset2;
+	_filter_params[8] = p_params->filter_sustain_offset;
+	_filter_params[9] = p_params->filter_release_offset;
+
+	// Mirrors SiOPMOperator::set_operator_params() and the setters it calls.
+
+	int i = 0;
+	for (const Ref<SiOPMOperatorParams> &op_params : p_params->operator_params) {
+		if (i >= _operator_count) {
+			break;
+		}
+		OperatorState &state = _operators[i];
+
+		state.pg_type = op_params->pulse_generator_type & SiOPMRefTable::PG_FILTER;
+		state.pt_type = op_params->pitch_table_type;
+		state.is_user_wave_table = is_user_wave_table(state.pg_type);
+
+		Ref<SiOPMWaveTable> wave_table = table->get_wave_table(state.pg_type);
+		state.wave_table = wave_table->get_wavelet();
+		state.wave_fixed_bits = wave_table->get_fixed_bits();
+		state.wave_phase_step_shift = (SiOPMRefTable::PHASE_BITS - state.wave_fixed_bits) & table->phase_step_shift_filter[state.pt_type];
+		state.pitch_table = table->pitch_table[state.pt_type];
+		state.pitch_table_filter = state.pitch_table.size() - 1;
+
+		const int initial_phase = op_params->initial_phase;
+		if (initial_phase == 255) {
+			state.key_on_phase = -2;
+		} else if (initial_phase == -1) {
+			state.key_on_phase = -1;
+		} else {
+			state.key_on_phase = (initial_phase & 255) << (SiOPMRefTable::PHASE_BITS - 8);
+		}
+
+		state.attack_rate = op_params->attack_rate & 63;
+		state.decay_rate = op_params->decay_rate & 63;
+		state.sustain_rate = op_params->sustain_rate & 63;
+		state.release_rate = op_params->release_rate & 63;
+		state.sustain_level = op_params->sustain_level & 15;
+		state.eg_sustain_level = table->eg_sustain_level_table[state.sustain_level];
+		state.total_level = CLAMP(op_params->total_level, 0, 127);
+
+		state.key_scaling_rate = 5 - (op_params->key_scaling_rate & 3);
+		state.key_scaling_level = op_params->key_scaling_level & 3;
+		state.eg_key_scale_level_rshift = (state.key_scaling_level == 0) ? 8 : (5 - state.key_scaling_level);
+
+		const int ams = op_params->amplitude_modulation_shift;
+		state.amplitude_modulation_shift = (ams != 0) ? (3 - ams) : 16;
+		state.fine_multiple = op_params->fine_multiple;
+		state.fm_shift = (op_params->frequency_modulation_level & 7) + 10;
+		state.detune1 = op_params->detune1 & 7;
+		state.pitch_index_shift = op_params->detune2;
+
+		state.mute = op_params->mute ? SiOPMRefTable::ENV_BOTTOM : 0;
+		if (op_params->ssg_envelope_control >= SiOPMOperatorParams::SSG_REPEAT_TO_ZERO) {
+			state.eg_state_table_index = 1;
+			state.ssg_type = op_params->ssg_envelope_control;
+			if (state.ssg_type >= SiOPMOperatorParams::SSG_MAX) {
+				state.ssg_type = SiOPMOperatorParams::SSG_IGNORE;
+			}
+		} else {
+			state.eg_state_table_index = 0;
+			state.ssg_type = SiOPMOperatorParams::SSG_DISABLED;
+		}
+		state.envelope_reset_on_attack = op_params->envelope_reset_on_attack;
+
+		state.pitch_fixed = op_params->fixed_pitch > 0;
+		if (state.pitch_fixed) {
+			state.pitch_index = op_params->fixed_pitch;
+			state.key_code = table->note_number_to_key_code[(state.pitch_index >> 6) & 127];
+		} else {
+			state.pitch_index = 0;
+			state.key_code = 0;
+		}
+
+		i++;
+	}
+
+	_compiled = true;
+}
+
+bool SiOPMVoiceProgram::update(const Ref<SiOPMChannelParams> &p_params) {
+	ERR_FAIL_COND_V(p_params.is_null(), false);
+
+	int key[KEY_SIZE];
+	const int key_size = _make_key(p_params, key);
+
+	const uint32_t table_generation = SiOPMRefTable::get_instance()->get_generation();
+
+	bool changed = !_compiled || _params != p_params || key_size != _key_size || table_generation != _table_generation;
+	if (!changed) {
+		changed = memcmp(key, _key, sizeof(int) * key_size) != 0;
+	}
+	if (!changed) {
+		for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+			if (_key_volumes[i] != p_params->master_volumes[i]) {
+				changed = true;
+				break;
+			}
+		}
+	}
+
+	if (!changed) {
+		return false;
+	}
+
+	memcpy(_key, key, sizeof(int) * key_size);
+	_key_size = key_size;
+	_table_generation = table_generation;
+	for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+		_key_volumes[i] = p_params->master_volumes[i];
+	}
+
+	_compile(p_params);
+	return true;
+}
+
+void SiOPMVoiceProgram::invalidate() {
+	_compiled = false;
+	_params = Ref<SiOPMChannelParams>();
+}
@@ -0,0 +1,137 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SIOPM_VOICE_PROGRAM_H
+#define SIOPM_VOICE_PROGRAM_H
+
+#include <godot_cpp/templates/vector.hpp>
+#include "sion_enums.h"
+#include "chip/siopm_channel_params.h"
+#include "chip/siopm_sound_chip.h"
+
+using namespace godot;
+
+// Channel params compiled into flat register state, ready to be copied into a channel.
+// Rebuilt lazily whenever the source params are found to differ from the compiled snapshot.
+class SiOPMVoiceProgram {
+public:
+	// Operator registers, already resolved against SiOPMRefTable.
+	struct OperatorState {
+		int pg_type = SiONPulseGeneratorType::PULSE_SINE;
+		SiONPitchTableType pt_type = SiONPitchTableType::PITCH_TABLE_OPM;
+		// User wave tables can be replaced at any moment, so they are resolved when applied.
+		bool is_user_wave_table = false;
+		Vector<int> wave_table;
+		int wave_fixed_bits = 0;
+		int wave_phase_step_shift = 0;
+		Vector<int> pitch_table;
+		int pitch_table_filter = 0;
+		int key_on_phase = 0;
+
+		int attack_rate = 0;
+		int decay_rate = 0;
+		int sustain_rate = 0;
+		int release_rate = 0;
+		int sustain_level = 0;
+		int eg_sustain_level = 0;
+		int total_level = 0;
+
+		// Internal values, 5-ks.
+		int key_scaling_rate = 5;
+		int key_scaling_level = 0;
+		int eg_key_scale_level_rshift = 8;
+
+		int amplitude_modulation_shift = 16;
+		int fine_multiple = 0;
+		int fm_shift = 0;
+		int detune1 = 0;
+		int pitch_index_shift = 0;
+
+		int mute = 0;
+		int ssg_type = 0;
+		int eg_state_table_index = 0;
+		bool envelope_reset_on_attack = false;
+
+		bool pitch_fixed = false;
+		int pitch_index = 0;
+		int key_code = 0;
+	};
+
+private:
+	static const int CHANNEL_KEY_SIZE = 22;
+	static const int OPERATOR_KEY_SIZE = 20;
+	static const int KEY_SIZE = CHANNEL_KEY_SIZE + OPERATOR_KEY_SIZE * SiOPMChannelParams::MAX_OPERATORS;
+
+	bool _compiled = false;
+	// Resolved registers depend on the sampling rate, see SiOPMRefTable::get_generation().
+	uint32_t _table_generation = 0;
+	int _key[KEY_SIZE] = {};
+	int _key_size = 0;
+	double _key_volumes[SiOPMSoundChip::STREAM_SEND_SIZE] = {};
+
+	int _make_key(const Ref<SiOPMChannelParams> &p_params, int (&r_key)[KEY_SIZE]) const;
+	void _compile(const Ref<SiOPMChannelParams> &p_params);
+
+	Ref<SiOPMChannelParams> _params;
+
+	int _operator_count = 0;
+	bool _analog_like = false;
+	int _algorithm = 0;
+	int _feedback = 0;
+	int _feedback_connection = 0;
+	int _frequency_ratio = 100;
+
+	int _lfo_wave_shape = 0;
+	int _lfo_frequency_step = 0;
+	int _amplitude_modulation_depth = 0;
+	int _pitch_modulation_depth = 0;
+
+	double _volumes[SiOPMSoundChip::STREAM_SEND_SIZE] = {};
+	bool _has_effect_send = false;
+	int _pan = 64;
+
+	int _filter_type = 0;
+	// Cutoff, resonance, AR, DR1, DR2, RR, DC1, DC2, SC, RC.
+	int _filter_params[10] = {};
+
+	OperatorState _operators[SiOPMChannelParams::MAX_OPERATORS];
+
+public:
+	static bool is_user_wave_table(int p_pg_type);
+
+	// Returns true if the program had to be recompiled.
+	bool update(const Ref<SiOPMChannelParams> &p_params);
+	void invalidate();
+
+	bool is_compiled() const { return _compiled; }
+	Ref<SiOPMChannelParams> get_params() const { return _params; }
+
+	int get_operator_count() const { return _operator_count; }
+	bool is_analog_like() const { return _analog_like; }
+	int get_algorithm() const { return _algorithm; }
+	int get_feedback() const { return _feedback; }
+	int get_feedback_connection() const { return _feedback_connection; }
+	int get_frequency_ratio() const { return _frequency_ratio; }
+
+	int get_lfo_wave_shape() const { return _lfo_wave_shape; }
+	int get_lfo_frequency_step() const { return _lfo_frequency_step; }
+	int get_amplitude_modulation_depth() const { return _amplitude_modulation_depth; }
+	int get_pitch_modulation_depth() const { return _pitch_modulation_depth; }
+
+	double get_volume(int p_index) const { return _volumes[p_index]; }
+	bool has_effect_send() const { return _has_effect_send; }
+	int get_pan() const { return _pan; }
+
+	int get_filter_type() const { return _filter_type; }
+	int get_filter_param(int p_index) const { return _filter_params[p_index]; }
+
+	const OperatorState &get_operator_state(int p_index) const { return _operators[p_index]; }
+
+	SiOPMVoiceProgram() {}
+	~SiOPMVoiceProgram() {}
+};
+
+#endif // SIOPM_VOICE_PROGRAM_H
@@ -12,7 +12,7 @@ SiOPMWaveBase::SiOPMWaveBase(SiONModuleType p_module_type) {
 	_module_type = p_module_type;
 }
 
-Vector<double> SiOPMWaveBase::_extract_wave_data(const Ref<AudioStream> &p_stream, int *r_channel_count) {
+Vector<double> SiOPMWaveBase::extract_wave_data(const Ref<AudioStream> &p_stream, int *r_channel_count) {
 	if (p_stream.is_null()) {
 		return Vector<double>();
 	}
@@ -25,36 +25,39 @@ Vector<double> SiOPMWaveBase::_extract_wave_data(const Ref<AudioStream> &p_strea
 		}
 
 		*r_channel_count = (wav_stream->is_stereo() ? 2 : 1);
-		PackedByteArray wav_data = wav_stream->get_data();
+		const PackedByteArray wav_data = wav_stream->get_data();
+		const uint8_t *bytes_ptr = wav_data.ptr();
+
+		// Decode everything in one pass, without growing the vector sample by sample.
 		Vector<double> raw_data;
 
-		int offset = 0;
-		while (offset < wav_data.size()) {
-			switch (data_format) {
-				case AudioStreamWAV::FORMAT_8_BITS: {
-					int value = wav_data.decode_s8(offset);
-					double sample = float(value) / 127.0; // Max int8.
-					raw_data.push_back(sample);
-
-					offset += 1;
-				} break;
-
-				case AudioStreamWAV::FORMAT_16_BITS: {
-					int value = wav_data.decode_s16(offset);
-					double sample = float(value) / 32767.0; // Max int16.
-					raw_data.push_back(sample);
-
-					offset += 2;
-				} break;
-
-				default:
-					offset += 1;
-					break;
-			}
+		switch (data_format) {
+			case AudioStreamWAV::FORMAT_8_BITS: {
+				raw_data.resize(wav_data.size());
+				double *raw_ptr = raw_data.ptrw();
+
+				for (int i = 0; i < raw_data.size(); i++) {
+					raw_ptr[i] = (int8_t)bytes_ptr[i] / 127.0; // Max int8.
+				}
+			} break;
+
+			case AudioStreamWAV::FORMAT_16_BITS: {
+				raw_data.resize(wav_data.size() >> 1);
+				double *raw_ptr = raw_data.ptrw();
+
+				for (int i = 0, j = 0; i < raw_data.size(); i++, j += 2) {
+					const int16_t value = (int16_t)(bytes_ptr[j] | (bytes_ptr[j + 1] << 8));
+					raw_ptr[i] = value / 32767.0; // Max int16.
+				}
+			} break;
+
+			default:
+				break;
 		}
 
 		return raw_data;
 	}
 
-	ERR_FAIL_V_MSG(Vector<double>(), "SiOPMWaveBase: Unsupported audio stream format.");
+	// Compressed streams cannot be decoded through the extension API, they must be imported as WAV.
+	ERR_FAIL_V_MSG(Vector<double>(), vformat("SiOPMWaveBase: Unsupported audio stream format (%s), only WAV streams can be decoded.", p_stream->get_class()));
 }
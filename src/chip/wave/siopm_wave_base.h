@@ -7,6 +7,7 @@
 #ifndef SIOPM_WAVE_BASE_H
 #define SIOPM_WAVE_BASE_H
 
+#include <cstdint>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/audio_stream.hpp>
 #include <godot_cpp/templates/vector.hpp>
@@ -22,11 +23,21 @@ class SiOPMWaveBase : public RefCounted {
 protected:
 	static void _bind_methods() {}
 
-	Vector<double> _extract_wave_data(const Ref<AudioStream> &p_stream, int *r_channel_count);
+	// Set while the data is being prepared by SiOPMWaveLoader. Such wave is empty until then.
+	bool _loading = false;
 
 public:
+	static Vector<double> extract_wave_data(const Ref<AudioStream> &p_stream, int *r_channel_count);
+
 	SiONModuleType get_module_type() const { return _module_type; }
 
+	// Approximate size of the wave data, in bytes.
+	virtual int64_t get_memory_usage() const { return 0; }
+
+	bool is_loading() const { return _loading; }
+	// Called by SiOPMWaveLoader on the main thread once the source is decoded.
+	virtual void apply_loaded_data(const Vector<double> &p_data, int p_channel_count) {}
+
 	SiOPMWaveBase(SiONModuleType p_module_type = SiONModuleType::MODULE_MAX);
 	~SiOPMWaveBase() {}
 };
@@ -0,0 +1,139 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "siopm_wave_loader.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include "chip/wave/siopm_wave_base.h"
+#include "chip/wave/siopm_wave_sampler_data.h"
+
+void SiOPMWaveLoader::start() {
+	if (_task_id >= 0 || _finished) {
+		return;
+	}
+
+	// Keep the loader alive until the task is collected.
+	_task_self = Ref<SiOPMWaveLoader>(this);
+	_task_id = WorkerThreadPool::get_singleton()->add_task(Callable(this, "_load"), false, "SiOPMWaveLoader: Load and decode sound data.");
+}
+
+void SiOPMWaveLoader::finish() {
+	if (_finished) {
+		return;
+	}
+
+	if (_task_id >= 0) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(_task_id);
+		_task_id = -1;
+	} else if (!is_completed()) {
+		// Never started, decode in place.
+		_load();
+	}
+
+	_finished = true;
+
+	for (uint64_t instance_id : _dependents) {
+		SiOPMWaveBase *wave = Object::cast_to<SiOPMWaveBase>(ObjectDB::get_instance(instance_id));
+		if (wave) {
+			wave->apply_loaded_data(_wave_data, _channel_count);
+		}
+	}
+	_dependents.clear();
+
+	// May free the loader, so this must go last.
+	_task_self = Ref<SiOPMWaveLoader>();
+}
+
+void SiOPMWaveLoader::add_dependent(SiOPMWaveBase *p_wave) {
+	ERR_FAIL_NULL(p_wave);
+	ERR_FAIL_COND_MSG(_finished, "SiOPMWaveLoader: Cannot add a dependent to a finished loader.");
+
+	_dependents.push_back(p_wave->get_instance_id());
+}
+
+bool SiOPMWaveLoader::has_dependents() const {
+	for (uint64_t instance_id : _dependents) {
+		if (ObjectDB::get_instance(instance_id)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Worker side.
+
+void SiOPMWaveLoader::_load() {
+	_decode();
+	_completed.store(true, std::memory_order_release);
+}
+
+void SiOPMWaveLoader::_decode() {
+	Ref<AudioStream> stream = _stream;
+
+	if (stream.is_null() && !_path.is_empty()) {
+		if (!ResourceLoader::get_singleton()->exists(_path)) {
+			// Files outside of the project aren't imported, so they are read directly.
+			_decode_wav_file();
+			return;
+		}
+
+		stream = ResourceLoader::get_singleton()->load(_path);
+		ERR_FAIL_COND_MSG(stream.is_null(), vformat("SiOPMWaveLoader: Resource '%s' is not an audio stream.", _path));
+	}
+
+	if (stream.is_valid()) {
+		_wave_data = SiOPMWaveBase::extract_wave_data(stream, &_channel_count);
+	}
+}
+
+void SiOPMWaveLoader::_decode_wav_file() {
+	// Streamed sampler data already knows how to parse WAV files, reuse it to read the whole file.
+	Ref<SiOPMWaveSamplerData> file_data = memnew(SiOPMWaveSamplerData(_path));
+	if (!file_data->is_streamed()) {
+		return; // The error has been reported already.
+	}
+
+	Ref<FileAccess> file = FileAccess::open(_path, FileAccess::READ);
+	ERR_FAIL_COND_MSG(file.is_null(), vformat("SiOPMWaveLoader: Cannot open '%s'.", _path));
+
+	_channel_count = file_data->get_channel_count();
+	_wave_data.resize(file_data->get_length() * _channel_count);
+	const int frames = file_data->read_file_frames(file, 0, file_data->get_length(), _wave_data.ptrw());
+	_wave_data.resize(frames * _channel_count);
+}
+
+void SiOPMWaveLoader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("_load"), &SiOPMWaveLoader::_load);
+}
+
+SiOPMWaveLoader::SiOPMWaveLoader(const Variant &p_source) {
+	_completed.store(false);
+
+	switch (p_source.get_type()) {
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			_path = p_source;
+		} break;
+
+		case Variant::OBJECT: {
+			_stream = p_source;
+			ERR_FAIL_COND_MSG(_stream.is_null(), "SiOPMWaveLoader: Unsupported source type, expected an audio stream.");
+		} break;
+
+		case Variant::NIL: {
+			// Nothing to do.
+		} break;
+
+		default: {
+			ERR_FAIL_MSG("SiOPMWaveLoader: Unsupported source type, expected a path or an audio stream.");
+		} break;
+	}
+}
@@ -0,0 +1,72 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SIOPM_WAVE_LOADER_H
+#define SIOPM_WAVE_LOADER_H
+
+#include <atomic>
+#include <cstdint>
+#include <godot_cpp/classes/audio_stream.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+using namespace godot;
+
+class SiOPMWaveBase;
+
+// Loads and decodes a sound on the worker thread pool, so referencing it doesn't stall the caller.
+// Wave data created from a loader that hasn't finished yet stays empty and is registered as its
+// dependent; the decoded data is handed over to all dependents by finish() on the main thread.
+class SiOPMWaveLoader : public RefCounted {
+	GDCLASS(SiOPMWaveLoader, RefCounted)
+
+	// Set on creation, read by the worker.
+	String _path;
+	Ref<AudioStream> _stream;
+
+	// Written by the worker, read once the task is completed.
+	Vector<double> _wave_data;
+	int _channel_count = 0;
+	std::atomic<bool> _completed;
+
+	// Main thread only.
+	int64_t _task_id = -1;
+	Ref<SiOPMWaveLoader> _task_self;
+	bool _finished = false;
+	// Instance IDs, so pending wave data can be freed before the loader is done.
+	Vector<uint64_t> _dependents;
+
+	void _load();
+	void _decode();
+	void _decode_wav_file();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void start();
+	// True when the worker is done, i.e. finish() won't block.
+	bool is_completed() const { return _completed.load(std::memory_order_acquire); }
+	// True when the decoded data has been handed over.
+	bool is_finished() const { return _finished; }
+	// Waits for the worker and prepares all pending dependents. Must be called on the main thread,
+	// with the output locked if dependents can be in use.
+	void finish();
+
+	void add_dependent(SiOPMWaveBase *p_wave);
+	bool has_dependents() const;
+
+	// Only valid once finished.
+	const Vector<double> &get_wave_data() const { return _wave_data; }
+	int get_channel_count() const { return _channel_count; }
+
+	// Accepts a resource or file path, or an audio stream.
+	SiOPMWaveLoader(const Variant &p_source = Variant());
+	~SiOPMWaveLoader() {}
+};
+
+#endif // SIOPM_WAVE_LOADER_H
@@ -11,6 +11,7 @@
 
 #include "sion_enums.h"
 #include "chip/siopm_ref_table.h"
+#include "chip/wave/siopm_wave_loader.h"
 #include "utils/transformer_util.h"
 
 using namespace godot;
@@ -24,31 +25,59 @@ void SiOPMWavePCMData::_prepare_wavelet(const Variant &p_data, int p_src_channel
 	Variant::Type data_type = p_data.get_type();
 	switch (data_type) {
 		case Variant::PACKED_INT32_ARRAY: {
-			// TODO: If someday Vector<T> and Packed*Arrays become friends, this can be simplified.
-			for (int value : (PackedInt32Array)p_data) {
-				_wavelet.append(value);
+			const PackedInt32Array source_data = p_data;
+			_wavelet.resize(source_data.size());
+
+			const int32_t *source_ptr = source_data.ptr();
+			int16_t *wavelet_ptr = _wavelet.ptrw();
+			for (int i = 0; i < source_data.size(); i++) {
+				wavelet_ptr[i] = (int16_t)CLAMP(source_ptr[i], 0, SiOPMRefTable::LOG_TABLE_SIZE * 3 - 1);
 			}
 		} break;
 
 		case Variant::PACKED_FLOAT32_ARRAY: {
 			// TODO: If someday Vector<T> and Packed*Arrays become friends, this can be simplified.
+			const PackedFloat32Array source_data = p_data;
 			Vector<double> raw_data;
-			for (double value : (PackedFloat32Array)p_data) {
-				raw_data.append(value);
+			raw_data.resize(source_data.size());
+
+			const float *source_ptr = source_data.ptr();
+			double *raw_ptr = raw_data.ptrw();
+			for (int i = 0; i < source_data.size(); i++) {
+				raw_ptr[i] = source_ptr[i];
 			}
 
-			_wavelet = TransformerUtil::transform_pcm_data(raw_data, source_channels, target_channels);
+			_store_wavelet(TransformerUtil::transform_pcm_data(raw_data, source_channels, target_channels));
 		} break;
 
 		case Variant::OBJECT: {
 			Ref<AudioStream> audio_stream = p_data;
 			if (audio_stream.is_valid()) {
-				Vector<double> raw_data = _extract_wave_data(audio_stream, &source_channels);
+				Vector<double> raw_data = extract_wave_data(audio_stream, &source_channels);
 				if (p_channel_count == 0) { // Update if necessary.
 					target_channels = source_channels;
 				}
 
-				_wavelet = TransformerUtil::transform_pcm_data(raw_data, source_channels, target_channels);
+				_store_wavelet(TransformerUtil::transform_pcm_data(raw_data, source_channels, target_channels));
+				break;
+			}
+
+			Ref<SiOPMWaveLoader> loader = p_data;
+			if (loader.is_valid()) {
+				if (!loader->is_finished()) {
+					// Prepared later, see apply_loaded_data().
+					_loading = true;
+					_loading_channel_count = p_channel_count;
+					loader->add_dependent(this);
+					return;
+				}
+
+				source_channels = CLAMP(loader->get_channel_count(), 1, 2);
+				if (p_channel_count == 0) {
+					target_channels = source_channels;
+				}
+
+				_store_wavelet(TransformerUtil::transform_pcm_data(loader->get_wave_data(), source_channels, target_channels));
 				break;
 			}
 
@@ -68,6 +97,37 @@ void SiOPMWavePCMData::_prepare_wavelet(const Variant &p_data, int p_src_channel
 	_end_point = get_sample_count() - 1;
 }
 
+void SiOPMWavePCMData::apply_loaded_data(const Vector<double> &p_data, int p_channel_count) {
+	if (!_loading) {
+		return;
+	}
+	_loading = false;
+
+	const int source_channels = CLAMP(p_channel_count, 1, 2);
+	const int target_channels = (_loading_channel_count == 0 ? source_channels : CLAMP(_loading_channel_count, 1, 2));
+
+	_store_wavelet(TransformerUtil::transform_pcm_data(p_data, source_channels, target_channels));
+	_channel_count = target_channels;
+
+	// Slicing requested while loading is applied now that the data is known.
+	if (_slice_pending) {
+		_slice_pending = false;
+		_slice();
+	} else {
+		_end_point = get_sample_count() - 1;
+	}
+}
+
+void SiOPMWavePCMData::_store_wavelet(const Vector<int> &p_log_data) {
+	_wavelet.resize(p_log_data.size());
+
+	const int *log_ptr = p_log_data.ptr();
+	int16_t *wavelet_ptr = _wavelet.ptrw();
+	for (int i = 0; i < p_log_data.size(); i++) {
+		wavelet_ptr[i] = (int16_t)log_ptr[i];
+	}
+}
+
 int SiOPMWavePCMData::get_sample_count() const {
 	if (_channel_count > 0) {
 		return _wavelet.size() >> (_channel_count - 1);
@@ -150,10 +210,16 @@ void SiOPMWavePCMData::slice(int p_start_point, int p_end_point, int p_loop_poin
 	_end_point = p_end_point;
 	_loop_point = p_loop_point;
 
+	if (_loading) {
+		_slice_pending = true;
+		return;
+	}
 	_slice();
 }
 
 void SiOPMWavePCMData::loop_tail_samples(int p_sample_count, int p_tail_margin, bool p_crossfade) {
+	ERR_FAIL_COND_MSG(_loading, "SiOPMWavePCMData: Cannot loop samples before the data is loaded.");
+
 	_end_point = _seek_end_gap() - p_tail_margin;
 
 	if (_end_point < (_start_point + p_sample_count)) {
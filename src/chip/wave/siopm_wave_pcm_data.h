@@ -7,6 +7,7 @@
 #ifndef SIOPM_WAVE_PCM_DATA_H
 #define SIOPM_WAVE_PCM_DATA_H
 
+#include <cstdint>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/variant.hpp>
 #include "chip/wave/siopm_wave_base.h"
@@ -18,11 +19,17 @@ class SiOPMWavePCMData : public SiOPMWaveBase {
 
 	static Vector<double> _sin_table;
 
-	Vector<int> _wavelet;
+	// Log table indices stay below SiOPMRefTable::LOG_TABLE_SIZE * 3, so they fit into 16 bits.
+	Vector<int16_t> _wavelet;
 	int _channel_count = 0;
 	int _sampling_pitch = 0;
 
+	// Requested channel count and slicing, kept until the loader is done.
+	int _loading_channel_count = 0;
+	bool _slice_pending = false;
+
 	void _prepare_wavelet(const Variant &p_data, int p_src_channel_count, int p_channel_count);
+	void _store_wavelet(const Vector<int> &p_log_data);
 
 	//
 
@@ -40,7 +47,11 @@ protected:
 	static void _bind_methods() {}
 
 public:
-	Vector<int> get_wavelet() const { return _wavelet; }
+	virtual void apply_loaded_data(const Vector<double> &p_data, int p_channel_count) override;
+
+	virtual int64_t get_memory_usage() const override { return _wavelet.size() * sizeof(int16_t); }
+
+	Vector<int16_t> get_wavelet() const { return _wavelet; }
 	int get_channel_count() const { return _channel_count; }
 	int get_sampling_pitch() const { return _sampling_pitch; }
 
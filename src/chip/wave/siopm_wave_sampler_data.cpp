@@ -6,15 +6,26 @@
 
 #include "siopm_wave_sampler_data.h"
 
+#include <cstring>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
 #include <godot_cpp/classes/audio_stream.hpp>
 
 #include "sion_enums.h"
+#include "chip/wave/siopm_wave_loader.h"
+#include "chip/wave/siopm_wave_sampler_reader.h"
 #include "templates/singly_linked_list.h"
 #include "utils/transformer_util.h"
 
 using namespace godot;
 
+SiONSampleFormat SiOPMWaveSamplerData::_default_format = SAMPLE_FORMAT_FLOAT32;
+
+void SiOPMWaveSamplerData::set_default_format(SiONSampleFormat p_format) {
+	ERR_FAIL_INDEX(p_format, SAMPLE_FORMAT_MAX);
+	_default_format = p_format;
+}
+
 void SiOPMWaveSamplerData::_prepare_wave_data(const Variant &p_data, int p_src_channel_count, int p_channel_count) {
 	int source_channels = CLAMP(p_src_channel_count, 1, 2);
 	int target_channels = (p_channel_count == 0 ? source_channels : CLAMP(p_channel_count, 1, 2));
@@ -23,29 +34,61 @@ void SiOPMWaveSamplerData::_prepare_wave_data(const Variant &p_data, int p_src_c
 	switch (data_type) {
 		case Variant::PACKED_FLOAT32_ARRAY: {
 			// TODO: If someday Vector<T> and Packed*Arrays become friends, this can be simplified.
+			const PackedFloat32Array source_data = p_data;
 			Vector<double> raw_data;
-			for (double value : (PackedFloat32Array)p_data) {
-				raw_data.append(value);
+			raw_data.resize(source_data.size());
+
+			const float *source_ptr = source_data.ptr();
+			double *raw_ptr = raw_data.ptrw();
+			for (int i = 0; i < source_data.size(); i++) {
+				raw_ptr[i] = source_ptr[i];
 			}
 
-			_wave_data = TransformerUtil::transform_sampler_data(raw_data, source_channels, target_channels);
+			Vector<double> wave_data = TransformerUtil::transform_sampler_data(raw_data, source_channels, target_channels);
+			_store_wave_data(wave_data.ptr(), wave_data.size());
 		} break;
 
 		case Variant::OBJECT: {
 			Ref<AudioStream> audio_stream = p_data;
 			if (audio_stream.is_valid()) {
-				Vector<double> raw_data = _extract_wave_data(audio_stream, &source_channels);
+				Vector<double> raw_data = extract_wave_data(audio_stream, &source_channels);
 				if (p_channel_count == 0) { // Update if necessary.
 					target_channels = source_channels;
 				}
 
-				_wave_data = TransformerUtil::transform_sampler_data(raw_data, source_channels, target_channels);
+				Vector<double> wave_data = TransformerUtil::transform_sampler_data(raw_data, source_channels, target_channels);
+				_store_wave_data(wave_data.ptr(), wave_data.size());
+				break;
+			}
+
+			Ref<SiOPMWaveLoader> loader = p_data;
+			if (loader.is_valid()) {
+				if (!loader->is_finished()) {
+					// Prepared later, see apply_loaded_data().
+					_loading = true;
+					_loading_channel_count = p_channel_count;
+					loader->add_dependent(this);
+					return;
+				}
+
+				source_channels = CLAMP(loader->get_channel_count(), 1, 2);
+				if (p_channel_count == 0) {
+					target_channels = source_channels;
+				}
+
+				Vector<double> wave_data = TransformerUtil::transform_sampler_data(loader->get_wave_data(), source_channels, target_channels);
+				_store_wave_data(wave_data.ptr(), wave_data.size());
 				break;
 			}
 
 			ERR_FAIL_MSG("SiOPMWaveSamplerData: Unsupported data type.");
 		} break;
 
+		case Variant::STRING: {
+			_prepare_file_stream(p_data, p_channel_count);
+			return;
+		} break;
+
 		case Variant::NIL: {
 			// Nothing to do.
 		} break;
@@ -59,9 +102,296 @@ void SiOPMWaveSamplerData::_prepare_wave_data(const Variant &p_data, int p_src_c
 	_end_point = get_length();
 }
 
+void SiOPMWaveSamplerData::apply_loaded_data(const Vector<double> &p_data, int p_channel_count) {
+	if (!_loading) {
+		return;
+	}
+	_loading = false;
+
+	const int source_channels = CLAMP(p_channel_count, 1, 2);
+	const int target_channels = (_loading_channel_count == 0 ? source_channels : CLAMP(_loading_channel_count, 1, 2));
+
+	Vector<double> wave_data = TransformerUtil::transform_sampler_data(p_data, source_channels, target_channels);
+	_store_wave_data(wave_data.ptr(), wave_data.size());
+	_channel_count = target_channels;
+
+	// Slicing requested while loading is applied now that the data is known.
+	if (_slice_pending) {
+		_slice_pending = false;
+		_slice();
+	} else {
+		_end_point = get_length();
+	}
+}
+
+void SiOPMWaveSamplerData::_store_wave_data(const double *p_data, int p_size) {
+	_float_data.clear();
+	_int16_data.clear();
+
+	switch (_format) {
+		case SAMPLE_FORMAT_FLOAT32: {
+			_float_data.resize(p_size);
+			float *data_ptr = _float_data.ptrw();
+			for (int i = 0; i < p_size; i++) {
+				data_ptr[i] = (float)p_data[i];
+			}
+		} break;
+
+		case SAMPLE_FORMAT_INT16: {
+			_int16_data.resize(p_size);
+			int16_t *data_ptr = _int16_data.ptrw();
+			for (int i = 0; i < p_size; i++) {
+				data_ptr[i] = (int16_t)Math::round(CLAMP(p_data[i], -1.0, 1.0) * 32767.0); // Max int16.
+			}
+		} break;
+
+		default: {
+			ERR_FAIL_MSG(vformat("SiOPMWaveSamplerData: Unsupported sample format (%d).", _format));
+		} break;
+	}
+}
+
+int64_t SiOPMWaveSamplerData::get_memory_usage() const {
+	return (int64_t)_float_data.size() * sizeof(float) + (int64_t)_int16_data.size() * sizeof(int16_t);
+}
+
+int SiOPMWaveSamplerData::_get_data_size() const {
+	return (_format == SAMPLE_FORMAT_INT16 ? _int16_data.size() : _float_data.size());
+}
+
+double SiOPMWaveSamplerData::_get_sample(int p_index) const {
+	if (_format == SAMPLE_FORMAT_INT16) {
+		return _int16_data[p_index] / 32767.0; // Max int16.
+	}
+
+	return _float_data[p_index];
+}
+
+void SiOPMWaveSamplerData::read_frames(int p_position, int p_frames, double *r_buffer) const {
+	const int start = p_position * _channel_count;
+	const int size = p_frames * _channel_count;
+	ERR_FAIL_COND(start < 0 || start + size > _get_data_size());
+
+	if (_format == SAMPLE_FORMAT_INT16) {
+		const int16_t *data_ptr = _int16_data.ptr() + start;
+		for (int i = 0; i < size; i++) {
+			r_buffer[i] = data_ptr[i] / 32767.0; // Max int16.
+		}
+	} else {
+		const float *data_ptr = _float_data.ptr() + start;
+		for (int i = 0; i < size; i++) {
+			r_buffer[i] = data_ptr[i];
+		}
+	}
+}
+
+void SiOPMWaveSamplerData::read_frames_planar(int p_position, int p_frames, float *r_left, float *r_right) const {
+	const int start = p_position * _channel_count;
+	ERR_FAIL_COND(start < 0 || start + p_frames * _channel_count > _get_data_size());
+
+	if (_format == SAMPLE_FORMAT_INT16) {
+		const int16_t *data_ptr = _int16_data.ptr() + start;
+		const float scale = 1.0f / 32767.0f; // Max int16.
+
+		if (_channel_count == 2) {
+			for (int i = 0; i < p_frames; i++) {
+				r_left[i] = data_ptr[i << 1] * scale;
+				r_right[i] = data_ptr[(i << 1) + 1] * scale;
+			}
+		} else {
+			for (int i = 0; i < p_frames; i++) {
+				r_left[i] = data_ptr[i] * scale;
+			}
+		}
+	} else {
+		const float *data_ptr = _float_data.ptr() + start;
+
+		if (_channel_count == 2) {
+			for (int i = 0; i < p_frames; i++) {
+				r_left[i] = data_ptr[i << 1];
+				r_right[i] = data_ptr[(i << 1) + 1];
+			}
+		} else {
+			memcpy(r_left, data_ptr, sizeof(float) * p_frames);
+		}
+	}
+}
+
+void SiOPMWaveSamplerData::_prepare_file_stream(const String &p_path, int p_channel_count) {
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_MSG(file.is_null(), vformat("SiOPMWaveSamplerData: Cannot open '%s' for streaming.", p_path));
+
+	ERR_FAIL_COND_MSG(file->get_buffer(4).get_string_from_ascii() != "RIFF", vformat("SiOPMWaveSamplerData: File '%s' is not a WAV file.", p_path));
+	file->get_32(); // RIFF size.
+	ERR_FAIL_COND_MSG(file->get_buffer(4).get_string_from_ascii() != "WAVE", vformat("SiOPMWaveSamplerData: File '%s' is not a WAV file.", p_path));
+
+	int format_tag = 0;
+	int channel_count = 0;
+	int bits_per_sample = 0;
+	uint64_t data_offset = 0;
+	uint64_t data_size = 0;
+
+	while (file->get_position() + 8 <= file->get_length()) {
+		const String chunk_id = file->get_buffer(4).get_string_from_ascii();
+		const uint64_t chunk_size = file->get_32();
+		const uint64_t chunk_start = file->get_position();
+
+		if (chunk_id == "fmt ") {
+			format_tag = file->get_16();
+			channel_count = file->get_16();
+			file->get_32(); // Sample rate.
+			file->get_32(); // Byte rate.
+			file->get_16(); // Block align.
+			bits_per_sample = file->get_16();
+
+			// WAVE_FORMAT_EXTENSIBLE keeps the actual format in the sub-format GUID.
+			if (format_tag == 0xFFFE && chunk_size >= 26) {
+				file->seek(chunk_start + 24);
+				format_tag = file->get_16();
+			}
+		} else if (chunk_id == "data") {
+			data_offset = chunk_start;
+			data_size = MIN(chunk_size, file->get_length() - chunk_start);
+			break;
+		}
+
+		// Chunks are padded to an even size.
+		file->seek(chunk_start + chunk_size + (chunk_size & 1));
+	}
+
+	const bool is_pcm = (format_tag == 1 && (bits_per_sample == 8 || bits_per_sample == 16 || bits_per_sample == 24));
+	const bool is_float = (format_tag == 3 && bits_per_sample == 32);
+	ERR_FAIL_COND_MSG(!is_pcm && !is_float, vformat("SiOPMWaveSamplerData: Unsupported WAV file format in '%s' (format %d, %d bits).", p_path, format_tag, bits_per_sample));
+	ERR_FAIL_COND_MSG(channel_count < 1 || channel_count > 2, vformat("SiOPMWaveSamplerData: Unsupported channel count in '%s' (%d).", p_path, channel_count));
+	ERR_FAIL_COND_MSG(data_offset == 0, vformat("SiOPMWaveSamplerData: File '%s' has no sample data.", p_path));
+
+	_file_path = p_path;
+	_file_data_offset = data_offset;
+	_file_format = bits_per_sample;
+	_file_channel_count = channel_count;
+	_file_length = (int)MIN(data_size / (channel_count * (bits_per_sample >> 3)), (uint64_t)INT32_MAX);
+	_channel_count = (p_channel_count == 0 ? channel_count : CLAMP(p_channel_count, 1, 2));
+
+	// Preload the head.
+	const int head_length = MIN(_file_length, STREAM_HEAD_FRAMES);
+	Vector<double> head_data;
+	head_data.resize(head_length * _channel_count);
+	const int read_length = read_file_frames(file, 0, head_length, head_data.ptrw());
+	if (read_length < head_length) {
+		_file_length = read_length;
+	}
+	_store_wave_data(head_data.ptr(), read_length * _channel_count);
+
+	_end_point = get_length();
+
+	_stream_readers.resize(STREAM_READER_COUNT);
+	for (int i = 0; i < STREAM_READER_COUNT; i++) {
+		_stream_readers.write[i] = Ref<SiOPMWaveSamplerReader>(memnew(SiOPMWaveSamplerReader(this)));
+	}
+}
+
+Ref<SiOPMWaveSamplerReader> SiOPMWaveSamplerData::acquire_stream_reader() {
+	uint32_t in_use = _stream_readers_in_use.load(std::memory_order_acquire);
+
+	while (true) {
+		int index = -1;
+		for (int i = 0; i < _stream_readers.size(); i++) {
+			if (!(in_use & (1 << i))) {
+				index = i;
+				break;
+			}
+		}
+		if (index < 0) {
+			return Ref<SiOPMWaveSamplerReader>();
+		}
+
+		if (_stream_readers_in_use.compare_exchange_weak(in_use, in_use | (1 << index), std::memory_order_acq_rel)) {
+			return _stream_readers[index];
+		}
+	}
+}
+
+void SiOPMWaveSamplerData::release_stream_reader(const Ref<SiOPMWaveSamplerReader> &p_reader) {
+	for (int i = 0; i < _stream_readers.size(); i++) {
+		if (_stream_readers[i] == p_reader) {
+			_stream_readers_in_use.fetch_and(~(1 << i), std::memory_order_acq_rel);
+			return;
+		}
+	}
+}
+
+int SiOPMWaveSamplerData::get_head_length() const {
+	if (_channel_count > 0) {
+		return _get_data_size() >> (_channel_count - 1);
+	}
+
+	return 0;
+}
+
+int SiOPMWaveSamplerData::read_file_frames(const Ref<FileAccess> &p_file, int p_position, int p_frames, double *r_buffer) const {
+	if (p_frames <= 0) {
+		return 0;
+	}
+
+	const int sample_size = _file_format >> 3;
+	const int frame_size = sample_size * _file_channel_count;
+	p_file->seek(_file_data_offset + (uint64_t)p_position * frame_size);
+
+	const PackedByteArray bytes = p_file->get_buffer((int64_t)p_frames * frame_size);
+	const int frames = bytes.size() / frame_size;
+	const uint8_t *bytes_ptr = bytes.ptr();
+
+	for (int i = 0; i < frames; i++) {
+		double values[2] = { 0, 0 };
+		for (int c = 0; c < _file_channel_count; c++) {
+			const uint8_t *sample = bytes_ptr + i * frame_size + c * sample_size;
+
+			switch (_file_format) {
+				case 8: { // Unsigned.
+					values[c] = (sample[0] - 128) / 127.0; // Max int8.
+				} break;
+
+				case 16: {
+					const int16_t value = (int16_t)(sample[0] | (sample[1] << 8));
+					values[c] = value / 32767.0; // Max int16.
+				} break;
+
+				case 24: {
+					const int32_t value = (int32_t)(((uint32_t)sample[0] << 8) | ((uint32_t)sample[1] << 16) | ((uint32_t)sample[2] << 24)) >> 8;
+					values[c] = value / 8388607.0; // Max int24.
+				} break;
+
+				case 32: {
+					float value;
+					memcpy(&value, sample, sizeof(float));
+					values[c] = value;
+				} break;
+			}
+		}
+
+		// Same conversion as in TransformerUtil::transform_sampler_data().
+		if (_channel_count == _file_channel_count) {
+			for (int c = 0; c < _channel_count; c++) {
+				r_buffer[i * _channel_count + c] = values[c];
+			}
+		} else if (_file_channel_count == 2) {
+			r_buffer[i] = (values[0] + values[1]) * 0.5;
+		} else {
+			r_buffer[i * 2] = values[0];
+			r_buffer[i * 2 + 1] = values[0];
+		}
+	}
+
+	return frames;
+}
+
 int SiOPMWaveSamplerData::get_length() const {
+	if (is_streamed()) {
+		return _file_length;
+	}
+
 	if (_channel_count > 0) {
-		return _wave_data.size() >> (_channel_count - 1);
+		return _get_data_size() >> (_channel_count - 1);
 	}
 
 	return 0;
@@ -71,6 +401,15 @@ void SiOPMWaveSamplerData::set_ignore_note_off(bool p_ignore) {
 	_ignore_note_off = (_loop_point == -1) && p_ignore;
 }
 
+void SiOPMWaveSamplerData::set_root_note(int p_note) {
+	_root_note = (p_note < 0 ? -1 : MIN(p_note, 127));
+}
+
+void SiOPMWaveSamplerData::set_resampling_quality(SiONSamplerQuality p_quality) {
+	ERR_FAIL_INDEX(p_quality, SAMPLER_QUALITY_MAX);
+	_resampling_quality = p_quality;
+}
+
 //
 
 int SiOPMWaveSamplerData::get_initial_sample_index(double p_phase) const {
@@ -78,7 +417,7 @@ int SiOPMWaveSamplerData::get_initial_sample_index(double p_phase) const {
 }
 
 int SiOPMWaveSamplerData::_seek_head_silence() {
-	if (_wave_data.is_empty()) {
+	if (_get_data_size() == 0) {
 		return 0;
 	}
 
@@ -95,9 +434,9 @@ int SiOPMWaveSamplerData::_seek_head_silence() {
 	if (_channel_count == 1) {
 		double ms = 0.0;
 
-		for (; i < _wave_data.size(); i++) {
+		for (; i < _get_data_size(); i++) {
 			ms -= ms_window->get()->value;
-			ms_window->get()->value = _wave_data[i] * _wave_data[i];
+			ms_window->get()->value = _get_sample(i) * _get_sample(i);
 			ms += ms_window->get()->value;
 
 			ms_window->next();
@@ -110,10 +449,10 @@ int SiOPMWaveSamplerData::_seek_head_silence() {
 	} else {
 		double ms = 0.0;
 
-		for (; i < _wave_data.size(); i += 2) {
+		for (; i < _get_data_size(); i += 2) {
 			ms -= ms_window->get()->value;
-			ms_window->get()->value  = _wave_data[i]     * _wave_data[i];
-			ms_window->get()->value += _wave_data[i + 1] * _wave_data[i + 1];
+			ms_window->get()->value  = _get_sample(i)     * _get_sample(i);
+			ms_window->get()->value += _get_sample(i + 1) * _get_sample(i + 1);
 			ms += ms_window->get()->value;
 
 			ms_window->next();
@@ -131,15 +470,15 @@ int SiOPMWaveSamplerData::_seek_head_silence() {
 }
 
 int SiOPMWaveSamplerData::_seek_end_gap() {
-	if (_wave_data.is_empty()) {
+	if (_get_data_size() == 0) {
 		return 0;
 	}
 
-	int i = _wave_data.size() - 1;
+	int i = _get_data_size() - 1;
 
 	if (_channel_count == 1) {
 		for (; i >= 0; i--) {
-			double ms = _wave_data[i] * _wave_data[i];
+			double ms = _get_sample(i) * _get_sample(i);
 
 			if (ms > 0.0001) {
 				break;
@@ -147,8 +486,8 @@ int SiOPMWaveSamplerData::_seek_end_gap() {
 		}
 	} else {
 		for (; i >= 0; i -= 2) {
-			double ms = _wave_data[i]     * _wave_data[i];
-			ms       += _wave_data[i - 1] * _wave_data[i - 1];
+			double ms = _get_sample(i)     * _get_sample(i);
+			ms       += _get_sample(i - 1) * _get_sample(i - 1);
 
 			if (ms > 0.0002) {
 				break;
@@ -170,7 +509,8 @@ void SiOPMWaveSamplerData::_slice() {
 		_loop_point = -1;
 	}
 	if (_end_point < 0) {
-		_end_point = _seek_end_gap();
+		// Trailing silence is not worth reading the whole file for.
+		_end_point = (is_streamed() ? get_length() : _seek_end_gap());
 	}
 
 	if (_end_point < _loop_point) {
@@ -186,6 +526,10 @@ void SiOPMWaveSamplerData::slice(int p_start_point, int p_end_point, int p_loop_
 	_end_point = p_end_point;
 	_loop_point = p_loop_point;
 
+	if (_loading) {
+		_slice_pending = true;
+		return;
+	}
 	_slice();
 }
 
@@ -194,7 +538,14 @@ void SiOPMWaveSamplerData::slice(int p_start_point, int p_end_point, int p_loop_
 SiOPMWaveSamplerData::SiOPMWaveSamplerData(const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count) :
 		SiOPMWaveBase(SiONModuleType::MODULE_SAMPLE) {
 
+	_format = _default_format;
 	_prepare_wave_data(p_data, p_src_channel_count, p_channel_count);
 	set_ignore_note_off(p_ignore_note_off);
 	_pan = p_pan;
 }
+
+SiOPMWaveSamplerData::~SiOPMWaveSamplerData() {
+	for (const Ref<SiOPMWaveSamplerReader> &reader : _stream_readers) {
+		reader->release();
+	}
+}
@@ -7,22 +7,64 @@
 #ifndef SIOPM_WAVE_SAMPLER_DATA_H
 #define SIOPM_WAVE_SAMPLER_DATA_H
 
+#include <atomic>
+#include <cstdint>
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/variant.hpp>
+#include "sion_enums.h"
 #include "chip/wave/siopm_wave_base.h"
+#include "chip/wave/siopm_wave_sampler_resampler.h"
 
 using namespace godot;
 
+class SiOPMWaveSamplerReader;
+
 class SiOPMWaveSamplerData : public SiOPMWaveBase {
 	GDCLASS(SiOPMWaveSamplerData, SiOPMWaveBase)
 
-	Vector<double> _wave_data;
+	static SiONSampleFormat _default_format;
+
+	SiONSampleFormat _format = SAMPLE_FORMAT_FLOAT32;
+	// Only one of these is filled, depending on the format.
+	Vector<float> _float_data;
+	Vector<int16_t> _int16_data;
 	int _channel_count = 0;
 	int _pan = 0;
 	// This flag is only available for non-loop samples.
 	bool _ignore_note_off = false;
 
+	// Note at which the sample plays at its original rate. Other notes are pitch-shifted from it,
+	// so one sample can cover a whole key range. -1 means the sample always plays as is.
+	int _root_note = -1;
+	SiONSamplerQuality _resampling_quality = SAMPLER_QUALITY_MEDIUM;
+
+	// Requested channel count and slicing, kept until the loader is done.
+	int _loading_channel_count = 0;
+	bool _slice_pending = false;
+
 	void _prepare_wave_data(const Variant &p_data, int p_src_channel_count, int p_channel_count);
+	void _store_wave_data(const double *p_data, int p_size);
+	int _get_data_size() const;
+	double _get_sample(int p_index) const;
+
+	// Long samples can be streamed from a WAV file. Only the head of the sample is kept in memory,
+	// which lets notes start immediately. The rest is read by SiOPMWaveSamplerReader during playback.
+	static const int STREAM_HEAD_FRAMES = 32768;
+
+	String _file_path;
+	uint64_t _file_data_offset = 0;
+	int _file_format = 0; // Bits per sample, 32 means floating point.
+	int _file_channel_count = 0;
+	int _file_length = 0;
+
+	// Every streamed note needs its own reader. Readers are created with the sample, so starting a
+	// note never allocates. Each bit of the mask is set while the respective reader is in use.
+	static const int STREAM_READER_COUNT = 4;
+	Vector<Ref<SiOPMWaveSamplerReader>> _stream_readers;
+	std::atomic<uint32_t> _stream_readers_in_use = { 0 };
+
+	void _prepare_file_stream(const String &p_path, int p_channel_count);
 
 	//
 
@@ -40,14 +82,46 @@ protected:
 	static void _bind_methods() {};
 
 public:
-	Vector<double> get_wave_data() const { return _wave_data; }
+	static SiONSampleFormat get_default_format() { return _default_format; }
+	// Affects sample data created afterwards.
+	static void set_default_format(SiONSampleFormat p_format);
+
+	virtual void apply_loaded_data(const Vector<double> &p_data, int p_channel_count) override;
+	virtual int64_t get_memory_usage() const override;
+
+	SiONSampleFormat get_format() const { return _format; }
+	const float *get_float_data_ptr() const { return _float_data.ptr(); }
+	const int16_t *get_int16_data_ptr() const { return _int16_data.ptr(); }
+	// Converts frames from the in-memory data to doubles.
+	void read_frames(int p_position, int p_frames, double *r_buffer) const;
+	// Same as above, but splits channels into separate float buffers. The right buffer is only used by stereo data.
+	void read_frames_planar(int p_position, int p_frames, float *r_left, float *r_right) const;
+
 	int get_channel_count() const { return _channel_count; }
 	int get_pan() const { return _pan; }
 	int get_length() const;
 
+	// Streamed samples only keep the head in the wave data.
+	bool is_streamed() const { return !_file_path.is_empty(); }
+	String get_file_path() const { return _file_path; }
+	int get_head_length() const;
+	// Reads frames from the file starting at the given sample position, converting them to the channel
+	// count of this sample. Returns the number of frames read.
+	int read_file_frames(const Ref<FileAccess> &p_file, int p_position, int p_frames, double *r_buffer) const;
+	// Safe to call from the audio thread. Returns null if every reader is playing already.
+	Ref<SiOPMWaveSamplerReader> acquire_stream_reader();
+	// The reader must be stopped first.
+	void release_stream_reader(const Ref<SiOPMWaveSamplerReader> &p_reader);
+
 	bool is_ignoring_note_off() const { return _ignore_note_off; }
 	void set_ignore_note_off(bool p_ignore);
 
+	bool is_pitched() const { return _root_note >= 0; }
+	int get_root_note() const { return _root_note; }
+	void set_root_note(int p_note);
+	SiONSamplerQuality get_resampling_quality() const { return _resampling_quality; }
+	void set_resampling_quality(SiONSamplerQuality p_quality);
+
 	//
 
 	int get_start_point() const { return _start_point; }
@@ -60,7 +134,7 @@ public:
 	//
 
 	SiOPMWaveSamplerData(const Variant &p_data = Variant(), bool p_ignore_note_off = false, int p_pan = 0, int p_src_channel_count = 2, int p_channel_count = 0);
-	~SiOPMWaveSamplerData() {}
+	~SiOPMWaveSamplerData();
 };
 
 #endif // SIOPM_WAVE_SAMPLER_DATA_H
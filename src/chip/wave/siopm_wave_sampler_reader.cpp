@@ -0,0 +1,329 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "siopm_wave_sampler_reader.h"
+
+#include <cstring>
+#include <thread>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include "chip/wave/siopm_wave_sampler_data.h"
+
+// Generations are stored in the upper 31 bits of the write state.
+static const uint32_t GENERATION_MASK = 0x7FFFFFFF;
+
+MPSCRingBuffer<SiOPMWaveSamplerReader *> *SiOPMWaveSamplerReader::_refill_queue = nullptr;
+Ref<Semaphore> SiOPMWaveSamplerReader::_worker_semaphore;
+Ref<Thread> SiOPMWaveSamplerReader::_worker_thread;
+std::atomic<bool> SiOPMWaveSamplerReader::_worker_exit = { false };
+std::mutex SiOPMWaveSamplerReader::_worker_lock;
+
+// Worker thread.
+
+void SiOPMWaveSamplerReader::_start_worker() {
+	std::lock_guard<std::mutex> lock(_worker_lock);
+	if (_worker_thread.is_valid()) {
+		return;
+	}
+
+	_refill_queue = memnew(MPSCRingBuffer<SiOPMWaveSamplerReader *>(REFILL_QUEUE_SIZE));
+	_worker_semaphore.instantiate();
+	_worker_exit.store(false);
+
+	_worker_thread.instantiate();
+	_worker_thread->start(callable_mp_static(&SiOPMWaveSamplerReader::_run_worker));
+}
+
+void SiOPMWaveSamplerReader::_run_worker() {
+	while (true) {
+		_worker_semaphore->wait();
+		if (_worker_exit.load(std::memory_order_acquire)) {
+			break;
+		}
+
+		SiOPMWaveSamplerReader *reader = nullptr;
+		while (_refill_queue->pop(&reader)) {
+			reader->_refill();
+		}
+	}
+}
+
+void SiOPMWaveSamplerReader::finalize() {
+	std::lock_guard<std::mutex> lock(_worker_lock);
+	if (_worker_thread.is_null()) {
+		return;
+	}
+
+	_worker_exit.store(true, std::memory_order_release);
+	_worker_semaphore->post();
+	_worker_thread->wait_to_finish();
+
+	// Readers which were never refilled must not wait for the worker anymore.
+	SiOPMWaveSamplerReader *reader = nullptr;
+	while (_refill_queue->pop(&reader)) {
+		reader->_refill_pending.store(false, std::memory_order_release);
+	}
+
+	_worker_thread = Ref<Thread>();
+	_worker_semaphore = Ref<Semaphore>();
+	memdelete(_refill_queue);
+	_refill_queue = nullptr;
+}
+
+//
+
+uint64_t SiOPMWaveSamplerReader::_pack_write_state(uint32_t p_generation, bool p_finished, uint32_t p_write_count) {
+	return ((uint64_t)p_generation << 33) | ((uint64_t)(p_finished ? 1 : 0) << 32) | p_write_count;
+}
+
+void SiOPMWaveSamplerReader::_set_request(bool p_active, int p_position) {
+	while (_request_lock.test_and_set(std::memory_order_acquire)) {
+		// Spin.
+	}
+
+	_requested_active = p_active;
+	_requested_position = p_position;
+	_generation.store((_generation.load(std::memory_order_relaxed) + 1) & GENERATION_MASK, std::memory_order_release);
+
+	_request_lock.clear(std::memory_order_release);
+}
+
+void SiOPMWaveSamplerReader::_request_refill() {
+	bool expected = false;
+	if (!_refill_pending.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+		return; // The worker will pick up the latest request anyway.
+	}
+
+	if (!_refill_queue || !_refill_queue->push(this)) {
+		// Too many readers are waiting, try again on the next read.
+		_refill_pending.store(false, std::memory_order_release);
+		return;
+	}
+	_worker_semaphore->post();
+}
+
+// Worker side.
+
+void SiOPMWaveSamplerReader::_refill_generation() {
+	if (_generation.load(std::memory_order_acquire) != _worker_generation) {
+		while (_request_lock.test_and_set(std::memory_order_acquire)) {
+			// Spin.
+		}
+
+		_worker_generation = _generation.load(std::memory_order_relaxed);
+		_worker_active = _requested_active;
+		_file_position = _requested_position;
+
+		_request_lock.clear(std::memory_order_release);
+
+		_worker_write_count = 0;
+		_worker_finished = false;
+
+		if (!_worker_active) {
+			// Playback has stopped, let go of the file.
+			_file = Ref<FileAccess>();
+			return;
+		}
+
+		if (_file.is_null()) {
+			_file = FileAccess::open(_owner->get_file_path(), FileAccess::READ);
+		}
+
+		if (_file.is_null()) {
+			_worker_finished = true;
+			_write_state.store(_pack_write_state(_worker_generation, true, 0), std::memory_order_release);
+			return;
+		}
+	}
+
+	if (!_worker_active || _worker_finished) {
+		return;
+	}
+
+	const int channel_count = _owner->get_channel_count();
+	uint32_t free_frames = RING_FRAMES - (_worker_write_count - _read_count.load(std::memory_order_acquire));
+
+	while (free_frames > 0) {
+		const int end_point = _owner->get_end_point();
+		if (_file_position >= end_point) {
+			const int loop_point = _owner->get_loop_point();
+			if (loop_point < 0) {
+				_worker_finished = true;
+				break;
+			}
+
+			const int start_point = _owner->get_start_point();
+			_file_position = (loop_point > start_point ? loop_point : start_point);
+		}
+
+		// Chunks never wrap around the ring.
+		const int ring_offset = _worker_write_count & RING_FILTER;
+		int frames = MIN((int)free_frames, READ_CHUNK_FRAMES);
+		frames = MIN(frames, end_point - _file_position);
+		frames = MIN(frames, RING_FRAMES - ring_offset);
+
+		const int read_frames = _owner->read_file_frames(_file, _file_position, frames, _ring_ptr + ring_offset * channel_count);
+		if (read_frames <= 0) {
+			// The file is shorter than expected, or the loop is empty.
+			_worker_finished = true;
+			break;
+		}
+
+		_file_position += read_frames;
+		_worker_write_count += read_frames;
+		free_frames -= read_frames;
+		_write_state.store(_pack_write_state(_worker_generation, false, _worker_write_count), std::memory_order_release);
+
+		if (_generation.load(std::memory_order_acquire) != _worker_generation) {
+			return; // Nobody needs this anymore.
+		}
+	}
+
+	_write_state.store(_pack_write_state(_worker_generation, _worker_finished, _worker_write_count), std::memory_order_release);
+}
+
+void SiOPMWaveSamplerReader::_refill() {
+	while (true) {
+		_refill_generation();
+
+		// Start over if another playback has been requested meanwhile.
+		if (_generation.load(std::memory_order_acquire) == _worker_generation) {
+			break;
+		}
+	}
+
+	// This is the last time the worker touches the reader, see release().
+	_refill_pending.store(false, std::memory_order_release);
+}
+
+// Audio side.
+
+void SiOPMWaveSamplerReader::start(int p_position) {
+	ERR_FAIL_NULL(_owner);
+
+	_active = true;
+	_channel_count = _owner->get_channel_count();
+
+	// Play from memory while the worker catches up.
+	_head_position = MAX(0, p_position);
+	_head_end = MIN(_owner->get_head_length(), _owner->get_end_point());
+	if (_head_position >= _head_end) {
+		_head_end = _head_position;
+	}
+
+	_read_count.store(0, std::memory_order_release);
+	_set_request(true, _head_end);
+	_request_refill();
+}
+
+void SiOPMWaveSamplerReader::stop() {
+	if (!_active) {
+		return;
+	}
+
+	_active = false;
+	_head_position = 0;
+	_head_end = 0;
+
+	_set_request(false, 0);
+	_request_refill();
+}
+
+int SiOPMWaveSamplerReader::read(double *r_buffer, int p_frames) {
+	if (!_active) {
+		return 0;
+	}
+
+	int written = 0;
+
+	if (_head_position < _head_end) {
+		const int frames = MIN(p_frames, _head_end - _head_position);
+		if (r_buffer) {
+			_owner->read_frames(_head_position, frames, r_buffer);
+		}
+
+		_head_position += frames;
+		written += frames;
+	}
+
+	if (written == p_frames) {
+		return written;
+	}
+
+	const uint64_t write_state = _write_state.load(std::memory_order_acquire);
+	const uint32_t read_count = _read_count.load(std::memory_order_relaxed);
+	uint32_t available = 0;
+	bool finished = false;
+	if ((uint32_t)(write_state >> 33) == _generation.load(std::memory_order_relaxed)) {
+		available = (uint32_t)write_state - read_count;
+		finished = ((write_state >> 32) & 1) != 0;
+	}
+
+	const int frames = MIN((uint32_t)(p_frames - written), available);
+	uint32_t position = read_count;
+	int remaining = frames;
+	while (remaining > 0) {
+		const int ring_offset = position & RING_FILTER;
+		const int chunk = MIN(remaining, RING_FRAMES - ring_offset);
+		if (r_buffer) {
+			memcpy(r_buffer + written * _channel_count, _ring_ptr + ring_offset * _channel_count, sizeof(double) * chunk * _channel_count);
+		}
+
+		position += chunk;
+		written += chunk;
+		remaining -= chunk;
+	}
+	_read_count.store(position, std::memory_order_release);
+
+	if (written < p_frames) {
+		if (finished) {
+			return written;
+		}
+
+		// The worker is late, fill the gap with silence and carry on.
+		if (r_buffer) {
+			memset(r_buffer + written * _channel_count, 0, sizeof(double) * (p_frames - written) * _channel_count);
+		}
+		written = p_frames;
+		_underrun_count++;
+	}
+
+	if (!finished && (available - frames) < (RING_FRAMES >> 1)) {
+		_request_refill();
+	}
+
+	return written;
+}
+
+void SiOPMWaveSamplerReader::release() {
+	_active = false;
+
+	// The worker may still hold a pointer to this reader.
+	while (_refill_pending.load(std::memory_order_acquire)) {
+		std::this_thread::yield();
+	}
+
+	_file = Ref<FileAccess>();
+	_owner = nullptr;
+}
+
+SiOPMWaveSamplerReader::SiOPMWaveSamplerReader(SiOPMWaveSamplerData *p_owner) {
+	_owner = p_owner;
+
+	// Large enough for stereo, so it never has to be reallocated while the worker is running.
+	_ring.resize(RING_FRAMES * 2);
+	_ring.fill(0);
+	_ring_ptr = _ring.ptrw();
+
+	_generation.store(0);
+	_write_state.store(0);
+	_read_count.store(0);
+	_refill_pending.store(false);
+
+	if (_owner) {
+		_start_worker();
+	}
+}
@@ -0,0 +1,119 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SIOPM_WAVE_SAMPLER_READER_H
+#define SIOPM_WAVE_SAMPLER_READER_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/semaphore.hpp>
+#include <godot_cpp/classes/thread.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include "templates/mpsc_ring_buffer.h"
+
+using namespace godot;
+
+class SiOPMWaveSamplerData;
+
+// Playback cursor for a sample streamed from a file. The head of the sample is played from memory,
+// while the rest is read ahead into a small ring by a worker thread. The audio thread never touches
+// the file, and memory use doesn't depend on the length of the sample.
+// Readers are created together with the sample and are owned by it, see SiOPMWaveSamplerData::acquire_stream_reader().
+class SiOPMWaveSamplerReader : public RefCounted {
+	GDCLASS(SiOPMWaveSamplerReader, RefCounted)
+
+	static const int RING_BITS = 14;
+	static const int RING_FRAMES = 1 << RING_BITS;
+	static const int RING_FILTER = RING_FRAMES - 1;
+	// Largest amount of frames read from the file at once.
+	static const int READ_CHUNK_FRAMES = 4096;
+
+	// One persistent worker refills every reader. Readers which run low are queued, and the worker is
+	// woken up by the semaphore, so requesting a refill never allocates.
+	static const int REFILL_QUEUE_SIZE = 1024;
+
+	static MPSCRingBuffer<SiOPMWaveSamplerReader *> *_refill_queue;
+	static Ref<Semaphore> _worker_semaphore;
+	static Ref<Thread> _worker_thread;
+	static std::atomic<bool> _worker_exit;
+	static std::mutex _worker_lock;
+
+	static void _start_worker();
+	static void _run_worker();
+
+	// The sample which owns this reader and outlives it.
+	SiOPMWaveSamplerData *_owner = nullptr;
+
+	// Shared between threads.
+
+	Vector<double> _ring;
+	double *_ring_ptr = nullptr;
+
+	// Each playback has its own generation, so the worker can tell that the request has changed.
+	// The request itself is guarded by a spin lock, which is only ever held for a couple of assignments.
+	std::atomic_flag _request_lock = ATOMIC_FLAG_INIT;
+	std::atomic<uint32_t> _generation;
+	bool _requested_active = false;
+	int _requested_position = 0;
+	// Generation, end of sample flag, and the total amount of frames written, published together.
+	std::atomic<uint64_t> _write_state;
+	std::atomic<uint32_t> _read_count;
+	// Set while the reader is queued for the worker, or is being refilled.
+	std::atomic<bool> _refill_pending;
+
+	// Audio thread only.
+
+	bool _active = false;
+	int _channel_count = 0;
+	int _head_position = 0;
+	int _head_end = 0;
+	int _underrun_count = 0;
+
+	// Worker only.
+
+	Ref<FileAccess> _file;
+	uint32_t _worker_generation = 0;
+	uint32_t _worker_write_count = 0;
+	int _file_position = 0;
+	bool _worker_active = false;
+	bool _worker_finished = false;
+
+	static uint64_t _pack_write_state(uint32_t p_generation, bool p_finished, uint32_t p_write_count);
+	void _set_request(bool p_active, int p_position);
+	void _request_refill();
+	void _refill_generation();
+	void _refill();
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	// The worker is started by the first reader, and is stopped when the module is unloaded.
+	static void finalize();
+
+	SiOPMWaveSamplerData *get_owner() const { return _owner; }
+	bool is_active() const { return _active; }
+	int get_underrun_count() const { return _underrun_count; }
+
+	// Called from the audio thread.
+
+	void start(int p_position);
+	void stop();
+	// Writes up to the requested amount of frames, or skips them if the buffer is null. Missing data is
+	// replaced with silence. Returns less than requested only when the end of the sample is reached.
+	int read(double *r_buffer, int p_frames);
+
+	// Waits for the pending refill and releases the file. Called by the owner before it is freed.
+	void release();
+
+	SiOPMWaveSamplerReader(SiOPMWaveSamplerData *p_owner = nullptr);
+	~SiOPMWaveSamplerReader() {}
+};
+
+#endif // SIOPM_WAVE_SAMPLER_READER_H
@@ -0,0 +1,200 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "siopm_wave_sampler_resampler.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+
+// Taps are stored as floats, so four of them fit into one 128-bit register.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIOPM_RESAMPLER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIOPM_RESAMPLER_NEON
+#include <arm_neon.h>
+#endif
+
+const double SiOPMWaveSamplerResampler::MAX_RATE = 4.0;
+const double SiOPMWaveSamplerResampler::MIN_RATE = 0.0625;
+const double SiOPMWaveSamplerResampler::BAND_RATES[BAND_COUNT] = { 1.0, 1.5, 2.0, 3.0, 4.0 };
+
+Vector<float> SiOPMWaveSamplerResampler::_kernels[SAMPLER_QUALITY_MAX][BAND_COUNT];
+
+int SiOPMWaveSamplerResampler::get_tap_count(SiONSamplerQuality p_quality) {
+	switch (p_quality) {
+		case SAMPLER_QUALITY_LINEAR:
+			return 2;
+		case SAMPLER_QUALITY_MEDIUM:
+			return 8;
+		case SAMPLER_QUALITY_HIGH:
+			return 32;
+		default:
+			return 2;
+	}
+}
+
+void SiOPMWaveSamplerResampler::_make_kernel(Vector<float> *r_kernel, int p_tap_count, double p_cutoff) {
+	r_kernel->resize((PHASE_COUNT + 1) * p_tap_count);
+	float *kernel_ptr = r_kernel->ptrw();
+
+	const int latency = (p_tap_count >> 1) - 1;
+	const double half_width = p_tap_count * 0.5;
+
+	for (int phase = 0; phase <= PHASE_COUNT; phase++) {
+		const double fraction = (double)phase / PHASE_COUNT;
+		float *row = kernel_ptr + phase * p_tap_count;
+
+		double sum = 0;
+		for (int k = 0; k < p_tap_count; k++) {
+			// Distance from the interpolated point, in source frames.
+			const double x = (k - latency) - fraction;
+
+			double value = 0;
+			if (p_tap_count == 2) {
+				value = 1.0 - Math::abs(x);
+			} else {
+				const double t = Math_PI * p_cutoff * x;
+				const double sinc = (Math::abs(t) < 1e-9 ? 1.0 : Math::sin(t) / t);
+				// Blackman window.
+				const double w = Math_PI * x / half_width;
+				const double window = 0.42 + 0.5 * Math::cos(w) + 0.08 * Math::cos(2 * w);
+
+				value = p_cutoff * sinc * window;
+			}
+
+			row[k] = (float)value;
+			sum += value;
+		}
+
+		// Keep the gain at exactly 1 for every phase.
+		if (sum != 0) {
+			for (int k = 0; k < p_tap_count; k++) {
+				row[k] = (float)(row[k] / sum);
+			}
+		}
+	}
+}
+
+void SiOPMWaveSamplerResampler::initialize() {
+	for (int quality = 0; quality < SAMPLER_QUALITY_MAX; quality++) {
+		const int tap_count = get_tap_count((SiONSamplerQuality)quality);
+
+		for (int band = 0; band < BAND_COUNT; band++) {
+			// Linear interpolation cannot be band-limited, so all its bands are the same.
+			const double cutoff = (tap_count == 2 ? 1.0 : 1.0 / BAND_RATES[band]);
+			_make_kernel(&_kernels[quality][band], tap_count, cutoff);
+		}
+	}
+}
+
+void SiOPMWaveSamplerResampler::finalize() {
+	for (int quality = 0; quality < SAMPLER_QUALITY_MAX; quality++) {
+		for (int band = 0; band < BAND_COUNT; band++) {
+			_kernels[quality][band].clear();
+		}
+	}
+}
+
+int SiOPMWaveSamplerResampler::_get_band(double p_rate) {
+	for (int band = 0; band < BAND_COUNT - 1; band++) {
+		if (p_rate <= BAND_RATES[band]) {
+			return band;
+		}
+	}
+
+	return BAND_COUNT - 1;
+}
+
+static inline float _dot_product(const float *p_taps, const float *p_source, int p_tap_count) {
+#if defined(SIOPM_RESAMPLER_SSE2)
+	__m128 sum = _mm_setzero_ps();
+	for (int k = 0; k < p_tap_count; k += 4) {
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(p_taps + k), _mm_loadu_ps(p_source + k)));
+	}
+
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+	return _mm_cvtss_f32(sum);
+
+#elif defined(SIOPM_RESAMPLER_NEON)
+	float32x4_t sum = vdupq_n_f32(0);
+	for (int k = 0; k < p_tap_count; k += 4) {
+		sum = vmlaq_f32(sum, vld1q_f32(p_taps + k), vld1q_f32(p_source + k));
+	}
+
+	return vaddvq_f32(sum);
+
+#else
+	float sum = 0;
+	for (int k = 0; k < p_tap_count; k++) {
+		sum += p_taps[k] * p_source[k];
+	}
+
+	return sum;
+#endif
+}
+
+void SiOPMWaveSamplerResampler::process(SiONSamplerQuality p_quality, const float *p_source, uint64_t p_position, uint64_t p_step, int p_frames, double *r_output, int p_output_stride) {
+	ERR_FAIL_INDEX(p_quality, SAMPLER_QUALITY_MAX);
+
+	const int tap_count = get_tap_count(p_quality);
+	const int band = _get_band((double)p_step / FRACTION_ONE);
+	const float *kernel_ptr = _kernels[p_quality][band].ptr();
+	ERR_FAIL_NULL_MSG(kernel_ptr, "SiOPMWaveSamplerResampler: Kernels are not initialized.");
+
+	uint64_t position = p_position;
+	double *output = r_output;
+
+	switch (p_quality) {
+		case SAMPLER_QUALITY_LINEAR: {
+			const double fraction_scale = 1.0 / FRACTION_ONE;
+
+			for (int i = 0; i < p_frames; i++) {
+				const float *source = p_source + (position >> FRACTION_BITS);
+				const double fraction = (position & (FRACTION_ONE - 1)) * fraction_scale;
+
+				*output = source[0] + (source[1] - source[0]) * fraction;
+				output += p_output_stride;
+				position += p_step;
+			}
+		} break;
+
+		case SAMPLER_QUALITY_MEDIUM: {
+			for (int i = 0; i < p_frames; i++) {
+				const float *source = p_source + (position >> FRACTION_BITS);
+				const int phase = (int)((position & (FRACTION_ONE - 1)) >> (FRACTION_BITS - PHASE_BITS));
+
+				*output = _dot_product(kernel_ptr + phase * tap_count, source, tap_count);
+				output += p_output_stride;
+				position += p_step;
+			}
+		} break;
+
+		case SAMPLER_QUALITY_HIGH: {
+			const int sub_phase_bits = FRACTION_BITS - PHASE_BITS;
+			const double sub_phase_scale = 1.0 / ((uint64_t)1 << sub_phase_bits);
+
+			for (int i = 0; i < p_frames; i++) {
+				const float *source = p_source + (position >> FRACTION_BITS);
+				const uint64_t fraction = position & (FRACTION_ONE - 1);
+				const int phase = (int)(fraction >> sub_phase_bits);
+				const double sub_phase = (fraction & (((uint64_t)1 << sub_phase_bits) - 1)) * sub_phase_scale;
+
+				const float *taps = kernel_ptr + phase * tap_count;
+				const double value0 = _dot_product(taps, source, tap_count);
+				const double value1 = _dot_product(taps + tap_count, source, tap_count);
+
+				*output = value0 + (value1 - value0) * sub_phase;
+				output += p_output_stride;
+				position += p_step;
+			}
+		} break;
+
+		default:
+			break;
+	}
+}
@@ -0,0 +1,59 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SIOPM_WAVE_SAMPLER_RESAMPLER_H
+#define SIOPM_WAVE_SAMPLER_RESAMPLER_H
+
+#include <cstdint>
+#include <godot_cpp/templates/vector.hpp>
+#include "sion_enums.h"
+
+using namespace godot;
+
+// Polyphase resampler for pitched sampler playback. Kernels are precomputed once for every
+// quality tier, so the cost per output frame is fixed by the tap count and doesn't depend on
+// the playback rate.
+class SiOPMWaveSamplerResampler {
+public:
+	// Positions and steps are fixed point numbers of source frames.
+	static const int FRACTION_BITS = 32;
+	static const uint64_t FRACTION_ONE = (uint64_t)1 << FRACTION_BITS;
+	static const int MAX_TAP_COUNT = 32;
+	// Rates above this are clamped, which bounds both the kernel bandwidth and the amount of source read.
+	static const double MAX_RATE;
+	static const double MIN_RATE;
+
+private:
+	static const int PHASE_BITS = 8;
+	static const int PHASE_COUNT = 1 << PHASE_BITS;
+
+	// Pitching up requires a lower cutoff to avoid aliasing, so each tier has kernels for several
+	// rate bands. Each band covers rates up to its value.
+	static const int BAND_COUNT = 5;
+	static const double BAND_RATES[BAND_COUNT];
+
+	// PHASE_COUNT + 1 rows of taps per kernel. The last row is the first one shifted by a frame,
+	// so neighboring phases can always be interpolated.
+	static Vector<float> _kernels[SAMPLER_QUALITY_MAX][BAND_COUNT];
+
+	static void _make_kernel(Vector<float> *r_kernel, int p_tap_count, double p_cutoff);
+	static int _get_band(double p_rate);
+
+public:
+	static void initialize();
+	static void finalize();
+
+	static int get_tap_count(SiONSamplerQuality p_quality);
+	// Number of source frames in front of the frame at the playback position.
+	static int get_latency(SiONSamplerQuality p_quality) { return (get_tap_count(p_quality) >> 1) - 1; }
+
+	// Renders frames from a single channel of planar source data. For each output frame, taps are
+	// read starting at the integer part of the position, which is then advanced by the step.
+	// Output is written with the given stride, so channels can be interleaved.
+	static void process(SiONSamplerQuality p_quality, const float *p_source, uint64_t p_position, uint64_t p_step, int p_frames, double *r_output, int p_output_stride);
+};
+
+#endif // SIOPM_WAVE_SAMPLER_RESAMPLER_H
@@ -26,12 +26,8 @@ void SiOPMWaveTable::initialize(Vector<int> p_wavelet, SiONPitchTableType p_defa
 void SiOPMWaveTable::copy_from(const Ref<SiOPMWaveTable> &p_source) {
 	_fixed_bits = p_source->_fixed_bits;
 	_default_pitch_table_type = p_source->_default_pitch_table_type;
-	_wavelet.clear();
-
-	int wavelet_size = p_source->_wavelet.size();
-	for (int i = 0; i < wavelet_size; i++) {
-		_wavelet.append(p_source->_wavelet[i]);
-	}
+	// Wavelets are never modified in place, so the data can be shared.
+	_wavelet = p_source->_wavelet;
 }
 
 SiOPMWaveTable::SiOPMWaveTable(Vector<int> p_wavelet, SiONPitchTableType p_default_pitch_table_type) :
@@ -29,6 +29,8 @@ public:
 	int get_fixed_bits() const { return _fixed_bits; }
 	SiONPitchTableType get_default_pitch_table_type() const { return _default_pitch_table_type; }
 
+	virtual int64_t get_memory_usage() const override { return _wavelet.size() * sizeof(int); }
+
 	//
 
 	void initialize(Vector<int> p_wavelet, SiONPitchTableType p_default_pt_type = SiONPitchTableType::PITCH_TABLE_OPM);
@@ -6,8 +6,10 @@
 
 #include "si_effect_autopan.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiEffectAutopan::set_params(double p_frequency, double p_stereo_width) {
-	_lfo_step = (int)(172.265625 / (p_frequency * 0.5)); // 44100/256
+	_lfo_step = (int)(SiOPMRefTable::get_instance()->sampling_rate / 256.0 / (p_frequency * 0.5));
 	if (_lfo_step <= 4) {
 		_lfo_step = 4;
 	}
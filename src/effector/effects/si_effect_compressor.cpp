@@ -6,10 +6,13 @@
 
 #include "si_effect_compressor.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiEffectCompressor::set_params(double p_threshold, double p_window_time, double p_attack_time, double p_release_time, double p_max_gain, double p_mixing_level) {
 	_threshold_squared = p_threshold * p_threshold;
 
-	_window_samples = (int)(p_window_time * 44.1);
+	const double samples_per_ms = SiOPMRefTable::get_instance()->sampling_rate * 0.001;
+	_window_samples = (int)(p_window_time * samples_per_ms);
 	_window_rms_averaging = 1.0 / _window_samples;
 
 	if (_window_rms_list) {
@@ -19,12 +22,12 @@ void SiEffectCompressor::set_params(double p_threshold, double p_window_time, do
 
 	_attack_rate = 0.5;
 	if (p_attack_time != 0) {
-		_attack_rate = Math::pow(2, -1.0 / (p_attack_time * 44.1));
+		_attack_rate = Math::pow(2, -1.0 / (p_attack_time * samples_per_ms));
 	}
 
 	_release_rate = 2.0;
 	if (p_release_time != 0) {
-		_release_rate = Math::pow(2, 1.0 / (p_release_time * 44.1));
+		_release_rate = Math::pow(2, 1.0 / (p_release_time * samples_per_ms));
 	}
 
 	_max_gain = Math::pow(2, -p_max_gain / 6.0);
@@ -0,0 +1,296 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "si_effect_convolution_reverb.h"
+
+#include <cstring>
+#include <godot_cpp/classes/audio_server.hpp>
+#include "chip/siopm_ref_table.h"
+
+HashMap<int, Ref<AudioStreamWAV>> SiEffectConvolutionReverb::_impulse_presets;
+
+void SiEffectConvolutionReverb::set_impulse_preset(int p_index, const Ref<AudioStreamWAV> &p_stream) {
+	if (p_stream.is_null()) {
+		_impulse_presets.erase(p_index);
+		return;
+	}
+
+	_impulse_presets[p_index] = p_stream;
+}
+
+Ref<AudioStreamWAV> SiEffectConvolutionReverb::get_impulse_preset(int p_index) {
+	if (!_impulse_presets.has(p_index)) {
+		return Ref<AudioStreamWAV>();
+	}
+
+	return _impulse_presets[p_index];
+}
+
+void SiEffectConvolutionReverb::finalize() {
+	_impulse_presets.clear();
+}
+
+Vector<double> SiEffectConvolutionReverb::_extract_impulse(const Ref<AudioStreamWAV> &p_stream, int p_channel) const {
+	const int channel_count = p_stream->is_stereo() ? 2 : 1;
+	const bool is_16_bits = p_stream->get_format() == AudioStreamWAV::FORMAT_16_BITS;
+	const PackedByteArray wav_data = p_stream->get_data();
+	const int frame_count = wav_data.size() / (channel_count * (is_16_bits ? 2 : 1));
+
+	Vector<double> raw_data;
+	raw_data.resize(frame_count);
+	double *raw_ptr = raw_data.ptrw();
+	for (int i = 0; i < frame_count; i++) {
+		const int index = i * channel_count + p_channel;
+		if (is_16_bits) {
+			raw_ptr[i] = wav_data.decode_s16(index * 2) / 32767.0; // Max int16.
+		} else {
+			raw_ptr[i] = wav_data.decode_s8(index) / 127.0; // Max int8.
+		}
+	}
+
+	// Responses recorded at a different rate are resampled linearly to the engine rate.
+	const int sampling_rate = SiOPMRefTable::get_instance()->sampling_rate;
+	const int max_length = MAX_IMPULSE_SECONDS * sampling_rate;
+	const double ratio = p_stream->get_mix_rate() / (double)sampling_rate;
+	if (ratio <= 0 || ratio == 1) {
+		if (raw_data.size() > max_length) {
+			raw_data.resize(max_length);
+		}
+		return raw_data;
+	}
+
+	const int length = MIN((int)(frame_count / ratio), max_length);
+	Vector<double> impulse;
+	impulse.resize(length);
+	double *impulse_ptr = impulse.ptrw();
+	for (int i = 0; i < length; i++) {
+		const double position = i * ratio;
+		const int index = (int)position;
+		const double next = (index + 1 < frame_count) ? raw_ptr[index + 1] : 0;
+		impulse_ptr[i] = raw_ptr[index] + (next - raw_ptr[index]) * (position - index);
+	}
+
+	return impulse;
+}
+
+Vector<double> SiEffectConvolutionReverb::_make_partitions(const Vector<double> &p_impulse, int p_partition_count) const {
+	const int spectrum_size = _fft.get_spectrum_size();
+	const int length = p_impulse.size();
+
+	Vector<double> partitions;
+	partitions.resize(p_partition_count * spectrum_size);
+	partitions.fill(0);
+
+	double *partitions_ptr = partitions.ptrw();
+	for (int i = 0; i < p_partition_count; i++) {
+		double *spectrum = partitions_ptr + i * spectrum_size;
+
+		// Only the first half is filled, the rest is padding for the linear convolution.
+		const int offset = i * BLOCK_SIZE;
+		const int count = MIN(BLOCK_SIZE, length - offset);
+		memcpy(spectrum, p_impulse.ptr() + offset, sizeof(double) * count);
+
+		_fft.forward(spectrum);
+	}
+
+	return partitions;
+}
+
+void SiEffectConvolutionReverb::set_impulse_response(const Ref<AudioStreamWAV> &p_stream) {
+	Vector<double> impulse_left;
+	Vector<double> impulse_right;
+
+	if (p_stream.is_valid()) {
+		AudioStreamWAV::Format data_format = p_stream->get_format();
+		ERR_FAIL_COND_MSG(data_format != AudioStreamWAV::FORMAT_8_BITS && data_format != AudioStreamWAV::FORMAT_16_BITS, vformat("SiEffectConvolutionReverb: Unsupported WAV file format (%d).", data_format));
+
+		impulse_left = _extract_impulse(p_stream, 0);
+		impulse_right = p_stream->is_stereo() ? _extract_impulse(p_stream, 1) : impulse_left;
+	}
+
+	// Normalize to unit energy, so the wet signal is roughly as loud as the dry one.
+	// Both channels are scaled by the same factor to preserve the balance.
+	double energy = 0;
+	for (int c = 0; c < 2; c++) {
+		const Vector<double> &impulse = (c == 0 ? impulse_left : impulse_right);
+		double channel_energy = 0;
+		for (int i = 0; i < impulse.size(); i++) {
+			channel_energy += impulse[i] * impulse[i];
+		}
+		energy = MAX(energy, channel_energy);
+	}
+
+	const int impulse_length = impulse_left.size();
+	const int partition_count = (energy > 0) ? (impulse_length + BLOCK_SIZE - 1) / BLOCK_SIZE : 0;
+
+	Vector<double> partitions_left;
+	Vector<double> partitions_right;
+	if (partition_count > 0) {
+		const double scale = 1.0 / Math::sqrt(energy);
+		double *left_ptr = impulse_left.ptrw();
+		for (int i = 0; i < impulse_left.size(); i++) {
+			left_ptr[i] *= scale;
+		}
+
+		partitions_left = _make_partitions(impulse_left, partition_count);
+
+		if (p_stream->is_stereo()) {
+			double *right_ptr = impulse_right.ptrw();
+			for (int i = 0; i < impulse_right.size(); i++) {
+				right_ptr[i] *= scale;
+			}
+
+			partitions_right = _make_partitions(impulse_right, partition_count);
+		} else {
+			partitions_right = partitions_left;
+		}
+	}
+
+	// The effect may be processed on the audio thread, which holds the audio server lock while mixing.
+	AudioServer::get_singleton()->lock();
+	_channels[0].partitions = partitions_left;
+	_channels[1].partitions = partitions_right;
+	_partition_count = partition_count;
+	_impulse_length = (partition_count > 0 ? impulse_length : 0);
+	_clear_buffers();
+	AudioServer::get_singleton()->unlock();
+}
+
+void SiEffectConvolutionReverb::set_params(double p_wet) {
+	_wet = CLAMP(p_wet, 0, 1);
+}
+
+void SiEffectConvolutionReverb::_clear_buffers() {
+	const int spectrum_size = _fft.get_spectrum_size();
+
+	for (int c = 0; c < 2; c++) {
+		ChannelState &channel = _channels[c];
+
+		channel.history.resize(_partition_count * spectrum_size);
+		channel.history.fill(0);
+		channel.input.resize(FFT_SIZE);
+		channel.input.fill(0);
+		channel.output.resize(BLOCK_SIZE);
+		channel.output.fill(0);
+	}
+
+	_accumulator.resize(spectrum_size);
+	_history_position = 0;
+	_block_position = 0;
+}
+
+int SiEffectConvolutionReverb::prepare_process() {
+	_clear_buffers();
+
+	return 2;
+}
+
+void SiEffectConvolutionReverb::_process_block() {
+	const int spectrum_size = _fft.get_spectrum_size();
+	double *accumulator = _accumulator.ptrw();
+
+	for (int c = 0; c < 2; c++) {
+		ChannelState &channel = _channels[c];
+		double *history = channel.history.ptrw();
+		double *input = channel.input.ptrw();
+
+		// Transform the latest two blocks, and keep the spectrum for the following partitions.
+		double *current = history + _history_position * spectrum_size;
+		memcpy(current, input, sizeof(double) * FFT_SIZE);
+		_fft.forward(current);
+		memmove(input, input + BLOCK_SIZE, sizeof(double) * BLOCK_SIZE);
+
+		// Each partition of the response is applied to the input from as many blocks ago.
+		memset(accumulator, 0, sizeof(double) * spectrum_size);
+		const double *partitions = channel.partitions.ptr();
+		int slot = _history_position;
+
+		for (int i = 0; i < _partition_count; i++) {
+			const double *spectrum = history + slot * spectrum_size;
+			const double *response = partitions + i * spectrum_size;
+
+			for (int j = 0; j < spectrum_size; j += 2) {
+				accumulator[j]     += spectrum[j] * response[j]     - spectrum[j + 1] * response[j + 1];
+				accumulator[j + 1] += spectrum[j] * response[j + 1] + spectrum[j + 1] * response[j];
+			}
+
+			slot = (slot == 0 ? _partition_count : slot) - 1;
+		}
+
+		// Overlap-save: the first half is wrapped around, only the second one is valid.
+		_fft.inverse(accumulator);
+		memcpy(channel.output.ptrw(), accumulator + BLOCK_SIZE, sizeof(double) * BLOCK_SIZE);
+	}
+
+	_history_position = (_history_position + 1) % _partition_count;
+}
+
+int SiEffectConvolutionReverb::process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) {
+	if (_partition_count == 0) {
+		return p_channels;
+	}
+
+	double *buffer_ptr = r_buffer->ptrw() + (p_start_index << 1);
+	double *input_left = _channels[0].input.ptrw() + BLOCK_SIZE;
+	double *input_right = _channels[1].input.ptrw() + BLOCK_SIZE;
+	const double *output_left = _channels[0].output.ptr();
+	const double *output_right = _channels[1].output.ptr();
+
+	for (int i = 0; i < p_length; i++) {
+		double *frame = buffer_ptr + (i << 1);
+
+		input_left[_block_position] = frame[0];
+		input_right[_block_position] = frame[1];
+
+		frame[0] = frame[0] * (1 - _wet) + output_left[_block_position] * _wet;
+		frame[1] = frame[1] * (1 - _wet) + output_right[_block_position] * _wet;
+
+		_block_position++;
+		if (_block_position == BLOCK_SIZE) {
+			_process_block();
+			_block_position = 0;
+		}
+	}
+
+	// Stereo responses turn mono input into stereo.
+	return 2;
+}
+
+int SiEffectConvolutionReverb::get_tail_length() const {
+	if (_partition_count == 0) {
+		return 0;
+	}
+
+	// Output lags behind by one block.
+	return _impulse_length + BLOCK_SIZE;
+}
+
+void SiEffectConvolutionReverb::set_by_mml(Vector<double> p_args) {
+	int preset = _get_mml_arg(p_args, 0, 0);
+	double wet = _get_mml_arg(p_args, 1, 30) / 100.0;
+
+	set_impulse_response(get_impulse_preset(preset));
+	set_params(wet);
+}
+
+void SiEffectConvolutionReverb::reset() {
+	set_impulse_response(Ref<AudioStreamWAV>());
+	set_params();
+}
+
+void SiEffectConvolutionReverb::_bind_methods() {
+	ClassDB::bind_static_method("SiEffectConvolutionReverb", D_METHOD("set_impulse_preset", "index", "stream"), &SiEffectConvolutionReverb::set_impulse_preset);
+	ClassDB::bind_static_method("SiEffectConvolutionReverb", D_METHOD("get_impulse_preset", "index"), &SiEffectConvolutionReverb::get_impulse_preset);
+
+	ClassDB::bind_method(D_METHOD("set_impulse_response", "stream"), &SiEffectConvolutionReverb::set_impulse_response);
+	ClassDB::bind_method(D_METHOD("set_params", "wet"), &SiEffectConvolutionReverb::set_params, DEFVAL(0.3));
+}
+
+SiEffectConvolutionReverb::SiEffectConvolutionReverb(double p_wet) :
+		SiEffectBase() {
+	_clear_buffers();
+	set_params(p_wet);
+}
@@ -0,0 +1,84 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SI_EFFECT_CONVOLUTION_REVERB_H
+#define SI_EFFECT_CONVOLUTION_REVERB_H
+
+#include <godot_cpp/classes/audio_stream_wav.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include "effector/si_effect_base.h"
+#include "utils/fft_util.h"
+
+using namespace godot;
+
+// Convolves the signal with an impulse response, using uniformly partitioned overlap-save
+// convolution in the frequency domain. The impulse response is split into blocks, and each
+// processed block costs one forward and one inverse FFT, plus a multiply-add per partition.
+// Output is delayed by one block.
+class SiEffectConvolutionReverb : public SiEffectBase {
+	GDCLASS(SiEffectConvolutionReverb, SiEffectBase)
+
+	static const int BLOCK_SIZE = 256;
+	static const int FFT_SIZE = BLOCK_SIZE * 2;
+	// In seconds, at the engine rate.
+	static const int MAX_IMPULSE_SECONDS = 10;
+
+	// Impulse responses available to MML, by index.
+	static HashMap<int, Ref<AudioStreamWAV>> _impulse_presets;
+
+	struct ChannelState {
+		// Spectra of impulse response partitions, each FFT_SIZE + 2 values long.
+		Vector<double> partitions;
+		// Spectra of recent input blocks, in the same layout. Used as a ring.
+		Vector<double> history;
+		// Previous and current input blocks.
+		Vector<double> input;
+		// Output of the last processed block, consumed while the next one is collected.
+		Vector<double> output;
+	};
+
+	FFTUtil _fft = FFTUtil(FFT_SIZE);
+	Vector<double> _accumulator;
+
+	ChannelState _channels[2];
+	int _partition_count = 0;
+	int _impulse_length = 0;
+	int _history_position = 0;
+	int _block_position = 0;
+
+	double _wet = 0;
+
+	Vector<double> _extract_impulse(const Ref<AudioStreamWAV> &p_stream, int p_channel) const;
+	Vector<double> _make_partitions(const Vector<double> &p_impulse, int p_partition_count) const;
+	void _clear_buffers();
+	void _process_block();
+
+protected:
+	static void _bind_methods();
+
+public:
+	static void set_impulse_preset(int p_index, const Ref<AudioStreamWAV> &p_stream);
+	static Ref<AudioStreamWAV> get_impulse_preset(int p_index);
+	static void finalize();
+
+	void set_impulse_response(const Ref<AudioStreamWAV> &p_stream);
+	void set_params(double p_wet = 0.3);
+
+	//
+
+	virtual int prepare_process() override;
+	virtual int process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) override;
+	virtual int get_tail_length() const override;
+
+	virtual void set_by_mml(Vector<double> p_args) override;
+	virtual void reset() override;
+
+	SiEffectConvolutionReverb(double p_wet = 0.3);
+	~SiEffectConvolutionReverb() {}
+};
+
+#endif // SI_EFFECT_CONVOLUTION_REVERB_H
@@ -6,6 +6,8 @@
 
 #include "si_effect_distortion.h"
 
+#include "chip/siopm_ref_table.h"
+
 const double SiEffectDistortion::THRESHOLD = 0.0000152587890625;
 
 void SiEffectDistortion::set_params(double p_pre_gain, double p_post_gain, double p_lpf_frequency, double p_lpf_slope) {
@@ -16,7 +18,7 @@ void SiEffectDistortion::set_params(double p_pre_gain, double p_post_gain, doubl
 	if (_filter_enabled) {
 		// TODO: Pick better names for these variables.
 
-		double omg = p_lpf_frequency * 0.00014247585730565955; // 2*pi/44100
+		double omg = p_lpf_frequency * Math_TAU / SiOPMRefTable::get_instance()->sampling_rate;
 		double cos = Math::cos(omg);
 		double sin = Math::sin(omg);
 
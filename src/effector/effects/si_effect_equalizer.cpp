@@ -6,13 +6,16 @@
 
 #include "si_effect_equalizer.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiEffectEqualizer::set_params(double p_low_gain, double p_mid_gain, double p_high_gain, double p_low_frequency, double p_high_frequency) {
 	_low_gain = p_low_gain;
 	_mid_gain = p_mid_gain;
 	_high_gain = p_high_gain;
 
-	_low_frequency = 2.0 * Math::sin(p_low_frequency * 0.00007123792865282977); // 3.141592653589793 / 44100
-	_high_frequency = 2.0 * Math::sin(p_high_frequency * 0.00007123792865282977);
+	const double omg_scale = Math_PI / SiOPMRefTable::get_instance()->sampling_rate;
+	_low_frequency = 2.0 * Math::sin(p_low_frequency * omg_scale);
+	_high_frequency = 2.0 * Math::sin(p_high_frequency * omg_scale);
 }
 
 int SiEffectEqualizer::prepare_process() {
@@ -44,33 +47,30 @@ double SiEffectEqualizer::_process_channel(PipeChannel *p_channel, double p_valu
 		return value_low * _low_gain + value_mid * _mid_gain + value_high * _high_gain;
 }
 
-void SiEffectEqualizer::_process_mono(Vector<double> *r_buffer, int p_start_index, int p_length) {
-	for (int i = p_start_index; i < (p_start_index + p_length); i += 2) {
-		double value = _process_channel(&_left, (*r_buffer)[i]);
+void SiEffectEqualizer::_process_mono(double *r_buffer, int p_length) {
+	for (int i = 0; i < p_length; i += 2) {
+		double value = _process_channel(&_left, r_buffer[i]);
 
-		r_buffer->write[i] = value;
-		r_buffer->write[i + 1] = value;
+		r_buffer[i] = value;
+		r_buffer[i + 1] = value;
 	}
 }
 
-void SiEffectEqualizer::_process_stereo(Vector<double> *r_buffer, int p_start_index, int p_length) {
-	for (int i = p_start_index; i < (p_start_index + p_length); i += 2) {
-		double value_left = _process_channel(&_left, (*r_buffer)[i]);
-		r_buffer->write[i] = value_left;
-
-		double value_right = _process_channel(&_right, (*r_buffer)[i + 1]);
-		r_buffer->write[i + 1] = value_right;
+void SiEffectEqualizer::_process_stereo(double *r_buffer, int p_length) {
+	for (int i = 0; i < p_length; i += 2) {
+		r_buffer[i] = _process_channel(&_left, r_buffer[i]);
+		r_buffer[i + 1] = _process_channel(&_right, r_buffer[i + 1]);
 	}
 }
 
 int SiEffectEqualizer::process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) {
-	int start_index = p_start_index << 1;
+	double *buffer_ptr = r_buffer->ptrw() + (p_start_index << 1);
 	int length = p_length << 1;
 
 	if (p_channels == 1) {
-		_process_mono(r_buffer, start_index, length);
+		_process_mono(buffer_ptr, length);
 	} else {
-		_process_stereo(r_buffer, start_index, length);
+		_process_stereo(buffer_ptr, length);
 	}
 
 	return p_channels;
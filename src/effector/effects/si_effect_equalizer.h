@@ -57,8 +57,8 @@ class SiEffectEqualizer : public SiEffectBase {
 	double _high_gain = 0;
 
 	double _process_channel(PipeChannel *p_channel, double p_value);
-	void _process_mono(Vector<double> *r_buffer, int p_start_index, int p_length);
-	void _process_stereo(Vector<double> *r_buffer, int p_start_index, int p_length);
+	void _process_mono(double *r_buffer, int p_length);
+	void _process_stereo(double *r_buffer, int p_length);
 
 protected:
 	static void _bind_methods();
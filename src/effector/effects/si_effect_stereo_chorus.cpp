@@ -6,12 +6,16 @@
 
 #include "si_effect_stereo_chorus.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiEffectStereoChorus::set_params(double p_delay_time, double p_feedback, double p_frequency, double p_depth, double p_wet, bool p_invert_phase) {
 	ERR_FAIL_COND_MSG(p_delay_time == 0, "SiEffectStereoChorus: Delay cannot be zero.");
 	ERR_FAIL_COND_MSG(p_frequency == 0, "SiEffectStereoChorus: Frequency cannot be zero.");
 	ERR_FAIL_COND_MSG(p_depth == 0, "SiEffectStereoChorus: Depth cannot be zero.");
 
-	int offset = (int)(p_delay_time * 44.1);
+	const int sampling_rate = SiOPMRefTable::get_instance()->sampling_rate;
+
+	int offset = (int)(p_delay_time * sampling_rate * 0.001);
 	if (offset > DELAY_BUFFER_FILTER) {
 		offset = DELAY_BUFFER_FILTER;
 	}
@@ -27,8 +31,8 @@ void SiEffectStereoChorus::set_params(double p_delay_time, double p_feedback, do
 	}
 
 	int table_size = (int)(_depth * 6.283185307179586);
-	if ((table_size * p_frequency) > 11025) {
-		table_size = 11025 / p_frequency;
+	if ((table_size * p_frequency) > (sampling_rate >> 2)) {
+		table_size = (sampling_rate >> 2) / p_frequency;
 	}
 	_phase_table.resize_zeroed(table_size);
 
@@ -43,7 +47,7 @@ void SiEffectStereoChorus::set_params(double p_delay_time, double p_feedback, do
 		depth_value += depth_step;
 	}
 
-	_lfo_step = (int)(44100 / (table_size * p_frequency));
+	_lfo_step = (int)(sampling_rate / (table_size * p_frequency));
 	if (_lfo_step < 4) {
 		_lfo_step = 4;
 	}
@@ -112,6 +116,11 @@ int SiEffectStereoChorus::process(int p_channels, Vector<double> *r_buffer, int
 	return p_channels;
 }
 
+int SiEffectStereoChorus::get_tail_length() const {
+	const int delay = ((_pointer_write - _pointer_read) & DELAY_BUFFER_FILTER) + (int)Math::abs(_depth);
+	return _get_feedback_tail_length(delay, _feedback);
+}
+
 void SiEffectStereoChorus::set_by_mml(Vector<double> p_args) {
 	double delay_time = _get_mml_arg(p_args, 0, 20);
 	double feedback   = _get_mml_arg(p_args, 1, 20) / 100.0;
@@ -6,8 +6,10 @@
 
 #include "si_effect_stereo_delay.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiEffectStereoDelay::set_params(double p_delay_time, double p_feedback, bool p_cross, double p_wet) {
-	int offset = (int)(p_delay_time * 44.1);
+	int offset = (int)(p_delay_time * SiOPMRefTable::get_instance()->sampling_rate * 0.001);
 	if (offset > DELAY_BUFFER_FILTER) {
 		offset = DELAY_BUFFER_FILTER;
 	}
@@ -55,6 +57,11 @@ int SiEffectStereoDelay::process(int p_channels, Vector<double> *r_buffer, int p
 	return p_channels;
 }
 
+int SiEffectStereoDelay::get_tail_length() const {
+	const int delay = (_pointer_write - _pointer_read) & DELAY_BUFFER_FILTER;
+	return _get_feedback_tail_length(delay, _feedback);
+}
+
 void SiEffectStereoDelay::set_by_mml(Vector<double> p_args) {
 	double delay_time = _get_mml_arg(p_args, 0, 250);
 	double feedback   = _get_mml_arg(p_args, 1, 25) / 100.0;
@@ -56,6 +56,12 @@ int SiEffectStereoReverb::process(int p_channels, Vector<double> *r_buffer, int
 	return p_channels;
 }
 
+int SiEffectStereoReverb::get_tail_length() const {
+	// Taps share the feedback, so the signal fades at least as fast as with the longest tap alone.
+	const double feedback = Math::abs(_feedback0) + Math::abs(_feedback1) + Math::abs(_feedback2);
+	return _get_feedback_tail_length(DELAY_BUFFER_FILTER, feedback);
+}
+
 void SiEffectStereoReverb::set_by_mml(Vector<double> p_args) {
 	double delay1   = _get_mml_arg(p_args, 0, 70) / 100.0;
 	double delay2   = _get_mml_arg(p_args, 1, 40) / 100.0;
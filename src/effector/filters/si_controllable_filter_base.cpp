@@ -6,6 +6,7 @@
 
 #include "si_controllable_filter_base.h"
 
+#include "chip/siopm_ref_table.h"
 #include "sequencer/simml_envelope_table.h"
 #include "sequencer/simml_ref_table.h"
 
@@ -29,9 +30,10 @@ void SiControllableFilterBase::set_params(int p_cutoff, int p_resonance, double
 	_cutoff_index = (_cutoff_ptr ? _cutoff_ptr->value : 128);
 	_resonance = (_resonance_ptr ? _resonance_ptr->value * 0.007751937984496124 : 0); // 0.007751937984496124 = 1/129
 
-	_lfo_step = (int)(44100 / p_fps);
-	if (_lfo_step <= 44) {
-		_lfo_step = 44;
+	const int sampling_rate = SiOPMRefTable::get_instance()->sampling_rate;
+	_lfo_step = (int)(sampling_rate / p_fps);
+	if (_lfo_step <= sampling_rate / 1000) {
+		_lfo_step = sampling_rate / 1000;
 	}
 
 	_lfo_residue_step = _lfo_step << 1;
@@ -57,9 +59,40 @@ void SiControllableFilterBase::set_resonance(double p_value) {
 	_resonance = CLAMP(p_value, 0, 1);
 }
 
+void SiControllableFilterBase::set_ramp_time(double p_time) {
+	_ramp_time = MAX(0, p_time);
+	_ramp.set_length((int)(_ramp_time * SiOPMRefTable::get_instance()->sampling_rate * 0.001));
+}
+
+double SiControllableFilterBase::_get_cutoff_coefficient() const {
+	const double position = _ramp.get_values()[0];
+	const int index = (int)position;
+	const double *table = SiOPMRefTable::get_instance()->filter_cutoff_table;
+	if (index >= 128) {
+		return table[128];
+	}
+
+	return table[index] + (table[index + 1] - table[index]) * (position - index);
+}
+
+double SiControllableFilterBase::_get_feedback_coefficient() const {
+	const double position = _ramp.get_values()[0];
+	const int index = (int)position;
+	const double *table = SiOPMRefTable::get_instance()->filter_feedback_table;
+	const double resonance = _ramp.get_values()[1];
+	if (index >= 128) {
+		return resonance * table[128];
+	}
+
+	return resonance * (table[index] + (table[index + 1] - table[index]) * (position - index));
+}
+
 //
 
 int SiControllableFilterBase::prepare_process() {
+	const double target[2] = { _cutoff_index, _resonance };
+	_ramp.snap(target);
+
 	_lfo_residue_step = 0;
 	_p0_left = 0;
 	_p1_left = 0;
@@ -69,6 +102,22 @@ int SiControllableFilterBase::prepare_process() {
 	return 2;
 }
 
+void SiControllableFilterBase::_process_ramped(Vector<double> *r_buffer, int p_start_index, int p_length) {
+	const double target[2] = { _cutoff_index, _resonance };
+
+	int i = p_start_index;
+	const int max = p_start_index + p_length;
+	while (i < max) {
+		int length = max - i;
+		if (_ramp.advance(target)) {
+			length = MIN(length, SiParameterRamp<2>::BLOCK_SIZE << 1);
+		}
+
+		_process_lfo(r_buffer, i, length);
+		i += length;
+	}
+}
+
 int SiControllableFilterBase::process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) {
 	int start_index = p_start_index << 1;
 	int length = p_length << 1;
@@ -77,7 +126,7 @@ int SiControllableFilterBase::process(int p_channels, Vector<double> *r_buffer,
 	int max = start_index + length;
 	int i = start_index;
 	while (i < (max - step)) {
-		_process_lfo(r_buffer, i, step);
+		_process_ramped(r_buffer, i, step);
 
 		if (_cutoff_ptr) {
 			_cutoff_ptr = _cutoff_ptr->next();
@@ -93,7 +142,7 @@ int SiControllableFilterBase::process(int p_channels, Vector<double> *r_buffer,
 		step = _lfo_step << 1;
 	}
 
-	_process_lfo(r_buffer, i, max - i);
+	_process_ramped(r_buffer, i, max - i);
 	_lfo_residue_step = step - (max - i);
 
 	return p_channels;
@@ -114,8 +163,14 @@ void SiControllableFilterBase::reset() {
 void SiControllableFilterBase::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_params", "cutoff", "resonance", "fps"), &SiControllableFilterBase::set_params, DEFVAL(255), DEFVAL(255), DEFVAL(20));
 	ClassDB::bind_method(D_METHOD("set_params_manually", "cutoff", "resonance"), &SiControllableFilterBase::set_params_manually);
+
+	ClassDB::bind_method(D_METHOD("get_ramp_time"), &SiControllableFilterBase::get_ramp_time);
+	ClassDB::bind_method(D_METHOD("set_ramp_time", "time"), &SiControllableFilterBase::set_ramp_time);
+
+	ClassDB::add_property("SiControllableFilterBase", PropertyInfo(Variant::FLOAT, "ramp_time"), "set_ramp_time", "get_ramp_time");
 }
 
 SiControllableFilterBase::SiControllableFilterBase() :
 		SiEffectBase() {
+	set_ramp_time(5);
 }
@@ -9,6 +9,7 @@
 
 #include <godot_cpp/templates/vector.hpp>
 #include "effector/si_effect_base.h"
+#include "effector/si_parameter_ramp.h"
 #include "templates/singly_linked_list.h"
 
 class SiControllableFilterBase : public SiEffectBase {
@@ -22,6 +23,12 @@ class SiControllableFilterBase : public SiEffectBase {
 	int _lfo_step = 0;
 	int _lfo_residue_step = 0;
 
+	// Cutoff index and resonance in use. They follow the target values with a short ramp,
+	// so changes made from envelopes or scripts don't produce zipper noise.
+	SiParameterRamp<2> _ramp;
+	double _ramp_time = 0;
+
+	void _process_ramped(Vector<double> *r_buffer, int p_start_index, int p_length);
 	virtual void _process_lfo(Vector<double> *r_buffer, int p_start_index, int p_length) {}
 
 protected:
@@ -32,9 +39,14 @@ protected:
 	double _p0_left = 0;
 	double _p1_left = 0;
 
-	int _cutoff_index = 0;
+	// Target values. Cutoff index can be fractional, the tables are interpolated.
+	double _cutoff_index = 0;
 	double _resonance = 0;
 
+	// Coefficients for the current sub-block.
+	double _get_cutoff_coefficient() const;
+	double _get_feedback_coefficient() const;
+
 public:
 	void set_params(int p_cutoff = 255, int p_resonance = 255, double p_fps = 20);
 	void set_params_manually(double p_cutoff, double p_resonance);
@@ -45,6 +57,9 @@ public:
 	double get_resonance() const { return _resonance; }
 	void set_resonance(double p_value);
 
+	double get_ramp_time() const { return _ramp_time; }
+	void set_ramp_time(double p_time);
+
 	//
 
 	virtual int prepare_process() override;
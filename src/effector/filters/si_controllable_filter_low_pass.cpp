@@ -6,11 +6,9 @@
 
 #include "si_controllable_filter_low_pass.h"
 
-#include "chip/siopm_ref_table.h"
-
 void SiControllableFilterLowPass::_process_lfo(Vector<double> *r_buffer, int p_start_index, int p_length) {
-	double cutoff = SiOPMRefTable::get_instance()->filter_cutoff_table[_cutoff_index];
-	double feedback = _resonance * SiOPMRefTable::get_instance()->filter_feedback_table[_cutoff_index];
+	double cutoff = _get_cutoff_coefficient();
+	double feedback = _get_feedback_coefficient();
 
 	for (int i = p_start_index; i < (p_start_index + p_length); ) {
 		double value_left = (*r_buffer)[i];
@@ -6,10 +6,12 @@
 
 #include "si_filter_all_pass.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiFilterAllPass::set_params(double p_frequency, double p_band) {
 	// TODO: Pick better names for these variables.
 
-	double omg = p_frequency * 0.00014247585730565955; // 2*pi/44100
+	double omg = p_frequency * Math_TAU / SiOPMRefTable::get_instance()->sampling_rate;
 	double cos = Math::cos(omg);
 	double sin = Math::sin(omg);
 
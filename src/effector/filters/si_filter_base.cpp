@@ -6,47 +6,280 @@
 
 #include "si_filter_base.h"
 
+#include "chip/siopm_ref_table.h"
+
+// Both channels share coefficients, so a stereo pair fits into one 128-bit register.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SI_FILTER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SI_FILTER_NEON
+#include <arm_neon.h>
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(SI_FILTER_NEON)
+// Flush-to-zero bit of the floating-point control register. It is not set by default.
+static const uint64_t FPCR_FZ = (uint64_t)1 << 24;
+
+static inline uint64_t _get_fpcr() {
+#if defined(_MSC_VER)
+	return _ReadStatusReg(0x5A20); // ARM64_SYSREG(3, 3, 4, 4, 0), FPCR.
+#else
+	uint64_t fpcr;
+	__asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+	return fpcr;
+#endif
+}
+
+static inline void _set_fpcr(uint64_t p_fpcr) {
+#if defined(_MSC_VER)
+	_WriteStatusReg(0x5A20, p_fpcr);
+#else
+	__asm__ __volatile__("msr fpcr, %0" : : "r"(p_fpcr));
+#endif
+}
+#endif
+
 const double SiFilterBase::THRESHOLD = 0.0000152587890625;
 
+void SiFilterBase::StereoState::check_threshold() {
+	// Flush the feedback path once it decays below the 16-bit floor, long before it can
+	// turn into denormals and stall the pipeline.
+	for (int i = 0; i < 2; i++) {
+		if (Math::abs(out1[i]) < THRESHOLD && Math::abs(out2[i]) < THRESHOLD) {
+			out1[i] = 0;
+			out2[i] = 0;
+		}
+	}
+}
+
+void SiFilterBase::StereoState::clear() {
+	for (int i = 0; i < 2; i++) {
+		in1[i] = 0;
+		in2[i] = 0;
+		out1[i] = 0;
+		out2[i] = 0;
+	}
+}
+
+void SiFilterBase::set_ramp_time(double p_time) {
+	_ramp_time = MAX(0, p_time);
+	_coefficients.set_length((int)(_ramp_time * SiOPMRefTable::get_instance()->sampling_rate * 0.001));
+}
+
+void SiFilterBase::_get_target_coefficients(double *r_coefficients) const {
+	r_coefficients[0] = _a1;
+	r_coefficients[1] = _a2;
+	r_coefficients[2] = _b0;
+	r_coefficients[3] = _b1;
+	r_coefficients[4] = _b2;
+}
+
 int SiFilterBase::prepare_process() {
-	_left.clear();
-	_right.clear();
+	_state.clear();
+
+	// Nothing to glide from at the start.
+	double target[5];
+	_get_target_coefficients(target);
+	_coefficients.snap(target);
 
 	return 2;
 }
 
-double SiFilterBase::_process_channel(ChannelValues *p_channel, double p_input) {
-	double output = _b0 * p_input + _b1 * p_channel->in1 + _b2 * p_channel->in2 - _a1 * p_channel->out1 - _a2 * p_channel->out2;
-	output = CLAMP(output, -1, 1);
+void SiFilterBase::_process_mono(double *r_buffer, int p_length, const double *p_coefficients) {
+	const double a1 = p_coefficients[0];
+	const double a2 = p_coefficients[1];
+	const double b0 = p_coefficients[2];
+	const double b1 = p_coefficients[3];
+	const double b2 = p_coefficients[4];
+
+	double in1 = _state.in1[0];
+	double in2 = _state.in2[0];
+	double out1 = _state.out1[0];
+	double out2 = _state.out2[0];
+
+	for (int i = 0; i < p_length; i += 2) {
+		const double input = r_buffer[i];
+		double output = b0 * input + b1 * in1 + b2 * in2 - a1 * out1 - a2 * out2;
+		output = CLAMP(output, -1, 1);
+
+		in2 = in1;
+		in1 = input;
+		out2 = out1;
+		out1 = output;
+
+		r_buffer[i] = output;
+		r_buffer[i + 1] = output;
+	}
+
+	_state.in1[0] = in1;
+	_state.in2[0] = in2;
+	_state.out1[0] = out1;
+	_state.out2[0] = out2;
+}
+
+void SiFilterBase::_process_stereo(double *r_buffer, int p_length, const double *p_coefficients) {
+#if defined(SI_FILTER_SSE2)
+	// Treat denormals as zero for the duration of the loop (FTZ and DAZ bits).
+	const unsigned int csr = _mm_getcsr();
+	_mm_setcsr(csr | 0x8040);
+
+	const __m128d b0 = _mm_set1_pd(p_coefficients[2]);
+	const __m128d b1 = _mm_set1_pd(p_coefficients[3]);
+	const __m128d b2 = _mm_set1_pd(p_coefficients[4]);
+	const __m128d a1 = _mm_set1_pd(p_coefficients[0]);
+	const __m128d a2 = _mm_set1_pd(p_coefficients[1]);
+	const __m128d lower = _mm_set1_pd(-1.0);
+	const __m128d upper = _mm_set1_pd(1.0);
+
+	__m128d in1 = _mm_loadu_pd(_state.in1);
+	__m128d in2 = _mm_loadu_pd(_state.in2);
+	__m128d out1 = _mm_loadu_pd(_state.out1);
+	__m128d out2 = _mm_loadu_pd(_state.out2);
 
-	p_channel->in2  = p_channel->in1;
-	p_channel->in1  = p_input;
-	p_channel->out2 = p_channel->out1;
-	p_channel->out1 = output;
+	for (int i = 0; i < p_length; i += 2) {
+		const __m128d input = _mm_loadu_pd(r_buffer + i);
 
-	return output;
+		// Same order of operations as the scalar path, so the results are identical.
+		__m128d output = _mm_mul_pd(b0, input);
+		output = _mm_add_pd(output, _mm_mul_pd(b1, in1));
+		output = _mm_add_pd(output, _mm_mul_pd(b2, in2));
+		output = _mm_sub_pd(output, _mm_mul_pd(a1, out1));
+		output = _mm_sub_pd(output, _mm_mul_pd(a2, out2));
+		output = _mm_min_pd(_mm_max_pd(output, lower), upper);
+
+		in2 = in1;
+		in1 = input;
+		out2 = out1;
+		out1 = output;
+
+		_mm_storeu_pd(r_buffer + i, output);
+	}
+
+	_mm_storeu_pd(_state.in1, in1);
+	_mm_storeu_pd(_state.in2, in2);
+	_mm_storeu_pd(_state.out1, out1);
+	_mm_storeu_pd(_state.out2, out2);
+
+	_mm_setcsr(csr);
+
+#elif defined(SI_FILTER_NEON)
+	// Treat denormals as zero for the duration of the loop (FZ bit).
+	const uint64_t fpcr = _get_fpcr();
+	_set_fpcr(fpcr | FPCR_FZ);
+
+	const float64x2_t b0 = vdupq_n_f64(p_coefficients[2]);
+	const float64x2_t b1 = vdupq_n_f64(p_coefficients[3]);
+	const float64x2_t b2 = vdupq_n_f64(p_coefficients[4]);
+	const float64x2_t a1 = vdupq_n_f64(p_coefficients[0]);
+	const float64x2_t a2 = vdupq_n_f64(p_coefficients[1]);
+	const float64x2_t lower = vdupq_n_f64(-1.0);
+	const float64x2_t upper = vdupq_n_f64(1.0);
+
+	float64x2_t in1 = vld1q_f64(_state.in1);
+	float64x2_t in2 = vld1q_f64(_state.in2);
+	float64x2_t out1 = vld1q_f64(_state.out1);
+	float64x2_t out2 = vld1q_f64(_state.out2);
+
+	for (int i = 0; i < p_length; i += 2) {
+		const float64x2_t input = vld1q_f64(r_buffer + i);
+
+		// Fused multiply-adds are avoided on purpose, to match the scalar path.
+		float64x2_t output = vmulq_f64(b0, input);
+		output = vaddq_f64(output, vmulq_f64(b1, in1));
+		output = vaddq_f64(output, vmulq_f64(b2, in2));
+		output = vsubq_f64(output, vmulq_f64(a1, out1));
+		output = vsubq_f64(output, vmulq_f64(a2, out2));
+		output = vminq_f64(vmaxq_f64(output, lower), upper);
+
+		in2 = in1;
+		in1 = input;
+		out2 = out1;
+		out1 = output;
+
+		vst1q_f64(r_buffer + i, output);
+	}
+
+	vst1q_f64(_state.in1, in1);
+	vst1q_f64(_state.in2, in2);
+	vst1q_f64(_state.out1, out1);
+	vst1q_f64(_state.out2, out2);
+
+	_set_fpcr(fpcr);
+
+#else
+	const double a1 = p_coefficients[0];
+	const double a2 = p_coefficients[1];
+	const double b0 = p_coefficients[2];
+	const double b1 = p_coefficients[3];
+	const double b2 = p_coefficients[4];
+
+	double in1[2] = { _state.in1[0], _state.in1[1] };
+	double in2[2] = { _state.in2[0], _state.in2[1] };
+	double out1[2] = { _state.out1[0], _state.out1[1] };
+	double out2[2] = { _state.out2[0], _state.out2[1] };
+
+	for (int i = 0; i < p_length; i += 2) {
+		for (int c = 0; c < 2; c++) {
+			const double input = r_buffer[i + c];
+			double output = b0 * input + b1 * in1[c] + b2 * in2[c] - a1 * out1[c] - a2 * out2[c];
+			output = CLAMP(output, -1, 1);
+
+			in2[c] = in1[c];
+			in1[c] = input;
+			out2[c] = out1[c];
+			out1[c] = output;
+
+			r_buffer[i + c] = output;
+		}
+	}
+
+	for (int c = 0; c < 2; c++) {
+		_state.in1[c] = in1[c];
+		_state.in2[c] = in2[c];
+		_state.out1[c] = out1[c];
+		_state.out2[c] = out2[c];
+	}
+#endif
 }
 
 int SiFilterBase::process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) {
-	int start_index = p_start_index << 1;
-	int length = p_length << 1;
+	_state.check_threshold();
 
-	_left.check_threshold();
-	_right.check_threshold();
+	double target[5];
+	_get_target_coefficients(target);
 
-	if (p_channels == 2) {
-		for (int i = start_index; i < (start_index + length); i += 2) {
-			r_buffer->write[i] = _process_channel(&_left, (*r_buffer)[i]);
-			r_buffer->write[i + 1] = _process_channel(&_right, (*r_buffer)[i + 1]);
+	double *buffer_ptr = r_buffer->ptrw() + (p_start_index << 1);
+	int i = 0;
+	while (i < p_length) {
+		int frames = p_length - i;
+		if (_coefficients.advance(target)) {
+			frames = MIN(frames, SiParameterRamp<5>::BLOCK_SIZE);
 		}
-	} else {
-		for (int i = start_index; i < (start_index + length); i += 2) {
-			double value = _process_channel(&_left, (*r_buffer)[i]);
 
-			r_buffer->write[i] = value;
-			r_buffer->write[i + 1] = value;
+		if (p_channels == 2) {
+			_process_stereo(buffer_ptr + (i << 1), frames << 1, _coefficients.get_values());
+		} else {
+			_process_mono(buffer_ptr + (i << 1), frames << 1, _coefficients.get_values());
 		}
+		i += frames;
 	}
 
 	return p_channels;
 }
+
+void SiFilterBase::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_ramp_time"), &SiFilterBase::get_ramp_time);
+	ClassDB::bind_method(D_METHOD("set_ramp_time", "time"), &SiFilterBase::set_ramp_time);
+
+	ClassDB::add_property("SiFilterBase", PropertyInfo(Variant::FLOAT, "ramp_time"), "set_ramp_time", "get_ramp_time");
+}
+
+SiFilterBase::SiFilterBase() :
+		SiEffectBase() {
+	set_ramp_time(5);
+}
@@ -8,40 +8,38 @@
 #define SI_FILTER_BASE_H
 
 #include "effector/si_effect_base.h"
+#include "effector/si_parameter_ramp.h"
 
 class SiFilterBase : public SiEffectBase {
 	GDCLASS(SiFilterBase, SiEffectBase)
 
 	static const double THRESHOLD;
 
-	struct ChannelValues {
-		double in1 = 0;
-		double in2 = 0;
-		double out1 = 0;
-		double out2 = 0;
-
-		void check_threshold() {
-			if (out1 < THRESHOLD) {
-				out1 = 0;
-				out2 = 0;
-			}
-		}
-
-		void clear() {
-			in1 = 0;
-			in2 = 0;
-			out1 = 0;
-			out2 = 0;
-		}
+	// Filter history for both channels, kept side by side so that left and right
+	// can be processed as a single pair of lanes.
+	struct StereoState {
+		double in1[2] = { 0, 0 };
+		double in2[2] = { 0, 0 };
+		double out1[2] = { 0, 0 };
+		double out2[2] = { 0, 0 };
+
+		void check_threshold();
+		void clear();
 	};
 
-	ChannelValues _left;
-	ChannelValues _right;
+	StereoState _state;
+
+	// Coefficients in use, in the order of a1, a2, b0, b1, b2. They follow the ones set
+	// by extending classes with a short ramp, to avoid zipper noise when parameters change.
+	SiParameterRamp<5> _coefficients;
+	double _ramp_time = 0;
 
-	double _process_channel(ChannelValues *p_channel, double p_input);
+	void _get_target_coefficients(double *r_coefficients) const;
+	void _process_mono(double *r_buffer, int p_length, const double *p_coefficients);
+	void _process_stereo(double *r_buffer, int p_length, const double *p_coefficients);
 
 protected:
-	static void _bind_methods() {}
+	static void _bind_methods();
 
 	double _a1 = 0;
 	double _a2 = 0;
@@ -50,10 +48,13 @@ protected:
 	double _b2 = 0;
 
 public:
+	double get_ramp_time() const { return _ramp_time; }
+	void set_ramp_time(double p_time);
+
 	virtual int prepare_process() override;
 	virtual int process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) override;
 
-	SiFilterBase() : SiEffectBase() {}
+	SiFilterBase();
 	~SiFilterBase() {}
 };
 
@@ -6,11 +6,13 @@
 
 #include "si_filter_peak.h"
 
+#include "chip/siopm_ref_table.h"
+
 void SiFilterPeak::set_params(double p_frequency, double p_band, double p_gain) {
 	// TODO: Pick better names for these variables.
 
 	double A   = Math::pow(10, p_gain * 0.025);
-	double omg = p_frequency * 0.00014247585730565955; // 2*pi/44100
+	double omg = p_frequency * Math_TAU / SiOPMRefTable::get_instance()->sampling_rate;
 	double cos = Math::cos(omg);
 	double sin = Math::sin(omg);
 
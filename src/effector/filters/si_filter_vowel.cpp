@@ -6,19 +6,23 @@
 
 #include "si_filter_vowel.h"
 
+#include "chip/siopm_ref_table.h"
+
 // Formants.
 
-bool SiFilterVowel::Formant::_initialized = false;
+int SiFilterVowel::Formant::_initialized_rate = 0;
 double SiFilterVowel::Formant::_alpha_table[BAND_TABLE_MAX][FREQ_TABLE_MAX];
 double SiFilterVowel::Formant::_cos_table[FREQ_TABLE_MAX];
 double SiFilterVowel::Formant::_gain_table[GAIN_TABLE_MAX];
 double SiFilterVowel::Formant::_band_list[BAND_TABLE_MAX] = { 0.25, 0.5, 0.75, 1, 1.5, 2, 3, 4 };
 
 void SiFilterVowel::Formant::initialize() {
-	if (_initialized) {
+	const int sampling_rate = SiOPMRefTable::get_instance()->sampling_rate;
+	if (_initialized_rate == sampling_rate) {
 		return;
 	}
-	_initialized = true;
+	_initialized_rate = sampling_rate;
+	const double omg_scale = Math_TAU / sampling_rate;
 
 	// Generate alpha table.
 	for (int i = 0; i < BAND_TABLE_MAX; i++) {
@@ -27,7 +31,7 @@ void SiFilterVowel::Formant::initialize() {
 		for (int j = 0; j < FREQ_TABLE_MAX; j++) {
 			// TODO: Pick better names for these variables, maybe?
 
-			double omg  = frequency * 0.00014247585730565955; // 2*pi/44100
+			double omg  = frequency * omg_scale;
 			double sin  = Math::sin(omg);
 			double ang = 0.34657359027997264 * band * omg / sin; // log(2)*0.5
 
@@ -41,7 +45,7 @@ void SiFilterVowel::Formant::initialize() {
 	{
 		double frequency = 50.0;
 		for (int j = 0; j < FREQ_TABLE_MAX; j++) {
-			_cos_table[j] = Math::cos(frequency * 0.00014247585730565955);
+			_cos_table[j] = Math::cos(frequency * omg_scale);
 
 			frequency *= 1.0218971486541166; // 2^(1/32)
 		}
@@ -25,7 +25,8 @@ class SiFilterVowel : public SiEffectBase {
 	// Formants.
 
 	struct Formant {
-		static bool _initialized;
+		// Tables depend on the sampling rate, so they are regenerated if it changes.
+		static int _initialized_rate;
 		static double _alpha_table[BAND_TABLE_MAX][FREQ_TABLE_MAX];
 		static double _cos_table[FREQ_TABLE_MAX];
 		static double _gain_table[GAIN_TABLE_MAX];
@@ -8,6 +8,7 @@
 #define SI_EFFECT_BASE_H
 
 #include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/math.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 using namespace godot;
@@ -32,6 +33,19 @@ protected:
 		return Math::is_nan(value) ? p_default : value;
 	}
 
+	// Helper for get_tail_length implementations. Returns the time it takes for a signal recirculating
+	// through a delay line to fade below -96dB.
+	_FORCE_INLINE_ static int _get_feedback_tail_length(int p_delay, double p_feedback) {
+		const double feedback = Math::abs(p_feedback);
+		if (feedback < 0.0000152587890625) { // 1/65536
+			return p_delay;
+		}
+
+		// -11.09 = ln(1/65536)
+		const int64_t repeats = (int64_t)Math::ceil(-11.090354888959125 / Math::log(feedback)) + 1;
+		return (int)MIN(repeats * p_delay, (int64_t)INT32_MAX);
+	}
+
 public:
 	bool is_free() const { return _is_free; }
 	void set_free(bool p_free) { _is_free = p_free; }
@@ -45,6 +59,9 @@ public:
 	// Start index and length must be adjusted internally to account for the stereo nature of the buffer.
 	// Returns the output channel count.
 	virtual int process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) { return p_channels; }
+	// Returns the number of frames the effect keeps producing output for after its input becomes silent.
+	// Effects without delay lines can keep the default. They are bypassed once their output is silent too.
+	virtual int get_tail_length() const { return 0; }
 
 	virtual void set_by_mml(Vector<double> p_args) {}
 	virtual void reset() {}
@@ -31,7 +31,7 @@ void SiEffectComposite::set_slot_levels(int p_slot, double p_send_level, double
 
 int SiEffectComposite::prepare_process() {
 	for (int i = 0; i < SLOTS_MAX; i++) {
-		for (Ref<SiEffectBase> effect : _slots[i].effects) {
+		for (const Ref<SiEffectBase> &effect : _slots[i].effects) {
 			effect->prepare_process();
 		}
 	}
@@ -40,6 +40,10 @@ int SiEffectComposite::prepare_process() {
 }
 
 int SiEffectComposite::process(int p_channels, Vector<double> *r_buffer, int p_start_index, int p_length) {
+	// Slot buffers are kept between calls, and only grow when needed.
+	const int end_index = p_start_index + p_length;
+	double *buffer_ptr = r_buffer->ptrw();
+
 	for (int i = 1; i < SLOTS_MAX; i++) {
 		if (_slots[i].effects.is_empty()) {
 			continue;
@@ -50,13 +54,15 @@ int SiEffectComposite::process(int p_channels, Vector<double> *r_buffer, int p_s
 			slot_buffer->resize_zeroed(r_buffer->size());
 		}
 
-		for (int j = p_start_index; j < (p_start_index + p_length); j++) {
-			slot_buffer->write[j] = (*r_buffer)[j] * _slots[i].send_level;
+		double *slot_ptr = slot_buffer->ptrw();
+		const double send_level = _slots[i].send_level;
+		for (int j = p_start_index; j < end_index; j++) {
+			slot_ptr[j] = buffer_ptr[j] * send_level;
 		}
 	}
 
-	for (int j = p_start_index; j < (p_start_index + p_length); j++) {
-		r_buffer->write[j] *= _slots[0].send_level;
+	for (int j = p_start_index; j < end_index; j++) {
+		buffer_ptr[j] *= _slots[0].send_level;
 	}
 
 	for (int i = 1; i < SLOTS_MAX; i++) {
@@ -65,24 +71,28 @@ int SiEffectComposite::process(int p_channels, Vector<double> *r_buffer, int p_s
 		}
 
 		int channel_num = p_channels;
-		for (Ref<SiEffectBase> effect : _slots[i].effects) {
+		for (const Ref<SiEffectBase> &effect : _slots[i].effects) {
 			channel_num = effect->process(channel_num, &_slots[i].buffer, p_start_index, p_length);
 		}
 
-		for (int j = p_start_index; j < (p_start_index + p_length); j++) {
-			r_buffer->write[j] += _slots[i].buffer[j] * _slots[i].mix_level;
+		const double *slot_ptr = _slots[i].buffer.ptr();
+		const double mix_level = _slots[i].mix_level;
+		for (int j = p_start_index; j < end_index; j++) {
+			buffer_ptr[j] += slot_ptr[j] * mix_level;
 		}
 	}
 
 	int out_channels = p_channels;
 	if (!_slots[0].effects.is_empty()) {
-		for (Ref<SiEffectBase> effect : _slots[0].effects) {
+		for (const Ref<SiEffectBase> &effect : _slots[0].effects) {
 			out_channels = effect->process(out_channels, r_buffer, p_start_index, p_length);
 		}
 
 		if (_slots[0].mix_level != 1) {
-			for (int j = p_start_index; j < (p_start_index + p_length); j++) {
-				r_buffer->write[j] *= _slots[0].mix_level;
+			// Effects may have reallocated the buffer.
+			buffer_ptr = r_buffer->ptrw();
+			for (int j = p_start_index; j < end_index; j++) {
+				buffer_ptr[j] *= _slots[0].mix_level;
 			}
 		}
 	}
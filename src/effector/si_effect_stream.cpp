@@ -11,6 +11,11 @@
 #include "chip/siopm_sound_chip.h"
 #include "chip/siopm_stream.h"
 #include "effector/si_effector.h"
+#include "utils/allocation_util.h"
+#include "utils/profiler_util.h"
+#include "utils/trace_util.h"
+
+const double SiEffectStream::SILENCE_THRESHOLD = 0.0000152587890625; // 1/65536
 
 int SiEffectStream::get_pan() const {
 	return _pan - 64;
@@ -20,6 +25,33 @@ void SiEffectStream::set_pan(int p_value) {
 	_pan = CLAMP(p_value + 64, 0, 128);
 }
 
+void SiEffectStream::_compile_chain() {
+	_compiled_chain.resize(_chain.size());
+
+	int i = 0;
+	for (const Ref<SiEffectBase> &effect : _chain) {
+		_compiled_chain.write[i] = effect.ptr();
+		i++;
+	}
+}
+
+void SiEffectStream::set_chain(const List<Ref<SiEffectBase>> &p_effects) {
+	_chain = p_effects;
+	_compile_chain();
+	_reset_bypass();
+}
+
+void SiEffectStream::add_to_chain(const Ref<SiEffectBase> &p_effect) {
+	_chain.push_back(p_effect);
+	_compile_chain();
+	_reset_bypass();
+}
+
+bool SiEffectStream::is_sending_to_slot(int p_slot) const {
+	// Without sends everything goes to the output stream, see write_in_stream().
+	return _has_effect_send && _volumes[p_slot] > 0 && !_output_streams[p_slot];
+}
+
 bool SiEffectStream::is_outputting_directly() const {
 	return (!_has_effect_send && _volumes[0] == 1 && _pan == 64);
 }
@@ -65,50 +97,138 @@ void SiEffectStream::connect(SiOPMStream *p_output) {
 	_output_streams.write[0] = p_output;
 }
 
+// Silence detection.
+
+bool SiEffectStream::_is_silent(int p_start_idx, int p_length) const {
+	const double *buffer_ptr = _stream->get_buffer_ptr()->ptr();
+	const int end_index = (p_start_idx + p_length) << 1;
+
+	for (int i = p_start_idx << 1; i < end_index; i++) {
+		if (buffer_ptr[i] > SILENCE_THRESHOLD || buffer_ptr[i] < -SILENCE_THRESHOLD) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool SiEffectStream::_update_bypass(int p_start_idx, int p_length) {
+	if (!_is_silent(p_start_idx, p_length)) {
+		// Resume immediately.
+		_silent_frames = 0;
+		_is_bypassed = false;
+		return false;
+	}
+
+	if (_is_bypassed) {
+		return true;
+	}
+
+	// Tails can be changed at any moment, so they are only checked while waiting for them to pass.
+	_silent_frames = MIN((int64_t)_silent_frames + p_length, (int64_t)INT32_MAX);
+	_is_bypassed = _output_silent && _silent_frames >= get_tail_length();
+	return _is_bypassed;
+}
+
+void SiEffectStream::_reset_bypass() {
+	_is_bypassed = false;
+	_output_silent = false;
+	_silent_frames = 0;
+}
+
+int SiEffectStream::get_tail_length() const {
+	int64_t tail_length = 0;
+	for (const SiEffectBase *effect : _compiled_chain) {
+		tail_length += effect->get_tail_length();
+	}
+
+	return (int)MIN(tail_length, (int64_t)INT32_MAX);
+}
+
 int SiEffectStream::prepare_process() {
-	if (_chain.is_empty()) {
+	_reset_bypass();
+
+	if (_compiled_chain.is_empty()) {
 		return 0;
 	}
 
-	_stream->set_channel_count(_chain[0]->prepare_process());
-	for (int i = 1; i < _chain.size(); i++) {
-		_chain[i]->prepare_process();
+	_stream->set_channel_count(_compiled_chain[0]->prepare_process());
+	for (int i = 1; i < _compiled_chain.size(); i++) {
+		_compiled_chain[i]->prepare_process();
 	}
 
 	return _stream->get_channel_count();
 }
 
 int SiEffectStream::process(int p_start_idx, int p_length, bool p_write_in_stream) {
+	int channel_count = process_chain(p_start_idx, p_length);
+	if (p_write_in_stream) {
+		write_in_stream(p_start_idx, p_length);
+	}
+
+	return channel_count;
+}
+
+int SiEffectStream::process_chain(int p_start_idx, int p_length) {
+	SION_TRACE_SCOPE("SiEffectStream::process_chain");
+	SION_ALLOC_FREE_SCOPE("SiEffectStream::process_chain");
+
+	const uint64_t start_time = ProfilerUtil::get_ticks_usec();
+	const int channel_count = _process_chain(p_start_idx, p_length);
+	_processing_time = ProfilerUtil::get_ticks_usec() - start_time;
+
+	return channel_count;
+}
+
+int SiEffectStream::_process_chain(int p_start_idx, int p_length) {
 	Vector<double> *buffer = _stream->get_buffer_ptr();
 	int channel_count = _stream->get_channel_count();
 
-	for (int i = 0; i < _chain.size(); i++) {
-		channel_count = _chain[i]->process(channel_count, buffer, p_start_idx, p_length);
+	if (_compiled_chain.is_empty()) {
+		_is_bypassed = _is_silent(p_start_idx, p_length);
+		return channel_count;
+	}
+	if (_update_bypass(p_start_idx, p_length)) {
+		return channel_count;
 	}
 
-	if (p_write_in_stream) {
-		if (_has_effect_send) {
-			for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
-				if (_volumes[i] > 0) {
-					SiOPMStream *stream = _output_streams[i];
-					if (!stream) {
-						stream = _sound_chip->get_stream_slot(i);
-					}
-					if (stream) {
-						stream->write_from_vector(buffer, p_start_idx, p_start_idx, p_length, _volumes[i], _pan, 2);
-					}
+	SiEffectBase *const *chain_ptr = _compiled_chain.ptr();
+	const int chain_size = _compiled_chain.size();
+	for (int i = 0; i < chain_size; i++) {
+		channel_count = chain_ptr[i]->process(channel_count, buffer, p_start_idx, p_length);
+	}
+
+	_output_silent = _is_silent(p_start_idx, p_length);
+	return channel_count;
+}
+
+void SiEffectStream::write_in_stream(int p_start_idx, int p_length) {
+	if (_is_bypassed) {
+		// Nothing but silence to write.
+		return;
+	}
+
+	Vector<double> *buffer = _stream->get_buffer_ptr();
+
+	if (_has_effect_send) {
+		for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+			if (_volumes[i] > 0) {
+				SiOPMStream *stream = _output_streams[i];
+				if (!stream) {
+					stream = _sound_chip->get_stream_slot(i);
+				}
+				if (stream) {
+					stream->write_from_vector(buffer, p_start_idx, p_start_idx, p_length, _volumes[i], _pan, 2);
 				}
 			}
-		} else {
-			SiOPMStream *stream = _output_streams[0];
-			if (!stream) {
-				stream = _sound_chip->get_output_stream();
-			}
-			stream->write_from_vector(buffer, p_start_idx, p_start_idx, p_length, _volumes[0], _pan, 2);
 		}
+	} else {
+		SiOPMStream *stream = _output_streams[0];
+		if (!stream) {
+			stream = _sound_chip->get_output_stream();
+		}
+		stream->write_from_vector(buffer, p_start_idx, p_start_idx, p_length, _volumes[0], _pan, 2);
 	}
-
-	return channel_count;
 }
 
 //
@@ -119,7 +239,7 @@ void SiEffectStream::_add_effect(String p_cmd, Vector<double> p_args, int p_argc
 	Ref<SiEffectBase> effect = SiEffector::get_effect_instance(p_cmd);
 	if (effect.is_valid()) {
 		effect->set_by_mml(p_args);
-		_chain.push_back(effect);
+		add_to_chain(effect);
 	}
 }
 
@@ -250,6 +370,7 @@ void SiEffectStream::initialize(int p_depth) {
 void SiEffectStream::reset() {
 	_stream->resize(_sound_chip->get_buffer_length() << 1);
 	_stream->clear();
+	_reset_bypass();
 }
 
 void SiEffectStream::free() {
@@ -257,6 +378,7 @@ void SiEffectStream::free() {
 		effect->set_free(true);
 	}
 	_chain.clear();
+	_compiled_chain.clear();
 }
 
 SiEffectStream::SiEffectStream(SiOPMSoundChip *p_chip, SiOPMStream *p_stream) {
@@ -7,6 +7,7 @@
 #ifndef SI_EFFECT_STREAM_H
 #define SI_EFFECT_STREAM_H
 
+#include <cstdint>
 #include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/string.hpp>
@@ -19,8 +20,13 @@ class SiOPMStream;
 
 class SiEffectStream {
 
+	// Anything quieter than -96dB is considered silence.
+	static const double SILENCE_THRESHOLD;
+
 	SiOPMSoundChip *_sound_chip = nullptr;
 	List<Ref<SiEffectBase>> _chain;
+	// Flat copy of the chain for processing. References are held by the list above.
+	Vector<SiEffectBase *> _compiled_chain;
 
 	SiOPMStream *_stream = nullptr;
 	// Deeper streams execute first.
@@ -31,20 +37,40 @@ class SiEffectStream {
 	Vector<double> _volumes;
 	Vector<SiOPMStream *> _output_streams;
 
+	// Silence detection. The chain is bypassed while the input is silent, once tails of all effects
+	// have passed and the last processed output was silent as well.
+	bool _is_bypassed = false;
+	bool _output_silent = false;
+	int _silent_frames = 0;
+
+	// Time spent in the last chain run, usec.
+	uint64_t _processing_time = 0;
+
+	bool _is_silent(int p_start_idx, int p_length) const;
+	bool _update_bypass(int p_start_idx, int p_length);
+	void _reset_bypass();
+
+	int _process_chain(int p_start_idx, int p_length);
+
+	void _compile_chain();
 	void _add_effect(String p_cmd, Vector<double> p_args, int p_argc);
 	void _set_postfix_param(int p_slot, String p_cmd, Vector<double> p_args, int p_argc);
 
 public:
 	List<Ref<SiEffectBase>> get_chain() const { return _chain; }
-	void set_chain(const List<Ref<SiEffectBase>> &p_effects) { _chain = p_effects; }
-	void add_to_chain(const Ref<SiEffectBase> &p_effect) { _chain.push_back(p_effect); }
+	void set_chain(const List<Ref<SiEffectBase>> &p_effects);
+	void add_to_chain(const Ref<SiEffectBase> &p_effect);
 	SiOPMStream *get_stream() const { return _stream; }
+	bool is_sending_to_slot(int p_slot) const;
 
 	int get_depth() const { return _depth; }
 	int get_pan() const;
 	void set_pan(int p_value);
 
 	bool is_outputting_directly() const;
+	bool is_bypassed() const { return _is_bypassed; }
+	int get_tail_length() const;
+	uint64_t get_processing_time() const { return _processing_time; }
 
 	void set_all_stream_send_levels(Vector<int> p_param);
 	void set_stream_send(int p_stream_num, double p_volume);
@@ -53,6 +79,9 @@ public:
 	void connect(SiOPMStream *p_output = nullptr);
 	int prepare_process();
 	int process(int p_start_idx, int p_length, bool p_write_in_stream = true);
+	// Split steps of process(). The chain only touches the stream's own buffer and can run on any thread.
+	int process_chain(int p_start_idx, int p_length);
+	void write_in_stream(int p_start_idx, int p_length);
 
 	//
 
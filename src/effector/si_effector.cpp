@@ -6,14 +6,18 @@
 
 #include "si_effector.h"
 
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include "chip/siopm_sound_chip.h"
 #include "chip/siopm_stream.h"
 #include "effector/si_effect_stream.h"
 #include "templates/type_constraints.h"
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
 
 #include "effector/effects/si_effect_autopan.h"
 #include "effector/effects/si_effect_compressor.h"
+#include "effector/effects/si_effect_convolution_reverb.h"
 #include "effector/effects/si_effect_distortion.h"
 #include "effector/effects/si_effect_downsampler.h"
 #include "effector/effects/si_effect_equalizer.h"
@@ -45,6 +49,7 @@ SiEffectStream *SiEffector::_get_global_stream(int p_slot) {
 		_global_effects.write[p_slot] = stream;
 		_sound_chip->set_stream_slot(p_slot, stream->get_stream());
 		_global_effect_count++;
+		_plan_dirty = true;
 	}
 
 	return _global_effects[p_slot];
@@ -101,6 +106,7 @@ Ref<SiEffectBase> SiEffector::get_effect_instance(const String &p_name) {
 
 	CREATE_EFFECT(SiEffectAutopan, "autopan");
 	CREATE_EFFECT(SiEffectCompressor, "comp");
+	CREATE_EFFECT(SiEffectConvolutionReverb, "conv");
 	CREATE_EFFECT(SiEffectDistortion, "dist");
 	CREATE_EFFECT(SiEffectDownsampler, "ds");
 	CREATE_EFFECT(SiEffectEqualizer, "eq");
@@ -159,6 +165,15 @@ TypedArray<SiEffectBase> SiEffector::get_slot_effects(int p_slot) const {
 	return effects;
 }
 
+uint64_t SiEffector::get_slot_processing_time(int p_slot) const {
+	ERR_FAIL_INDEX_V_MSG(p_slot, SiOPMSoundChip::STREAM_SEND_SIZE, 0, "SiEffector: Invalid effect slot index.");
+
+	if (!_global_effects[p_slot]) {
+		return 0;
+	}
+	return _global_effects[p_slot]->get_processing_time();
+}
+
 void SiEffector::add_slot_effect(int p_slot, const Ref<SiEffectBase> &p_effect) {
 	ERR_FAIL_INDEX_MSG(p_slot, SiOPMSoundChip::STREAM_SEND_SIZE, "SiEffector: Invalid effect slot index.");
 
@@ -191,6 +206,7 @@ void SiEffector::clear_slot_effects(int p_slot) {
 			_global_effects[p_slot]->free();
 			_free_effect_streams.push_back(_global_effects[p_slot]);
 			_global_effects.write[p_slot] = nullptr;
+			_plan_dirty = true;
 		}
 	}
 }
@@ -199,6 +215,7 @@ SiEffectStream *SiEffector::create_local_effect(int p_depth, List<Ref<SiEffectBa
 	SiEffectStream *effect = _alloc_stream(p_depth);
 	effect->set_chain(p_effects);
 	effect->prepare_process();
+	_plan_dirty = true;
 
 	if (p_depth == 0) {
 		_local_effects.push_back(effect);
@@ -220,6 +237,7 @@ void SiEffector::delete_local_effect(SiEffectStream *p_effect) {
 	_local_effects.erase(p_effect);
 	p_effect->free();
 	_free_effect_streams.push_back(p_effect);
+	_plan_dirty = true;
 }
 
 void SiEffector::parse_global_effect_mml(int p_slot, String p_mml, String p_postfix) {
@@ -231,6 +249,72 @@ void SiEffector::parse_global_effect_mml(int p_slot, String p_mml, String p_post
 
 // Processing.
 
+void SiEffector::_compile_plan() {
+	_plan.clear();
+
+	for (SiEffectStream *effect : _local_effects) {
+		PlanStep step;
+		step.stream = effect;
+		_plan.push_back(step);
+	}
+
+	for (int i = 1; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+		if (_global_effects[i] != nullptr) {
+			PlanStep step;
+			step.stream = _global_effects[i];
+			step.slot = i;
+			_plan.push_back(step);
+		}
+	}
+
+	_plan_dirty = false;
+}
+
+void SiEffector::_process_wave_task(int p_index) {
+	_wave_effects[p_index]->process_chain(0, _sound_chip->get_buffer_length());
+}
+
+void SiEffector::_process_wave() {
+	if (_wave_size == 0) {
+		return;
+	}
+
+	const int buffer_length = _sound_chip->get_buffer_length();
+
+	if (_parallel_processing && _wave_size > 1) {
+		WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+		const int64_t group_id = thread_pool->add_group_task(Callable(this, "_process_wave_task"), _wave_size, -1, true, "SiEffector: Process effect slots.");
+		thread_pool->wait_for_group_task_completion(group_id);
+	} else {
+		for (int i = 0; i < _wave_size; i++) {
+			_wave_effects[i]->process_chain(0, buffer_length);
+		}
+	}
+
+	// Outputs are shared, so they must be written in the slot order.
+	for (int i = 0; i < _wave_size; i++) {
+		SiEffectStream *effect = _wave_effects[i];
+
+		if (effect->is_bypassed()) {
+			continue;
+		}
+		if (effect->is_outputting_directly()) {
+			const double *buffer_ptr = effect->get_stream()->get_buffer_ptr()->ptr();
+			Vector<double> *output = _sound_chip->get_output_stream()->get_buffer_ptr();
+			double *output_ptr = output->ptrw();
+
+			const int output_size = output->size();
+			for (int j = 0; j < output_size; j++) {
+				output_ptr[j] += buffer_ptr[j];
+			}
+		} else {
+			effect->write_in_stream(0, buffer_length);
+		}
+	}
+
+	_wave_size = 0;
+}
+
 void SiEffector::prepare_process() {
 	// Do nothing with local effects.
 
@@ -248,6 +332,7 @@ void SiEffector::prepare_process() {
 	}
 
 	_master_effect->prepare_process();
+	_plan_dirty = true;
 }
 
 void SiEffector::begin_process() {
@@ -265,29 +350,41 @@ void SiEffector::begin_process() {
 }
 
 void SiEffector::end_process() {
-	for (SiEffectStream *effect : _local_effects) {
-		effect->process(0, _sound_chip->get_buffer_length());
+	SION_TRACE_SCOPE("SiEffector::end_process");
+	SION_ALLOC_SCOPE("SiEffector::end_process");
+
+	if (_plan_dirty) {
+		_compile_plan();
 	}
 
-	for (int i = 1; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
-		if (_global_effects[i] != nullptr) {
-			SiEffectStream *effect = _global_effects[i];
-
-			if (effect->is_outputting_directly()) {
-				effect->process(0, _sound_chip->get_buffer_length(), false);
-
-				Vector<double> *buffer = effect->get_stream()->get_buffer_ptr();
-				Vector<double> *output = _sound_chip->get_output_stream()->get_buffer_ptr();
-				for (int j = 0; j < output->size(); j++) {
-					output->write[j] += (*buffer)[j];
-				}
-			} else {
-				effect->process(0, _sound_chip->get_buffer_length(), true);
+	const int buffer_length = _sound_chip->get_buffer_length();
+	const PlanStep *plan_ptr = _plan.ptr();
+	const int plan_size = _plan.size();
+
+	// Local streams feed global slots, so they go first and one by one.
+	int step_index = 0;
+	for (; step_index < plan_size && plan_ptr[step_index].slot < 0; step_index++) {
+		plan_ptr[step_index].stream->process(0, buffer_length);
+	}
+
+	// A slot can only join the current wave if nothing in that wave sends into it. Sends are checked
+	// every time, as they can be changed without touching the plan.
+	for (; step_index < plan_size; step_index++) {
+		const PlanStep &step = plan_ptr[step_index];
+
+		for (int i = 0; i < _wave_size; i++) {
+			if (_wave_effects[i]->is_sending_to_slot(step.slot)) {
+				_process_wave();
+				break;
 			}
 		}
+
+		_wave_effects.write[_wave_size] = step.stream;
+		_wave_size++;
 	}
+	_process_wave();
 
-	_master_effect->process(0, _sound_chip->get_buffer_length(), false);
+	_master_effect->process(0, buffer_length, false);
 }
 
 void SiEffector::reset() {
@@ -328,6 +425,7 @@ void SiEffector::initialize() {
 
 	_master_effect->initialize(0);
 	_global_effects.write[0] = _master_effect;
+	_plan_dirty = true;
 }
 
 void SiEffector::_bind_methods() {
@@ -335,6 +433,13 @@ void SiEffector::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_slot_effect", "slot", "effect"), &SiEffector::add_slot_effect);
 	ClassDB::bind_method(D_METHOD("set_slot_effects", "slot", "effects"), &SiEffector::set_slot_effects);
 	ClassDB::bind_method(D_METHOD("clear_slot_effects", "slot"), &SiEffector::clear_slot_effects);
+
+	ClassDB::bind_method(D_METHOD("is_parallel_processing"), &SiEffector::is_parallel_processing);
+	ClassDB::bind_method(D_METHOD("set_parallel_processing", "enabled"), &SiEffector::set_parallel_processing);
+
+	ClassDB::add_property("SiEffector", PropertyInfo(Variant::BOOL, "parallel_processing"), "set_parallel_processing", "is_parallel_processing");
+
+	ClassDB::bind_method(D_METHOD("_process_wave_task", "index"), &SiEffector::_process_wave_task);
 }
 
 SiEffector::SiEffector(SiOPMSoundChip *p_chip) {
@@ -343,11 +448,13 @@ SiEffector::SiEffector(SiOPMSoundChip *p_chip) {
 	_master_effect = memnew(SiEffectStream(_sound_chip, _sound_chip->get_output_stream()));
 	_global_effects.resize_zeroed(SiOPMSoundChip::STREAM_SEND_SIZE);
 	_global_effects.write[0] = _master_effect;
+	_wave_effects.resize_zeroed(SiOPMSoundChip::STREAM_SEND_SIZE);
 
 	// Register default effect instances.
 
 	register_effect<SiEffectAutopan>("autopan");
 	register_effect<SiEffectCompressor>("comp");
+	register_effect<SiEffectConvolutionReverb>("conv");
 	register_effect<SiEffectDistortion>("dist");
 	register_effect<SiEffectDownsampler>("ds");
 	register_effect<SiEffectEqualizer>("eq");
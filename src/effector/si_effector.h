@@ -7,6 +7,7 @@
 #ifndef SI_EFFECTOR_H
 #define SI_EFFECTOR_H
 
+#include <cstdint>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/list.hpp>
@@ -35,6 +36,27 @@ class SiEffector : public Object {
 	SiEffectStream *_get_global_stream(int p_slot);
 	SiEffectStream *_alloc_stream(int p_depth);
 
+	// Flat execution plan: local streams, deepest first, then global slots in order. The master
+	// slot always goes last. Rebuilt whenever streams are added or removed.
+	struct PlanStep {
+		SiEffectStream *stream = nullptr;
+		int slot = -1; // Local streams don't have a slot.
+	};
+
+	Vector<PlanStep> _plan;
+	bool _plan_dirty = true;
+
+	void _compile_plan();
+
+	// Consecutive global slots which don't feed each other are processed together as a wave.
+	// Their chains can run concurrently, while their outputs are mixed in order.
+	bool _parallel_processing = false;
+	Vector<SiEffectStream *> _wave_effects;
+	int _wave_size = 0;
+
+	void _process_wave_task(int p_index);
+	void _process_wave();
+
 protected:
 	static void _bind_methods();
 
@@ -43,6 +65,9 @@ public:
 
 	int get_global_effect_count() const { return _global_effect_count; }
 
+	bool is_parallel_processing() const { return _parallel_processing; }
+	void set_parallel_processing(bool p_enabled) { _parallel_processing = p_enabled; }
+
 	template <class T>
 	static void register_effect(const String &p_name);
 	static Ref<SiEffectBase> get_effect_instance(const String &p_name);
@@ -52,6 +77,8 @@ public:
 	// Slots and connections.
 
 	TypedArray<SiEffectBase> get_slot_effects(int p_slot) const;
+	// Time spent in the slot's effect chain during the last buffer, usec. Slot 0 is the master effect.
+	uint64_t get_slot_processing_time(int p_slot) const;
 	void add_slot_effect(int p_slot, const Ref<SiEffectBase> &p_effect);
 	void set_slot_effects(int p_slot, const TypedArray<SiEffectBase> &p_effects);
 	void clear_slot_effects(int p_slot);
@@ -0,0 +1,80 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SI_PARAMETER_RAMP_H
+#define SI_PARAMETER_RAMP_H
+
+// Moves a set of parameters linearly towards their target values, one sub-block at a time.
+// A new ramp starts from the current values whenever the target changes, so parameters
+// set at arbitrary moments glide instead of jumping.
+template <int N>
+class SiParameterRamp {
+	double _values[N] = {};
+	double _target[N] = {};
+	double _step[N] = {};
+
+	int _length = 0;
+	int _blocks_left = 0;
+
+public:
+	// Number of frames processed with the same values while ramping.
+	static const int BLOCK_SIZE = 32;
+
+	const double *get_values() const { return _values; }
+	bool is_active() const { return _blocks_left > 0; }
+
+	int get_length() const { return _length * BLOCK_SIZE; }
+	void set_length(int p_frames) {
+		_length = (p_frames > 0 ? (p_frames + BLOCK_SIZE - 1) / BLOCK_SIZE : 0);
+	}
+
+	// Jumps to the values immediately.
+	void snap(const double *p_values) {
+		for (int i = 0; i < N; i++) {
+			_values[i] = p_values[i];
+			_target[i] = p_values[i];
+		}
+		_blocks_left = 0;
+	}
+
+	// Starts a new ramp if the target has changed, then moves to the values for the next sub-block.
+	// Returns true if the values keep changing, meaning only one sub-block should be processed.
+	bool advance(const double *p_target) {
+		bool changed = false;
+		for (int i = 0; i < N; i++) {
+			if (p_target[i] != _target[i]) {
+				changed = true;
+				break;
+			}
+		}
+
+		if (changed) {
+			if (_length == 0) {
+				snap(p_target);
+				return false;
+			}
+
+			for (int i = 0; i < N; i++) {
+				_target[i] = p_target[i];
+				_step[i] = (_target[i] - _values[i]) / _length;
+			}
+			_blocks_left = _length;
+		}
+
+		if (_blocks_left == 0) {
+			return false;
+		}
+
+		_blocks_left--;
+		for (int i = 0; i < N; i++) {
+			// Land exactly on the target at the end.
+			_values[i] = (_blocks_left == 0 ? _target[i] : _values[i] + _step[i]);
+		}
+		return true;
+	}
+};
+
+#endif // SI_PARAMETER_RAMP_H
@@ -6,6 +6,7 @@
 
 #include "sion_event.h"
 
+#include <cstring>
 #include "sion_data.h"
 #include "sion_driver.h"
 
@@ -28,6 +29,40 @@ Ref<SiONData> SiONEvent::get_data() const {
 	return _driver->get_data();
 }
 
+void SiONEvent::publish_stream_buffer() {
+	if (_stream_frame_count == 0) {
+		if (!_stream_buffer.is_empty()) {
+			_stream_buffer = PackedVector2Array();
+		}
+		return;
+	}
+
+	// Only copies if a listener still holds the buffer from the last time this event was emitted.
+	_stream_buffer.resize(_stream_frame_count);
+	memcpy(_stream_buffer.ptrw(), _stream_frames.ptr(), sizeof(Vector2) * _stream_frame_count);
+}
+
+void SiONEvent::_set_event_type(const char *p_type) {
+	// Pooled events are usually reused for the same type, this avoids creating a new string.
+	if (_event_type != p_type) {
+		_event_type = p_type;
+	}
+}
+
+void SiONEvent::initialize(const char *p_type, SiONDriver *p_driver, const Vector2 *p_stream_frames, int p_frame_count) {
+	_set_event_type(p_type);
+	_driver = p_driver;
+
+	_stream_frame_count = p_stream_frames ? p_frame_count : 0;
+	if (_stream_frame_count > 0) {
+		// Pooled events keep their storage, so this only allocates the first time.
+		if (_stream_frames.size() < _stream_frame_count) {
+			_stream_frames.resize(_stream_frame_count);
+		}
+		memcpy(_stream_frames.ptrw(), p_stream_frames, sizeof(Vector2) * _stream_frame_count);
+	}
+}
+
 //
 
 void SiONEvent::_bind_methods() {
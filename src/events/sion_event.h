@@ -8,7 +8,9 @@
 #define SION_EVENT_H
 
 #include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/vector2.hpp>
 
 using namespace godot;
 
@@ -21,11 +23,17 @@ class SiONEvent : public RefCounted {
 	String _event_type;
 
 	SiONDriver *_driver = nullptr;
+	// Frames are copied by the audio thread into storage which is never handed out, and are then
+	// published to the buffer exposed to listeners on the main thread. Both are reused by the pool.
+	Vector<Vector2> _stream_frames;
+	int _stream_frame_count = 0;
 	PackedVector2Array _stream_buffer;
 
 protected:
 	static void _bind_methods();
 
+	void _set_event_type(const char *p_type);
+
 public:
 	// Event types, doubling as signal names.
 
@@ -76,6 +84,11 @@ public:
 	SiONDriver *get_driver() const { return _driver; }
 	Ref<SiONData> get_data() const;
 	PackedVector2Array get_stream_buffer() const { return _stream_buffer; }
+	// Copies the frames stored by initialize() into the stream buffer. Called on the main thread before emitting.
+	void publish_stream_buffer();
+
+	// Reinitializes a pooled event, see RefPool. Stream frames are copied, so the caller can reuse its buffer.
+	void initialize(const char *p_type, SiONDriver *p_driver, const Vector2 *p_stream_frames = nullptr, int p_frame_count = 0);
 
 	//
 
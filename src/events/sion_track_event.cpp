@@ -19,24 +19,14 @@ const char *SiONTrackEvent::NOTE_OFF_FRAME = "note_off_frame";
 const char *SiONTrackEvent::STREAMING_BEAT = "streaming_beat";
 const char *SiONTrackEvent::BPM_CHANGED = "bpm_changed";
 const char *SiONTrackEvent::USER_DEFINED = "user_defined_event";
+const char *SiONTrackEvent::COMMAND_EXECUTED = "command_executed";
 
 bool SiONTrackEvent::decrement_timer(int p_frame_rate) {
 	_frame_trigger_timer -= p_frame_rate;
 	return (_frame_trigger_timer <= 0);
 }
 
-//
-
-void SiONTrackEvent::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("get_track"), &SiONTrackEvent::get_track);
-	ClassDB::bind_method(D_METHOD("get_event_trigger_id"), &SiONTrackEvent::get_event_trigger_id);
-	ClassDB::bind_method(D_METHOD("get_note"), &SiONTrackEvent::get_note);
-	ClassDB::bind_method(D_METHOD("get_buffer_index"), &SiONTrackEvent::get_buffer_index);
-	ClassDB::bind_method(D_METHOD("get_frame_trigger_delay"), &SiONTrackEvent::get_frame_trigger_delay);
-}
-
-SiONTrackEvent::SiONTrackEvent(String p_type, SiONDriver *p_driver, SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id) :
-		SiONEvent(p_type, p_driver) {
+void SiONTrackEvent::_set_track_data(SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id) {
 	_track = p_track;
 
 	if (_track) {
@@ -49,6 +39,31 @@ SiONTrackEvent::SiONTrackEvent(String p_type, SiONDriver *p_driver, SiMMLTrack *
 		_buffer_index = p_buffer_index;
 	}
 
-	_frame_trigger_delay = (double)_buffer_index / p_driver->get_sequencer()->get_sample_rate() + p_driver->get_streaming_latency();
+	SiONDriver *driver = get_driver();
+	if (driver) {
+		_frame_trigger_delay = (double)_buffer_index / driver->get_sequencer()->get_sample_rate() + driver->get_streaming_latency();
+	} else {
+		_frame_trigger_delay = 0;
+	}
 	_frame_trigger_timer = _frame_trigger_delay;
 }
+
+void SiONTrackEvent::initialize(const char *p_type, SiONDriver *p_driver, SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id) {
+	SiONEvent::initialize(p_type, p_driver);
+	_set_track_data(p_track, p_buffer_index, p_note, p_event_trigger_id);
+}
+
+//
+
+void SiONTrackEvent::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_track"), &SiONTrackEvent::get_track);
+	ClassDB::bind_method(D_METHOD("get_event_trigger_id"), &SiONTrackEvent::get_event_trigger_id);
+	ClassDB::bind_method(D_METHOD("get_note"), &SiONTrackEvent::get_note);
+	ClassDB::bind_method(D_METHOD("get_buffer_index"), &SiONTrackEvent::get_buffer_index);
+	ClassDB::bind_method(D_METHOD("get_frame_trigger_delay"), &SiONTrackEvent::get_frame_trigger_delay);
+}
+
+SiONTrackEvent::SiONTrackEvent(String p_type, SiONDriver *p_driver, SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id) :
+		SiONEvent(p_type, p_driver) {
+	_set_track_data(p_track, p_buffer_index, p_note, p_event_trigger_id);
+}
@@ -21,6 +21,8 @@ class SiONTrackEvent : public SiONEvent {
 	double _frame_trigger_delay = 0;
 	int _frame_trigger_timer = 0;
 
+	void _set_track_data(SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id);
+
 protected:
 	static void _bind_methods();
 
@@ -54,9 +56,15 @@ public:
 	// Event trigger ID and note number are configured as arguments of the dispatched event.
 	static const char *USER_DEFINED;
 
+	// Emitted when a command queued with one of the SiONDriver.queue_*() methods is executed.
+	// Event trigger ID contains the command ID returned by the queueing method. The track is only set
+	// for commands which start a note.
+	static const char *COMMAND_EXECUTED;
+
 	// Properties.
 
 	SiMMLTrack *get_track() const { return _track; }
+	void set_track(SiMMLTrack *p_track) { _track = p_track; }
 	int get_event_trigger_id() const { return _event_trigger_id; }
 	int get_note() const { return _note; }
 	int get_buffer_index() const { return _buffer_index; }
@@ -64,6 +72,9 @@ public:
 
 	bool decrement_timer(int p_frame_rate);
 
+	// Reinitializes a pooled event, see RefPool.
+	void initialize(const char *p_type, SiONDriver *p_driver, SiMMLTrack *p_track, int p_buffer_index = 0, int p_note = 0, int p_event_trigger_id = 0);
+
 	//
 
 	SiONTrackEvent(String p_type = String(), SiONDriver *p_driver = nullptr, SiMMLTrack *p_track = nullptr, int p_buffer_index = 0, int p_note = 0, int p_event_trigger_id = 0);
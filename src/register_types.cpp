@@ -10,6 +10,8 @@
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/godot.hpp>
 
+#include "sion_analysis_tap.h"
+#include "sion_audio_stream.h"
 #include "sion_data.h"
 #include "sion_driver.h"
 #include "sion_voice.h"
@@ -25,13 +27,17 @@
 #include "chip/siopm_ref_table.h"
 #include "chip/siopm_sound_chip.h"
 #include "chip/wave/siopm_wave_base.h"
+#include "chip/wave/siopm_wave_loader.h"
 #include "chip/wave/siopm_wave_pcm_data.h"
 #include "chip/wave/siopm_wave_pcm_table.h"
 #include "chip/wave/siopm_wave_sampler_data.h"
+#include "chip/wave/siopm_wave_sampler_reader.h"
+#include "chip/wave/siopm_wave_sampler_resampler.h"
 #include "chip/wave/siopm_wave_sampler_table.h"
 #include "chip/wave/siopm_wave_table.h"
 #include "effector/effects/si_effect_autopan.h"
 #include "effector/effects/si_effect_compressor.h"
+#include "effector/effects/si_effect_convolution_reverb.h"
 #include "effector/effects/si_effect_distortion.h"
 #include "effector/effects/si_effect_downsampler.h"
 #include "effector/effects/si_effect_equalizer.h"
@@ -73,6 +79,8 @@
 #include "sequencer/simml_sequencer.h"
 #include "sequencer/simml_track.h"
 #include "sequencer/simml_voice.h"
+#include "utils/allocation_util.h"
+#include "utils/intern_pool_util.h"
 #include "utils/sion_voice_preset_util.h"
 
 #include "templates/singly_linked_list.h"
@@ -95,9 +103,11 @@ void initialize_sion_module(ModuleInitializationLevel p_level) {
 		// Chip.
 
 		ClassDB::register_internal_class<SiOPMWaveBase>();
+		ClassDB::register_internal_class<SiOPMWaveLoader>();
 		ClassDB::register_internal_class<SiOPMWavePCMData>();
 		ClassDB::register_internal_class<SiOPMWavePCMTable>();
 		ClassDB::register_internal_class<SiOPMWaveSamplerData>();
+		ClassDB::register_internal_class<SiOPMWaveSamplerReader>();
 		ClassDB::register_internal_class<SiOPMWaveSamplerTable>();
 		ClassDB::register_internal_class<SiOPMWaveTable>();
 
@@ -125,6 +135,7 @@ void initialize_sion_module(ModuleInitializationLevel p_level) {
 		ClassDB::register_class<SiEffectAutopan>();
 		ClassDB::register_class<SiEffectComposite>();
 		ClassDB::register_class<SiEffectCompressor>();
+		ClassDB::register_class<SiEffectConvolutionReverb>();
 		ClassDB::register_class<SiEffectDistortion>();
 		ClassDB::register_class<SiEffectDownsampler>();
 		ClassDB::register_class<SiEffectEqualizer>();
@@ -171,6 +182,9 @@ void initialize_sion_module(ModuleInitializationLevel p_level) {
 
 		// Main SiON API classes.
 
+		ClassDB::register_class<SiONAnalysisTap>();
+		ClassDB::register_abstract_class<SiONAudioStream>();
+		ClassDB::register_internal_class<SiONAudioStreamPlayback>();
 		ClassDB::register_class<SiONData>();
 		ClassDB::register_class<SiONDriver>();
 		ClassDB::register_class<SiONVoice>();
@@ -178,14 +192,18 @@ void initialize_sion_module(ModuleInitializationLevel p_level) {
 
 	// Initialization.
 
+	// Only does something in builds with allocation tracking.
+	AllocationUtil::install_hooks();
+
 	// SUS: This is a bit ugly, but I don't have a better idea yet.
 	SinglyLinkedList<int>::initialize_pool();
 	SinglyLinkedList<double>::initialize_pool();
 
 	// Initialize singletons and static members before the execution.
+	// SiOPMRefTable is generated on first use, see SiONDriver.
 	MMLParser::initialize();
 	MMLSequencer::initialize();
-	SiOPMRefTable::initialize();
+	SiOPMWaveSamplerResampler::initialize();
 	SiMMLRefTable::initialize();
 	SiMMLTrack::initialize();
 }
@@ -197,17 +215,25 @@ void uninitialize_sion_module(ModuleInitializationLevel p_level) {
 
 	// Finalization.
 
+	// Pooled envelope tables still hold list elements.
+	InternPoolUtil::clear();
+
 	// SUS: This is a bit ugly, but I don't have a better idea yet.
 	SinglyLinkedList<int>::finalize_pool();
 	SinglyLinkedList<double>::finalize_pool();
 
 	// Finalize singletons and static members after the execution.
 	SiOPMChannelFM::finalize_pool();
+	SiEffectConvolutionReverb::finalize();
 	SiMMLTrack::finalize();
 	SiMMLRefTable::finalize();
 	SiOPMRefTable::finalize();
+	SiOPMWaveSamplerReader::finalize();
+	SiOPMWaveSamplerResampler::finalize();
 	MMLSequencer::finalize();
 	MMLParser::finalize();
+
+	AllocationUtil::uninstall_hooks();
 }
 
 extern "C" {
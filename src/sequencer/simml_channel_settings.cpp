@@ -91,7 +91,7 @@ MMLSequence *SiMMLChannelSettings::select_tone(SiMMLTrack *p_track, int p_voice_
 			}
 
 			// This module only changes channel params, but not track params.
-			p_track->get_channel()->set_channel_params(voice->get_channel_params(), false, false);
+			p_track->get_channel()->set_channel_program(voice->get_program(), false, false);
 			p_track->reset_volume_offset();
 
 			MMLSequence *init_sequence = voice->get_channel_params()->get_init_sequence();
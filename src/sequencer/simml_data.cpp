@@ -13,6 +13,7 @@
 #include "sequencer/simml_envelope_table.h"
 #include "sequencer/simml_ref_table.h"
 #include "sequencer/simml_voice.h"
+#include "utils/intern_pool_util.h"
 
 using namespace godot;
 
@@ -68,7 +69,7 @@ Ref<SiOPMWaveTable> SiMMLData::set_wave_table(int p_index, Vector<double> *p_dat
 		log_table.write[i] = SiOPMRefTable::calculate_log_table_index((*p_data)[i]);
 	}
 
-	_wave_tables.write[index] = Ref<SiOPMWaveTable>(memnew(SiOPMWaveTable(log_table)));
+	_wave_tables.write[index] = InternPoolUtil::intern_wave_table(log_table);
 	return _wave_tables[index];
 }
 
@@ -144,6 +145,9 @@ void SiMMLData::clear() {
 	for (int i = 0; i < SiOPMRefTable::SAMPLER_TABLE_MAX; i++) {
 		_sampler_tables.write[i] = Ref<SiOPMWaveSamplerTable>();
 	}
+
+	// Shared tables which were only used by this data can go now.
+	InternPoolUtil::prune();
 }
 
 SiMMLData::SiMMLData() {
@@ -115,6 +115,14 @@ void SiMMLEnvelopeTable::copy_from(const Ref<SiMMLEnvelopeTable> &p_source) {
 	}
 }
 
+int64_t SiMMLEnvelopeTable::get_memory_usage() const {
+	if (!_data) {
+		return 0;
+	}
+
+	return (int64_t)_data->size() * sizeof(SinglyLinkedList<int>::Element);
+}
+
 SiMMLEnvelopeTable::SiMMLEnvelopeTable(Vector<int> p_table, int p_loop_point) {
 	from_vector(p_table, p_loop_point);
 }
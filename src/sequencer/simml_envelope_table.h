@@ -7,6 +7,7 @@
 #ifndef SIMML_ENVELOPE_TABLE_H
 #define SIMML_ENVELOPE_TABLE_H
 
+#include <cstdint>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/string.hpp>
@@ -38,6 +39,9 @@ public:
 
 	void copy_from(const Ref<SiMMLEnvelopeTable> &p_source);
 
+	// Approximate size of the table, in bytes.
+	int64_t get_memory_usage() const;
+
 	SiMMLEnvelopeTable(Vector<int> p_table = Vector<int>(), int p_loop_point = -1);
 	~SiMMLEnvelopeTable();
 };
@@ -30,6 +30,10 @@
 #include "sequencer/simml_ref_table.h"
 #include "sequencer/simml_track.h"
 #include "sequencer/simml_voice.h"
+#include "utils/allocation_util.h"
+#include "utils/intern_pool_util.h"
+#include "utils/profiler_util.h"
+#include "utils/trace_util.h"
 #include "utils/translator_util.h"
 
 using namespace godot;
@@ -314,7 +318,9 @@ void SiMMLSequencer::_on_after_compile(MMLSequenceGroup *p_group) {
 }
 
 void SiMMLSequencer::_on_process(int p_length, MMLEvent *p_event) {
+	const uint64_t start_time = ProfilerUtil::get_ticks_usec();
 	_current_track->buffer(p_length);
+	_current_track->add_processing_time(ProfilerUtil::get_ticks_usec() - start_time);
 }
 
 void SiMMLSequencer::_on_timer_interruption() {
@@ -350,9 +356,8 @@ void SiMMLSequencer::_on_table_parse(MMLEvent *p_prev, String p_table) {
 	String data = res->get_string(1);
 	String postfix = res->get_string(2);
 
-	Ref<SiMMLEnvelopeTable> env_table = memnew(SiMMLEnvelopeTable);
-	env_table->parse_mml(data, postfix);
-	ERR_FAIL_COND_MSG(!env_table->get_data(), vformat("SiMMLSequencer: Invalid table parameter '%s' in the {..} command.", data));
+	Ref<SiMMLEnvelopeTable> env_table = InternPoolUtil::intern_envelope_table(data, postfix);
+	ERR_FAIL_COND_MSG(env_table.is_null(), vformat("SiMMLSequencer: Invalid table parameter '%s' in the {..} command.", data));
 
 	Ref<SiMMLData> simml_data = mml_data;
 	simml_data->set_envelope_table(_internal_table_index, env_table);
@@ -435,6 +440,9 @@ void SiMMLSequencer::prepare_process(const Ref<MMLData> &p_data, int p_sample_ra
 }
 
 void SiMMLSequencer::process() {
+	SION_TRACE_SCOPE("SiMMLSequencer::process");
+	SION_ALLOC_SCOPE("SiMMLSequencer::process");
+
 	// Prepare for buffering.
 	for (SiMMLTrack *track : _tracks) {
 		track->get_channel()->reset_channel_buffer_status();
@@ -455,6 +463,9 @@ void SiMMLSequencer::process() {
 			_bpm = track->get_bpm_settings();
 			if (_bpm.is_null()) {
 				_bpm = _adjustible_bpm;
+			} else if (_bpm->get_sample_rate() != _sample_rate) {
+				// Settings of the data are created when it's compiled, before the output rate is known.
+				_bpm->update(_bpm->get_bpm(), _sample_rate);
 			}
 
 			finished = process_executor(track->get_executor(), length) && finished;
@@ -801,9 +812,8 @@ bool SiMMLSequencer::_parse_system_command_before(String p_command, String p_par
 	if (p_command == "#TABLE") {
 		ERR_FAIL_COND_V_MSG((number < 0 || number > 254), true, vformat("SiMMLSequencer: Parameter '%d' for command '%s' is outside of valid range (%d : %d).", number, p_command, 0, 254));
 
-		Ref<SiMMLEnvelopeTable> env_table = memnew(SiMMLEnvelopeTable);
-		env_table->parse_mml(content, postfix);
-		ERR_FAIL_COND_V_MSG(!env_table->get_data(), true, vformat("SiMMLSequencer: Invalid parameter '%s' for command '%s'.", content, p_command));
+		Ref<SiMMLEnvelopeTable> env_table = InternPoolUtil::intern_envelope_table(content, postfix);
+		ERR_FAIL_COND_V_MSG(env_table.is_null(), true, vformat("SiMMLSequencer: Invalid parameter '%s' for command '%s'.", content, p_command));
 
 		Ref<SiMMLData> simml_data = mml_data;
 		simml_data->set_envelope_table(number, env_table);
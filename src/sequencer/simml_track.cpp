@@ -20,6 +20,8 @@
 #include "sequencer/simml_envelope_table.h"
 #include "sequencer/simml_ref_table.h"
 #include "sequencer/simml_voice.h"
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
 
 SinglyLinkedList<int> *SiMMLTrack::_envelope_zero_table = nullptr;
 
@@ -632,6 +634,9 @@ void SiMMLTrack::_process_buffer(int p_length) {
 }
 
 void SiMMLTrack::buffer(int p_length) {
+	SION_TRACE_SCOPE_ARG("SiMMLTrack::buffer", get_track_id());
+	SION_ALLOC_SCOPE("SiMMLTrack::buffer");
+
 	int length = p_length;
 
 	// Check if the track is stopping.
@@ -702,6 +707,8 @@ void SiMMLTrack::_toggle_key() {
 }
 
 void SiMMLTrack::_key_on() {
+	SION_TRACE_INSTANT_ARG("SiMMLTrack::_key_on", get_track_id());
+
 	if (_callback_before_note_on.is_valid()) {
 		_callback_before_note_on.call(this);
 	}
@@ -749,6 +756,8 @@ void SiMMLTrack::_key_on() {
 }
 
 void SiMMLTrack::_key_off() {
+	SION_TRACE_INSTANT_ARG("SiMMLTrack::_key_off", get_track_id());
+
 	if (_callback_before_note_off.is_valid()) {
 		_callback_before_note_off.call(this);
 	}
@@ -7,6 +7,7 @@
 #ifndef SIMML_TRACK_H
 #define SIMML_TRACK_H
 
+#include <cstdint>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/variant/callable.hpp>
 #include <godot_cpp/templates/vector.hpp>
@@ -84,6 +85,8 @@ private:
 	// Priority number to overwrite when tracks overflow.
 	int _priority = 0;
 	int _default_fps = 0;
+	// Time spent synthesizing since last reset, usec.
+	uint64_t _processing_time = 0;
 
 	int _velocity_mode = 0;
 	int _velocity_shift = 0;
@@ -232,6 +235,10 @@ public:
 	int get_track_id() const;
 	int get_track_type_id() const;
 
+	uint64_t get_processing_time() const { return _processing_time; }
+	void add_processing_time(uint64_t p_time) { _processing_time += p_time; }
+	void reset_processing_time() { _processing_time = 0; }
+
 	// This value only is available in the track playing an MML sequence.
 	Ref<SiMMLData> get_mml_data() const { return _mml_data; }
 	Ref<BeatsPerMinute> get_bpm_settings() const;
@@ -80,6 +80,11 @@ bool SiMMLVoice::has_pitch_modulation() const {
 	return pitch_modulation_depth > 0 || pitch_modulation_depth_end > 0;
 }
 
+const SiOPMVoiceProgram *SiMMLVoice::get_program() {
+	_program.update(channel_params);
+	return &_program;
+}
+
 void SiMMLVoice::update_track_voice(SiMMLTrack *p_track) {
 	switch (module_type) {
 		case SiONModuleType::MODULE_FM: { // Registered FM voice (%6)
@@ -88,7 +93,7 @@ void SiMMLVoice::update_track_voice(SiMMLTrack *p_track) {
 
 		case SiONModuleType::MODULE_KS: { // PMS Guitar (%11)
 			p_track->set_channel_module_type(SiONModuleType::MODULE_KS, 1);
-			p_track->get_channel()->set_channel_params(channel_params, false);
+			p_track->get_channel()->set_channel_program(get_program(), false);
 			p_track->get_channel()->set_all_release_rate(pms_tension);
 			if (is_pcm_voice()) {
 				p_track->get_channel()->set_wave_data(wave_data);
@@ -98,11 +103,11 @@ void SiMMLVoice::update_track_voice(SiMMLTrack *p_track) {
 		default: { // Other sound modules.
 			if (wave_data.is_valid()) {
 				p_track->set_channel_module_type(wave_data->get_module_type(), -1);
-				p_track->get_channel()->set_channel_params(channel_params, update_volumes);
+				p_track->get_channel()->set_channel_program(get_program(), update_volumes);
 				p_track->get_channel()->set_wave_data(wave_data);
 			} else {
 				p_track->set_channel_module_type(module_type, channel_num, tone_num);
-				p_track->get_channel()->set_channel_params(channel_params, update_volumes);
+				p_track->get_channel()->set_channel_program(get_program(), update_volumes);
 			}
 		} break;
 	}
@@ -161,6 +166,7 @@ void SiMMLVoice::reset() {
 	preferable_note = -1;
 
 	channel_params->initialize();
+	_program.invalidate();
 	wave_data = Ref<SiOPMWaveBase>();
 	pms_tension = 8;
 
@@ -222,6 +228,7 @@ void SiMMLVoice::copy_from(const Ref<SiMMLVoice> &p_source) {
 	preferable_note = p_source->preferable_note;
 
 	channel_params->copy_from(p_source->channel_params);
+	_program.invalidate();
 	wave_data = p_source->wave_data;
 	pms_tension = p_source->pms_tension;
 
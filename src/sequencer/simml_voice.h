@@ -9,6 +9,7 @@
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include "chip/siopm_channel_params.h"
+#include "chip/siopm_voice_program.h"
 #include "chip/wave/siopm_wave_base.h"
 #include "sequencer/simml_envelope_table.h"
 
@@ -68,6 +69,9 @@ class SiMMLVoice : public RefCounted {
 	int note_off_pitch_envelope_step = 1;
 	int note_off_note_envelope_step = 1;
 
+	// Compiled channel params, rebuilt on demand when they change.
+	SiOPMVoiceProgram _program;
+
 protected:
 	SiONChipType chip_type = (SiONChipType)0;
 	SiONModuleType module_type = (SiONModuleType)5;
@@ -105,6 +109,7 @@ public:
 	void set_tone_num(int p_num) { tone_num = p_num; }
 
 	Ref<SiOPMChannelParams> get_channel_params() const { return channel_params; }
+	const SiOPMVoiceProgram *get_program();
 	Ref<SiOPMWaveBase> get_wave_data() const { return wave_data; }
 	void set_wave_data(const Ref<SiOPMWaveBase> &p_data) { wave_data = p_data; }
 
@@ -0,0 +1,261 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "sion_analysis_tap.h"
+
+#include <cstring>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include "utils/allocation_util.h"
+#include "utils/trace_util.h"
+
+// Configuration.
+
+void SiONAnalysisTap::set_fft_size(int p_size) {
+	ERR_FAIL_COND_MSG(_attached, "SiONAnalysisTap: Cannot change the configuration while the tap is attached.");
+	ERR_FAIL_COND_MSG(p_size < 64 || p_size > 16384 || (p_size & (p_size - 1)) != 0, "SiONAnalysisTap: FFT size must be a power of 2 between 64 and 16384.");
+
+	_fft_size = p_size;
+	_allocate();
+}
+
+void SiONAnalysisTap::set_scope_length(int p_length) {
+	ERR_FAIL_COND_MSG(_attached, "SiONAnalysisTap: Cannot change the configuration while the tap is attached.");
+	ERR_FAIL_COND_MSG(p_length < 1 || p_length > 16384, "SiONAnalysisTap: Scope length must be between 1 and 16384.");
+
+	_scope_length = p_length;
+	_allocate();
+}
+
+void SiONAnalysisTap::set_scope_decimation(int p_factor) {
+	ERR_FAIL_COND_MSG(_attached, "SiONAnalysisTap: Cannot change the configuration while the tap is attached.");
+	ERR_FAIL_COND_MSG(p_factor < 1, "SiONAnalysisTap: Scope decimation factor must be at least 1.");
+
+	_scope_decimation = p_factor;
+	_allocate();
+}
+
+void SiONAnalysisTap::_allocate() {
+	_fft = FFTUtil(_fft_size);
+
+	// Hann window, its sum is used to scale magnitudes back to the amplitude of a sine wave.
+	_window.resize_zeroed(_fft_size);
+	_window_gain = 0;
+	for (int i = 0; i < _fft_size; i++) {
+		const double value = 0.5 - 0.5 * Math::cos(Math_TAU * i / _fft_size);
+		_window.write[i] = value;
+		_window_gain += value;
+	}
+
+	const int bin_count = (_fft_size >> 1) + 1;
+
+	_fft_input.resize_zeroed(_fft_size);
+	_fft_input.fill(0);
+	_fft_input_position = 0;
+	_fft_buffer.resize_zeroed(_fft.get_spectrum_size());
+	_spectrum.resize_zeroed(bin_count);
+	_spectrum.fill(0);
+
+	_scope_ring.resize_zeroed(_scope_length);
+	_scope_ring.fill(0);
+	_scope_position = 0;
+	_scope_accumulator = 0;
+	_scope_accumulated = 0;
+
+	for (int i = 0; i < 3; i++) {
+		Snapshot &snapshot = _snapshots[i];
+		for (int j = 0; j < LEVEL_COUNT; j++) {
+			snapshot.levels[j] = 0;
+		}
+
+		snapshot.spectrum.resize_zeroed(bin_count);
+		snapshot.spectrum.fill(0);
+		snapshot.scope.resize_zeroed(_scope_length);
+		snapshot.scope.fill(0);
+	}
+}
+
+// Snapshots.
+
+const SiONAnalysisTap::Snapshot &SiONAnalysisTap::_acquire_snapshot() {
+	if (_shared_index.load(std::memory_order_acquire) & SNAPSHOT_FRESH) {
+		_read_index = _shared_index.exchange(_read_index, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+	}
+
+	return _snapshots[_read_index];
+}
+
+void SiONAnalysisTap::_publish(const float *p_levels) {
+	Snapshot &snapshot = _snapshots[_write_index];
+
+	for (int i = 0; i < LEVEL_COUNT; i++) {
+		snapshot.levels[i] = p_levels[i];
+	}
+
+	memcpy(snapshot.spectrum.ptrw(), _spectrum.ptr(), _spectrum.size() * sizeof(float));
+
+	// The scope is stored from the oldest point to the newest one.
+	float *scope = snapshot.scope.ptrw();
+	const float *scope_ring = _scope_ring.ptr();
+	const int tail_length = _scope_length - _scope_position;
+	memcpy(scope, scope_ring + _scope_position, tail_length * sizeof(float));
+	memcpy(scope + tail_length, scope_ring, _scope_position * sizeof(float));
+
+	_write_index = _shared_index.exchange(_write_index | SNAPSHOT_FRESH, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+}
+
+PackedFloat32Array SiONAnalysisTap::get_levels() {
+	const Snapshot &snapshot = _acquire_snapshot();
+
+	PackedFloat32Array levels;
+	levels.resize(LEVEL_COUNT);
+	memcpy(levels.ptrw(), snapshot.levels, LEVEL_COUNT * sizeof(float));
+	return levels;
+}
+
+PackedFloat32Array SiONAnalysisTap::get_spectrum() {
+	const Snapshot &snapshot = _acquire_snapshot();
+
+	PackedFloat32Array spectrum;
+	spectrum.resize(snapshot.spectrum.size());
+	memcpy(spectrum.ptrw(), snapshot.spectrum.ptr(), snapshot.spectrum.size() * sizeof(float));
+	return spectrum;
+}
+
+PackedFloat32Array SiONAnalysisTap::get_scope() {
+	const Snapshot &snapshot = _acquire_snapshot();
+
+	PackedFloat32Array scope;
+	scope.resize(snapshot.scope.size());
+	memcpy(scope.ptrw(), snapshot.scope.ptr(), snapshot.scope.size() * sizeof(float));
+	return scope;
+}
+
+// Processing.
+
+void SiONAnalysisTap::attach(TapTarget p_target, int p_target_index, int p_buffer_length) {
+	_target = p_target;
+	_target_index = p_target_index;
+	_attached = true;
+
+	_track_stream.resize(p_buffer_length << 1);
+	_track_stream.clear();
+	_allocate();
+}
+
+void SiONAnalysisTap::detach() {
+	_attached = false;
+}
+
+void SiONAnalysisTap::_compute_spectrum() {
+	// Unroll the input ring through the window, from the oldest sample to the newest one.
+	double *fft_buffer = _fft_buffer.ptrw();
+	const double *fft_input = _fft_input.ptr();
+	const double *window = _window.ptr();
+
+	for (int i = 0; i < _fft_size; i++) {
+		fft_buffer[i] = fft_input[(_fft_input_position + i) & (_fft_size - 1)] * window[i];
+	}
+
+	_fft.forward(fft_buffer);
+
+	float *spectrum = _spectrum.ptrw();
+	const int bin_count = _spectrum.size();
+	const double scale = 2.0 / _window_gain;
+	for (int i = 0; i < bin_count; i++) {
+		const double real = fft_buffer[i << 1];
+		const double imag = fft_buffer[(i << 1) + 1];
+		spectrum[i] = Math::sqrt(real * real + imag * imag) * scale;
+	}
+
+	// DC and Nyquist bins have no mirrored counterpart.
+	spectrum[0] *= 0.5;
+	spectrum[bin_count - 1] *= 0.5;
+}
+
+void SiONAnalysisTap::process(const Vector<double> *p_buffer, int p_channel_count, int p_length) {
+	SION_TRACE_SCOPE("SiONAnalysisTap::process");
+	SION_ALLOC_FREE_SCOPE("SiONAnalysisTap::process");
+
+	const double *buffer = p_buffer->ptr();
+	const int right_offset = (p_channel_count > 1 ? 1 : 0);
+
+	double peak_left = 0;
+	double peak_right = 0;
+	double sum_left = 0;
+	double sum_right = 0;
+
+	double *fft_input = _fft_input.ptrw();
+	float *scope_ring = _scope_ring.ptrw();
+
+	for (int i = 0; i < p_length; i++) {
+		const double left = buffer[i * p_channel_count];
+		const double right = buffer[i * p_channel_count + right_offset];
+
+		peak_left = MAX(peak_left, Math::abs(left));
+		peak_right = MAX(peak_right, Math::abs(right));
+		sum_left += left * left;
+		sum_right += right * right;
+
+		const double mono = (left + right) * 0.5;
+
+		fft_input[_fft_input_position] = mono;
+		_fft_input_position = (_fft_input_position + 1) & (_fft_size - 1);
+
+		// Each scope point is an average of several samples, which keeps the shape without aliasing.
+		_scope_accumulator += mono;
+		_scope_accumulated++;
+		if (_scope_accumulated == _scope_decimation) {
+			scope_ring[_scope_position] = _scope_accumulator / _scope_decimation;
+			_scope_position = (_scope_position + 1) % _scope_length;
+			_scope_accumulator = 0;
+			_scope_accumulated = 0;
+		}
+	}
+
+	_compute_spectrum();
+
+	float levels[LEVEL_COUNT];
+	levels[0] = peak_left;
+	levels[1] = peak_right;
+	levels[2] = (p_length > 0 ? Math::sqrt(sum_left / p_length) : 0);
+	levels[3] = (p_length > 0 ? Math::sqrt(sum_right / p_length) : 0);
+	_publish(levels);
+}
+
+//
+
+void SiONAnalysisTap::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_fft_size"), &SiONAnalysisTap::get_fft_size);
+	ClassDB::bind_method(D_METHOD("set_fft_size", "size"), &SiONAnalysisTap::set_fft_size);
+	ClassDB::bind_method(D_METHOD("get_scope_length"), &SiONAnalysisTap::get_scope_length);
+	ClassDB::bind_method(D_METHOD("set_scope_length", "length"), &SiONAnalysisTap::set_scope_length);
+	ClassDB::bind_method(D_METHOD("get_scope_decimation"), &SiONAnalysisTap::get_scope_decimation);
+	ClassDB::bind_method(D_METHOD("set_scope_decimation", "factor"), &SiONAnalysisTap::set_scope_decimation);
+
+	ClassDB::add_property("SiONAnalysisTap", PropertyInfo(Variant::INT, "fft_size"), "set_fft_size", "get_fft_size");
+	ClassDB::add_property("SiONAnalysisTap", PropertyInfo(Variant::INT, "scope_length"), "set_scope_length", "get_scope_length");
+	ClassDB::add_property("SiONAnalysisTap", PropertyInfo(Variant::INT, "scope_decimation"), "set_scope_decimation", "get_scope_decimation");
+
+	ClassDB::bind_method(D_METHOD("is_attached"), &SiONAnalysisTap::is_attached);
+	ClassDB::bind_method(D_METHOD("get_target"), &SiONAnalysisTap::get_target);
+	ClassDB::bind_method(D_METHOD("get_target_index"), &SiONAnalysisTap::get_target_index);
+
+	ClassDB::bind_method(D_METHOD("get_levels"), &SiONAnalysisTap::get_levels);
+	ClassDB::bind_method(D_METHOD("get_spectrum"), &SiONAnalysisTap::get_spectrum);
+	ClassDB::bind_method(D_METHOD("get_scope"), &SiONAnalysisTap::get_scope);
+
+	BIND_ENUM_CONSTANT(TARGET_MASTER);
+	BIND_ENUM_CONSTANT(TARGET_STREAM_SLOT);
+	BIND_ENUM_CONSTANT(TARGET_TRACK);
+	BIND_ENUM_CONSTANT(TARGET_MAX);
+}
+
+SiONAnalysisTap::SiONAnalysisTap() {
+	_shared_index.store(1);
+	_allocate();
+}
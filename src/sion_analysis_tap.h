@@ -0,0 +1,122 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_ANALYSIS_TAP_H
+#define SION_ANALYSIS_TAP_H
+
+#include <atomic>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include "chip/siopm_stream.h"
+#include "utils/fft_util.h"
+
+using namespace godot;
+
+// Measures the signal at one point of the output, see SiONDriver::attach_analysis_tap().
+// Analysis runs on the thread which renders the sound, results are handed over to the reader
+// through a triple buffer, so neither side ever waits for the other. Only one thread may read
+// snapshots at a time.
+class SiONAnalysisTap : public RefCounted {
+	GDCLASS(SiONAnalysisTap, RefCounted)
+
+public:
+	enum TapTarget {
+		TARGET_MASTER = 0,
+		TARGET_STREAM_SLOT = 1,
+		TARGET_TRACK = 2,
+		TARGET_MAX = 3
+	};
+
+	// Peak and RMS levels of the left and right channels.
+	static const int LEVEL_COUNT = 4;
+
+private:
+	struct Snapshot {
+		float levels[LEVEL_COUNT] = {};
+		Vector<float> spectrum;
+		Vector<float> scope;
+	};
+
+	// The shared index carries a flag telling if it holds a snapshot which hasn't been read yet.
+	static const int SNAPSHOT_FRESH = 4;
+	static const int SNAPSHOT_INDEX_MASK = 3;
+
+	int _fft_size = 1024;
+	int _scope_length = 512;
+	int _scope_decimation = 8;
+
+	bool _attached = false;
+	TapTarget _target = TARGET_MASTER;
+	int _target_index = 0;
+
+	// Track taps collect the output of all channels playing for the track.
+	SiOPMStream _track_stream;
+
+	// Analysis state, only touched by the rendering thread.
+
+	FFTUtil _fft;
+	Vector<double> _window;
+	double _window_gain = 0;
+	Vector<double> _fft_input;
+	int _fft_input_position = 0;
+	Vector<double> _fft_buffer;
+	Vector<float> _spectrum;
+
+	Vector<float> _scope_ring;
+	int _scope_position = 0;
+	double _scope_accumulator = 0;
+	int _scope_accumulated = 0;
+
+	Snapshot _snapshots[3];
+	int _write_index = 0;
+	std::atomic<int> _shared_index;
+	int _read_index = 2;
+
+	void _allocate();
+	void _compute_spectrum();
+	void _publish(const float *p_levels);
+	const Snapshot &_acquire_snapshot();
+
+protected:
+	static void _bind_methods();
+
+public:
+	// Configuration. Can only be changed while the tap is detached.
+
+	int get_fft_size() const { return _fft_size; }
+	void set_fft_size(int p_size);
+	int get_scope_length() const { return _scope_length; }
+	void set_scope_length(int p_length);
+	int get_scope_decimation() const { return _scope_decimation; }
+	void set_scope_decimation(int p_factor);
+
+	bool is_attached() const { return _attached; }
+	TapTarget get_target() const { return _target; }
+	int get_target_index() const { return _target_index; }
+
+	// Snapshots, read without locking.
+
+	PackedFloat32Array get_levels();
+	PackedFloat32Array get_spectrum();
+	PackedFloat32Array get_scope();
+
+	// Driver interface, called with the audio server lock held in native output modes.
+
+	void attach(TapTarget p_target, int p_target_index, int p_buffer_length);
+	void detach();
+
+	SiOPMStream *get_track_stream() { return &_track_stream; }
+	// Analyzes one buffer of interleaved samples.
+	void process(const Vector<double> *p_buffer, int p_channel_count, int p_length);
+
+	SiONAnalysisTap();
+	~SiONAnalysisTap() {}
+};
+
+VARIANT_ENUM_CAST(SiONAnalysisTap::TapTarget);
+
+#endif // SION_ANALYSIS_TAP_H
@@ -0,0 +1,129 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "sion_audio_stream.h"
+
+#include <godot_cpp/classes/audio_server.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include "sion_driver.h"
+
+// Stream.
+
+void SiONAudioStream::set_driver(SiONDriver *p_driver) {
+	// The driver is read by the audio thread while mixing.
+	AudioServer::get_singleton()->lock();
+	_driver = p_driver;
+	AudioServer::get_singleton()->unlock();
+}
+
+void SiONAudioStream::push_frames(const double *p_interleaved, int p_frames, double p_volume) {
+	const int capacity = _frames.size();
+	if (capacity == 0) {
+		return;
+	}
+
+	AudioFrame *frames_ptr = _frames.ptrw();
+	int write_position = (_read_position + _available_frames) % capacity;
+	for (int i = 0; i < p_frames; i++) {
+		frames_ptr[write_position].left = p_interleaved[i << 1] * p_volume;
+		frames_ptr[write_position].right = p_interleaved[(i << 1) + 1] * p_volume;
+		write_position = (write_position + 1) % capacity;
+	}
+
+	_available_frames += p_frames;
+	if (_available_frames > capacity) {
+		// Nobody has been reading, drop the oldest frames.
+		_read_position = (_read_position + _available_frames - capacity) % capacity;
+		_available_frames = capacity;
+	}
+}
+
+int SiONAudioStream::pop_frames(AudioFrame *p_buffer, int p_frames) {
+	const int capacity = _frames.size();
+	const int count = MIN(p_frames, _available_frames);
+
+	const AudioFrame *frames_ptr = _frames.ptr();
+	for (int i = 0; i < count; i++) {
+		p_buffer[i] = frames_ptr[_read_position];
+		_read_position = (_read_position + 1) % capacity;
+	}
+
+	_available_frames -= count;
+	return count;
+}
+
+void SiONAudioStream::clear_frames() {
+	_read_position = 0;
+	_available_frames = 0;
+}
+
+Ref<AudioStreamPlayback> SiONAudioStream::_instantiate_playback() const {
+	Ref<SiONAudioStreamPlayback> playback;
+	playback.instantiate();
+	playback->_stream = Ref<SiONAudioStream>(const_cast<SiONAudioStream *>(this));
+
+	return playback;
+}
+
+String SiONAudioStream::_get_stream_name() const {
+	return "SiON";
+}
+
+void SiONAudioStream::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_bus"), &SiONAudioStream::get_bus);
+}
+
+SiONAudioStream::SiONAudioStream(SiONDriver *p_driver, int p_bus, int p_capacity) {
+	_driver = p_driver;
+	_bus = p_bus;
+	_frames.resize(p_capacity);
+}
+
+// Playback.
+
+void SiONAudioStreamPlayback::_start(double p_from_pos) {
+	// Output is continuous, so the starting position is meaningless.
+	_active = true;
+	_mixed_frames = 0;
+	begin_resample();
+
+	// Don't play frames which were rendered while nobody was listening.
+	AudioServer::get_singleton()->lock();
+	_stream->clear_frames();
+	AudioServer::get_singleton()->unlock();
+}
+
+void SiONAudioStreamPlayback::_stop() {
+	_active = false;
+}
+
+double SiONAudioStreamPlayback::_get_playback_position() const {
+	return (double)_mixed_frames / _get_stream_sampling_rate();
+}
+
+int32_t SiONAudioStreamPlayback::_mix_resampled(AudioFrame *p_buffer, int32_t p_frames) {
+	SiONDriver *driver = _stream->get_driver();
+	if (!_active || !driver) {
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i].left = 0;
+			p_buffer[i].right = 0;
+		}
+		return p_frames;
+	}
+
+	driver->mix_output(_stream.ptr(), p_buffer, p_frames);
+	_mixed_frames += p_frames;
+	return p_frames;
+}
+
+double SiONAudioStreamPlayback::_get_stream_sampling_rate() const {
+	SiONDriver *driver = _stream->get_driver();
+	if (!driver) {
+		return 44100;
+	}
+
+	return driver->get_sample_rate();
+}
@@ -0,0 +1,88 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_AUDIO_STREAM_H
+#define SION_AUDIO_STREAM_H
+
+#include <godot_cpp/classes/audio_frame.hpp>
+#include <godot_cpp/classes/audio_stream.hpp>
+#include <godot_cpp/classes/audio_stream_playback.hpp>
+#include <godot_cpp/classes/audio_stream_playback_resampled.hpp>
+#include <godot_cpp/templates/vector.hpp>
+
+using namespace godot;
+
+class SiONAudioStreamPlayback;
+class SiONDriver;
+
+// Audio stream rendered by SiONDriver on demand, directly inside of Godot's mixer.
+// Can be played by any audio player node, including positional ones.
+class SiONAudioStream : public AudioStream {
+	GDCLASS(SiONAudioStream, AudioStream)
+
+	friend class SiONAudioStreamPlayback;
+
+	// Accessed from the audio thread, guarded by the audio server lock.
+	SiONDriver *_driver = nullptr;
+	int _bus = 0;
+
+	// Each stream is consumed at its own pace, so rendered frames are kept in a ring until read.
+	Vector<AudioFrame> _frames;
+	int _read_position = 0;
+	int _available_frames = 0;
+
+protected:
+	static void _bind_methods();
+
+public:
+	SiONDriver *get_driver() const { return _driver; }
+	void set_driver(SiONDriver *p_driver);
+	int get_bus() const { return _bus; }
+
+	int get_capacity() const { return _frames.size(); }
+	int get_available_frames() const { return _available_frames; }
+	// Oldest frames are dropped when the ring is full.
+	void push_frames(const double *p_interleaved, int p_frames, double p_volume);
+	int pop_frames(AudioFrame *p_buffer, int p_frames);
+	void clear_frames();
+
+	virtual Ref<AudioStreamPlayback> _instantiate_playback() const override;
+	virtual String _get_stream_name() const override;
+	virtual double _get_length() const override { return 0; }
+	virtual bool _is_monophonic() const override { return true; }
+
+	SiONAudioStream(SiONDriver *p_driver = nullptr, int p_bus = 0, int p_capacity = 0);
+	~SiONAudioStream() {}
+};
+
+class SiONAudioStreamPlayback : public AudioStreamPlaybackResampled {
+	GDCLASS(SiONAudioStreamPlayback, AudioStreamPlaybackResampled)
+
+	friend class SiONAudioStream;
+
+	Ref<SiONAudioStream> _stream;
+	bool _active = false;
+	int64_t _mixed_frames = 0;
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual void _start(double p_from_pos) override;
+	virtual void _stop() override;
+	virtual bool _is_playing() const override { return _active; }
+	virtual int32_t _get_loop_count() const override { return 0; }
+	virtual double _get_playback_position() const override;
+	virtual void _seek(double p_time) override {}
+
+	virtual int32_t _mix_resampled(AudioFrame *p_buffer, int32_t p_frames) override;
+	virtual double _get_stream_sampling_rate() const override;
+
+	SiONAudioStreamPlayback() {}
+	~SiONAudioStreamPlayback() {}
+};
+
+#endif // SION_AUDIO_STREAM_H
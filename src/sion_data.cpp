@@ -13,6 +13,11 @@
 #include "chip/wave/siopm_wave_sampler_data.h"
 #include "chip/wave/siopm_wave_sampler_table.h"
 
+void SiONData::set_fm_voice(int p_index, const Ref<SiONVoice> &p_voice) {
+	ERR_FAIL_COND_MSG(p_voice.is_null(), "SiONData: Cannot set an empty FM voice.");
+	set_voice(p_index, p_voice);
+}
+
 Ref<SiOPMWavePCMData> SiONData::set_pcm_wave(int p_index, const Variant &p_data, double p_sampling_note, int p_key_range_from, int p_key_range_to, int p_src_channel_count, int p_channel_count) {
 	Ref<SiOPMWavePCMTable> pcm_table = get_pcm_voice(p_index)->get_wave_data();
 	if (pcm_table.is_valid()) {
@@ -29,10 +34,12 @@ void SiONData::set_pcm_voice(int p_index, const Ref<SiONVoice> &p_voice) {
 	_pcm_voices.write[p_index & (_pcm_voices.size() - 1)] = p_voice;
 }
 
-Ref<SiOPMWaveSamplerData> SiONData::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count) {
+Ref<SiOPMWaveSamplerData> SiONData::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count, int p_root_note, int p_key_range_to, SiONSamplerQuality p_quality) {
 	int bank = (p_index >> SiOPMRefTable::NOTE_BITS) & (SiOPMRefTable::SAMPLER_TABLE_MAX - 1);
 	Ref<SiOPMWaveSamplerData> sampler_data = memnew(SiOPMWaveSamplerData(p_data, p_ignore_note_off, p_pan, p_src_channel_count, p_channel_count));
-	_sampler_tables[bank]->set_sample(sampler_data, p_index & (SiOPMRefTable::NOTE_TABLE_SIZE - 1));
+	sampler_data->set_root_note(p_root_note);
+	sampler_data->set_resampling_quality(p_quality);
+	_sampler_tables[bank]->set_sample(sampler_data, p_index & (SiOPMRefTable::NOTE_TABLE_SIZE - 1), p_key_range_to);
 	return sampler_data;
 }
 
@@ -40,3 +47,7 @@ void SiONData::set_sampler_table(int p_bank, const Ref<SiOPMWaveSamplerTable> &p
 	// Size is expected to be power of 2.
 	_sampler_tables.write[p_bank & (_sampler_tables.size() - 1)] = p_table;
 }
+
+void SiONData::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_fm_voice", "index", "voice"), &SiONData::set_fm_voice);
+}
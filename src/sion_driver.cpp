@@ -6,8 +6,11 @@
 
 #include "sion_driver.h"
 
+#include <godot_cpp/classes/audio_server.hpp>
+#include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/core/math.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 #include <godot_cpp/variant/packed_vector2_array.hpp>
 
 #include "sion_data.h"
@@ -36,6 +39,8 @@
 #include "sequencer/simml_sequencer.h"
 #include "sequencer/simml_track.h"
 #include "utils/fader_util.h"
+#include "utils/intern_pool_util.h"
+#include "utils/trace_util.h"
 #include "utils/transformer_util.h"
 
 // TODO: Extract somewhere more manageable?
@@ -44,6 +49,9 @@ const char *SiONDriver::VERSION_FLAVOR = "beta8";
 
 SiONDriver *SiONDriver::_mutex = nullptr;
 bool SiONDriver::_allow_multiple_drivers = false;
+std::mutex SiONDriver::_live_drivers_lock;
+int SiONDriver::_live_driver_count = 0;
+int SiONDriver::_live_sample_rate = 0;
 
 // Data.
 
@@ -60,7 +68,7 @@ Ref<SiOPMWaveTable> SiONDriver::set_wave_table(int p_index, Vector<double> p_tab
 	Vector<int> wave_data = TransformerUtil::transform_pcm_data(p_table, 1);
 	wave_data.resize_zeroed(1 << bits);
 
-	Ref<SiOPMWaveTable> wave_table = memnew(SiOPMWaveTable(wave_data));
+	Ref<SiOPMWaveTable> wave_table = InternPoolUtil::intern_wave_table(wave_data);
 	SiOPMRefTable::get_instance()->register_wave_table(p_index, wave_table);
 	return wave_table;
 }
@@ -74,8 +82,57 @@ Ref<SiOPMWavePCMData> SiONDriver::set_pcm_wave(int p_index, const Variant &p_dat
 	return pcm_data;
 }
 
-Ref<SiOPMWaveSamplerData> SiONDriver::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_num, int p_channel_num) {
-	return SiOPMRefTable::get_instance()->register_sampler_data(p_index, p_data, p_ignore_note_off, p_pan, p_src_channel_num, p_channel_num);
+Ref<SiOPMWaveSamplerData> SiONDriver::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_num, int p_channel_num, int p_root_note, int p_key_range_to, SiONSamplerQuality p_quality) {
+	return SiOPMRefTable::get_instance()->register_sampler_data(p_index, p_data, p_ignore_note_off, p_pan, p_src_channel_num, p_channel_num, p_root_note, p_key_range_to, p_quality);
+}
+
+void SiONDriver::load_sound(const String &p_id, const Variant &p_source) {
+	ERR_FAIL_COND_MSG(p_id.is_empty(), "SiONDriver: Cannot load a sound without an ID.");
+
+	Ref<SiOPMWaveLoader> loader = memnew(SiOPMWaveLoader(p_source));
+	SiOPMRefTable::get_instance()->sound_reference[p_id] = loader;
+
+	_loading_sound_list.push_back(loader);
+	loader->start();
+}
+
+bool SiONDriver::_update_loading_sounds() {
+	if (_loading_sound_list.is_empty()) {
+		return false;
+	}
+
+	// Dependents can be in use by the audio thread.
+	OutputLock lock(this);
+
+	bool is_loading = false;
+	List<Ref<SiOPMWaveLoader>> remaining_sounds;
+	for (const Ref<SiOPMWaveLoader> &loader : _loading_sound_list) {
+		if (loader->is_completed()) {
+			loader->finish();
+			continue;
+		}
+
+		// Sounds which nothing has referenced yet don't hold the stream back.
+		if (loader->has_dependents()) {
+			is_loading = true;
+		}
+		remaining_sounds.push_back(loader);
+	}
+
+	_loading_sound_list = remaining_sounds;
+	return is_loading;
+}
+
+void SiONDriver::_finish_loading_sounds() {
+	if (_loading_sound_list.is_empty()) {
+		return;
+	}
+
+	OutputLock lock(this);
+	for (const Ref<SiOPMWaveLoader> &loader : _loading_sound_list) {
+		loader->finish();
+	}
+	_loading_sound_list.clear();
 }
 
 void SiONDriver::set_pcm_voice(int p_index, const Ref<SiONVoice> &p_voice) {
@@ -96,32 +153,50 @@ void SiONDriver::set_voice(int p_index, const Ref<SiONVoice> &p_voice) {
 	SiMMLRefTable::get_instance()->register_master_voice(p_index, p_voice);
 }
 
+int SiONDriver::get_shared_data_count() const {
+	return InternPoolUtil::get_entry_count();
+}
+
+int64_t SiONDriver::get_shared_data_memory() const {
+	// Tables of previous songs are dropped lazily, so report only what is in use.
+	InternPoolUtil::prune();
+	return InternPoolUtil::get_memory_usage();
+}
+
 void SiONDriver::clear_all_user_tables() {
 	SiOPMRefTable::get_instance()->reset_all_user_tables();
 	SiMMLRefTable::get_instance()->reset_all_user_tables();
+	InternPoolUtil::prune();
 }
 
 SiMMLTrack *SiONDriver::create_user_controllable_track(int p_track_id) {
+	OutputLock lock(this);
 	int internal_track_id = (p_track_id & SiMMLTrack::TRACK_ID_FILTER) | SiMMLTrack::USER_CONTROLLED;
 
 	return sequencer->create_controllable_track(internal_track_id, false);
 }
 
 void SiONDriver::notify_user_defined_track(int p_event_trigger_id, int p_note) {
-	SiONTrackEvent *event = memnew(SiONTrackEvent(SiONTrackEvent::USER_DEFINED, this, nullptr, sequencer->get_stream_writing_residue(), p_note, p_event_trigger_id));
-	_track_event_queue.push_back(event);
+	OutputLock lock(this);
+	_queue_track_event(_create_track_event(SiONTrackEvent::USER_DEFINED, nullptr, sequencer->get_stream_writing_residue(), p_note, p_event_trigger_id));
 }
 
 // Background sound.
 
 void SiONDriver::_set_background_sample(const Ref<AudioStream> &p_sound) {
-	_background_sample = p_sound;
-	if (_background_sample.is_valid()) {
-		_background_sample_data = Ref<SiOPMWaveSamplerData>(memnew(SiOPMWaveSamplerData(_background_sample, true)));
-	} else {
-		_background_sample_data = Ref<SiOPMWaveSamplerData>();
+	Ref<SiOPMWaveSamplerData> sample_data;
+	if (p_sound.is_valid()) {
+		sample_data = Ref<SiOPMWaveSamplerData>(memnew(SiOPMWaveSamplerData(p_sound, true)));
 	}
 
+	_set_background_sample_data(sample_data, p_sound);
+}
+
+void SiONDriver::_set_background_sample_data(const Ref<SiOPMWaveSamplerData> &p_data, const Ref<AudioStream> &p_sound) {
+	OutputLock lock(this);
+	_background_sample = p_sound;
+	_background_sample_data = p_data;
+
 	if (_is_streaming) {
 		_start_background_sample();
 	}
@@ -133,6 +208,15 @@ void SiONDriver::set_background_sample(const Ref<AudioStream> &p_sound, double p
 	_set_background_sample(p_sound);
 }
 
+void SiONDriver::set_background_sample_file(const String &p_path, double p_mix_level, double p_loop_point) {
+	set_background_sample_volume(p_mix_level);
+	_background_loop_point = p_loop_point;
+
+	Ref<SiOPMWaveSamplerData> sample_data = memnew(SiOPMWaveSamplerData(p_path, true));
+	ERR_FAIL_COND_MSG(!sample_data->is_streamed(), vformat("SiONDriver: Cannot stream background sample from '%s'.", p_path));
+	_set_background_sample_data(sample_data);
+}
+
 void SiONDriver::clear_background_sample() {
 	_background_loop_point = -1;
 	_set_background_sample(nullptr);
@@ -162,7 +246,7 @@ void SiONDriver::_start_background_sample() {
 	if (_background_sample_data.is_valid()) {
 		_background_voice->set_wave_data(_background_sample_data);
 		if (_background_loop_point != -1) {
-			_background_sample_data->slice(-1, -1, _background_loop_point * 44100);
+			_background_sample_data->slice(-1, -1, _background_loop_point * _sample_rate);
 		}
 
 		_background_track = sequencer->create_controllable_track(SiMMLTrack::DRIVER_BACKGROUND, false);
@@ -285,7 +369,23 @@ void SiONDriver::set_max_track_count(int p_value) {
 	sequencer->set_max_track_count(p_value);
 }
 
+double SiONDriver::get_virtual_voice_threshold() const {
+	return sound_chip->get_virtual_voice_threshold();
+}
+
+void SiONDriver::set_virtual_voice_threshold(double p_threshold) {
+	ERR_FAIL_COND_MSG(p_threshold < 0, "SiONDriver: Virtual voice threshold cannot be negative.");
+
+	OutputLock lock(this);
+	sound_chip->set_virtual_voice_threshold(p_threshold);
+}
+
 void SiONDriver::_update_volume() {
+	// Native output applies the volume while mixing.
+	if (_is_native_output()) {
+		return;
+	}
+
 	double db_volume = Math::linear2db(_master_volume * _fader_volume);
 	_audio_player->set_volume_db(db_volume);
 }
@@ -312,6 +412,7 @@ void SiONDriver::set_bpm(double p_value) {
 	// You're welcome!
 	ERR_FAIL_COND_MSG(p_value < 1 || p_value > 4000, "SiONDriver: BPM must be between 1 and 4000 (inclusive).");
 
+	OutputLock lock(this);
 	sequencer->set_effective_bpm(p_value);
 }
 
@@ -366,6 +467,8 @@ void SiONDriver::_prepare_compile(String p_mml, const Ref<SiONData> &p_data) {
 
 void SiONDriver::_prepare_render(const Variant &p_data, int p_buffer_size, int p_buffer_channel_num, bool p_reset_effector) {
 	_prepare_process(p_data, p_reset_effector);
+	// Rendering can't be suspended, so the sounds must be ready now.
+	_finish_loading_sounds();
 
 	_render_buffer.clear();
 	_render_buffer.resize_zeroed(p_buffer_size);
@@ -374,6 +477,12 @@ void SiONDriver::_prepare_render(const Variant &p_data, int p_buffer_size, int p
 	_render_buffer_size_max = p_buffer_size;
 	_render_buffer_index = 0;
 
+	_profiler.reset();
+	_allocations.reset();
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		track->reset_processing_time(); // Skip seeking done while preparing.
+	}
+
 	_job_progress = 0.01;
 	_performance_stats.rendering_time = 0;
 	_current_job_type = JobType::RENDER;
@@ -381,11 +490,11 @@ void SiONDriver::_prepare_render(const Variant &p_data, int p_buffer_size, int p
 
 bool SiONDriver::_rendering() {
 	// Processing.
-	sound_chip->begin_process();
-	effector->begin_process();
-	sequencer->process();
-	effector->end_process();
-	sound_chip->end_process();
+	_profiler.begin_buffer();
+	_allocations.begin_buffer();
+	_process_buffer();
+	_allocations.end_buffer();
+	_profiler.end_buffer();
 
 	bool finished = false;
 
@@ -423,6 +532,9 @@ bool SiONDriver::_rendering() {
 }
 
 void SiONDriver::_streaming() {
+	SION_TRACE_SCOPE("SiONDriver::_streaming");
+	SION_ALLOC_SCOPE("SiONDriver::_streaming");
+
 	// Don't push new frames unless we can consume the entire buffer.
 	// This may not be the most optimal way to handle this, perhaps we should
 	// be more opportunistic and push frames as quickly as we can, keeping
@@ -437,29 +549,117 @@ void SiONDriver::_streaming() {
 	// _audio_player->get_playback_position()
 	// _performance_stats.streaming_latency = (event.position * 0.022675736961451247 - channel.position) * 1000;
 
+	_streaming_thread_id = OS::get_singleton()->get_thread_caller_id();
 	_in_streaming_process = true;
-	PackedVector2Array stream_buffer;
+	_stream_buffer.resize(_buffer_length);
 
 	if (_is_paused || _suspend_streaming) {
 		// Zero-fill when there is nothing to write.
-		for (int i = 0; i < _buffer_length; i++) {
-			stream_buffer.push_back(Vector2(0, 0));
-		}
-		_audio_playback->push_buffer(stream_buffer);
+		_stream_buffer.fill(Vector2(0, 0));
+		_audio_playback->push_buffer(_stream_buffer);
 
 		_in_streaming_process = false;
 		return;
 	}
 
-	int start_time = Time::get_singleton()->get_ticks_msec();
-	_performance_stats.streaming_time = start_time;
+	_render_stream_buffer();
+
+	// Write samples.
+	const uint64_t output_start = ProfilerUtil::get_ticks_usec();
+	const double *output_buffer = sound_chip->get_output_buffer_ptr()->ptr();
+	Vector2 *stream_buffer = _stream_buffer.ptrw();
+	for (int i = 0; i < _buffer_length; i++) {
+		stream_buffer[i] = Vector2(output_buffer[i << 1], output_buffer[(i << 1) + 1]);
+	}
+	_audio_playback->push_buffer(_stream_buffer);
+	_profiler.add_stage_time(ProfilerUtil::STAGE_OUTPUT, ProfilerUtil::get_ticks_usec() - output_start);
+	_profiler.end_buffer();
+
+	_dispatch_stream_events(_stream_buffer);
+	_allocations.end_buffer();
+
+	_in_streaming_process = false;
+}
+
+void SiONDriver::_process_buffer() {
+	SION_ALLOC_SCOPE("SiONDriver::_process_buffer");
+
+	uint64_t stage_start = ProfilerUtil::get_ticks_usec();
+	uint64_t stage_end = 0;
 
-	// Processing.
 	sound_chip->begin_process();
 	effector->begin_process();
+	_prepare_analysis_taps();
+	stage_end = ProfilerUtil::get_ticks_usec();
+	_profiler.add_stage_time(ProfilerUtil::STAGE_MIXING, stage_end - stage_start);
+	stage_start = stage_end;
+
 	sequencer->process();
+	stage_end = ProfilerUtil::get_ticks_usec();
+	const uint64_t sequencer_time = stage_end - stage_start;
+	stage_start = stage_end;
+
 	effector->end_process();
+	stage_end = ProfilerUtil::get_ticks_usec();
+	_profiler.add_stage_time(ProfilerUtil::STAGE_EFFECTS, stage_end - stage_start);
+	stage_start = stage_end;
+
 	sound_chip->end_process();
+	_process_analysis_taps();
+	_profiler.add_stage_time(ProfilerUtil::STAGE_MIXING, ProfilerUtil::get_ticks_usec() - stage_start);
+
+	for (int i = 0; i < SiOPMSoundChip::STREAM_SEND_SIZE; i++) {
+		_profiler.set_slot_time(i, effector->get_slot_processing_time(i));
+	}
+
+	// Collect synthesis times, which are a part of sequencer processing.
+
+	uint64_t synthesis_time = 0;
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		const uint64_t track_time = track->get_processing_time();
+		if (track_time > 0) {
+			_profiler.add_track_time(track->get_track_id(), track_time);
+			synthesis_time += track_time;
+			track->reset_processing_time();
+		}
+	}
+
+	_profiler.add_stage_time(ProfilerUtil::STAGE_SYNTHESIS, synthesis_time);
+	_profiler.add_stage_time(ProfilerUtil::STAGE_SEQUENCER, sequencer_time > synthesis_time ? sequencer_time - synthesis_time : 0);
+}
+
+void SiONDriver::_render_stream_buffer() {
+	SION_TRACE_SCOPE("SiONDriver::_render_stream_buffer");
+
+	int start_time = Time::get_singleton()->get_ticks_msec();
+	_performance_stats.streaming_time = start_time;
+
+	// Processing.
+	_profiler.begin_buffer();
+	_allocations.begin_buffer();
+
+	const uint64_t commands_start = ProfilerUtil::get_ticks_usec();
+	_process_commands();
+	_profiler.add_stage_time(ProfilerUtil::STAGE_SEQUENCER, ProfilerUtil::get_ticks_usec() - commands_start);
+
+	_process_buffer();
+
+	// Count voices.
+
+	_performance_stats.real_voice_count = 0;
+	_performance_stats.virtual_voice_count = 0;
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		SiOPMChannelBase *channel = track->get_channel();
+		if (!channel || channel->is_idling()) {
+			continue;
+		}
+
+		if (channel->is_virtual()) {
+			_performance_stats.virtual_voice_count++;
+		} else {
+			_performance_stats.real_voice_count++;
+		}
+	}
 
 	// Calculate an average processing time.
 
@@ -471,27 +671,41 @@ void SiONDriver::_streaming() {
 	frame_record->value = frame_time;
 	_performance_stats.total_processing_time += frame_record->value;
 	_performance_stats.update_average_processing_time();
+}
 
-	// Write samples.
-	Vector<double> *output_buffer = sound_chip->get_output_buffer_ptr();
-	for (int i = 0; i < output_buffer->size(); i += 2) {
-		stream_buffer.push_back(Vector2((*output_buffer)[i], (*output_buffer)[i + 1]));
-	}
-	_audio_playback->push_buffer(stream_buffer);
+Dictionary SiONDriver::get_performance_profile() const {
+	OutputLock lock(this);
+	return _profiler.get_report();
+}
+
+Dictionary SiONDriver::get_allocation_report() const {
+#ifndef SION_ALLOC_TRACKING_ENABLED
+	ERR_FAIL_V_MSG(Dictionary(), "SiONDriver: Allocation tracking is not compiled in, build with sion_alloc_tracking=yes.");
+#else
+	OutputLock lock(this);
+	return _allocations.get_report();
+#endif
+}
+
+Error SiONDriver::dump_trace(const String &p_path) {
+	return TraceUtil::dump_chrome_trace(p_path);
+}
+
+void SiONDriver::_dispatch_stream_events(const PackedVector2Array &p_stream_buffer) {
+	SION_ALLOC_SCOPE("SiONDriver::_dispatch_stream_events");
 
-	// Dispatch events.
 	if (_stream_event_enabled) {
-		_dispatch_event(memnew(SiONEvent(SiONEvent::STREAMING, this, stream_buffer)));
+		_dispatch_event(_create_event(SiONEvent::STREAMING, p_stream_buffer.ptr(), p_stream_buffer.size()));
 	}
 	if (!_is_finish_sequence_dispatched && sequencer->is_sequence_finished()) {
-		_dispatch_event(memnew(SiONEvent(SiONEvent::SEQUENCE_FINISHED, this)));
+		_dispatch_event(_create_event(SiONEvent::SEQUENCE_FINISHED));
 		_is_finish_sequence_dispatched = true;
 	}
 
 	bool finished = false;
 	if (_fader->execute()) {
-		String event_type = (_fader->is_incrementing() ? SiONEvent::FADE_IN_COMPLETED : SiONEvent::FADE_OUT_COMPLETED);
-		_dispatch_event(memnew(SiONEvent(event_type, this, stream_buffer)));
+		const char *event_type = (_fader->is_incrementing() ? SiONEvent::FADE_IN_COMPLETED : SiONEvent::FADE_OUT_COMPLETED);
+		_dispatch_event(_create_event(event_type));
 		finished = !_fader->is_incrementing();
 	} else {
 		finished = sequencer->is_finished();
@@ -500,6 +714,151 @@ void SiONDriver::_streaming() {
 	if (finished && _auto_stop) {
 		stop();
 	}
+}
+
+// Native output.
+
+SiONDriver::OutputLock::OutputLock(const SiONDriver *p_driver) {
+	if (p_driver->_is_native_output()) {
+		AudioServer::get_singleton()->lock();
+		_locked = true;
+	}
+}
+
+SiONDriver::OutputLock::~OutputLock() {
+	if (_locked) {
+		AudioServer::get_singleton()->unlock();
+	}
+}
+
+bool SiONDriver::_is_main_thread() const {
+	return OS::get_singleton()->get_thread_caller_id() == OS::get_singleton()->get_main_thread_id();
+}
+
+bool SiONDriver::_is_in_streaming_thread() const {
+	return _in_streaming_process && OS::get_singleton()->get_thread_caller_id() == _streaming_thread_id;
+}
+
+void SiONDriver::set_output_mode(OutputMode p_mode) {
+	ERR_FAIL_INDEX(p_mode, OUTPUT_MAX);
+	ERR_FAIL_COND_MSG(_is_streaming, "SiONDriver: Cannot change the output mode while streaming.");
+
+	_output_mode = p_mode;
+	if (_is_native_output()) {
+		_audio_player->set_volume_db(0);
+	} else {
+		_update_volume();
+	}
+}
+
+Ref<SiONAudioStream> SiONDriver::get_output_stream(int p_bus) const {
+	ERR_FAIL_INDEX_V(p_bus, _output_streams.size(), Ref<SiONAudioStream>());
+	return _output_streams[p_bus];
+}
+
+Ref<SiONAudioStream> SiONDriver::create_output_stream() {
+	OutputLock lock(this);
+
+	const int bus = sound_chip->add_output_bus();
+	Ref<SiONAudioStream> stream = memnew(SiONAudioStream(this, bus, _buffer_length * OUTPUT_RING_BUFFERS));
+	_output_streams.push_back(stream);
+
+	return stream;
+}
+
+int SiONDriver::get_track_output_bus(int p_track_id) const {
+	const int track_id = p_track_id & SiMMLTrack::TRACK_ID_FILTER;
+
+	HashMap<int, int>::ConstIterator E = _track_output_buses.find(track_id);
+	return E ? E->value : 0;
+}
+
+void SiONDriver::set_track_output_bus(int p_track_id, int p_bus) {
+	ERR_FAIL_INDEX_MSG(p_bus, _output_streams.size(), "SiONDriver: Invalid output bus index, see create_output_stream().");
+
+	OutputLock lock(this);
+
+	const int track_id = p_track_id & SiMMLTrack::TRACK_ID_FILTER;
+	if (p_bus == 0) {
+		_track_output_buses.erase(track_id);
+	} else {
+		_track_output_buses[track_id] = p_bus;
+	}
+
+	// Reroute tracks which are already playing.
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		const int track_type = track->get_track_type_id();
+		if (track->get_track_id() == track_id && (track_type == SiMMLTrack::DRIVER_NOTE || track_type == SiMMLTrack::DRIVER_SEQUENCE)) {
+			_apply_track_output_bus(track, track_id);
+		}
+	}
+}
+
+void SiONDriver::_apply_track_output_bus(SiMMLTrack *p_track, int p_track_id) {
+	if (!p_track->get_channel()) {
+		return;
+	}
+
+	// Channels pass their streams on when replaced, so this sticks until the track is reinitialized.
+	// Sends to effect slots are not rerouted and still end up in the main output.
+	const int bus = get_track_output_bus(p_track_id);
+	p_track->get_channel()->set_stream_buffer(0, bus == 0 ? nullptr : sound_chip->get_output_bus(bus));
+}
+
+void SiONDriver::mix_output(SiONAudioStream *p_stream, AudioFrame *p_buffer, int p_frames) {
+	SION_TRACE_SCOPE("SiONDriver::mix_output");
+	SION_ALLOC_SCOPE("SiONDriver::mix_output");
+
+	// The audio thread holds the audio server lock while mixing, see OutputLock.
+
+	if (!_is_streaming || _is_paused || _suspend_streaming || _preserve_stop) {
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i].left = 0;
+			p_buffer[i].right = 0;
+		}
+		return;
+	}
+
+	_streaming_thread_id = OS::get_singleton()->get_thread_caller_id();
+	_in_streaming_process = true;
+
+	// The mixer asks for arbitrary frame counts, while the engine always renders full buffers.
+	// Rendered buffers are distributed to every output stream, each consumed at its own pace.
+	const int wanted_frames = MIN(p_frames, p_stream->get_capacity());
+	while (p_stream->get_available_frames() < wanted_frames) {
+		_render_stream_buffer();
+
+		const uint64_t output_start = ProfilerUtil::get_ticks_usec();
+		const double volume = _master_volume * _fader_volume;
+		for (const Ref<SiONAudioStream> &stream : _output_streams) {
+			Vector<double> *bus_buffer = sound_chip->get_output_bus(stream->get_bus())->get_buffer_ptr();
+			stream->push_frames(bus_buffer->ptr(), _buffer_length, volume);
+		}
+
+		// Packing the buffer is only worth it when somebody listens.
+		if (_stream_event_enabled) {
+			const double *output_buffer = sound_chip->get_output_buffer_ptr()->ptr();
+			_stream_buffer.resize(_buffer_length);
+			Vector2 *stream_buffer = _stream_buffer.ptrw();
+			for (int i = 0; i < _buffer_length; i++) {
+				stream_buffer[i] = Vector2(output_buffer[i << 1], output_buffer[(i << 1) + 1]);
+			}
+		}
+		_profiler.add_stage_time(ProfilerUtil::STAGE_OUTPUT, ProfilerUtil::get_ticks_usec() - output_start);
+		_profiler.end_buffer();
+		_dispatch_stream_events(_stream_event_enabled ? _stream_buffer : PackedVector2Array());
+		_allocations.end_buffer();
+
+		if (!_is_streaming || _preserve_stop) {
+			break;
+		}
+	}
+
+	const int written = p_stream->pop_frames(p_buffer, p_frames);
+	for (int i = written; i < p_frames; i++) {
+		p_buffer[i].left = 0;
+		p_buffer[i].right = 0;
+	}
 
 	_in_streaming_process = false;
 }
@@ -549,6 +908,9 @@ PackedFloat64Array SiONDriver::render(const Variant &p_data, int p_buffer_size,
 		}
 	}
 	_performance_stats.rendering_time = Time::get_singleton()->get_ticks_msec() - start_time;
+#ifdef SION_ALLOC_TRACKING_ENABLED
+	_allocations.flush_warnings();
+#endif
 
 	PackedFloat64Array buffer;
 	for (double value : _render_buffer) {
@@ -618,19 +980,41 @@ int SiONDriver::queue_render(const Variant &p_data, int p_buffer_size, int p_buf
 // Playback.
 
 void SiONDriver::_prepare_stream(const Variant &p_data, bool p_reset_effector) {
+	OutputLock lock(this);
 	_prepare_process(p_data, p_reset_effector);
 
 	_performance_stats.total_processing_time = 0;
 	_performance_stats.processing_time_data->reset();
+	_profiler.reset();
+	_allocations.reset();
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		track->reset_processing_time(); // Skip seeking done while preparing.
+	}
 
 	_is_paused = false;
+	_preserve_stop = false;
 	_is_finish_sequence_dispatched = (p_data.get_type() == Variant::NIL);
+	_command_window_start = Time::get_singleton()->get_ticks_usec();
 
 	// Start streaming.
 	_is_streaming = true;
 	_suspend_streaming = true;
-	_audio_player->play();
-	_audio_playback = _audio_player->get_stream_playback();
+
+	if (_is_native_output()) {
+		for (const Ref<SiONAudioStream> &stream : _output_streams) {
+			stream->clear_frames();
+		}
+		_performance_stats.streaming_latency = AudioServer::get_singleton()->get_output_latency() * 1000;
+
+		if (_output_mode == OUTPUT_STREAM) {
+			_audio_player->set_stream(_output_streams[0]);
+			_audio_player->play();
+		}
+	} else {
+		_audio_player->set_stream(_audio_stream);
+		_audio_player->play();
+		_audio_playback = _audio_player->get_stream_playback();
+	}
 
 	_set_processing_immediate();
 }
@@ -649,14 +1033,22 @@ void SiONDriver::stop() {
 	if (!_is_streaming) {
 		return;
 	}
-	if (_in_streaming_process) {
+	// Stopping from within the buffer being rendered is finished once the buffer is done. Other
+	// threads stop right away, the lock waits for the audio thread to finish mixing.
+	if (_is_in_streaming_thread()) {
 		_preserve_stop = true;
 		return;
 	}
 
+	OutputLock lock(this);
+	if (!_is_streaming) {
+		return; // Stopped by another thread while waiting for the lock.
+	}
 	_preserve_stop = false;
 	_is_paused = false;
 	_is_streaming = false;
+	_command_queue->clear();
+	_retired_command_queue->clear();
 
 	clear_data(); // Original SiON doesn't do that, but that seems like an oversight.
 	clear_background_sample();
@@ -669,12 +1061,14 @@ void SiONDriver::stop() {
 	_update_volume();
 	sequencer->stop_sequence();
 
-	_dispatch_event(memnew(SiONEvent(SiONEvent::STREAM_STOPPED, this)));
+	// Listeners must not run under the audio server lock.
+	_dispatch_event(_create_event(SiONEvent::STREAM_STOPPED), true);
 
 	_performance_stats.streaming_latency = 0;
 }
 
 void SiONDriver::reset() {
+	OutputLock lock(this);
 	sequencer->reset_all_tracks();
 }
 
@@ -692,7 +1086,7 @@ SiMMLTrack *SiONDriver::_find_or_create_track(int p_track_id, double p_delay, do
 	ERR_FAIL_COND_V_MSG(p_delay < 0, nullptr, "SiONDriver: Playback delay cannot be less than zero.");
 
 	int internal_track_id = (p_track_id & SiMMLTrack::TRACK_ID_FILTER) | SiMMLTrack::DRIVER_NOTE;
-	double delay_samples = sequencer->calculate_sample_delay(0, p_delay, p_quant);
+	double delay_samples = sequencer->calculate_sample_delay(_command_sample_offset, p_delay, p_quant);
 
 	SiMMLTrack *track = nullptr;
 
@@ -728,14 +1122,17 @@ SiMMLTrack *SiONDriver::sample_on(int p_sample_number, double p_length, double p
 	ERR_FAIL_COND_V_MSG(!_is_streaming, nullptr, "SiONDriver: Driver is not streaming, you must call SiONDriver.stream() first.");
 	ERR_FAIL_COND_V_MSG(p_length < 0, nullptr, "SiONDriver: Sample length cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int delay_samples = 0;
-	SiMMLTrack *track = _find_or_create_track(p_delay, p_quant, p_track_id, p_disposable, &delay_samples);
+	SiMMLTrack *track = _find_or_create_track(p_track_id, p_delay, p_quant, p_disposable, &delay_samples);
 	if (!track) {
 		return nullptr;
 	}
 
 	track->set_channel_module_type(SiONModuleType::MODULE_SAMPLE, 0);
 	track->key_on(p_sample_number, _convert_event_length(p_length), delay_samples);
+	_apply_track_output_bus(track, p_track_id);
 
 	return track;
 }
@@ -744,8 +1141,10 @@ SiMMLTrack *SiONDriver::note_on(int p_note, const Ref<SiONVoice> &p_voice, doubl
 	ERR_FAIL_COND_V_MSG(!_is_streaming, nullptr, "SiONDriver: Driver is not streaming, you must call SiONDriver.stream() first.");
 	ERR_FAIL_COND_V_MSG(p_length < 0, nullptr, "SiONDriver: Note length cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int delay_samples = 0;
-	SiMMLTrack *track = _find_or_create_track(p_delay, p_quant, p_track_id, p_disposable, &delay_samples);
+	SiMMLTrack *track = _find_or_create_track(p_track_id, p_delay, p_quant, p_disposable, &delay_samples);
 	if (!track) {
 		return nullptr;
 	}
@@ -754,6 +1153,7 @@ SiMMLTrack *SiONDriver::note_on(int p_note, const Ref<SiONVoice> &p_voice, doubl
 		p_voice->update_track_voice(track);
 	}
 	track->key_on(p_note, _convert_event_length(p_length), delay_samples);
+	_apply_track_output_bus(track, p_track_id);
 
 	return track;
 }
@@ -763,8 +1163,10 @@ SiMMLTrack *SiONDriver::note_on_with_bend(int p_note, int p_note_to, double p_be
 	ERR_FAIL_COND_V_MSG(p_length < 0, nullptr, "SiONDriver: Note length cannot be less than zero.");
 	ERR_FAIL_COND_V_MSG(p_bend_length < 0, nullptr, "SiONDriver: Pitch bending length cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int delay_samples = 0;
-	SiMMLTrack *track = _find_or_create_track(p_delay, p_quant, p_track_id, p_disposable, &delay_samples);
+	SiMMLTrack *track = _find_or_create_track(p_track_id, p_delay, p_quant, p_disposable, &delay_samples);
 	if (!track) {
 		return nullptr;
 	}
@@ -774,6 +1176,7 @@ SiMMLTrack *SiONDriver::note_on_with_bend(int p_note, int p_note_to, double p_be
 	}
 	track->key_on(p_note, _convert_event_length(p_length), delay_samples);
 	track->bend_note(p_note_to, _convert_event_length(p_bend_length));
+	_apply_track_output_bus(track, p_track_id);
 
 	return track;
 }
@@ -782,8 +1185,10 @@ TypedArray<SiMMLTrack> SiONDriver::note_off(int p_note, int p_track_id, double p
 	ERR_FAIL_COND_V_MSG(!_is_streaming, TypedArray<SiMMLTrack>(), "SiONDriver: Driver is not streaming, you must call SiONDriver.stream() first.");
 	ERR_FAIL_COND_V_MSG(p_delay < 0, TypedArray<SiMMLTrack>(), "SiONDriver: Note off delay cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int internal_track_id = (p_track_id & SiMMLTrack::TRACK_ID_FILTER) | SiMMLTrack::DRIVER_NOTE;
-	int delay_samples = sequencer->calculate_sample_delay(0, p_delay, p_quant);
+	int delay_samples = sequencer->calculate_sample_delay(_command_sample_offset, p_delay, p_quant);
 
 	TypedArray<SiMMLTrack> tracks;
 	for (SiMMLTrack *track : sequencer->get_tracks()) {
@@ -809,8 +1214,10 @@ TypedArray<SiMMLTrack> SiONDriver::sequence_on(const Ref<SiONData> &p_data, cons
 	ERR_FAIL_COND_V_MSG(p_length < 0, TypedArray<SiMMLTrack>(), "SiONDriver: Sequence length cannot be less than zero.");
 	ERR_FAIL_COND_V_MSG(p_delay < 0, TypedArray<SiMMLTrack>(), "SiONDriver: Sequence delay cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int internal_track_id = (p_track_id & SiMMLTrack::TRACK_ID_FILTER) | SiMMLTrack::DRIVER_SEQUENCE;
-	int delay_samples = sequencer->calculate_sample_delay(0, p_delay, p_quant);
+	int delay_samples = sequencer->calculate_sample_delay(_command_sample_offset, p_delay, p_quant);
 	int length_samples = sequencer->calculate_sample_length(p_length);
 
 	TypedArray<SiMMLTrack> tracks;
@@ -825,6 +1232,7 @@ TypedArray<SiMMLTrack> SiONDriver::sequence_on(const Ref<SiONData> &p_data, cons
 			if (p_voice.is_valid()) {
 				p_voice->update_track_voice(track);
 			}
+			_apply_track_output_bus(track, p_track_id);
 
 			tracks.push_back(track);
 		}
@@ -838,8 +1246,10 @@ TypedArray<SiMMLTrack> SiONDriver::sequence_on(const Ref<SiONData> &p_data, cons
 TypedArray<SiMMLTrack> SiONDriver::sequence_off(int p_track_id, double p_delay, double p_quant, bool p_stop_with_reset) {
 	ERR_FAIL_COND_V_MSG(p_delay < 0, TypedArray<SiMMLTrack>(), "SiONDriver: Sequence off delay cannot be less than zero.");
 
+	OutputLock lock(this);
+
 	int internal_track_id = (p_track_id & SiMMLTrack::TRACK_ID_FILTER) | SiMMLTrack::DRIVER_SEQUENCE;
-	int delay_samples = sequencer->calculate_sample_delay(0, p_delay, p_quant);
+	int delay_samples = sequencer->calculate_sample_delay(_command_sample_offset, p_delay, p_quant);
 
 	TypedArray<SiMMLTrack> tracks;
 	for (SiMMLTrack *track : sequencer->get_tracks()) {
@@ -862,17 +1272,221 @@ void SiONDriver::_fade_callback(double p_value) {
 		return;
 	}
 
-	_dispatch_event(memnew(SiONEvent(SiONEvent::FADING, this)));
+	_dispatch_event(_create_event(SiONEvent::FADING));
 }
 
 void SiONDriver::fade_in(double p_time) {
+	OutputLock lock(this);
 	_fader->set_fade(0, 1, p_time * _sample_rate / _buffer_length);
 }
 
 void SiONDriver::fade_out(double p_time) {
+	OutputLock lock(this);
 	_fader->set_fade(1, 0, p_time * _sample_rate / _buffer_length);
 }
 
+// Thread-safe command queue.
+
+int SiONDriver::_push_command(SiONDriverCommand &p_command) {
+	p_command.id = ++_last_command_id;
+	p_command.timestamp = Time::get_singleton()->get_ticks_usec();
+
+	ERR_FAIL_COND_V_MSG(!_command_queue->push(p_command), -1, "SiONDriver: Command queue is full, command is dropped.");
+	return p_command.id;
+}
+
+void SiONDriver::_process_commands() {
+	SION_ALLOC_SCOPE("SiONDriver::_process_commands");
+
+	// Commands are executed with one buffer of latency. Their offset in the previous time window
+	// is mapped onto the current buffer, which keeps the relative timing between them intact.
+	const uint64_t window_end = Time::get_singleton()->get_ticks_usec();
+	const double samples_per_usec = _sample_rate / 1000000.0;
+
+	SiONDriverCommand command;
+	while (_command_queue->pop(&command)) {
+		if (command.timestamp > _command_window_start) {
+			_command_sample_offset = CLAMP((int)((command.timestamp - _command_window_start) * samples_per_usec), 0, _buffer_length - 1);
+		} else {
+			_command_sample_offset = 0;
+		}
+
+		_execute_command(command);
+
+		if (command.voice.is_valid() || command.data.is_valid()) {
+			_retired_command_queue->push(command);
+		}
+	}
+
+	_command_sample_offset = 0;
+	_command_window_start = window_end;
+}
+
+void SiONDriver::_execute_command(const SiONDriverCommand &p_command) {
+	SiMMLTrack *result_track = nullptr;
+
+	switch (p_command.type) {
+		case COMMAND_SAMPLE_ON: {
+			result_track = sample_on(p_command.note, p_command.length, p_command.delay, p_command.quant, p_command.track_id, p_command.flag);
+		} break;
+
+		case COMMAND_NOTE_ON: {
+			result_track = note_on(p_command.note, p_command.voice, p_command.length, p_command.delay, p_command.quant, p_command.track_id, p_command.flag);
+		} break;
+
+		case COMMAND_NOTE_OFF: {
+			note_off(p_command.note, p_command.track_id, p_command.delay, p_command.quant, p_command.flag);
+		} break;
+
+		case COMMAND_SEQUENCE_ON: {
+			TypedArray<SiMMLTrack> tracks = sequence_on(p_command.data, p_command.voice, p_command.length, p_command.delay, p_command.quant, p_command.track_id, p_command.flag);
+			if (tracks.size() > 0) {
+				result_track = Object::cast_to<SiMMLTrack>(tracks[0]);
+			}
+		} break;
+
+		case COMMAND_SEQUENCE_OFF: {
+			sequence_off(p_command.track_id, p_command.delay, p_command.quant, p_command.flag);
+		} break;
+
+		case COMMAND_TRACK_PARAMETER: {
+			// Parameters have no delayed form, so they are applied at the start of the buffer.
+			const int track_id = p_command.track_id & SiMMLTrack::TRACK_ID_FILTER;
+			const int value = (int)p_command.value;
+
+			for (SiMMLTrack *track : sequencer->get_tracks()) {
+				const int track_type = track->get_track_type_id();
+				if (track->get_track_id() != track_id || (track_type != SiMMLTrack::DRIVER_NOTE && track_type != SiMMLTrack::DRIVER_SEQUENCE)) {
+					continue;
+				}
+
+				switch (p_command.parameter) {
+					case TRACK_VELOCITY:        track->set_velocity(value); break;
+					case TRACK_EXPRESSION:      track->set_expression(value); break;
+					case TRACK_MASTER_VOLUME:   track->set_master_volume(value); break;
+					case TRACK_PAN:             track->set_pan(value); break;
+					case TRACK_PITCH_BEND:      track->set_pitch_bend(value); break;
+					case TRACK_MUTE:            track->set_mute(value != 0); break;
+					case TRACK_EFFECT_SEND_1:   track->set_effect_send1(value); break;
+					case TRACK_EFFECT_SEND_2:   track->set_effect_send2(value); break;
+					case TRACK_EFFECT_SEND_3:   track->set_effect_send3(value); break;
+					case TRACK_EFFECT_SEND_4:   track->set_effect_send4(value); break;
+					default: break;
+				}
+			}
+		} break;
+
+		case COMMAND_VOLUME: {
+			set_volume(p_command.value);
+		} break;
+
+		case COMMAND_BPM: {
+			set_bpm(p_command.value);
+		} break;
+
+		default: break; // Silences enum warnings.
+	}
+
+	// Results are delivered on the main thread, together with other track events.
+	Ref<SiONTrackEvent> event = _create_track_event(SiONTrackEvent::COMMAND_EXECUTED, nullptr, _command_sample_offset, p_command.note, p_command.id);
+	event->set_track(result_track);
+	_queue_track_event(event);
+}
+
+int SiONDriver::queue_sample_on(int p_sample_number, double p_length, double p_delay, double p_quant, int p_track_id, bool p_disposable) {
+	SiONDriverCommand command;
+	command.type = COMMAND_SAMPLE_ON;
+	command.note = p_sample_number;
+	command.length = p_length;
+	command.delay = p_delay;
+	command.quant = p_quant;
+	command.track_id = p_track_id;
+	command.flag = p_disposable;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_note_on(int p_note, const Ref<SiONVoice> &p_voice, double p_length, double p_delay, double p_quant, int p_track_id, bool p_disposable) {
+	SiONDriverCommand command;
+	command.type = COMMAND_NOTE_ON;
+	command.note = p_note;
+	command.voice = p_voice;
+	command.length = p_length;
+	command.delay = p_delay;
+	command.quant = p_quant;
+	command.track_id = p_track_id;
+	command.flag = p_disposable;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_note_off(int p_note, int p_track_id, double p_delay, double p_quant, bool p_stop_immediately) {
+	SiONDriverCommand command;
+	command.type = COMMAND_NOTE_OFF;
+	command.note = p_note;
+	command.track_id = p_track_id;
+	command.delay = p_delay;
+	command.quant = p_quant;
+	command.flag = p_stop_immediately;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_sequence_on(const Ref<SiONData> &p_data, const Ref<SiONVoice> &p_voice, double p_length, double p_delay, double p_quant, int p_track_id, bool p_disposable) {
+	ERR_FAIL_COND_V(p_data.is_null(), -1);
+
+	SiONDriverCommand command;
+	command.type = COMMAND_SEQUENCE_ON;
+	command.data = p_data;
+	command.voice = p_voice;
+	command.length = p_length;
+	command.delay = p_delay;
+	command.quant = p_quant;
+	command.track_id = p_track_id;
+	command.flag = p_disposable;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_sequence_off(int p_track_id, double p_delay, double p_quant, bool p_stop_with_reset) {
+	SiONDriverCommand command;
+	command.type = COMMAND_SEQUENCE_OFF;
+	command.track_id = p_track_id;
+	command.delay = p_delay;
+	command.quant = p_quant;
+	command.flag = p_stop_with_reset;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_track_parameter(int p_track_id, TrackParameter p_parameter, double p_value) {
+	ERR_FAIL_INDEX_V(p_parameter, TRACK_PARAMETER_MAX, -1);
+
+	SiONDriverCommand command;
+	command.type = COMMAND_TRACK_PARAMETER;
+	command.track_id = p_track_id;
+	command.parameter = p_parameter;
+	command.value = p_value;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_volume(double p_value) {
+	SiONDriverCommand command;
+	command.type = COMMAND_VOLUME;
+	command.value = p_value;
+
+	return _push_command(command);
+}
+
+int SiONDriver::queue_bpm(double p_value) {
+	SiONDriverCommand command;
+	command.type = COMMAND_BPM;
+	command.value = p_value;
+
+	return _push_command(command);
+}
+
 // Processing.
 
 void SiONDriver::_set_processing_queue() {
@@ -940,7 +1554,7 @@ void SiONDriver::_prepare_process(const Variant &p_data, bool p_reset_effector)
 	}
 
 	effector->prepare_process();                                     // Set effector connections.
-	_track_event_queue.clear();                                      // Clear event queue.
+	_clear_track_event_queue();                                      // Clear event queue.
 
 	//
 
@@ -1026,7 +1640,7 @@ void SiONDriver::_process_frame_queue() {
 		}
 	}
 
-	_dispatch_event(memnew(SiONEvent(SiONEvent::QUEUE_EXECUTING, this)));
+	_dispatch_event(_create_event(SiONEvent::QUEUE_EXECUTING));
 }
 
 void SiONDriver::_process_frame_immediate() {
@@ -1035,14 +1649,20 @@ void SiONDriver::_process_frame_immediate() {
 	_performance_stats.frame_rate = t - _performance_stats.frame_timestamp;
 	_performance_stats.frame_timestamp = t;
 
+	// Sounds which finish loading while streaming are handed over as well.
+	const bool is_loading = _update_loading_sounds();
+
 	// This is true at the start of streaming.
 	if (_suspend_streaming) {
+		if (_suspend_while_loading && is_loading) {
+			return;
+		}
 		_suspend_streaming = false;
 
 		// In the original code this event is cancellable and this means users can
 		// react to it to trigger an immediate stop to streaming. If this is needed
 		// in this implementation, you can just call stop() while reacting to the signal.
-		_dispatch_event(memnew(SiONEvent(SiONEvent::STREAM_STARTED, this)));
+		_dispatch_event(_create_event(SiONEvent::STREAM_STARTED));
 		return;
 	}
 
@@ -1050,20 +1670,8 @@ void SiONDriver::_process_frame_immediate() {
 		stop();
 	}
 
-	// Process events and keep the ones which are still remaining.
-	if (_track_event_queue.size() > 0) {
-		List<Ref<SiONTrackEvent>> remaining_events;
-		for (const Ref<SiONTrackEvent> &event : _track_event_queue) {
-			if (event->decrement_timer(_performance_stats.frame_rate)) {
-				_dispatch_event(event);
-				continue;
-			}
-
-			remaining_events.push_back(event);
-		}
-
-		_track_event_queue = remaining_events;
-	}
+	_retired_command_queue->clear();
+	_dispatch_track_events();
 }
 
 bool SiONDriver::_prepare_next_job() {
@@ -1075,7 +1683,7 @@ bool SiONDriver::_prepare_next_job() {
 		_queue_length = 0;
 		_clear_processing();
 
-		_dispatch_event(memnew(SiONEvent(SiONEvent::QUEUE_COMPLETED, this)));
+		_dispatch_event(_create_event(SiONEvent::QUEUE_COMPLETED));
 		return true; // Finished.
 	}
 
@@ -1120,7 +1728,7 @@ void SiONDriver::_cancel_all_jobs() {
 	_queue_length = 0;
 	_clear_processing();
 
-	_dispatch_event(memnew(SiONEvent(SiONEvent::QUEUE_CANCELLED, this)));
+	_dispatch_event(_create_event(SiONEvent::QUEUE_CANCELLED));
 }
 
 double SiONDriver::get_queue_total_progress() const {
@@ -1166,49 +1774,175 @@ double SiONDriver::_convert_event_length(double p_length) const {
 	return p_length * beat_resolution * 0.0625;
 }
 
-void SiONDriver::_dispatch_event(const Ref<SiONEvent> &p_event) {
+void SiONDriver::_dispatch_event(const Ref<SiONEvent> &p_event, bool p_deferred) {
+	SION_TRACE_INSTANT("SiONDriver::_dispatch_event");
+
 	// This method exists as a proxy. Original implementation relied on native events, whereas we
 	// want to rely on signals. For simplicity's sake, we keep original event objects but strip any
 	// Event-related logic from them. Instead, they are just data objects which we pass to signals.
 	// Signal names are event types.
 
-	String signal_name = p_event->get_event_type();
-	ERR_FAIL_COND(signal_name.is_empty());
+	ERR_FAIL_COND(p_event->get_event_type().is_empty());
+
+	// Events raised while mixing natively are delivered on the main thread.
+	if (p_deferred || !_is_main_thread()) {
+		call_deferred("_emit_event", p_event);
+		return;
+	}
+
+	_emit_event(p_event);
+}
+
+void SiONDriver::_emit_event(const Ref<SiONEvent> &p_event) {
+	// The event gets its own copy of the frames here, on the main thread, so listeners can keep
+	// the buffer without the audio thread ever having to copy it.
+	p_event->publish_stream_buffer();
+
+	emit_signal(p_event->get_event_type(), p_event);
+}
+
+// Pools are shared by the main thread and the audio thread, which already holds the lock while mixing.
+
+Ref<SiONEvent> SiONDriver::_create_event(const char *p_type, const Vector2 *p_stream_frames, int p_frame_count) {
+	OutputLock lock(this);
+
+	Ref<SiONEvent> event = _event_pool.acquire();
+	event->initialize(p_type, this, p_stream_frames, p_frame_count);
+	return event;
+}
+
+Ref<SiONTrackEvent> SiONDriver::_create_track_event(const char *p_type, SiMMLTrack *p_track, int p_buffer_index, int p_note, int p_event_trigger_id) {
+	OutputLock lock(this);
 
-	emit_signal(signal_name, p_event);
+	Ref<SiONTrackEvent> event = _track_event_pool.acquire();
+	event->initialize(p_type, this, p_track, p_buffer_index, p_note, p_event_trigger_id);
+	return event;
+}
+
+void SiONDriver::_queue_track_event(const Ref<SiONTrackEvent> &p_event, int p_batched_type) {
+	if (_track_event_count == _track_event_queue.size()) {
+		_track_event_queue.resize(MAX(16, _track_event_count * 2));
+	}
+
+	QueuedTrackEvent &queued = _track_event_queue.ptrw()[_track_event_count];
+	queued.event = p_event;
+	queued.batched_type = p_batched_type;
+	queued.track_id = (p_event->get_track() ? p_event->get_track()->get_track_id() : -1);
+	_track_event_count++;
+}
+
+void SiONDriver::_clear_track_event_queue() {
+	QueuedTrackEvent *queue = _track_event_queue.ptrw();
+	for (int i = 0; i < _track_event_count; i++) {
+		queue[i].event = Ref<SiONTrackEvent>();
+	}
+	_track_event_count = 0;
+}
+
+void SiONDriver::_dispatch_track_events() {
+	QueuedTrackEvent *due_events = nullptr;
+	int due_count = 0;
+	int batched_count = 0;
+
+	// Take out due events first, so listeners can safely queue new events or restart the driver.
+	// Only this part needs the lock, signals are emitted without blocking the audio thread.
+	{
+		OutputLock lock(this);
+		if (_track_event_count == 0) {
+			return;
+		}
+
+		if (_due_track_events.size() < _track_event_count) {
+			_due_track_events.resize(_track_event_queue.size());
+		}
+
+		QueuedTrackEvent *queue = _track_event_queue.ptrw();
+		due_events = _due_track_events.ptrw();
+		int remaining_count = 0;
+
+		for (int i = 0; i < _track_event_count; i++) {
+			QueuedTrackEvent &queued = queue[i];
+			if (!queued.event->decrement_timer(_performance_stats.frame_rate)) {
+				// Keep the order of remaining events.
+				if (remaining_count != i) {
+					queue[remaining_count] = queued;
+					queued.event = Ref<SiONTrackEvent>();
+				}
+				remaining_count++;
+				continue;
+			}
+
+			if (_batched_track_events_enabled && queued.batched_type >= 0) {
+				batched_count++;
+			}
+
+			due_events[due_count] = queued;
+			queued.event = Ref<SiONTrackEvent>();
+			due_count++;
+		}
+		_track_event_count = remaining_count;
+	}
+
+	// Each batched event is packed as its type, track ID, note, and sample offset in the buffer.
+	PackedInt32Array batched_events;
+	int32_t *batched_ptr = nullptr;
+	if (batched_count > 0) {
+		batched_events.resize(batched_count * 4);
+		batched_ptr = batched_events.ptrw();
+	}
+
+	for (int i = 0; i < due_count; i++) {
+		QueuedTrackEvent &queued = due_events[i];
+
+		if (batched_ptr && queued.batched_type >= 0) {
+			batched_ptr[0] = queued.batched_type;
+			batched_ptr[1] = queued.track_id;
+			batched_ptr[2] = (queued.batched_type == BATCHED_BEAT ? queued.event->get_event_trigger_id() : queued.event->get_note());
+			batched_ptr[3] = queued.event->get_buffer_index();
+			batched_ptr += 4;
+		} else {
+			_dispatch_event(queued.event);
+		}
+
+		// Return the event to the pool.
+		queued.event = Ref<SiONTrackEvent>();
+	}
+
+	if (batched_count > 0) {
+		static const StringName track_events_batched = StringName("track_events_batched");
+		emit_signal(track_events_batched, batched_events);
+	}
 }
 
 void SiONDriver::_note_on_callback(SiMMLTrack *p_track) {
-	_publish_note_event(p_track, p_track->get_event_trigger_type_on(), SiONTrackEvent::NOTE_ON_FRAME, SiONTrackEvent::NOTE_ON_STREAM);
+	_publish_note_event(p_track, p_track->get_event_trigger_type_on(), SiONTrackEvent::NOTE_ON_FRAME, SiONTrackEvent::NOTE_ON_STREAM, BATCHED_NOTE_ON);
 }
 
 void SiONDriver::_note_off_callback(SiMMLTrack *p_track) {
-	_publish_note_event(p_track, p_track->get_event_trigger_type_off(), SiONTrackEvent::NOTE_OFF_FRAME, SiONTrackEvent::NOTE_OFF_STREAM);
+	_publish_note_event(p_track, p_track->get_event_trigger_type_off(), SiONTrackEvent::NOTE_OFF_FRAME, SiONTrackEvent::NOTE_OFF_STREAM, BATCHED_NOTE_OFF);
 }
 
-void SiONDriver::_publish_note_event(SiMMLTrack *p_track, int p_type, String p_frame_event, String p_stream_event) {
+void SiONDriver::_publish_note_event(SiMMLTrack *p_track, int p_type, const char *p_frame_event, const char *p_stream_event, BatchedEventType p_batched_type) {
 	// Frame event; dispatch later.
 	if (p_type & 1) {
-		Ref<SiONTrackEvent> event = memnew(SiONTrackEvent(p_frame_event, this, p_track));
-		_track_event_queue.push_back(event);
+		_queue_track_event(_create_track_event(p_frame_event, p_track), p_batched_type);
 		return;
 	}
 
 	// Stream event; dispatch immediately.
 	if (p_type & 2) {
-		Ref<SiONTrackEvent> event = memnew(SiONTrackEvent(p_stream_event, this, p_track));
-		_dispatch_event(event);
+		_dispatch_event(_create_track_event(p_stream_event, p_track));
 		return;
 	}
 }
 
 void SiONDriver::_tempo_changed_callback(int p_buffer_index, bool p_dummy) {
-	Ref<SiONTrackEvent> event = memnew(SiONTrackEvent(SiONTrackEvent::BPM_CHANGED, this, nullptr, p_buffer_index));
+	Ref<SiONTrackEvent> event = _create_track_event(SiONTrackEvent::BPM_CHANGED, nullptr, p_buffer_index);
 
 	if (p_dummy && _notify_change_bpm_on_position_changed) {
 		_dispatch_event(event);
 	} else {
-		_track_event_queue.push_back(event);
+		_queue_track_event(event, BATCHED_BPM_CHANGED);
 	}
 }
 
@@ -1217,8 +1951,7 @@ void SiONDriver::_beat_callback(int p_buffer_index, int p_beat_counter) {
 		return;
 	}
 
-	Ref<SiONTrackEvent> event = memnew(SiONTrackEvent(SiONTrackEvent::STREAMING_BEAT, this, nullptr, p_buffer_index, 0, p_beat_counter));
-	_track_event_queue.push_back(event);
+	_queue_track_event(_create_track_event(SiONTrackEvent::STREAMING_BEAT, nullptr, p_buffer_index, 0, p_beat_counter), BATCHED_BEAT);
 }
 
 void SiONDriver::set_beat_callback_interval(double p_length_16th) {
@@ -1237,6 +1970,11 @@ void SiONDriver::set_beat_callback_interval(double p_length_16th) {
 
 void SiONDriver::_timer_callback() {
 	static const StringName timer_interval = StringName("timer_interval");
+	if (!_is_main_thread()) {
+		call_deferred("emit_signal", timer_interval);
+		return;
+	}
+
 	emit_signal(timer_interval);
 }
 
@@ -1252,6 +1990,118 @@ void SiONDriver::set_timer_interval(double p_length) {
 	}
 }
 
+// Analysis.
+
+void SiONDriver::attach_analysis_tap(const Ref<SiONAnalysisTap> &p_tap, SiONAnalysisTap::TapTarget p_target, int p_index) {
+	ERR_FAIL_COND_MSG(p_tap.is_null(), "SiONDriver: Cannot attach an empty analysis tap.");
+	ERR_FAIL_COND_MSG(p_tap->is_attached(), "SiONDriver: Analysis tap is already attached.");
+	ERR_FAIL_INDEX_MSG(p_target, SiONAnalysisTap::TARGET_MAX, "SiONDriver: Invalid analysis tap target.");
+	if (p_target == SiONAnalysisTap::TARGET_STREAM_SLOT) {
+		ERR_FAIL_INDEX_MSG(p_index, SiOPMSoundChip::STREAM_SEND_SIZE, "SiONDriver: Stream slot index is out of bounds.");
+	}
+
+	OutputLock lock(this);
+
+	if (p_target == SiONAnalysisTap::TARGET_TRACK) {
+		for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+			ERR_FAIL_COND_MSG(tap->get_target() == SiONAnalysisTap::TARGET_TRACK && tap->get_target_index() == p_index, vformat("SiONDriver: Track %d already has an analysis tap attached.", p_index));
+		}
+		_track_tap_count++;
+	}
+
+	p_tap->attach(p_target, p_index, _buffer_length);
+	_analysis_taps.push_back(p_tap);
+}
+
+void SiONDriver::detach_analysis_tap(const Ref<SiONAnalysisTap> &p_tap) {
+	ERR_FAIL_COND_MSG(p_tap.is_null(), "SiONDriver: Cannot detach an empty analysis tap.");
+
+	OutputLock lock(this);
+
+	const int index = _analysis_taps.find(p_tap);
+	ERR_FAIL_COND_MSG(index < 0, "SiONDriver: Analysis tap is not attached to this driver.");
+
+	if (p_tap->get_target() == SiONAnalysisTap::TARGET_TRACK) {
+		// The tap can be freed right after, so channels must forget its stream now.
+		SiOPMStream *tap_stream = p_tap->get_track_stream();
+		for (SiMMLTrack *track : sequencer->get_tracks()) {
+			SiOPMChannelBase *channel = track->get_channel();
+			if (channel && channel->get_tap_stream() == tap_stream) {
+				channel->set_tap_stream(nullptr);
+			}
+		}
+		_track_tap_count--;
+	}
+
+	p_tap->detach();
+	_analysis_taps.remove_at(index);
+}
+
+TypedArray<SiONAnalysisTap> SiONDriver::get_analysis_taps() const {
+	TypedArray<SiONAnalysisTap> taps;
+	for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+		taps.push_back(tap);
+	}
+	return taps;
+}
+
+void SiONDriver::_prepare_analysis_taps() {
+	if (_track_tap_count == 0) {
+		return;
+	}
+
+	for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+		if (tap->get_target() == SiONAnalysisTap::TARGET_TRACK) {
+			tap->get_track_stream()->clear();
+		}
+	}
+
+	// Tracks can change their channels at any time, so they are matched with taps every buffer.
+	// Channels created in the middle of the buffer take over the stream of the previous one.
+	for (SiMMLTrack *track : sequencer->get_tracks()) {
+		SiOPMChannelBase *channel = track->get_channel();
+		if (!channel) {
+			continue;
+		}
+
+		SiOPMStream *tap_stream = nullptr;
+		for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+			if (tap->get_target() == SiONAnalysisTap::TARGET_TRACK && tap->get_target_index() == track->get_track_id()) {
+				tap_stream = tap->get_track_stream();
+				break;
+			}
+		}
+		channel->set_tap_stream(tap_stream);
+	}
+}
+
+void SiONDriver::_process_analysis_taps() {
+	for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+		SiOPMStream *stream = nullptr;
+		switch (tap->get_target()) {
+			case SiONAnalysisTap::TARGET_MASTER: {
+				stream = sound_chip->get_output_stream();
+			} break;
+
+			case SiONAnalysisTap::TARGET_STREAM_SLOT: {
+				// Slots without effects are not processed separately, so there is nothing to measure.
+				stream = sound_chip->get_stream_slot(tap->get_target_index());
+			} break;
+
+			case SiONAnalysisTap::TARGET_TRACK: {
+				stream = tap->get_track_stream();
+			} break;
+
+			default: break; // Silences enum warnings.
+		}
+
+		// Streams are always interleaved stereo, even when the driver outputs mono.
+		if (stream) {
+			tap->process(stream->get_buffer_ptr(), 2, stream->get_buffer_ptr()->size() >> 1);
+		}
+	}
+}
+
 //
 
 void SiONDriver::_update_node_processing() {
@@ -1261,9 +2111,17 @@ void SiONDriver::_update_node_processing() {
 void SiONDriver::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_PROCESS: {
-			if (_is_streaming) {
+			SION_TRACE_SCOPE("SiONDriver::_notification");
+
+			if (_is_streaming && !_is_native_output()) {
 				_streaming();
 			}
+#ifdef SION_ALLOC_TRACKING_ENABLED
+			if (_is_streaming) {
+				OutputLock lock(this);
+				_allocations.flush_warnings();
+			}
+#endif
 			if (_current_frame_processing != FrameProcessingType::NONE) {
 				_process_frame();
 			}
@@ -1290,6 +2148,7 @@ void SiONDriver::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("_beat_callback", "buffer_index", "beat_counter"), &SiONDriver::_beat_callback);
 	ClassDB::bind_method(D_METHOD("_timer_callback"), &SiONDriver::_timer_callback);
+	ClassDB::bind_method(D_METHOD("_emit_event", "event"), &SiONDriver::_emit_event);
 
 	ClassDB::bind_method(D_METHOD("_fade_callback", "value"), &SiONDriver::_fade_callback);
 	ClassDB::bind_method(D_METHOD("_fade_background_callback", "value"), &SiONDriver::_fade_callback);
@@ -1313,6 +2172,16 @@ void SiONDriver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_audio_stream"), &SiONDriver::get_audio_stream);
 	ClassDB::bind_method(D_METHOD("get_audio_playback"), &SiONDriver::get_audio_playback);
 
+	ClassDB::bind_method(D_METHOD("get_output_mode"), &SiONDriver::get_output_mode);
+	ClassDB::bind_method(D_METHOD("set_output_mode", "mode"), &SiONDriver::set_output_mode);
+	ClassDB::bind_method(D_METHOD("get_output_stream", "bus"), &SiONDriver::get_output_stream, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("create_output_stream"), &SiONDriver::create_output_stream);
+	ClassDB::bind_method(D_METHOD("get_output_stream_count"), &SiONDriver::get_output_stream_count);
+	ClassDB::bind_method(D_METHOD("get_track_output_bus", "track_id"), &SiONDriver::get_track_output_bus);
+	ClassDB::bind_method(D_METHOD("set_track_output_bus", "track_id", "bus"), &SiONDriver::set_track_output_bus);
+
+	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::INT, "output_mode", PROPERTY_HINT_ENUM, "Generator,Stream,External"), "set_output_mode", "get_output_mode");
+
 	// Configuration.
 
 	ClassDB::bind_method(D_METHOD("get_track_count"), &SiONDriver::get_track_count);
@@ -1321,6 +2190,11 @@ void SiONDriver::_bind_methods() {
 
 	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::INT, "max_track_count"), "set_max_track_count", "get_max_track_count");
 
+	ClassDB::bind_method(D_METHOD("get_virtual_voice_threshold"), &SiONDriver::get_virtual_voice_threshold);
+	ClassDB::bind_method(D_METHOD("set_virtual_voice_threshold", "threshold"), &SiONDriver::set_virtual_voice_threshold);
+
+	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::FLOAT, "virtual_voice_threshold"), "set_virtual_voice_threshold", "get_virtual_voice_threshold");
+
 	ClassDB::bind_method(D_METHOD("get_buffer_length"), &SiONDriver::get_buffer_length);
 	ClassDB::bind_method(D_METHOD("get_channel_num"), &SiONDriver::get_channel_num);
 	ClassDB::bind_method(D_METHOD("get_sample_rate"), &SiONDriver::get_sample_rate);
@@ -1343,6 +2217,17 @@ void SiONDriver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_stream_event_enabled", "enabled"), &SiONDriver::set_stream_event_enabled);
 	ClassDB::bind_method(D_METHOD("set_fading_event_enabled", "enabled"), &SiONDriver::set_fading_event_enabled);
 
+	ClassDB::bind_method(D_METHOD("is_batched_track_events_enabled"), &SiONDriver::is_batched_track_events_enabled);
+	ClassDB::bind_method(D_METHOD("set_batched_track_events_enabled", "enabled"), &SiONDriver::set_batched_track_events_enabled);
+
+	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::BOOL, "batched_track_events_enabled"), "set_batched_track_events_enabled", "is_batched_track_events_enabled");
+
+	// Analysis.
+
+	ClassDB::bind_method(D_METHOD("attach_analysis_tap", "tap", "target", "index"), &SiONDriver::attach_analysis_tap, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("detach_analysis_tap", "tap"), &SiONDriver::detach_analysis_tap);
+	ClassDB::bind_method(D_METHOD("get_analysis_taps"), &SiONDriver::get_analysis_taps);
+
 	// Processing, compiling, rendering.
 
 	ClassDB::bind_method(D_METHOD("compile", "mml"), &SiONDriver::compile);
@@ -1369,6 +2254,28 @@ void SiONDriver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("sequence_on", "data", "voice", "length", "delay", "quantize", "track_id", "disposable"), &SiONDriver::sequence_on, DEFVAL((Object *)nullptr), DEFVAL(0), DEFVAL(0), DEFVAL(1), DEFVAL(0), DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("sequence_off", "track_id", "delay", "quantize", "stop_with_reset"), &SiONDriver::sequence_off, DEFVAL(0), DEFVAL(1), DEFVAL(false));
 
+	ClassDB::bind_method(D_METHOD("queue_sample_on", "sample_number", "length", "delay", "quantize", "track_id", "disposable"), &SiONDriver::queue_sample_on, DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("queue_note_on", "note", "voice", "length", "delay", "quantize", "track_id", "disposable"), &SiONDriver::queue_note_on, DEFVAL((Object *)nullptr), DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("queue_note_off", "note", "track_id", "delay", "quantize", "stop_immediately"), &SiONDriver::queue_note_off, DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("queue_sequence_on", "data", "voice", "length", "delay", "quantize", "track_id", "disposable"), &SiONDriver::queue_sequence_on, DEFVAL((Object *)nullptr), DEFVAL(0), DEFVAL(0), DEFVAL(1), DEFVAL(0), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("queue_sequence_off", "track_id", "delay", "quantize", "stop_with_reset"), &SiONDriver::queue_sequence_off, DEFVAL(0), DEFVAL(1), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("queue_track_parameter", "track_id", "parameter", "value"), &SiONDriver::queue_track_parameter);
+	ClassDB::bind_method(D_METHOD("queue_volume", "value"), &SiONDriver::queue_volume);
+	ClassDB::bind_method(D_METHOD("queue_bpm", "bpm"), &SiONDriver::queue_bpm);
+
+	ClassDB::bind_method(D_METHOD("set_sampler_wave", "index", "data", "ignore_note_off", "pan", "src_channel_num", "channel_num", "root_note", "key_range_to", "quality"), &SiONDriver::set_sampler_wave, DEFVAL(false), DEFVAL(0), DEFVAL(2), DEFVAL(0), DEFVAL(-1), DEFVAL(-1), DEFVAL(SAMPLER_QUALITY_MEDIUM));
+	ClassDB::bind_method(D_METHOD("load_sound", "id", "source"), &SiONDriver::load_sound);
+	ClassDB::bind_method(D_METHOD("get_loading_sound_count"), &SiONDriver::get_loading_sound_count);
+	ClassDB::bind_method(D_METHOD("get_suspend_while_loading"), &SiONDriver::get_suspend_while_loading);
+	ClassDB::bind_method(D_METHOD("set_suspend_while_loading", "enabled"), &SiONDriver::set_suspend_while_loading);
+
+	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::BOOL, "suspend_while_loading"), "set_suspend_while_loading", "get_suspend_while_loading");
+
+	ClassDB::bind_method(D_METHOD("get_sample_format"), &SiONDriver::get_sample_format);
+	ClassDB::bind_method(D_METHOD("set_sample_format", "format"), &SiONDriver::set_sample_format);
+
+	ClassDB::add_property("SiONDriver", PropertyInfo(Variant::INT, "sample_format", PROPERTY_HINT_ENUM, "Float32,Int16"), "set_sample_format", "get_sample_format");
+
 	ClassDB::bind_method(D_METHOD("get_data"), &SiONDriver::get_data);
 	ClassDB::bind_method(D_METHOD("clear_data"), &SiONDriver::clear_data);
 
@@ -1385,6 +2292,13 @@ void SiONDriver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_compiling_time"), &SiONDriver::get_compiling_time);
 	ClassDB::bind_method(D_METHOD("get_rendering_time"), &SiONDriver::get_rendering_time);
 	ClassDB::bind_method(D_METHOD("get_processing_time"), &SiONDriver::get_processing_time);
+	ClassDB::bind_method(D_METHOD("get_performance_profile"), &SiONDriver::get_performance_profile);
+	ClassDB::bind_method(D_METHOD("get_allocation_report"), &SiONDriver::get_allocation_report);
+	ClassDB::bind_static_method("SiONDriver", D_METHOD("dump_trace", "path"), &SiONDriver::dump_trace);
+	ClassDB::bind_method(D_METHOD("get_real_voice_count"), &SiONDriver::get_real_voice_count);
+	ClassDB::bind_method(D_METHOD("get_virtual_voice_count"), &SiONDriver::get_virtual_voice_count);
+	ClassDB::bind_method(D_METHOD("get_shared_data_count"), &SiONDriver::get_shared_data_count);
+	ClassDB::bind_method(D_METHOD("get_shared_data_memory"), &SiONDriver::get_shared_data_memory);
 
 	//
 
@@ -1410,9 +2324,34 @@ void SiONDriver::_bind_methods() {
 	ADD_SIGNAL(MethodInfo(SiONTrackEvent::STREAMING_BEAT, PropertyInfo(Variant::OBJECT, "event", PROPERTY_HINT_RESOURCE_TYPE, "SiONTrackEvent")));
 	ADD_SIGNAL(MethodInfo(SiONTrackEvent::BPM_CHANGED, PropertyInfo(Variant::OBJECT, "event", PROPERTY_HINT_RESOURCE_TYPE, "SiONTrackEvent")));
 	ADD_SIGNAL(MethodInfo(SiONTrackEvent::USER_DEFINED, PropertyInfo(Variant::OBJECT, "event", PROPERTY_HINT_RESOURCE_TYPE, "SiONTrackEvent")));
+	ADD_SIGNAL(MethodInfo(SiONTrackEvent::COMMAND_EXECUTED, PropertyInfo(Variant::OBJECT, "event", PROPERTY_HINT_RESOURCE_TYPE, "SiONTrackEvent")));
+	ADD_SIGNAL(MethodInfo("track_events_batched", PropertyInfo(Variant::PACKED_INT32_ARRAY, "events")));
 
 	//
 
+	BIND_ENUM_CONSTANT(OUTPUT_GENERATOR);
+	BIND_ENUM_CONSTANT(OUTPUT_STREAM);
+	BIND_ENUM_CONSTANT(OUTPUT_EXTERNAL);
+	BIND_ENUM_CONSTANT(OUTPUT_MAX);
+
+	BIND_ENUM_CONSTANT(TRACK_VELOCITY);
+	BIND_ENUM_CONSTANT(TRACK_EXPRESSION);
+	BIND_ENUM_CONSTANT(TRACK_MASTER_VOLUME);
+	BIND_ENUM_CONSTANT(TRACK_PAN);
+	BIND_ENUM_CONSTANT(TRACK_PITCH_BEND);
+	BIND_ENUM_CONSTANT(TRACK_MUTE);
+	BIND_ENUM_CONSTANT(TRACK_EFFECT_SEND_1);
+	BIND_ENUM_CONSTANT(TRACK_EFFECT_SEND_2);
+	BIND_ENUM_CONSTANT(TRACK_EFFECT_SEND_3);
+	BIND_ENUM_CONSTANT(TRACK_EFFECT_SEND_4);
+	BIND_ENUM_CONSTANT(TRACK_PARAMETER_MAX);
+
+	BIND_ENUM_CONSTANT(BATCHED_NOTE_ON);
+	BIND_ENUM_CONSTANT(BATCHED_NOTE_OFF);
+	BIND_ENUM_CONSTANT(BATCHED_BEAT);
+	BIND_ENUM_CONSTANT(BATCHED_BPM_CHANGED);
+	BIND_ENUM_CONSTANT(BATCHED_EVENT_MAX);
+
 	BIND_ENUM_CONSTANT(CHIP_AUTO);
 	BIND_ENUM_CONSTANT(CHIP_SIOPM);
 	BIND_ENUM_CONSTANT(CHIP_OPL);
@@ -1516,15 +2455,36 @@ void SiONDriver::_bind_methods() {
 	BIND_ENUM_CONSTANT(PULSE_PCM);
 	BIND_ENUM_CONSTANT(PULSE_USER_CUSTOM);
 	BIND_ENUM_CONSTANT(PULSE_USER_PCM);
+
+	BIND_ENUM_CONSTANT(SAMPLER_QUALITY_LINEAR);
+	BIND_ENUM_CONSTANT(SAMPLER_QUALITY_MEDIUM);
+	BIND_ENUM_CONSTANT(SAMPLER_QUALITY_HIGH);
+	BIND_ENUM_CONSTANT(SAMPLER_QUALITY_MAX);
+
+	BIND_ENUM_CONSTANT(SAMPLE_FORMAT_FLOAT32);
+	BIND_ENUM_CONSTANT(SAMPLE_FORMAT_INT16);
+	BIND_ENUM_CONSTANT(SAMPLE_FORMAT_MAX);
 }
 
 SiONDriver::SiONDriver(int p_buffer_length, int p_channel_num, int p_sample_rate, int p_bitrate) {
-	ERR_FAIL_COND_MSG(!_allow_multiple_drivers && _mutex, "SiONDriver: Only one driver instance is allowed.");
-	_mutex = this;
-
 	ERR_FAIL_COND_MSG((p_buffer_length != 2048 && p_buffer_length != 4096 && p_buffer_length != 8192), "SiONDriver: Buffer length can only be 2048, 4096, or 8192.");
 	ERR_FAIL_COND_MSG((p_channel_num != 1 && p_channel_num != 2), "SiONDriver: Channel number can only be 1 (mono) or 2 (stereo).");
-	ERR_FAIL_COND_MSG((p_sample_rate != 44100), "SiONDriver: Sampling rate can only be 44100.");
+	ERR_FAIL_COND_MSG((p_sample_rate != 44100 && p_sample_rate != 48000), "SiONDriver: Sampling rate can only be 44100 or 48000.");
+
+	{
+		std::lock_guard<std::mutex> lock(_live_drivers_lock);
+
+		ERR_FAIL_COND_MSG(!_allow_multiple_drivers && _live_driver_count > 0, "SiONDriver: Only one driver instance is allowed.");
+		ERR_FAIL_COND_MSG(_live_driver_count > 0 && _live_sample_rate != p_sample_rate, vformat("SiONDriver: Sampling rate must match the existing driver (%d).", _live_sample_rate));
+
+		_live_driver_count++;
+		_live_sample_rate = p_sample_rate;
+		_is_live = true;
+		_mutex = this;
+	}
+
+	// Generate reference tables now, rather than on the first use by the audio thread.
+	SiOPMRefTable::initialize(p_sample_rate);
 
 	sound_chip = memnew(SiOPMSoundChip);
 	effector = memnew(SiEffector(sound_chip));
@@ -1545,6 +2505,9 @@ SiONDriver::SiONDriver(int p_buffer_length, int p_channel_num, int p_sample_rate
 		_audio_stream->set_buffer_length((double)p_buffer_length / p_sample_rate);
 		_audio_player->set_stream(_audio_stream);
 
+		Ref<SiONAudioStream> output_stream = memnew(SiONAudioStream(this, 0, p_buffer_length * OUTPUT_RING_BUFFERS));
+		_output_streams.push_back(output_stream);
+
 		_fader = memnew(FaderUtil);
 		_fader->set_callback(Callable(this, "_fade_callback"));
 	}
@@ -1577,13 +2540,41 @@ SiONDriver::SiONDriver(int p_buffer_length, int p_channel_num, int p_sample_rate
 		_timer_interval_event = _timer_sequence->append_new_event(MMLEvent::GLOBAL_WAIT, 0, 0);
 	}
 
+	_command_queue = memnew(MPSCRingBuffer<SiONDriverCommand>(COMMAND_QUEUE_SIZE));
+	_retired_command_queue = memnew(MPSCRingBuffer<SiONDriverCommand>(COMMAND_QUEUE_SIZE));
+	_last_command_id.store(0);
+	// Every executed command reports back with a frame event. Make room for a full command queue
+	// up front, so bursts of commands don't grow the event queue on the audio thread.
+	_track_event_queue.resize(COMMAND_QUEUE_SIZE);
+	_due_track_events.resize(COMMAND_QUEUE_SIZE);
+
 	_performance_stats.processing_time_data = memnew(SinglyLinkedList<int>(TIME_AVERAGING_COUNT, 0, true));
+	_profiler = ProfilerUtil(SiOPMSoundChip::STREAM_SEND_SIZE);
+	_profiler.set_buffer_duration(_buffer_length, _sample_rate);
 	_performance_stats.total_processing_time_ratio = _sample_rate / (_buffer_length * TIME_AVERAGING_COUNT);
 }
 
 SiONDriver::~SiONDriver() {
-	if (_mutex == this) {
-		_mutex = nullptr;
+	if (_is_live) {
+		std::lock_guard<std::mutex> lock(_live_drivers_lock);
+
+		_live_driver_count--;
+		if (_mutex == this) {
+			_mutex = nullptr;
+		}
+	}
+
+	// Streams may outlive the driver if they are still referenced by players.
+	for (const Ref<SiONAudioStream> &stream : _output_streams) {
+		stream->set_driver(nullptr);
+	}
+
+	// Every worker task must be collected.
+	_finish_loading_sounds();
+
+	// Taps may outlive the driver and be attached to another one.
+	for (const Ref<SiONAnalysisTap> &tap : _analysis_taps) {
+		tap->detach();
 	}
 
 	_timer_interval_event = nullptr;
@@ -1591,6 +2582,8 @@ SiONDriver::~SiONDriver() {
 
 	memdelete(_fader);
 	memdelete(_background_fader);
+	memdelete(_command_queue);
+	memdelete(_retired_command_queue);
 
 	memdelete(sequencer);
 	memdelete(effector);
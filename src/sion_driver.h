@@ -7,6 +7,9 @@
 #ifndef SION_DRIVER_H
 #define SION_DRIVER_H
 
+#include <atomic>
+#include <mutex>
+#include <godot_cpp/classes/audio_frame.hpp>
 #include <godot_cpp/classes/audio_stream.hpp>
 #include <godot_cpp/classes/audio_stream_generator.hpp>
 #include <godot_cpp/classes/audio_stream_generator_playback.hpp>
@@ -17,13 +20,20 @@
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 
+#include "sion_analysis_tap.h"
+#include "sion_audio_stream.h"
 #include "sion_voice.h"
+#include "chip/wave/siopm_wave_loader.h"
 #include "chip/wave/siopm_wave_sampler_data.h"
 #include "events/sion_event.h"
 #include "events/sion_track_event.h"
 #include "sequencer/base/mml_data.h"
 #include "sequencer/base/mml_system_command.h"
+#include "templates/mpsc_ring_buffer.h"
+#include "templates/ref_pool.h"
 #include "templates/singly_linked_list.h"
+#include "utils/allocation_util.h"
+#include "utils/profiler_util.h"
 
 using namespace godot;
 
@@ -61,6 +71,38 @@ public:
 		NEM_MAX = 4
 	};
 
+	// Ways to deliver the output to Godot.
+	enum OutputMode {
+		OUTPUT_GENERATOR = 0, // Push buffers to an AudioStreamGenerator from the main thread (default).
+		OUTPUT_STREAM = 1,    // Mix into Godot's mixer on the audio thread, using the driver's own player.
+		OUTPUT_EXTERNAL = 2,  // Same as OUTPUT_STREAM, but the output stream must be played by a user's node.
+		OUTPUT_MAX = 3
+	};
+
+	// Track parameters which can be changed with queue_track_parameter().
+	enum TrackParameter {
+		TRACK_VELOCITY = 0,
+		TRACK_EXPRESSION = 1,
+		TRACK_MASTER_VOLUME = 2,
+		TRACK_PAN = 3,
+		TRACK_PITCH_BEND = 4,
+		TRACK_MUTE = 5,
+		TRACK_EFFECT_SEND_1 = 6,
+		TRACK_EFFECT_SEND_2 = 7,
+		TRACK_EFFECT_SEND_3 = 8,
+		TRACK_EFFECT_SEND_4 = 9,
+		TRACK_PARAMETER_MAX = 10
+	};
+
+	// Types of events delivered by the track_events_batched signal.
+	enum BatchedEventType {
+		BATCHED_NOTE_ON = 0,
+		BATCHED_NOTE_OFF = 1,
+		BATCHED_BEAT = 2,
+		BATCHED_BPM_CHANGED = 3,
+		BATCHED_EVENT_MAX = 4
+	};
+
 private:
 	enum FrameProcessingType {
 		NONE = 0,
@@ -73,6 +115,12 @@ private:
 	// Single unique instance.
 	static SiONDriver *_mutex;
 	static bool _allow_multiple_drivers;
+	// Reference tables are shared, so every live driver must render at the same rate. Tracked
+	// separately from the instance above, which only points to the latest driver.
+	static std::mutex _live_drivers_lock;
+	static int _live_driver_count;
+	static int _live_sample_rate;
+	bool _is_live = false;
 
 	SiOPMSoundChip *sound_chip = nullptr;
 	SiEffector *effector = nullptr;
@@ -92,6 +140,34 @@ private:
 
 	FaderUtil *_fader = nullptr;
 
+	// Native output.
+
+	// Size of each output stream's ring, in engine buffers.
+	static const int OUTPUT_RING_BUFFERS = 3;
+
+	OutputMode _output_mode = OUTPUT_GENERATOR;
+	// One stream per sound chip output bus, the main output is the 1st one.
+	Vector<Ref<SiONAudioStream>> _output_streams;
+	// Track ID to output bus routing.
+	HashMap<int, int> _track_output_buses;
+
+	void _apply_track_output_bus(SiMMLTrack *p_track, int p_track_id);
+
+	// In native output modes engine state is shared with the audio thread. It is guarded by
+	// the audio server lock, which the audio thread holds while mixing.
+	class OutputLock {
+		bool _locked = false;
+
+	public:
+		OutputLock(const SiONDriver *p_driver);
+		~OutputLock();
+	};
+
+	bool _is_native_output() const { return _output_mode != OUTPUT_GENERATOR; }
+	bool _is_main_thread() const;
+	// True when called from within the stream buffer being rendered, e.g. by a listener.
+	bool _is_in_streaming_thread() const;
+
 	// Background sound.
 
 	Ref<AudioStream> _background_sample;
@@ -110,6 +186,7 @@ private:
 	FaderUtil *_background_fader = nullptr;
 
 	void _set_background_sample(const Ref<AudioStream> &p_sound);
+	void _set_background_sample_data(const Ref<SiOPMWaveSamplerData> &p_data, const Ref<AudioStream> &p_sound = Ref<AudioStream>());
 	void _start_background_sample();
 	void _fade_background_callback(double p_value);
 
@@ -119,7 +196,7 @@ private:
 	int _buffer_length = 2048;
 	// Output channels (1 or 2).
 	int _channel_num = 2;
-	// Output frequency ratio (44100 or 22050).
+	// Output frequency ratio (44100 or 48000).
 	double _sample_rate = 44100;
 	// Output bitrate. Value of 0 means that the wave is represented by a float in [-1,+1].
 	int _bitrate = 0;
@@ -129,15 +206,27 @@ private:
 	bool _beat_event_enabled = false;
 	bool _stream_event_enabled = false;
 	bool _fading_event_enabled = false;
-
-	bool _is_streaming = false;
-	bool _in_streaming_process = false;
+	// Deliver frame note, beat, and BPM events with one signal per frame.
+	bool _batched_track_events_enabled = false;
+	// Reused by every streamed buffer. Streaming events copy it, so it's always written in place.
+	PackedVector2Array _stream_buffer;
+
+	// Streaming state is read by the audio thread in native output modes, and set from the main thread.
+	std::atomic<bool> _is_streaming = { false };
+	std::atomic<bool> _in_streaming_process = { false };
+	// Thread which renders the current stream buffer, valid while _in_streaming_process is set.
+	std::atomic<uint64_t> _streaming_thread_id = { 0 };
 	// Preserve stop after streaming.
-	bool _preserve_stop = false;
-	bool _suspend_streaming = false;
+	std::atomic<bool> _preserve_stop = { false };
+	std::atomic<bool> _suspend_streaming = { false };
 	// Suspend starting steam while loading.
 	bool _suspend_while_loading = true;
-	Vector<Variant> _loading_sound_list;
+	List<Ref<SiOPMWaveLoader>> _loading_sound_list;
+
+	// Hands over sounds decoded by now. Returns true if a sound still in use is loading.
+	bool _update_loading_sounds();
+	// Blocks until every sound is loaded.
+	void _finish_loading_sounds();
 	// If true, FINISH_SEQUENCE event has already been dispatched.
 	bool _is_finish_sequence_dispatched = false;
 
@@ -151,14 +240,26 @@ private:
 	void _prepare_compile(String p_mml, const Ref<SiONData> &p_data);
 	void _prepare_render(const Variant &p_data, int p_buffer_size, int p_buffer_channel_num, bool p_reset_effector);
 	void _prepare_stream(const Variant &p_data, bool p_reset_effector);
+	// Shared by rendering and streaming, records stage times to the profiler.
+	void _process_buffer();
 	bool _rendering();
 	void _streaming();
+	void _render_stream_buffer();
+	void _dispatch_stream_events(const PackedVector2Array &p_stream_buffer);
+
+	// Analysis.
+
+	Vector<Ref<SiONAnalysisTap>> _analysis_taps;
+	int _track_tap_count = 0;
+
+	void _prepare_analysis_taps();
+	void _process_analysis_taps();
 
 	// Playback.
 
 	// Auto stop when the sequence finishes.
 	bool _auto_stop = false;
-	bool _is_paused = false;
+	std::atomic<bool> _is_paused = { false };
 	double _start_position = 0; // ms
 	double _master_volume = 1;
 	double _fader_volume = 1;
@@ -169,6 +270,56 @@ private:
 
 	SiMMLTrack *_find_or_create_track(int p_track_id, double p_delay, double p_quant, bool p_disposable, int *r_delay_samples);
 
+	// Thread-safe command queue.
+
+	static const int COMMAND_QUEUE_SIZE = 1024;
+
+	enum CommandType {
+		COMMAND_NONE = 0,
+		COMMAND_SAMPLE_ON = 1,
+		COMMAND_NOTE_ON = 2,
+		COMMAND_NOTE_OFF = 3,
+		COMMAND_SEQUENCE_ON = 4,
+		COMMAND_SEQUENCE_OFF = 5,
+		COMMAND_TRACK_PARAMETER = 6,
+		COMMAND_VOLUME = 7,
+		COMMAND_BPM = 8,
+	};
+
+	// Commands are plain values, so they can be safely passed between threads.
+	struct SiONDriverCommand {
+		CommandType type = CommandType::COMMAND_NONE;
+		int id = 0;
+		uint64_t timestamp = 0; // usec
+
+		Ref<SiONVoice> voice;
+		Ref<SiONData> data;
+
+		int note = 0;
+		int track_id = 0;
+		int parameter = 0;
+		double value = 0;
+		double length = 0;
+		double delay = 0;
+		double quant = 0;
+		// Disposable for note on commands, stop immediately/with reset for note off commands.
+		bool flag = false;
+	};
+
+	MPSCRingBuffer<SiONDriverCommand> *_command_queue = nullptr;
+	// Executed commands which hold voices or data. Their references are released on the main thread,
+	// because dropping the last one frees the object.
+	MPSCRingBuffer<SiONDriverCommand> *_retired_command_queue = nullptr;
+	std::atomic<int> _last_command_id;
+	// Start of the time window covered by the buffer being processed, usec.
+	uint64_t _command_window_start = 0;
+	// Sample offset of the command being executed. Added to all delays computed by note methods.
+	int _command_sample_offset = 0;
+
+	int _push_command(SiONDriverCommand &p_command);
+	void _process_commands();
+	void _execute_command(const SiONDriverCommand &p_command);
+
 	void _update_volume();
 	void _fade_callback(double p_value);
 
@@ -207,20 +358,45 @@ private:
 	double _job_progress = 0;
 	JobType _current_job_type = JobType::NO_JOB;
 	List<SiONDriverJob> _job_queue;
-	List<Ref<SiONTrackEvent>> _track_event_queue;
 
 	bool _prepare_next_job();
 	void _cancel_all_jobs();
 
 	// Events.
 
+	struct QueuedTrackEvent {
+		Ref<SiONTrackEvent> event;
+		// One of BatchedEventType, or -1 if the event is always emitted on its own.
+		int batched_type = -1;
+		int track_id = -1;
+	};
+
+	// Events are reused once nobody references them anymore.
+	static const int EVENT_POOL_SIZE = 16;
+	static const int TRACK_EVENT_POOL_SIZE = 1024;
+	RefPool<SiONEvent> _event_pool = RefPool<SiONEvent>(EVENT_POOL_SIZE);
+	RefPool<SiONTrackEvent> _track_event_pool = RefPool<SiONTrackEvent>(TRACK_EVENT_POOL_SIZE);
+
+	// Frame events waiting to be dispatched. Lists only grow, entries past the count are empty.
+	Vector<QueuedTrackEvent> _track_event_queue;
+	int _track_event_count = 0;
+	Vector<QueuedTrackEvent> _due_track_events;
+
 	double _convert_event_length(double p_length) const;
 
-	void _dispatch_event(const Ref<SiONEvent> &p_event);
+	// Deferred events are always delivered on the next message queue flush, outside of any lock.
+	void _dispatch_event(const Ref<SiONEvent> &p_event, bool p_deferred = false);
+	void _emit_event(const Ref<SiONEvent> &p_event);
+
+	Ref<SiONEvent> _create_event(const char *p_type, const Vector2 *p_stream_frames = nullptr, int p_frame_count = 0);
+	Ref<SiONTrackEvent> _create_track_event(const char *p_type, SiMMLTrack *p_track, int p_buffer_index = 0, int p_note = 0, int p_event_trigger_id = 0);
+	void _queue_track_event(const Ref<SiONTrackEvent> &p_event, int p_batched_type = -1);
+	void _clear_track_event_queue();
+	void _dispatch_track_events();
 
 	void _note_on_callback(SiMMLTrack *p_track);
 	void _note_off_callback(SiMMLTrack *p_track);
-	void _publish_note_event(SiMMLTrack *p_track, int p_type, String p_frame_event, String p_stream_event);
+	void _publish_note_event(SiMMLTrack *p_track, int p_type, const char *p_frame_event, const char *p_stream_event, BatchedEventType p_batched_type);
 
 	void _tempo_changed_callback(int p_buffer_index, bool p_dummy);
 	void _beat_callback(int p_buffer_index, int p_beat_counter);
@@ -261,12 +437,20 @@ private:
 		int frame_timestamp = 0;
 		// Frame rate, ms.
 		int frame_rate = 1;
+		// Playing channels in the previous buffer, synthesized and virtualized.
+		int real_voice_count = 0;
+		int virtual_voice_count = 0;
 
 		void update_average_processing_time() {
 			average_processing_time = total_processing_time * total_processing_time_ratio;
 		}
 	} _performance_stats;
 
+	// High resolution timing of processing stages, see get_performance_profile().
+	ProfilerUtil _profiler;
+	// Heap activity during processing, see get_allocation_report().
+	AllocationUtil _allocations;
+
 	//
 
 	void _update_node_processing();
@@ -304,7 +488,10 @@ public:
 
 	Ref<SiOPMWaveTable> set_wave_table(int p_index, Vector<double> p_table);
 	Ref<SiOPMWavePCMData> set_pcm_wave(int p_index, const Variant &p_data, double p_sampling_note = 69, int p_key_range_from = 0, int p_key_range_to = 127, int p_src_channel_num = 2, int p_channel_num = 0);
-	Ref<SiOPMWaveSamplerData> set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off = false, int p_pan = 0, int p_src_channel_num = 2, int p_channel_num = 0);
+	Ref<SiOPMWaveSamplerData> set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off = false, int p_pan = 0, int p_src_channel_num = 2, int p_channel_num = 0, int p_root_note = -1, int p_key_range_to = -1, SiONSamplerQuality p_quality = SAMPLER_QUALITY_MEDIUM);
+	// Loads and decodes the sound on a worker thread, making it available to #SAMPLER and #PCMWAVE commands by its ID.
+	void load_sound(const String &p_id, const Variant &p_source);
+	int get_loading_sound_count() const { return _loading_sound_list.size(); }
 	void set_pcm_voice(int p_index, const Ref<SiONVoice> &p_voice);
 	void set_sampler_table(int p_bank, const Ref<SiOPMWaveSamplerTable> &p_table);
 	void set_envelope_table(int p_index, Vector<int> p_table, int p_loop_point = -1);
@@ -321,10 +508,22 @@ public:
 	Ref<AudioStreamGeneratorPlayback> get_audio_playback() const { return _audio_playback; }
 	FaderUtil *get_fader() const { return _fader; }
 
+	OutputMode get_output_mode() const { return _output_mode; }
+	void set_output_mode(OutputMode p_mode);
+	Ref<SiONAudioStream> get_output_stream(int p_bus = 0) const;
+	Ref<SiONAudioStream> create_output_stream();
+	int get_output_stream_count() const { return _output_streams.size(); }
+	int get_track_output_bus(int p_track_id) const;
+	void set_track_output_bus(int p_track_id, int p_bus);
+	// Called by output streams on the audio thread.
+	void mix_output(SiONAudioStream *p_stream, AudioFrame *p_buffer, int p_frames);
+
 	// Background sound.
 
 	Ref<AudioStream> get_background_sample() const { return _background_sample; }
 	void set_background_sample(const Ref<AudioStream> &p_sound, double p_mix_level = 0.5, double p_loop_point = -1);
+	// Streams the sample from a WAV file instead of decoding it fully into memory.
+	void set_background_sample_file(const String &p_path, double p_mix_level = 0.5, double p_loop_point = -1);
 	void clear_background_sample();
 	Ref<SiOPMWaveSamplerData> get_background_sample_data() const { return _background_sample_data; }
 	SiMMLTrack *get_background_sample_track() const { return _background_track; }
@@ -345,6 +544,9 @@ public:
 	int get_max_track_count() const;
 	void set_max_track_count(int p_value);
 
+	double get_virtual_voice_threshold() const;
+	void set_virtual_voice_threshold(double p_threshold);
+
 	int get_buffer_length() const { return _buffer_length; }
 	int get_channel_num() const { return _channel_num; }
 	double get_sample_rate() const { return _sample_rate; }
@@ -369,12 +571,17 @@ public:
 	double get_streaming_position() const;
 	void set_start_position(double p_value);
 
-	bool get_suspend_while_loading() { return _suspend_while_loading; }
+	bool get_suspend_while_loading() const { return _suspend_while_loading; }
 	void set_suspend_while_loading(bool p_enabled) { _suspend_while_loading = p_enabled; }
+	// Affects sampler data created afterwards, including data of loaded sounds.
+	SiONSampleFormat get_sample_format() const { return SiOPMWaveSamplerData::get_default_format(); }
+	void set_sample_format(SiONSampleFormat p_format) { SiOPMWaveSamplerData::set_default_format(p_format); }
 
 	void set_beat_event_enabled(bool p_enabled) { _beat_event_enabled = p_enabled; }
 	void set_stream_event_enabled(bool p_enabled) { _stream_event_enabled = p_enabled; }
 	void set_fading_event_enabled(bool p_enabled) { _fading_event_enabled = p_enabled; }
+	bool is_batched_track_events_enabled() const { return _batched_track_events_enabled; }
+	void set_batched_track_events_enabled(bool p_enabled) { _batched_track_events_enabled = p_enabled; }
 
 	Ref<SiONData> compile(String p_mml);
 	int queue_compile(String p_mml);
@@ -405,6 +612,18 @@ public:
 	void fade_in(double p_time);
 	void fade_out(double p_time);
 
+	// Thread-safe control. Commands are executed at the start of the next streamed buffer,
+	// offset within it by the time they were queued at.
+
+	int queue_sample_on(int p_sample_number, double p_length = 0, double p_delay = 0, double p_quant = 0, int p_track_id = 0, bool p_disposable = true);
+	int queue_note_on(int p_note, const Ref<SiONVoice> &p_voice = Ref<SiONVoice>(), double p_length = 0, double p_delay = 0, double p_quant = 0, int p_track_id = 0, bool p_disposable = true);
+	int queue_note_off(int p_note, int p_track_id = 0, double p_delay = 0, double p_quant = 0, bool p_stop_immediately = false);
+	int queue_sequence_on(const Ref<SiONData> &p_data, const Ref<SiONVoice> &p_voice = Ref<SiONVoice>(), double p_length = 0, double p_delay = 0, double p_quant = 1, int p_track_id = 0, bool p_disposable = true);
+	int queue_sequence_off(int p_track_id, double p_delay = 0, double p_quant = 1, bool p_stop_with_reset = false);
+	int queue_track_parameter(int p_track_id, TrackParameter p_parameter, double p_value);
+	int queue_volume(double p_value);
+	int queue_bpm(double p_value);
+
 	// Processing.
 
 	double get_queue_job_progress() const { return _job_progress; }
@@ -420,6 +639,12 @@ public:
 	// Note: Original code takes a callback. Here you need to connect to the `timer_interval` signal.
 	void set_timer_interval(double p_length = 1);
 
+	// Analysis.
+
+	void attach_analysis_tap(const Ref<SiONAnalysisTap> &p_tap, SiONAnalysisTap::TapTarget p_target, int p_index = 0);
+	void detach_analysis_tap(const Ref<SiONAnalysisTap> &p_tap);
+	TypedArray<SiONAnalysisTap> get_analysis_taps() const;
+
 	// MIDI.
 	// FIXME: Implement SMF/MIDI support.
 
@@ -430,8 +655,17 @@ public:
 	int get_compiling_time() const { return _performance_stats.compiling_time; }
 	int get_rendering_time() const { return _performance_stats.rendering_time; }
 	int get_processing_time() const { return _performance_stats.average_processing_time; }
+	Dictionary get_performance_profile() const;
+	Dictionary get_allocation_report() const;
+	// Only available in builds with tracing compiled in, see TraceUtil.
+	static Error dump_trace(const String &p_path);
 
 	double get_streaming_latency() const { return _performance_stats.streaming_latency; }
+	int get_real_voice_count() const { return _performance_stats.real_voice_count; }
+	int get_virtual_voice_count() const { return _performance_stats.virtual_voice_count; }
+	// Tables and wave data shared between all songs, see InternPoolUtil.
+	int get_shared_data_count() const;
+	int64_t get_shared_data_memory() const;
 
 	//
 
@@ -439,4 +673,8 @@ public:
 	~SiONDriver();
 };
 
+VARIANT_ENUM_CAST(SiONDriver::OutputMode);
+VARIANT_ENUM_CAST(SiONDriver::TrackParameter);
+VARIANT_ENUM_CAST(SiONDriver::BatchedEventType);
+
 #endif // SION_DRIVER_H
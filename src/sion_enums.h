@@ -58,6 +58,21 @@ enum SiONPitchTableType : unsigned int {
 	PITCH_TABLE_MAX
 };
 
+// Resampling quality of pitched sampler notes, see SiOPMWaveSamplerResampler.
+enum SiONSamplerQuality : unsigned int {
+	SAMPLER_QUALITY_LINEAR = 0, // Linear interpolation between 2 frames.
+	SAMPLER_QUALITY_MEDIUM = 1, // 8-tap windowed sinc (default).
+	SAMPLER_QUALITY_HIGH   = 2, // 32-tap windowed sinc, with interpolation between kernel phases.
+	SAMPLER_QUALITY_MAX
+};
+
+// Storage format of sampler data. Samples are kept compact in memory and are mixed as is.
+enum SiONSampleFormat : unsigned int {
+	SAMPLE_FORMAT_FLOAT32 = 0, // Default.
+	SAMPLE_FORMAT_INT16   = 1, // Half the memory of float32, at the cost of precision.
+	SAMPLE_FORMAT_MAX
+};
+
 // A.k.a. wave/waveform shapes.
 enum SiONPulseGeneratorType : int {
 	PULSE_SINE				= 0,    // sine wave.
@@ -141,5 +156,7 @@ VARIANT_ENUM_CAST(SiONChipType);
 VARIANT_ENUM_CAST(SiONModuleType);
 VARIANT_ENUM_CAST(SiONPitchTableType);
 VARIANT_ENUM_CAST(SiONPulseGeneratorType);
+VARIANT_ENUM_CAST(SiONSamplerQuality);
+VARIANT_ENUM_CAST(SiONSampleFormat);
 
 #endif // SION_ENUMS_H
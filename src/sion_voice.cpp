@@ -20,6 +20,7 @@
 #include "chip/wave/siopm_wave_sampler_table.h"
 #include "chip/wave/siopm_wave_table.h"
 #include "utils/godot_util.h"
+#include "utils/intern_pool_util.h"
 #include "utils/translator_util.h"
 
 void SiONVoice::set_params(TypedArray<int> p_args) {
@@ -208,8 +209,7 @@ Ref<SiOPMWaveTable> SiONVoice::set_wave_table(Vector<double> *p_data) {
 		table.append(table_index);
 	}
 
-	Ref<SiOPMWaveTable> wave_table = memnew(SiOPMWaveTable(table));
-	wave_data = wave_table;
+	wave_data = InternPoolUtil::intern_wave_table(table);
 
 	return wave_data;
 }
@@ -243,16 +243,18 @@ Ref<SiOPMWavePCMData> SiONVoice::set_pcm_wave(int p_index, const Variant &p_data
 	return pcm_data;
 }
 
-Ref<SiOPMWaveSamplerData> SiONVoice::set_sampler_voice(const Variant &p_data, bool p_ignore_note_off, int p_channel_count) {
+Ref<SiOPMWaveSamplerData> SiONVoice::set_sampler_voice(const Variant &p_data, bool p_ignore_note_off, int p_channel_count, int p_root_note, SiONSamplerQuality p_quality) {
 	module_type = SiONModuleType::MODULE_SAMPLE;
 
 	Ref<SiOPMWaveSamplerData> sampler_data = memnew(SiOPMWaveSamplerData(p_data, p_ignore_note_off, 0, 2, p_channel_count));
+	sampler_data->set_root_note(p_root_note);
+	sampler_data->set_resampling_quality(p_quality);
 	wave_data = sampler_data;
 
 	return wave_data;
 }
 
-Ref<SiOPMWaveSamplerData> SiONVoice::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count) {
+Ref<SiOPMWaveSamplerData> SiONVoice::set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off, int p_pan, int p_src_channel_count, int p_channel_count, int p_root_note, int p_key_range_to, SiONSamplerQuality p_quality) {
 	module_type = SiONModuleType::MODULE_SAMPLE;
 
 	Ref<SiOPMWaveSamplerTable> sampler_table = wave_data;
@@ -262,7 +264,9 @@ Ref<SiOPMWaveSamplerData> SiONVoice::set_sampler_wave(int p_index, const Variant
 	}
 
 	Ref<SiOPMWaveSamplerData> sampler_data = memnew(SiOPMWaveSamplerData(p_data, p_ignore_note_off, p_pan, p_src_channel_count, p_channel_count));
-	sampler_table->set_sample(sampler_data, p_index & (SiOPMRefTable::NOTE_TABLE_SIZE - 1));
+	sampler_data->set_root_note(p_root_note);
+	sampler_data->set_resampling_quality(p_quality);
+	sampler_table->set_sample(sampler_data, p_index & (SiOPMRefTable::NOTE_TABLE_SIZE - 1), p_key_range_to);
 
 	return sampler_data;
 }
@@ -394,6 +398,9 @@ void SiONVoice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_mml", "index", "chip_type", "append_postfix"), &SiONVoice::get_mml, DEFVAL(SiONChipType::CHIP_AUTO), DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("set_by_mml", "mml"), &SiONVoice::set_by_mml);
 
+	ClassDB::bind_method(D_METHOD("set_sampler_voice", "data", "ignore_note_off", "channel_count", "root_note", "quality"), &SiONVoice::set_sampler_voice, DEFVAL(false), DEFVAL(2), DEFVAL(-1), DEFVAL(SAMPLER_QUALITY_MEDIUM));
+	ClassDB::bind_method(D_METHOD("set_sampler_wave", "index", "data", "ignore_note_off", "pan", "src_channel_count", "channel_count", "root_note", "key_range_to", "quality"), &SiONVoice::set_sampler_wave, DEFVAL(false), DEFVAL(0), DEFVAL(2), DEFVAL(0), DEFVAL(-1), DEFVAL(-1), DEFVAL(SAMPLER_QUALITY_MEDIUM));
+
 	ClassDB::bind_method(D_METHOD("set_pms_guitar", "attack_rate", "decay_rate", "total_level", "fixed_pitch", "wave_shape", "tension"), &SiONVoice::set_pms_guitar, DEFVAL(48), DEFVAL(48), DEFVAL(0), DEFVAL(69), DEFVAL(20), DEFVAL(8));
 	ClassDB::bind_method(D_METHOD("set_analog_like", "connection_type", "wave_shape1", "wave_shape2", "balance", "pitch_difference"), &SiONVoice::set_analog_like, DEFVAL(1), DEFVAL(1), DEFVAL(0), DEFVAL(0));
 
@@ -20,6 +20,7 @@ class SiOPMWaveSamplerData;
 class SiOPMWaveSamplerTable;
 enum SiONChipType : signed int;
 enum SiONModuleType : unsigned int;
+enum SiONSamplerQuality : unsigned int;
 
 // Provides all of voice setting parameters of SiON.
 class SiONVoice : public SiMMLVoice {
@@ -62,8 +63,8 @@ public:
 
 	Ref<SiOPMWavePCMData> set_pcm_voice(const Variant &p_data, int p_sampling_note = 69, int p_src_channel_count = 2, int p_channel_count = 0);
 	Ref<SiOPMWavePCMData> set_pcm_wave(int p_index, const Variant &p_data, int p_sampling_note = 69, int p_key_range_from = 0, int p_key_range_to = 127, int p_src_channel_count = 2, int p_channel_count = 0);
-	Ref<SiOPMWaveSamplerData> set_sampler_voice(const Variant &p_data, bool p_ignore_note_off = false, int p_channel_count = 2);
-	Ref<SiOPMWaveSamplerData> set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off = false, int p_pan = 0, int p_src_channel_count = 2, int p_channel_count = 0);
+	Ref<SiOPMWaveSamplerData> set_sampler_voice(const Variant &p_data, bool p_ignore_note_off = false, int p_channel_count = 2, int p_root_note = -1, SiONSamplerQuality p_quality = (SiONSamplerQuality)1);
+	Ref<SiOPMWaveSamplerData> set_sampler_wave(int p_index, const Variant &p_data, bool p_ignore_note_off = false, int p_pan = 0, int p_src_channel_count = 2, int p_channel_count = 0, int p_root_note = -1, int p_key_range_to = -1, SiONSamplerQuality p_quality = (SiONSamplerQuality)1);
 
 	void set_sampler_table(const Ref<SiOPMWaveSamplerTable> &p_table);
 
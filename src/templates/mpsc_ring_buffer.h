@@ -0,0 +1,117 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_MPSC_RING_BUFFER_H
+#define SION_MPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <godot_cpp/core/memory.hpp>
+
+using namespace godot;
+
+// A bounded lock-free queue with many producers and a single consumer.
+// Each cell carries a sequence number which tells producers and the consumer whose turn it is
+// to access the cell (see Dmitry Vyukov's bounded MPMC queue). Neither side ever blocks, a full
+// queue simply rejects new values.
+template <class T>
+class MPSCRingBuffer {
+
+	struct Cell {
+		std::atomic<uint32_t> sequence;
+		T value;
+	};
+
+	// Keep the producer and consumer cursors on separate cache lines.
+	static const int CACHE_LINE_SIZE = 64;
+
+	Cell *_cells = nullptr;
+	uint32_t _capacity = 0;
+	uint32_t _mask = 0;
+
+	alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _enqueue_position;
+	alignas(CACHE_LINE_SIZE) uint32_t _dequeue_position = 0;
+
+public:
+	uint32_t get_capacity() const { return _capacity; }
+
+	// Safe to call from any thread. Returns false if the queue is full.
+	bool push(const T &p_value) {
+		Cell *cell = nullptr;
+		uint32_t position = _enqueue_position.load(std::memory_order_relaxed);
+
+		while (true) {
+			cell = &_cells[position & _mask];
+			const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const int32_t diff = (int32_t)(sequence - position);
+
+			if (diff == 0) {
+				// The cell is free, try to claim it.
+				if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			} else if (diff < 0) {
+				// The consumer hasn't freed this cell yet.
+				return false;
+			} else {
+				// Another producer has claimed the cell, catch up.
+				position = _enqueue_position.load(std::memory_order_relaxed);
+			}
+		}
+
+		cell->value = p_value;
+		cell->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Must only be called from the consumer thread. Returns false if the queue is empty.
+	bool pop(T *r_value) {
+		Cell *cell = &_cells[_dequeue_position & _mask];
+		const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+		if ((int32_t)(sequence - (_dequeue_position + 1)) < 0) {
+			return false;
+		}
+
+		*r_value = cell->value;
+		// The cell lets go of its references, the consumer keeps its own. Values are never freed
+		// here, the consumer decides where they are released.
+		cell->value = T();
+		cell->sequence.store(_dequeue_position + _capacity, std::memory_order_release);
+		_dequeue_position++;
+		return true;
+	}
+
+	// Must only be called from the consumer thread.
+	void clear() {
+		T value;
+		while (pop(&value)) {
+			// Discard.
+		}
+	}
+
+	// Capacity is rounded up to the next power of 2, and is at least 2.
+	MPSCRingBuffer(uint32_t p_capacity = 1024) {
+		_capacity = 2;
+		while (_capacity < p_capacity) {
+			_capacity <<= 1;
+		}
+		_mask = _capacity - 1;
+
+		_cells = memnew_arr(Cell, _capacity);
+		for (uint32_t i = 0; i < _capacity; i++) {
+			_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		_enqueue_position.store(0, std::memory_order_relaxed);
+	}
+
+	~MPSCRingBuffer() {
+		if (_cells) {
+			memdelete_arr(_cells);
+		}
+	}
+};
+
+#endif // SION_MPSC_RING_BUFFER_H
@@ -0,0 +1,65 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_REF_POOL_H
+#define SION_REF_POOL_H
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/templates/vector.hpp>
+
+using namespace godot;
+
+// A pool of reference-counted objects. An object is handed out again once nothing but the pool
+// references it, so objects kept by users are never modified. Handed out objects are not reset,
+// callers must reinitialize them.
+// Only a few objects past the cursor are checked for reuse, if none is free a new object is
+// created. The pool grows up to its maximum size, objects created past it are not pooled.
+template <class T>
+class RefPool {
+	static const int SCAN_LENGTH = 4;
+
+	Vector<Ref<T>> _objects;
+	int _max_size = 0;
+	int _cursor = 0;
+
+public:
+	int get_size() const { return _objects.size(); }
+	int get_max_size() const { return _max_size; }
+
+	Ref<T> acquire() {
+		const int size = _objects.size();
+		const Ref<T> *objects = _objects.ptr();
+
+		const int scan_length = MIN(size, SCAN_LENGTH);
+		for (int i = 0; i < scan_length; i++) {
+			const Ref<T> &object = objects[_cursor];
+			_cursor = (_cursor + 1) % size;
+
+			if (object->get_reference_count() == 1) {
+				return object;
+			}
+		}
+
+		Ref<T> object;
+		object.instantiate();
+		if (size < _max_size) {
+			_objects.push_back(object);
+		}
+		return object;
+	}
+
+	void clear() {
+		_objects.clear();
+		_cursor = 0;
+	}
+
+	RefPool(int p_max_size) {
+		_max_size = p_max_size;
+	}
+};
+
+#endif // SION_REF_POOL_H
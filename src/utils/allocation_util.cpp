@@ -0,0 +1,223 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "allocation_util.h"
+
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/godot.hpp>
+#include <godot_cpp/variant/array.hpp>
+
+AllocationUtil::AllocFunction AllocationUtil::_original_alloc = nullptr;
+AllocationUtil::ReallocFunction AllocationUtil::_original_realloc = nullptr;
+AllocationUtil::FreeFunction AllocationUtil::_original_free = nullptr;
+
+thread_local AllocationUtil *AllocationUtil::_active_tracker = nullptr;
+thread_local const char *AllocationUtil::_current_section = nullptr;
+thread_local int AllocationUtil::_allocation_free_depth = 0;
+
+void *AllocationUtil::_alloc_hook(size_t p_bytes) {
+	if (_active_tracker) {
+		_active_tracker->_record(false, p_bytes);
+	}
+	return _original_alloc(p_bytes);
+}
+
+void *AllocationUtil::_realloc_hook(void *p_ptr, size_t p_bytes) {
+	if (_active_tracker) {
+		_active_tracker->_record(false, p_bytes);
+	}
+	return _original_realloc(p_ptr, p_bytes);
+}
+
+void AllocationUtil::_free_hook(void *p_ptr) {
+	if (_active_tracker) {
+		_active_tracker->_record(true, 0);
+	}
+	_original_free(p_ptr);
+}
+
+void AllocationUtil::install_hooks() {
+#ifdef SION_ALLOC_TRACKING_ENABLED
+	if (_original_alloc) {
+		return;
+	}
+
+	_original_alloc = internal::gdextension_interface_mem_alloc;
+	_original_realloc = internal::gdextension_interface_mem_realloc;
+	_original_free = internal::gdextension_interface_mem_free;
+
+	internal::gdextension_interface_mem_alloc = &_alloc_hook;
+	internal::gdextension_interface_mem_realloc = &_realloc_hook;
+	internal::gdextension_interface_mem_free = &_free_hook;
+#endif
+}
+
+void AllocationUtil::uninstall_hooks() {
+	if (!_original_alloc) {
+		return;
+	}
+
+	// Hooks only forward, so memory allocated through them can be freed by the originals.
+	internal::gdextension_interface_mem_alloc = _original_alloc;
+	internal::gdextension_interface_mem_realloc = _original_realloc;
+	internal::gdextension_interface_mem_free = _original_free;
+
+	_original_alloc = nullptr;
+	_original_realloc = nullptr;
+	_original_free = nullptr;
+}
+
+//
+
+AllocationUtil::Site *AllocationUtil::_find_site(Site *p_sites, int &r_site_count, const char *p_name, bool p_is_allocation_free) {
+	// Names are literals, so comparing pointers is enough.
+	for (int i = 0; i < r_site_count; i++) {
+		if (p_sites[i].name == p_name) {
+			return &p_sites[i];
+		}
+	}
+
+	// When out of space, everything else goes into the last site.
+	if (r_site_count == MAX_SITES) {
+		Site *site = &p_sites[MAX_SITES - 1];
+		site->name = "(other)";
+		return site;
+	}
+
+	Site *site = &p_sites[r_site_count];
+	r_site_count++;
+
+	*site = Site();
+	site->name = p_name;
+	site->is_allocation_free = p_is_allocation_free;
+	return site;
+}
+
+void AllocationUtil::_record(bool p_is_free, size_t p_bytes) {
+	const char *section = (_current_section ? _current_section : "(unmarked)");
+	const bool is_allocation_free = (_allocation_free_depth > 0);
+
+	Site *site = _find_site(_sites, _site_count, section, is_allocation_free);
+	Site *violation = (is_allocation_free ? _find_site(_violations, _violation_count, section, true) : nullptr);
+
+	if (p_is_free) {
+		_free_count++;
+		site->free_count++;
+		if (violation) {
+			violation->free_count++;
+		}
+	} else {
+		_allocation_count++;
+		_allocated_bytes += p_bytes;
+		site->allocation_count++;
+		site->allocated_bytes += p_bytes;
+		if (violation) {
+			violation->allocation_count++;
+			violation->allocated_bytes += p_bytes;
+		}
+	}
+}
+
+void AllocationUtil::begin_buffer() {
+#ifdef SION_ALLOC_TRACKING_ENABLED
+	_site_count = 0;
+	_allocation_count = 0;
+	_free_count = 0;
+	_allocated_bytes = 0;
+	_engine_memory_start = (int64_t)OS::get_singleton()->get_static_memory_usage();
+
+	_active_tracker = this;
+#endif
+}
+
+void AllocationUtil::end_buffer() {
+#ifdef SION_ALLOC_TRACKING_ENABLED
+	if (_active_tracker != this) {
+		return;
+	}
+	_active_tracker = nullptr;
+
+	_engine_memory_delta = (int64_t)OS::get_singleton()->get_static_memory_usage() - _engine_memory_start;
+
+	_buffer_count++;
+	_total_allocation_count += _allocation_count;
+	if (_allocation_count > 0 || _free_count > 0) {
+		_dirty_buffer_count++;
+	}
+#endif
+}
+
+void AllocationUtil::reset() {
+	_site_count = 0;
+	_allocation_count = 0;
+	_free_count = 0;
+	_allocated_bytes = 0;
+	_engine_memory_delta = 0;
+
+	_buffer_count = 0;
+	_dirty_buffer_count = 0;
+	_total_allocation_count = 0;
+}
+
+Dictionary AllocationUtil::get_report() const {
+	Dictionary report;
+
+#ifdef SION_ALLOC_TRACKING_ENABLED
+	report["allocation_count"] = (int64_t)_allocation_count;
+	report["free_count"] = (int64_t)_free_count;
+	report["allocated_bytes"] = (int64_t)_allocated_bytes;
+	report["engine_memory_delta"] = _engine_memory_delta;
+
+	Array sites;
+	for (int i = 0; i < _site_count; i++) {
+		const Site &site = _sites[i];
+
+		Dictionary site_report;
+		site_report["name"] = String(site.name);
+		site_report["allocation_free"] = site.is_allocation_free;
+		site_report["allocation_count"] = (int64_t)site.allocation_count;
+		site_report["free_count"] = (int64_t)site.free_count;
+		site_report["allocated_bytes"] = (int64_t)site.allocated_bytes;
+		sites.push_back(site_report);
+	}
+	report["sites"] = sites;
+
+	report["buffer_count"] = (int64_t)_buffer_count;
+	report["dirty_buffer_count"] = (int64_t)_dirty_buffer_count;
+	report["total_allocation_count"] = (int64_t)_total_allocation_count;
+#endif
+
+	return report;
+}
+
+void AllocationUtil::flush_warnings() {
+	for (int i = 0; i < _violation_count; i++) {
+		const Site &site = _violations[i];
+		WARN_PRINT(vformat("AllocationUtil: Allocation-free section '%s' made %d allocations (%d bytes) and %d frees.", String(site.name), (int64_t)site.allocation_count, (int64_t)site.allocated_bytes, (int64_t)site.free_count));
+	}
+
+	_violation_count = 0;
+}
+
+// Scope.
+
+AllocationUtil::Scope::Scope(const char *p_name, bool p_is_allocation_free) {
+	_previous_section = _current_section;
+	_is_allocation_free = p_is_allocation_free;
+
+	_current_section = p_name;
+	if (_is_allocation_free) {
+		_allocation_free_depth++;
+	}
+}
+
+AllocationUtil::Scope::~Scope() {
+	_current_section = _previous_section;
+	if (_is_allocation_free) {
+		_allocation_free_depth--;
+	}
+}
@@ -0,0 +1,122 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_ALLOCATION_UTIL_H
+#define SION_ALLOCATION_UTIL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+
+// Counts heap activity of the extension on the audio path, to find the sources of hitches.
+// Allocations made through Godot's memory interface (memnew, memalloc, Vector, HashMap, List,
+// and so on) are attributed to the innermost section marked in code. Sections can be marked
+// as allocation-free, and any activity inside them is reported as a violation.
+//
+// Memory owned by the engine (String, Variant, packed arrays) is not allocated through the
+// extension, so it's only visible as a net change of the engine memory usage, and only in
+// debug builds of the engine.
+//
+// Tracking is compiled in only with the sion_alloc_tracking=yes build option. Otherwise
+// the markers expand to nothing, and reports are empty.
+class AllocationUtil {
+public:
+	static const int MAX_SITES = 64;
+
+	struct Site {
+		const char *name = nullptr; // Must be a string literal, only the pointer is stored.
+		bool is_allocation_free = false;
+		uint32_t allocation_count = 0;
+		uint32_t free_count = 0;
+		uint64_t allocated_bytes = 0;
+	};
+
+private:
+	typedef void *(*AllocFunction)(size_t p_bytes);
+	typedef void *(*ReallocFunction)(void *p_ptr, size_t p_bytes);
+	typedef void (*FreeFunction)(void *p_ptr);
+
+	static AllocFunction _original_alloc;
+	static ReallocFunction _original_realloc;
+	static FreeFunction _original_free;
+
+	static void *_alloc_hook(size_t p_bytes);
+	static void *_realloc_hook(void *p_ptr, size_t p_bytes);
+	static void _free_hook(void *p_ptr);
+
+	// Only the thread which began a buffer records into the tracker.
+	static thread_local AllocationUtil *_active_tracker;
+	static thread_local const char *_current_section;
+	static thread_local int _allocation_free_depth;
+
+	// Last buffer.
+	Site _sites[MAX_SITES];
+	int _site_count = 0;
+	uint32_t _allocation_count = 0;
+	uint32_t _free_count = 0;
+	uint64_t _allocated_bytes = 0;
+	int64_t _engine_memory_start = 0;
+	int64_t _engine_memory_delta = 0;
+
+	// Since the last reset.
+	uint64_t _buffer_count = 0;
+	uint64_t _dirty_buffer_count = 0;
+	uint64_t _total_allocation_count = 0;
+
+	// Violations of allocation-free sections, since the last flush.
+	Site _violations[MAX_SITES];
+	int _violation_count = 0;
+
+	Site *_find_site(Site *p_sites, int &r_site_count, const char *p_name, bool p_is_allocation_free);
+	void _record(bool p_is_free, size_t p_bytes);
+
+public:
+	// Replaces Godot's memory functions used by the extension with counting ones.
+	static void install_hooks();
+	static void uninstall_hooks();
+
+	void begin_buffer();
+	void end_buffer();
+
+	void reset();
+
+	// Returns the report of the last buffer, and the counts since the last reset.
+	Dictionary get_report() const;
+	// Prints warnings about allocation-free sections which allocated since the last call.
+	// Printing allocates, so this must be called outside of the audio path.
+	void flush_warnings();
+
+	class Scope {
+		const char *_previous_section = nullptr;
+		bool _is_allocation_free = false;
+
+	public:
+		Scope(const char *p_name, bool p_is_allocation_free = false);
+		~Scope();
+	};
+
+	AllocationUtil() {}
+	~AllocationUtil() {}
+};
+
+#ifdef SION_ALLOC_TRACKING_ENABLED
+
+#define SION_ALLOC_CONCAT_IMPL(m_a, m_b) m_a##m_b
+#define SION_ALLOC_CONCAT(m_a, m_b) SION_ALLOC_CONCAT_IMPL(m_a, m_b)
+
+#define SION_ALLOC_SCOPE(m_name) AllocationUtil::Scope SION_ALLOC_CONCAT(_alloc_scope_, __LINE__)(m_name)
+#define SION_ALLOC_FREE_SCOPE(m_name) AllocationUtil::Scope SION_ALLOC_CONCAT(_alloc_scope_, __LINE__)(m_name, true)
+
+#else
+
+#define SION_ALLOC_SCOPE(m_name)
+#define SION_ALLOC_FREE_SCOPE(m_name)
+
+#endif // SION_ALLOC_TRACKING_ENABLED
+
+#endif // SION_ALLOCATION_UTIL_H
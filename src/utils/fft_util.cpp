@@ -0,0 +1,185 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "fft_util.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+
+void FFTUtil::_transform(double *r_data, bool p_inverse) const {
+	const int points = _size >> 1;
+
+	for (int i = 0; i < points; i++) {
+		const int j = _bit_reverse_table[i];
+		if (j > i) {
+			SWAP(r_data[i << 1], r_data[j << 1]);
+			SWAP(r_data[(i << 1) + 1], r_data[(j << 1) + 1]);
+		}
+	}
+
+	const double *cos_ptr = _cos_table.ptr();
+	const double *sin_ptr = _sin_table.ptr();
+	const double direction = p_inverse ? 1 : -1;
+
+	for (int length = 2; length <= points; length <<= 1) {
+		const int half = length >> 1;
+		// Tables are computed for the real size, which is twice the amount of complex points.
+		const int step = _size / length;
+
+		for (int start = 0; start < points; start += length) {
+			double *even = r_data + (start << 1);
+			double *odd = r_data + ((start + half) << 1);
+
+			for (int k = 0; k < half; k++) {
+				const double wr = cos_ptr[k * step];
+				const double wi = sin_ptr[k * step] * direction;
+
+				const double tr = odd[k << 1] * wr - odd[(k << 1) + 1] * wi;
+				const double ti = odd[k << 1] * wi + odd[(k << 1) + 1] * wr;
+
+				odd[k << 1] = even[k << 1] - tr;
+				odd[(k << 1) + 1] = even[(k << 1) + 1] - ti;
+				even[k << 1] += tr;
+				even[(k << 1) + 1] += ti;
+			}
+		}
+	}
+}
+
+void FFTUtil::forward(double *r_data) const {
+	const int points = _size >> 1;
+
+	// Even samples go into real parts, odd samples into imaginary parts.
+	_transform(r_data, false);
+
+	// Split the packed transform into the spectrum of the real signal.
+	// X[k] = (Z[k] + conj(Z[N/2-k])) / 2 - i * W^k * (Z[k] - conj(Z[N/2-k])) / 2
+	const double dc_real = r_data[0];
+	const double dc_imag = r_data[1];
+	r_data[0] = dc_real + dc_imag;
+	r_data[1] = 0;
+	r_data[points << 1] = dc_real - dc_imag;
+	r_data[(points << 1) + 1] = 0;
+
+	for (int k = 1; k <= (points >> 1); k++) {
+		const int m = points - k;
+		const double zk_real = r_data[k << 1];
+		const double zk_imag = r_data[(k << 1) + 1];
+		const double zm_real = r_data[m << 1];
+		const double zm_imag = r_data[(m << 1) + 1];
+
+		// Bin k.
+		{
+			const double even_real = (zk_real + zm_real) * 0.5;
+			const double even_imag = (zk_imag - zm_imag) * 0.5;
+			const double odd_real = (zk_imag + zm_imag) * 0.5;
+			const double odd_imag = -(zk_real - zm_real) * 0.5;
+			const double wr = _cos_table[k];
+			const double wi = -_sin_table[k];
+
+			r_data[k << 1] = even_real + wr * odd_real - wi * odd_imag;
+			r_data[(k << 1) + 1] = even_imag + wr * odd_imag + wi * odd_real;
+		}
+
+		// Bin N/2-k, the mirrored counterpart.
+		{
+			const double even_real = (zm_real + zk_real) * 0.5;
+			const double even_imag = (zm_imag - zk_imag) * 0.5;
+			const double odd_real = (zm_imag + zk_imag) * 0.5;
+			const double odd_imag = -(zm_real - zk_real) * 0.5;
+			const double wr = _cos_table[m];
+			const double wi = -_sin_table[m];
+
+			r_data[m << 1] = even_real + wr * odd_real - wi * odd_imag;
+			r_data[(m << 1) + 1] = even_imag + wr * odd_imag + wi * odd_real;
+		}
+	}
+}
+
+void FFTUtil::inverse(double *r_data) const {
+	const int points = _size >> 1;
+
+	// Merge the spectrum back into the packed form, reversing the split from forward().
+	// Z[k] = (X[k] + conj(X[N/2-k])) / 2 + i * W^-k * (X[k] - conj(X[N/2-k])) / 2
+	for (int k = 0; k <= (points >> 1); k++) {
+		const int m = points - k;
+		const double xk_real = r_data[k << 1];
+		const double xk_imag = r_data[(k << 1) + 1];
+		const double xm_real = r_data[m << 1];
+		const double xm_imag = r_data[(m << 1) + 1];
+
+		// Bin k.
+		{
+			const double even_real = (xk_real + xm_real) * 0.5;
+			const double even_imag = (xk_imag - xm_imag) * 0.5;
+			const double diff_real = (xk_real - xm_real) * 0.5;
+			const double diff_imag = (xk_imag + xm_imag) * 0.5;
+			const double wr = _cos_table[k];
+			const double wi = _sin_table[k];
+			const double odd_real = diff_real * wr - diff_imag * wi;
+			const double odd_imag = diff_real * wi + diff_imag * wr;
+
+			r_data[k << 1] = even_real - odd_imag;
+			r_data[(k << 1) + 1] = even_imag + odd_real;
+		}
+
+		// Bin N/2-k. Index N/2 itself is not a part of the packed form.
+		if (k > 0 && m != k) {
+			const double even_real = (xm_real + xk_real) * 0.5;
+			const double even_imag = (xm_imag - xk_imag) * 0.5;
+			const double diff_real = (xm_real - xk_real) * 0.5;
+			const double diff_imag = (xm_imag + xk_imag) * 0.5;
+			const double wr = _cos_table[m];
+			const double wi = _sin_table[m];
+			const double odd_real = diff_real * wr - diff_imag * wi;
+			const double odd_imag = diff_real * wi + diff_imag * wr;
+
+			r_data[m << 1] = even_real - odd_imag;
+			r_data[(m << 1) + 1] = even_imag + odd_real;
+		}
+	}
+
+	_transform(r_data, true);
+
+	const double scale = 1.0 / points;
+	for (int i = 0; i < _size; i++) {
+		r_data[i] *= scale;
+	}
+	r_data[_size] = 0;
+	r_data[_size + 1] = 0;
+}
+
+FFTUtil::FFTUtil(int p_size) {
+	if (p_size == 0) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_size < 4 || (p_size & (p_size - 1)) != 0, "FFTUtil: Size must be a power of 2, at least 4.");
+
+	_size = p_size;
+	const int points = _size >> 1;
+
+	_cos_table.resize(points);
+	_sin_table.resize(points);
+	for (int i = 0; i < points; i++) {
+		const double angle = Math_TAU * i / _size;
+		_cos_table.write[i] = Math::cos(angle);
+		_sin_table.write[i] = Math::sin(angle);
+	}
+
+	int bits = 0;
+	while ((1 << bits) < points) {
+		bits++;
+	}
+
+	_bit_reverse_table.resize(points);
+	for (int i = 0; i < points; i++) {
+		int reversed = 0;
+		for (int b = 0; b < bits; b++) {
+			reversed |= ((i >> b) & 1) << (bits - 1 - b);
+		}
+		_bit_reverse_table.write[i] = reversed;
+	}
+}
@@ -0,0 +1,40 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_FFT_UTIL_H
+#define SION_FFT_UTIL_H
+
+#include <godot_cpp/templates/vector.hpp>
+
+using namespace godot;
+
+// Radix-2 FFT for real signals. A real signal of N samples is transformed as a complex signal
+// of N/2 points and then split into N/2+1 bins. Spectrum is stored as interleaved pairs of
+// real and imaginary parts, so buffers must hold N+2 values.
+class FFTUtil {
+
+	int _size = 0;
+	Vector<double> _cos_table;
+	Vector<double> _sin_table;
+	Vector<int> _bit_reverse_table;
+
+	void _transform(double *r_data, bool p_inverse) const;
+
+public:
+	int get_size() const { return _size; }
+	int get_spectrum_size() const { return _size + 2; }
+
+	// Transforms N real samples into N/2+1 complex bins, in place.
+	void forward(double *r_data) const;
+	// Transforms N/2+1 complex bins back into N real samples, in place. The result is normalized.
+	void inverse(double *r_data) const;
+
+	// Size must be a power of 2, at least 4.
+	FFTUtil(int p_size = 0);
+	~FFTUtil() {}
+};
+
+#endif // SION_FFT_UTIL_H
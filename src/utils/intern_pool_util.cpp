@@ -0,0 +1,162 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "intern_pool_util.h"
+
+#include <cstring>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/templates/list.hpp>
+#include "chip/wave/siopm_wave_base.h"
+#include "chip/wave/siopm_wave_table.h"
+#include "sequencer/simml_envelope_table.h"
+
+HashMap<String, Ref<SiOPMWaveTable>> InternPoolUtil::_wave_tables;
+HashMap<String, Ref<SiMMLEnvelopeTable>> InternPoolUtil::_envelope_tables;
+HashMap<String, InternPoolUtil::SoundWaveEntry> InternPoolUtil::_sound_waves;
+
+int64_t InternPoolUtil::_lookup_count = 0;
+int64_t InternPoolUtil::_hit_count = 0;
+
+Ref<SiOPMWaveTable> InternPoolUtil::intern_wave_table(const Vector<int> &p_wavelet, SiONPitchTableType p_pitch_table_type) {
+	const uint32_t hash = hash_murmur3_buffer(p_wavelet.ptr(), p_wavelet.size() * sizeof(int));
+	const String key = vformat("%d:%d:%x", p_pitch_table_type, p_wavelet.size(), hash);
+	_lookup_count++;
+
+	HashMap<String, Ref<SiOPMWaveTable>>::Iterator existing = _wave_tables.find(key);
+	if (existing) {
+		const Vector<int> existing_wavelet = existing->value->get_wavelet();
+		if (memcmp(existing_wavelet.ptr(), p_wavelet.ptr(), p_wavelet.size() * sizeof(int)) == 0) {
+			_hit_count++;
+			return existing->value;
+		}
+
+		// Hash collision, keep the first table pooled and this one private.
+		return Ref<SiOPMWaveTable>(memnew(SiOPMWaveTable(p_wavelet, p_pitch_table_type)));
+	}
+
+	Ref<SiOPMWaveTable> wave_table = memnew(SiOPMWaveTable(p_wavelet, p_pitch_table_type));
+	_wave_tables[key] = wave_table;
+	return wave_table;
+}
+
+Ref<SiMMLEnvelopeTable> InternPoolUtil::intern_envelope_table(const String &p_table_numbers, const String &p_postfix) {
+	// Parsing is deterministic, so the definition itself is the address.
+	const String key = p_table_numbers + "|" + p_postfix;
+	_lookup_count++;
+
+	HashMap<String, Ref<SiMMLEnvelopeTable>>::Iterator existing = _envelope_tables.find(key);
+	if (existing) {
+		_hit_count++;
+		return existing->value;
+	}
+
+	Ref<SiMMLEnvelopeTable> envelope_table = memnew(SiMMLEnvelopeTable);
+	envelope_table->parse_mml(p_table_numbers, p_postfix);
+	if (!envelope_table->get_data()) {
+		return Ref<SiMMLEnvelopeTable>();
+	}
+
+	_envelope_tables[key] = envelope_table;
+	return envelope_table;
+}
+
+Variant InternPoolUtil::_get_source_identity(const Variant &p_source) {
+	// Object hashes are based on their address, which can be reused by another object once the
+	// source is freed. Object IDs are never reused.
+	if (p_source.get_type() == Variant::OBJECT) {
+		Object *object = p_source;
+		return object ? (int64_t)object->get_instance_id() : (int64_t)0;
+	}
+
+	return p_source;
+}
+
+String InternPoolUtil::get_source_key(const Variant &p_source) {
+	if (p_source.get_type() == Variant::OBJECT) {
+		return vformat("id%d", (int64_t)_get_source_identity(p_source));
+	}
+
+	return vformat("%x", p_source.hash());
+}
+
+Ref<SiOPMWaveBase> InternPoolUtil::find_sound_wave(const String &p_key, const Variant &p_source) {
+	_lookup_count++;
+
+	HashMap<String, SoundWaveEntry>::Iterator existing = _sound_waves.find(p_key);
+	if (existing && existing->value.source_identity == _get_source_identity(p_source)) {
+		_hit_count++;
+		return existing->value.wave;
+	}
+
+	return Ref<SiOPMWaveBase>();
+}
+
+void InternPoolUtil::add_sound_wave(const String &p_key, const Variant &p_source, const Ref<SiOPMWaveBase> &p_wave) {
+	ERR_FAIL_COND(p_wave.is_null());
+
+	SoundWaveEntry entry;
+	entry.wave = p_wave;
+	entry.source_identity = _get_source_identity(p_source);
+	_sound_waves[p_key] = entry;
+}
+
+template <typename T>
+static void _prune_map(HashMap<String, Ref<T>> &r_map) {
+	List<String> unused_keys;
+	for (const KeyValue<String, Ref<T>> &kv : r_map) {
+		if (kv.value->get_reference_count() <= 1) {
+			unused_keys.push_back(kv.key);
+		}
+	}
+
+	for (const String &key : unused_keys) {
+		r_map.erase(key);
+	}
+}
+
+void InternPoolUtil::prune() {
+	_prune_map(_wave_tables);
+	_prune_map(_envelope_tables);
+
+	List<String> unused_keys;
+	for (const KeyValue<String, SoundWaveEntry> &kv : _sound_waves) {
+		if (kv.value.wave->get_reference_count() <= 1) {
+			unused_keys.push_back(kv.key);
+		}
+	}
+	for (const String &key : unused_keys) {
+		_sound_waves.erase(key);
+	}
+}
+
+void InternPoolUtil::clear() {
+	_wave_tables.clear();
+	_envelope_tables.clear();
+	_sound_waves.clear();
+
+	_lookup_count = 0;
+	_hit_count = 0;
+}
+
+int InternPoolUtil::get_entry_count() {
+	return _wave_tables.size() + _envelope_tables.size() + _sound_waves.size();
+}
+
+int64_t InternPoolUtil::get_memory_usage() {
+	int64_t usage = 0;
+
+	for (const KeyValue<String, Ref<SiOPMWaveTable>> &kv : _wave_tables) {
+		usage += kv.value->get_memory_usage();
+	}
+	for (const KeyValue<String, Ref<SiMMLEnvelopeTable>> &kv : _envelope_tables) {
+		usage += kv.value->get_memory_usage();
+	}
+	for (const KeyValue<String, SoundWaveEntry> &kv : _sound_waves) {
+		usage += kv.value.wave->get_memory_usage();
+	}
+
+	return usage;
+}
@@ -0,0 +1,69 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_INTERN_POOL_UTIL_H
+#define SION_INTERN_POOL_UTIL_H
+
+#include <cstdint>
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/variant.hpp>
+#include "sion_enums.h"
+
+using namespace godot;
+
+class SiMMLEnvelopeTable;
+class SiOPMWaveBase;
+class SiOPMWaveTable;
+
+// Global pool of immutable tables and wave data, addressed by their content or definition. Songs
+// with identical definitions share one instance instead of each holding its own copy. Entries that
+// nothing but the pool references are dropped by prune().
+class InternPoolUtil {
+
+	struct SoundWaveEntry {
+		Ref<SiOPMWaveBase> wave;
+		// Object ID of a resource source, or the source data itself. Compared on lookup, so that
+		// a different source under the same key is never mistaken for the pooled one.
+		Variant source_identity;
+	};
+
+	static HashMap<String, Ref<SiOPMWaveTable>> _wave_tables;
+	static HashMap<String, Ref<SiMMLEnvelopeTable>> _envelope_tables;
+	static HashMap<String, SoundWaveEntry> _sound_waves;
+
+	static Variant _get_source_identity(const Variant &p_source);
+
+	static int64_t _lookup_count;
+	static int64_t _hit_count;
+
+public:
+	// Wave tables are addressed by their contents.
+	static Ref<SiOPMWaveTable> intern_wave_table(const Vector<int> &p_wavelet, SiONPitchTableType p_pitch_table_type = SiONPitchTableType::PITCH_TABLE_OPM);
+	// Envelope tables are addressed by their MML definition. Returns null if the definition is invalid.
+	static Ref<SiMMLEnvelopeTable> intern_envelope_table(const String &p_table_numbers, const String &p_postfix);
+
+	// Sampler and PCM data are addressed by their source and the parameters they were created with,
+	// see TranslatorUtil::parse_sampler_wave() and TranslatorUtil::parse_pcm_wave().
+	static String get_source_key(const Variant &p_source);
+	static Ref<SiOPMWaveBase> find_sound_wave(const String &p_key, const Variant &p_source);
+	static void add_sound_wave(const String &p_key, const Variant &p_source, const Ref<SiOPMWaveBase> &p_wave);
+
+	static void prune();
+	static void clear();
+
+	// Reporting.
+
+	static int get_entry_count();
+	// Approximate size of the pooled data, in bytes.
+	static int64_t get_memory_usage();
+	static int64_t get_lookup_count() { return _lookup_count; }
+	static int64_t get_hit_count() { return _hit_count; }
+};
+
+#endif // SION_INTERN_POOL_UTIL_H
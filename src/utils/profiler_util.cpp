@@ -0,0 +1,172 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "profiler_util.h"
+
+#include <algorithm>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+
+uint64_t ProfilerUtil::_get_buffer_time() const {
+	uint64_t total = 0;
+	for (int i = 0; i < STAGE_MAX; i++) {
+		total += _stage_times[i];
+	}
+	return total;
+}
+
+void ProfilerUtil::set_buffer_duration(int p_buffer_length, double p_sample_rate) {
+	ERR_FAIL_COND(p_sample_rate <= 0);
+
+	_buffer_duration = p_buffer_length * 1000000.0 / p_sample_rate;
+}
+
+void ProfilerUtil::begin_buffer() {
+	for (int i = 0; i < STAGE_MAX; i++) {
+		_stage_times[i] = 0;
+	}
+
+	_track_count = 0;
+	_slot_times.fill(0);
+}
+
+void ProfilerUtil::add_track_time(int p_track_id, uint64_t p_time) {
+	if (_track_count == _track_ids.size()) {
+		const int capacity = MAX(16, _track_count * 2);
+		_track_ids.resize(capacity);
+		_track_times.resize(capacity);
+	}
+
+	_track_ids.write[_track_count] = p_track_id;
+	_track_times.write[_track_count] = (int64_t)p_time;
+	_track_count++;
+}
+
+void ProfilerUtil::set_slot_time(int p_slot, uint64_t p_time) {
+	ERR_FAIL_INDEX(p_slot, _slot_times.size());
+
+	_slot_times.write[p_slot] = (int64_t)p_time;
+}
+
+void ProfilerUtil::end_buffer() {
+	const uint64_t buffer_time = _get_buffer_time();
+
+	for (int i = 0; i < STAGE_MAX; i++) {
+		_total_stage_times[i] += _stage_times[i];
+	}
+	_total_buffer_count++;
+	_total_max_time = MAX(_total_max_time, buffer_time);
+
+	_history[_history_position] = buffer_time;
+	_history_position = (_history_position + 1) % HISTORY_SIZE;
+	if (_history_count < HISTORY_SIZE) {
+		_history_count++;
+	}
+}
+
+void ProfilerUtil::reset() {
+	begin_buffer();
+
+	_history_position = 0;
+	_history_count = 0;
+
+	for (int i = 0; i < STAGE_MAX; i++) {
+		_total_stage_times[i] = 0;
+	}
+	_total_buffer_count = 0;
+	_total_max_time = 0;
+}
+
+Dictionary ProfilerUtil::get_report() const {
+	Dictionary report;
+
+	report["buffer_usec"] = _buffer_duration;
+	report["sequencer_usec"] = (int64_t)_stage_times[STAGE_SEQUENCER];
+	report["synthesis_usec"] = (int64_t)_stage_times[STAGE_SYNTHESIS];
+	report["effects_usec"] = (int64_t)_stage_times[STAGE_EFFECTS];
+	report["mixing_usec"] = (int64_t)_stage_times[STAGE_MIXING];
+	report["output_usec"] = (int64_t)_stage_times[STAGE_OUTPUT];
+	report["total_usec"] = (int64_t)_get_buffer_time();
+
+	PackedInt32Array track_ids;
+	PackedInt64Array track_times;
+	track_ids.resize(_track_count);
+	track_times.resize(_track_count);
+	for (int i = 0; i < _track_count; i++) {
+		track_ids.set(i, _track_ids[i]);
+		track_times.set(i, _track_times[i]);
+	}
+	report["track_ids"] = track_ids;
+	report["track_usec"] = track_times;
+
+	PackedInt64Array slot_times;
+	slot_times.resize(_slot_times.size());
+	for (int i = 0; i < _slot_times.size(); i++) {
+		slot_times.set(i, _slot_times[i]);
+	}
+	report["effect_slot_usec"] = slot_times;
+
+	// Percentiles of the total time over the recent history.
+
+	Vector<uint64_t> sorted;
+	sorted.resize(_history_count);
+	uint64_t *sorted_ptr = sorted.ptrw();
+	uint64_t history_total = 0;
+	for (int i = 0; i < _history_count; i++) {
+		sorted_ptr[i] = _history[i];
+		history_total += _history[i];
+	}
+	std::sort(sorted_ptr, sorted_ptr + _history_count);
+
+	const auto percentile = [&](double p_fraction) -> int64_t {
+		if (_history_count == 0) {
+			return 0;
+		}
+		const int index = MIN((int)(p_fraction * _history_count), _history_count - 1);
+		return (int64_t)sorted_ptr[index];
+	};
+
+	report["buffer_count"] = _history_count;
+	report["p50_usec"] = percentile(0.5);
+	report["p95_usec"] = percentile(0.95);
+	report["p99_usec"] = percentile(0.99);
+	report["max_usec"] = percentile(1.0);
+
+	// Ratio of processing time to the duration of the produced audio. Anything close to 1 risks dropouts.
+	if (_buffer_duration > 0 && _history_count > 0) {
+		report["real_time_factor"] = history_total / (_history_count * _buffer_duration);
+		report["peak_real_time_factor"] = sorted_ptr[_history_count - 1] / _buffer_duration;
+	} else {
+		report["real_time_factor"] = 0.0;
+		report["peak_real_time_factor"] = 0.0;
+	}
+
+	// Totals since the last reset.
+
+	Dictionary totals;
+	uint64_t total_time = 0;
+	for (int i = 0; i < STAGE_MAX; i++) {
+		total_time += _total_stage_times[i];
+	}
+
+	totals["buffer_count"] = (int64_t)_total_buffer_count;
+	totals["sequencer_usec"] = (int64_t)_total_stage_times[STAGE_SEQUENCER];
+	totals["synthesis_usec"] = (int64_t)_total_stage_times[STAGE_SYNTHESIS];
+	totals["effects_usec"] = (int64_t)_total_stage_times[STAGE_EFFECTS];
+	totals["mixing_usec"] = (int64_t)_total_stage_times[STAGE_MIXING];
+	totals["output_usec"] = (int64_t)_total_stage_times[STAGE_OUTPUT];
+	totals["total_usec"] = (int64_t)total_time;
+	totals["max_usec"] = (int64_t)_total_max_time;
+	report["totals"] = totals;
+
+	return report;
+}
+
+ProfilerUtil::ProfilerUtil(int p_slot_count) {
+	_slot_times.resize_zeroed(p_slot_count);
+}
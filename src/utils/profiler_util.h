@@ -0,0 +1,80 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_PROFILER_UTIL_H
+#define SION_PROFILER_UTIL_H
+
+#include <chrono>
+#include <cstdint>
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+
+// Per-buffer timing of the processing stages, in microseconds. Recording is a couple of clock reads
+// per stage, track, and effect slot, so it's always on. Everything that allocates or sorts happens
+// when the report is requested.
+class ProfilerUtil {
+public:
+	enum Stage {
+		STAGE_SEQUENCER, // Queued commands and event processing, excluding synthesis.
+		STAGE_SYNTHESIS, // Channel synthesis of all tracks.
+		STAGE_EFFECTS,   // Local and global effects, and the master effect.
+		STAGE_MIXING,    // Clearing, limiting, and quantizing output streams.
+		STAGE_OUTPUT,    // Pushing the rendered buffer to Godot.
+		STAGE_MAX
+	};
+
+	// Number of buffers percentiles are calculated from.
+	static const int HISTORY_SIZE = 256;
+
+	// Monotonic clock, cheaper than going through the engine.
+	_FORCE_INLINE_ static uint64_t get_ticks_usec() {
+		return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+private:
+	double _buffer_duration = 0; // usec
+
+	uint64_t _stage_times[STAGE_MAX] = {};
+	// Only grow, so recording doesn't allocate once the track count settles.
+	Vector<int> _track_ids;
+	Vector<int64_t> _track_times;
+	int _track_count = 0;
+	Vector<int64_t> _slot_times;
+
+	// Total times of last buffers.
+	uint64_t _history[HISTORY_SIZE] = {};
+	int _history_position = 0;
+	int _history_count = 0;
+
+	// Sums since the last reset, for measuring whole renders.
+	uint64_t _total_stage_times[STAGE_MAX] = {};
+	uint64_t _total_buffer_count = 0;
+	uint64_t _total_max_time = 0;
+
+	uint64_t _get_buffer_time() const;
+
+public:
+	void set_buffer_duration(int p_buffer_length, double p_sample_rate);
+
+	void begin_buffer();
+	void add_stage_time(Stage p_stage, uint64_t p_time) { _stage_times[p_stage] += p_time; }
+	void add_track_time(int p_track_id, uint64_t p_time);
+	void set_slot_time(int p_slot, uint64_t p_time);
+	void end_buffer();
+
+	void reset();
+
+	// Returns the report of the last buffer, the recent history, and the totals since the last reset.
+	Dictionary get_report() const;
+
+	ProfilerUtil(int p_slot_count = 0);
+	~ProfilerUtil() {}
+};
+
+#endif // SION_PROFILER_UTIL_H
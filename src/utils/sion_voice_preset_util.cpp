@@ -6,13 +6,32 @@
 
 #include "sion_voice_preset_util.h"
 
+#include <iterator>
 #include <godot_cpp/core/class_db.hpp>
 #include "sion_enums.h"
 #include "sion_voice.h"
 #include "chip/siopm_channel_params.h"
 #include "chip/siopm_operator_params.h"
 #include "chip/wave/siopm_wave_table.h"
-#include "utils/godot_util.h"
+#include "utils/intern_pool_util.h"
+
+// Presets are defined as constant tables, which cost nothing until a voice is requested.
+
+struct SiONVoicePresetUtil::SimplePreset {
+	PresetType type;
+	const char *key;
+	const char *name;
+	// Arguments of the matching _create_*_voice() method, in order.
+	int16_t args[8];
+	double fine_multiple = 1;
+};
+
+struct SiONVoicePresetUtil::FMPreset {
+	const char *key;
+	const char *name;
+	// OPN presets only use the first OPN_PARAM_COUNT values.
+	uint8_t params[MA3_PARAM_COUNT];
+};
 
 void SiONVoicePresetUtil::_generate_voices(uint32_t p_flags) {
 	if (p_flags & INCLUDE_DEFAULT) {
@@ -38,462 +57,490 @@ void SiONVoicePresetUtil::_generate_voices(uint32_t p_flags) {
 void SiONVoicePresetUtil::_generate_default_voices() {
 	// 16 default voices.
 
-	_begin_category("default");
-	_create_basic_voice("sine",      "Sine Wave",           0);
-	_create_basic_voice("saw",       "Saw Wave",            1);
-	_create_basic_voice("triangle8", "8-bit Triangle Wave", 3);
-	_create_basic_voice("triangle",  "Triangle Wave",       4);
-	_create_basic_voice("square",    "Square Wave",         5);
-	_create_basic_voice("noise",     "White Noise",         6);
-	_create_basic_voice("snoise",    "93-bit Noise",        25);
-	_create_basic_voice("konami",    "Konami Wave Sample",  7);
-	_create_basic_voice("ma1",       "MA-3 Wave Sample",    33);
-	_create_basic_voice("beep",      "Pulse Wave Sample",   81);
-	_create_basic_voice("ramp",      "Ramp Wave Sample",    160);
-
-	_create_percussive_voice("bassdrumm", "Bass Drum (1 op)",      0, 63, 28, -128);
-	_create_percussive_voice("snare",     "Snare Drum (1 op)",    17, 63, 36, 0, 96, 1);
-	_create_percussive_voice("closedhh",  "Closed Hi-Hat (1 op)", 19, 63, 40, 0);
-	_create_percussive_voice("openedhh",  "Opened Hi-Hat (1 op)", 19, 63, 28, 0);
-	_create_percussive_voice("crash",     "Crash Symbal (1 op)",  16, 48, 24, 0);
-
-	_create_analog_voice("dualsaw",      "Dual Saw",      0, 1, 1, 0, 8);
-	_create_analog_voice("dualsquare",   "Dual Square",   0, 5, 5, 0, 8);
+	static const SimplePreset default_presets[] = {
+		{ PRESET_BASIC, "sine",      "Sine Wave",           { 0 } },
+		{ PRESET_BASIC, "saw",       "Saw Wave",            { 1 } },
+		{ PRESET_BASIC, "triangle8", "8-bit Triangle Wave", { 3 } },
+		{ PRESET_BASIC, "triangle",  "Triangle Wave",       { 4 } },
+		{ PRESET_BASIC, "square",    "Square Wave",         { 5 } },
+		{ PRESET_BASIC, "noise",     "White Noise",         { 6 } },
+		{ PRESET_BASIC, "snoise",    "93-bit Noise",        { 25 } },
+		{ PRESET_BASIC, "konami",    "Konami Wave Sample",  { 7 } },
+		{ PRESET_BASIC, "ma1",       "MA-3 Wave Sample",    { 33 } },
+		{ PRESET_BASIC, "beep",      "Pulse Wave Sample",   { 81 } },
+		{ PRESET_BASIC, "ramp",      "Ramp Wave Sample",    { 160 } },
+
+		{ PRESET_PERCUSSIVE, "bassdrumm", "Bass Drum (1 op)",      { 0, 63, 28, -128, 128, 0 } },
+		{ PRESET_PERCUSSIVE, "snare",     "Snare Drum (1 op)",    { 17, 63, 36, 0, 96, 1 } },
+		{ PRESET_PERCUSSIVE, "closedhh",  "Closed Hi-Hat (1 op)", { 19, 63, 40, 0, 128, 0 } },
+		{ PRESET_PERCUSSIVE, "openedhh",  "Opened Hi-Hat (1 op)", { 19, 63, 28, 0, 128, 0 } },
+		{ PRESET_PERCUSSIVE, "crash",     "Crash Symbal (1 op)",  { 16, 48, 24, 0, 128, 0 } },
+
+		{ PRESET_ANALOG, "dualsaw",      "Dual Saw",      { 0, 1, 1, 0, 8 } },
+		{ PRESET_ANALOG, "dualsquare",   "Dual Square",   { 0, 5, 5, 0, 8 } },
+	};
+	_register_simple_presets("default", default_presets, std::size(default_presets));
 }
 
 void SiONVoicePresetUtil::_generate_valsound_voices() {
 	// 258 voices from valsound.
 
-	_begin_category("valsound.bass");
-	_create_opn_voice("valsound.bass1",  "Analog Bass #2 (+FBsynth)",  { 6,7, 31, 0, 0,12, 1,18,1, 1,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0, 31, 0, 0, 9, 0, 3,0, 1,7,0, 31, 0, 0, 9, 0, 3,0, 1,3,0 });
-	_create_opn_voice("valsound.bass2",  "Analog Bass",                { 5,6, 31, 0, 0, 0, 0,41,0, 1,0,0, 20, 0, 0,10, 0, 0,0, 1,1,0, 24, 0, 0, 8, 0, 0,0, 1,2,0, 20, 0, 0,10, 0, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.bass3",  "Analog Bass #2 (q2)",        { 6,4, 21, 5, 0, 0, 2,35,0, 0,0,0, 26,10, 0,11, 1, 0,0, 1,0,0, 27, 0, 0,11, 0, 0,0, 1,3,0, 27,14, 0,11, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass4",  "Chopper Bass 0",             { 0,5, 28,14,15,15, 4,25,2,10,1,0, 31,14,10, 9, 3,34,2, 0,2,0, 31,14, 9, 9, 2,23,0, 0,3,0, 31, 6, 5,11, 2, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.bass5",  "Chopper Bass 1",             { 0,5, 28,14,15,15, 4,30,1,14,1,0, 31,14,10, 9, 2,35,1, 3,2,0, 31,14, 9, 9, 2,25,0, 0,3,0, 31, 6, 5,11, 1, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.bass6",  "Chopper Bass 2 (cut)",       { 0,4, 31,15,28, 5, 2,28,3,15,6,0, 31,10,15, 4, 4,41,3, 4,6,0, 31, 8, 3, 5, 1,21,2, 0,6,0, 31, 2, 2, 5,15, 0,2, 0,6,0 });
-	_create_opn_voice("valsound.bass7",  "Chopper Bass 3",             { 0,5, 31,18, 2,13, 9,28,2,13,1,0, 31,10,15, 4, 4,41,3, 1,2,0, 31, 8, 3, 5, 1,21,2, 0,3,0, 31, 2, 2,12,15, 0,2, 0,7,0 });
-	_create_opn_voice("valsound.bass8",  "Elec.Chopper Bass +4",       { 0,5, 31,18, 2,13, 9,28,2,13,1,0, 31,10,15, 4, 4,41,3, 1,2,0, 31, 8, 3, 5, 1,21,2, 0,3,0, 31, 2, 2,12,15, 0,2, 1,7,0 });
-	_create_opn_voice("valsound.bass9",  "Effect Bass 1",              { 4,3, 23, 5, 4, 7, 2, 0,0, 1,3,0, 30, 2, 2, 8, 2, 0,1, 7,3,0, 24, 5, 4, 7, 2, 0,0, 1,7,0, 31, 2, 2, 8, 2, 0,1,10,7,0 });
-	_create_opn_voice("valsound.bass10", "Effect Bass 2 (to UP)",      { 4,3,  3, 6, 5,15, 2, 0,0, 1,3,0,  7, 4, 3,15, 2, 0,1, 7,3,0,  3, 6, 5,15, 2, 0,0, 1,7,0,  7, 4, 3,15, 2, 0,1,10,7,0 });
-	_create_opn_voice("valsound.bass11", "Effect Bass 3",              { 4,3, 22, 5, 6, 0, 0, 9,0, 1,3,0, 19, 3, 4, 7, 1, 0,0, 7,3,0, 23, 0, 0, 0, 0,19,0, 1,7,0, 20, 2, 0, 7, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass12", "Mohaaa",                     { 0,5,  7, 0, 0,15, 0,21,0, 1,0,0,  6, 0, 0,15, 0,18,0, 2,0,0,  8, 0, 0,15, 0,23,0, 1,0,0, 18, 0, 0,15, 0, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.bass13", "Effect FB Bass #5",          { 0,7, 31, 6, 2,15, 3,20,0, 1,3,0, 31, 6, 2,15, 6,14,2, 2,0,0,  6, 6, 2,15, 1, 8,0, 1,7,0, 31, 5, 1,15, 2, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.bass14", "Magical Bass",               { 0,7, 31, 8, 0, 6,10,38,1, 1,3,0, 28,18, 5, 6,13,47,1,10,7,0, 31, 7, 7, 6, 8,23,2, 0,2,0, 28, 9, 6, 8, 1, 0,2, 0,0,0 });
-	_create_opn_voice("valsound.bass15", "E.Bass #6",                  { 0,7, 31,15, 0,10, 5,35,1,14,3,0, 31,14, 7, 7, 4,41,1, 4,7,0, 31,14, 3, 0, 2,18,1, 0,3,0, 31,12, 8, 8, 1, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.bass16", "E.Bass #7",                  { 3,7, 31,15, 0,10, 5,29,1,10,7,0, 31,13, 7, 7, 4,46,1, 4,7,0, 31,14, 5, 0, 2,19,1, 0,3,0, 31,12, 4, 8, 1, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.bass17", "E.Bass 70",                  { 2,5, 31, 8, 0, 0, 3,34,0, 0,3,0, 31,14, 6, 9, 2,42,0, 8,0,0, 31,16, 3, 0, 2,20,0, 0,7,0, 31,12, 5, 8, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass18", "VAL006 Bass (like Euro)",    { 0,4, 31, 7, 7,11, 2,25,3, 6,0,0, 31, 6, 6,11, 1,55,3, 4,7,0, 31, 9, 6,11, 1,18,2, 0,3,0, 31, 6, 8,11,15, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.bass19", "E.Bass x2",                  { 2,7, 31,14, 8, 3, 1,33,0, 0,1,0, 31,17, 8, 9, 5,30,0,14,2,0, 31,15, 8, 5, 5,35,0, 4,3,0, 31,15, 8, 6, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass20", "E.Bass x4",                  { 2,7, 31,14, 3, 0, 2,33,1, 3,3,0, 23,16, 4,12, 3,30,2,10,0,0, 31,13, 3,11, 3,27,1, 0,7,0, 31, 7, 5, 9, 1, 0,3, 1,0,0 });
-	_create_opn_voice("valsound.bass21", "Metal Pick Bass x5",         { 3,7, 31,14, 0, 6,13,51,2,13,0,0, 31,13, 0, 6,13,21,0, 1,0,0, 31, 9, 0, 6,13,23,0, 0,0,0, 31, 9, 0, 7,13, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.bass22", "Groove Bass 1",              { 5,3, 31, 0, 0, 0, 0,38,0, 0,0,0, 21, 0, 0,13, 0, 5,0, 0,0,0, 21, 0, 0,13, 0, 3,0, 1,0,0, 21, 0, 0,13, 0, 3,0, 1,0,0 });
-	_create_opn_voice("valsound.bass23", "Analog Bass Groove #2",      { 6,5, 31, 0, 0, 0, 0,41,0, 2,0,0, 31, 0, 0,10, 0, 2,0, 1,0,0, 31, 0, 0,10, 0, 1,0, 1,7,0, 31, 0, 0,10, 0, 1,0, 1,3,0 });
-	_create_opn_voice("valsound.bass24", "Harmonics #1",               { 6,6, 31,12, 9, 0, 2,45,1, 2,3,0, 31,10, 8, 6, 1, 0,1, 1,7,0, 31,13, 8, 5, 2, 0,1, 2,7,0, 31,16,12, 5,10, 0,1, 0,3,0 });
-	_create_opn_voice("valsound.bass25", "Low Bass x1",                { 5,3, 31, 0, 9,15, 0,25,2, 0,0,0, 31,15, 6, 8, 1, 0,1, 0,1,0, 31,15, 6, 8, 1, 0,1, 1,2,0, 31,15, 0, 7, 2, 0,1, 1,3,0 });
-	_create_opn_voice("valsound.bass26", "Low Bass x2 (little FB)",    { 5,6, 21, 0, 9, 0, 0,24,2, 0,0,0, 21,15, 6, 8, 1, 0,1, 0,1,0, 21,15, 6, 8, 1, 0,1, 1,2,0, 27,15, 0, 7, 2, 0,1, 1,3,0 });
-	_create_opn_voice("valsound.bass27", "Low Bass x1 (rezzo.)",       { 5,3, 31, 0, 9,15, 0,30,2, 0,0,0, 31,15, 6,12, 1, 2,1, 0,1,0, 31,15, 6,12, 1, 2,1, 1,2,0, 31,15,10,12, 2, 2,1, 4,3,0 });
-	_create_opn_voice("valsound.bass28", "Low Bass Picked",            { 5,7, 31, 5, 0, 0,11,33,1, 0,0,0, 30,12, 4, 9, 1, 0,1, 0,0,0, 27,14, 8, 9, 3, 0,1, 1,0,0, 27,14, 7,12,15, 6,1, 5,0,0 });
-	_create_opn_voice("valsound.bass29", "Metal Bass",                 { 0,5, 20,10, 9,15, 1,22,0, 0,7,0, 17, 9, 0, 0, 2,22,0, 1,7,0, 21, 9, 0, 0, 1,18,0, 0,3,0, 18, 8, 0, 8, 1, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.bass30", "E.N. Bass 1",                { 3,7, 27,14, 0, 4, 4,25,0, 7,0,0, 31,12, 0, 4, 3,45,0, 2,0,0, 31,19, 0, 4, 5,15,0, 0,0,0, 31,12, 6, 7, 1, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.bass31", "PSG Bass 1",                 { 5,7, 31,14, 0, 0, 0,22,0, 0,0,0, 31,14, 3, 8, 5, 0,0, 1,3,0, 31,14, 3, 8, 3, 0,0, 0,0,0, 31,16, 3, 8, 3, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass32", "PSG Bass 2",                 { 5,7, 31,14, 0, 0, 0,22,0, 1,0,0, 31,14, 3, 8, 5, 0,0, 2,3,0, 31,14, 3, 8, 3, 0,0, 0,0,0, 31,16, 3, 8, 3, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass33", "Rezonance-type Bass #1",     { 2,0, 24,19, 2,13,10,33,1, 3,3,0, 26,16, 5,14, 6,28,1, 0,0,0, 15,14, 6, 8, 5,14,1, 0,0,0, 31, 7, 5, 9, 2, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.bass34", "Slap Bass",                  { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 8, 8, 7, 5,23,3, 7,7,0, 31, 5, 6, 7, 1,37,0, 0,3,0, 31, 8, 6, 7, 5, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass35", "Slap Bass 1",                { 2,7, 31,14, 7, 8, 2,33,0, 0,7,0, 21,15, 6, 7, 4,18,2, 6,7,0, 31, 5, 6, 7, 1,40,0, 0,3,0, 31,12, 7, 7, 5, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.bass36", "Slap Bass 2 (1+)",           { 2,7, 31,14, 7, 8, 2,33,0, 0,7,0, 21,15, 6, 7, 4,28,2, 7,7,0, 31, 5, 6, 7, 1,40,0, 0,3,0, 31,12, 7, 7, 5, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.bass37", "Slap Bass #3",               { 2,7, 31,14, 7, 0, 5,32,0, 3,7,0, 31,16, 1,12, 4,35,0,10,0,0, 31,11, 2, 0, 3,23,1, 0,3,0, 31,12, 5, 7, 1, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.bass38", "Slap Bass (pull)",           { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 8, 8, 9, 5,23,3,10,7,0, 31, 5, 6,10, 1,37,0, 0,3,0, 31,16, 6,11, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass39", "Slap Bass (mute)",           { 2,2, 31,18, 7,11,12,33,0, 0,7,0, 21,11, 8,11,15,23,3, 7,7,0, 31,15, 6,11,11,37,0, 0,3,0, 31,15, 6,13,11, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass40", "Slap Bass (pick)",           { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 9, 8, 7, 5,23,3, 7,7,0, 31, 5, 6, 8, 1,37,0, 0,3,0, 31,11, 6,10, 5, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass41", "Super Bass #2",              { 2,2, 24,18, 2,13, 9,12,2, 3,3,0, 26,16, 5,14, 9,24,1, 1,0,0, 31,12, 2, 8, 3,22,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass42", "SP Bass #3 (soft)",          { 2,3, 24,18, 2,13, 9,25,2, 3,3,0, 26,16, 5,14, 9,24,1, 1,0,0, 31,12, 2, 8, 3,32,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass43", "SP Bass #4 (soft*2)",        { 2,1, 24,18, 2,13,10,28,2, 3,3,0, 26,16, 5,14, 6,24,1, 0,0,0, 31,12, 2, 8, 3,30,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass44", "SP Bass #5 (attack)",        { 0,5, 19,18, 2,15,10,30,2, 0,3,0, 31,16, 5,14, 5,24,1, 0,0,0, 31,12, 2, 8, 3,30,1, 0,7,0, 31,10, 7, 9, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass45", "SP Bass #6 (rezz+pipebass)", { 2,3, 24,18, 2,13, 9,35,2,12,3,0, 26,16, 5,14, 9,25,1, 2,0,0, 31,12, 2, 8, 3,32,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bass46", "Synth Bass 1",               { 4,3, 30, 0, 0, 0, 0,23,0, 1,3,0, 27, 4, 0, 7, 1, 0,0, 1,3,0, 30, 0, 0, 0, 0,18,0, 1,7,0, 25, 4, 0, 7, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass47", "Synth Bass 2 (myon)",        { 5,7, 14, 0, 9,12, 0,26,2, 0,0,0, 14,15, 6, 8, 1, 0,1, 0,1,0, 20,15, 6, 8, 1, 0,1, 1,2,0, 18,15, 0,12, 2, 0,1, 1,3,0 });
-	_create_opn_voice("valsound.bass48", "Synth Bass #3 (cho!)",       { 3,7, 31,11, 9, 0, 4,32,1, 1,3,0, 31,15, 7, 8, 5,41,1, 8,7,0, 26,18, 7,10, 6, 4,1, 0,3,0, 31, 9, 6, 7, 1, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.bass49", "Synth Wind Bass #4",         { 2,7, 31,13, 9, 0, 4,32,1, 0,3,0, 31,15, 7, 8, 4,21,1, 1,0,0, 26,18, 7, 8, 3,21,1, 1,7,0, 31, 9, 6, 7, 1, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.bass50", "Synth Bass #5 (q2)",         { 4,4, 20, 0, 0, 8, 7,17,0, 0,3,0, 18, 7, 4,11, 0, 0,0, 1,3,0, 18, 0, 0, 9, 0,22,0, 1,7,0, 15, 0, 0,11, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bass51", "Old Wood Bass",              { 5,7, 31,15, 0,13, 2,28,1, 0,0,0, 31,10, 1,12, 1, 4,0, 2,0,0, 25,10, 1,12, 1, 4,0, 1,0,0, 31,10, 1,12, 1, 4,0, 2,0,0 });
-	_create_opn_voice("valsound.bass52", "Wood Bass (bright)",         { 2,7, 31,13, 3,10, 2,32,1, 0,7,0, 31,12, 4,10, 3,20,1, 0,0,0, 31,17, 0,10, 7,15,1, 2,3,0, 31, 6, 1,10, 5, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.bass53", "Wood Bass x2 (bow)",         { 4,5, 31,11, 5, 0, 3,25,1, 0,3,0, 31,10, 9, 8, 4, 0,1, 1,3,0, 23,12, 5, 0, 4,14,1, 0,7,0, 31,12, 9, 7, 5, 0,1, 2,7,0 });
-	_create_opn_voice("valsound.bass54", "Wood Bass 3 (muted1)",       { 5,5, 31,15, 0,15, 2,38,1, 0,0,0, 31,10, 1,12, 1, 4,0, 2,0,0, 25,10, 1,12, 1, 2,0, 1,0,0, 31,10, 1,12, 1, 4,0, 1,0,0 });
-
-	_begin_category("valsound.bell");
-	_create_opn_voice("valsound.bell1",  "Calm Bell",                { 4,3, 31,12, 0,10, 5,38,0, 6,3,0, 31, 8, 4, 6,11, 4,0, 2,3,0, 31,12, 4, 6, 2,40,1, 6,7,0, 31, 6, 4, 6,11, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.bell2",  "China Bell Double",        { 4,7, 21,15, 8, 0, 3,27,1, 8,3,0, 31,13, 5, 6, 4, 0,1, 4,3,0, 21,15, 8, 0, 3,25,1, 6,7,0, 31,13, 5, 6, 4, 0,1, 3,7,0 });
-	_create_opn_voice("valsound.bell3",  "Church Bell 2",            { 4,0, 26, 3, 0, 2,15,35,2, 4,3,0, 31, 6, 0, 3,15, 7,1,11,0,0, 31, 6, 0, 1,14,41,2, 6,7,0, 31, 7, 0, 3,15, 0,0,11,7,0 });
-	_create_opn_voice("valsound.bell4",  "Church Bell",              { 4,0, 26, 3, 0, 2,15,35,2, 4,3,0, 31, 6, 0, 3,15, 7,1,11,0,0, 31, 6, 0, 1,14,41,2, 4,7,0, 31, 7, 0, 3,15, 0,0,15,7,0 });
-	_create_opn_voice("valsound.bell5",  "Glocken 1",                { 4,3, 31,24, 0,12,15,32,0,14,2,0, 31,15, 0, 8,15, 0,0, 2,0,0, 31,20, 0, 4,15,27,0,15,0,0, 31,14, 0, 5,15, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.bell6",  "Harp #1",                  { 1,7, 31,10,10, 6, 5,26,0, 3,0,0, 31,10,10, 7, 5,50,1, 2,0,0, 31,13,10, 7,13,40,0, 2,0,0, 31,14, 5, 7,10, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.bell7",  "Harp #2",                  { 1,3, 31, 9, 0, 0,15,40,2, 6,3,0, 31,11, 0, 8,15,30,2, 1,7,0, 31, 8, 0, 0,15,40,2, 1,0,0, 31, 8, 0, 8,14, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.bell8",  "Kirakira",                 { 1,7, 21,11, 6, 0,12,31,2, 6,2,0, 21,12, 8, 0,12,26,2,10,6,0, 28,11, 7, 0,12,32,1, 2,0,0, 28, 4, 2, 4, 5, 0,1, 2,0,0 });
-	_create_opn_voice("valsound.bell9",  "Marimba",                  { 4,6, 22,16, 7, 3,15,36,2,15,3,0, 16,10,13, 7,10, 0,2, 1,3,0, 19,18, 7, 3, 8,26,1, 6,7,0, 16,11,12, 7,10, 3,2, 2,7,0 });
-	_create_opn_voice("valsound.bell10", "Old Bell",                 { 4,6, 27, 4, 0, 5,14,34,0, 3,3,0, 31, 7, 0, 6,14, 0,1, 1,0,0, 31, 7, 0, 3,13,41,0,14,7,0, 31, 8, 0, 6,14,16,0, 4,7,0 });
-	_create_opn_voice("valsound.bell11", "Percus. Bell",             { 5,3, 31,12, 0, 9, 5,38,0,12,0,0, 31,15, 4, 5,11, 9,0, 3,0,0, 31,12, 4, 8,12, 9,0, 2,3,0, 31, 6, 4, 8,11, 9,0, 1,7,0 });
-	_create_opn_voice("valsound.bell12", "Pretty Bell",              { 6,6, 31,12, 9, 0, 3,43,1, 2,0,0, 31, 9, 8, 6, 3, 0,1, 1,3,0, 31,13, 8, 5, 3, 0,1, 4,7,0, 31,16,16, 5,13,13,1,15,0,0 });
-	_create_opn_voice("valsound.bell13", "Synth Bell #0 (from OPM)", { 6,2, 31, 5, 5, 5, 2,30,0, 7,7,0, 31, 8, 5, 7,15, 0,0, 3,7,0, 31, 6, 7, 7, 5, 0,0, 0,3,0, 31, 8, 5, 5, 2,10,0, 1,3,0 });
-	_create_opn_voice("valsound.bell14", "Synth Bell #1 (o5)",       { 6,3, 31, 5, 5, 5, 2,33,1, 8,3,0, 27,11, 0, 6,15, 0,1, 2,3,0, 31, 6, 7, 6, 5, 0,2, 0,7,0, 31,11, 8, 6, 3, 0,1, 1,7,0 });
-	_create_opn_voice("valsound.bell15", "Synth Bell 2",             { 6,5, 31, 8, 9, 0, 5,33,1, 7,3,0, 31, 9, 7, 8, 2, 0,1, 3,7,0, 31,12, 7, 8, 1, 0,1, 2,3,0, 31, 9, 7, 7, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.bell16", "Vibraphone (AMS-modu.)",   { 4,5, 24,14, 0, 7,15,50,1,12,3,0, 24,10, 0, 7,15, 0,1, 4,7,0, 26,14, 0, 6,15,57,1, 4,7,0, 26, 8, 0, 6,15, 0,2, 4,3,0 });
-	_create_opn_voice("valsound.bell17", "Twin Marinba 2 (g&c)",     { 4,5, 18, 9, 5,14,12,33,1,14,3,0, 31,16, 6, 9, 7, 0,1, 4,3,0, 18, 9, 5,14,12,33,1, 7,7,0, 31,16, 6, 9, 7, 0,1, 3,7,0 });
-	_create_opn_voice("valsound.bell18", "Twin Marinba 1 (g&c)",     { 4,2, 31,10, 5, 0,12,30,1, 8,3,0, 31,16, 6, 9, 9, 0,1, 4,3,0, 31,10, 5, 0,12,30,1, 6,7,0, 31,16, 6, 9, 9, 0,1, 3,7,0 });
-
-	_begin_category("valsound.brass");
-	_create_opn_voice("valsound.brass1",  "Brass Strings",          { 5,7, 20, 0, 0, 0, 0,27,0, 1,0,0, 15, 3, 0, 6, 1, 5,0, 2,1,0, 14, 4, 0, 6, 1, 5,0, 1,2,0, 15, 4, 0, 6, 1, 5,0, 1,3,0 });
-	_create_opn_voice("valsound.brass2",  "E.Trumpet (mute)",       { 2,7, 13, 6, 0, 8, 1,26,2, 2,3,0, 15, 8, 0, 8, 1,32,1, 2,7,0, 21,15, 0, 8,11,20,0, 2,3,0, 18, 4, 0, 8, 2, 0,1, 8,0,0 });
-	_create_opn_voice("valsound.brass3",  "Horn 2",                 { 4,7, 15,11, 2, 0, 2,23,0, 2,3,0, 13,12, 2,15, 2, 0,0, 2,3,0, 15,13, 5, 0, 1,27,0, 2,7,0, 13,11, 2,15, 2, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.brass4",  "Alpine Horn #3",         { 5,7, 15,10, 0, 6, 5,35,0, 1,0,0, 15, 5, 0, 8, 2, 6,0, 2,2,0, 15, 5, 0, 8, 2, 6,0, 1,5,0, 15, 5, 0, 8, 2, 6,0, 1,0,0 });
-	_create_opn_voice("valsound.brass5",  "Lead Brass",             { 2,7, 18, 4, 2, 8, 1,27,0, 2,3,0, 14,14, 0, 8, 5,33,1, 8,0,0, 20, 0, 2, 8, 0,36,0, 2,7,0, 17, 4, 1, 8, 3, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.brass6",  "Normal Horn",            { 4,7, 15,13, 2,15, 1,36,0, 2,3,0, 13,12, 2,15, 3, 0,0, 2,3,0, 15,13, 5,15, 2,25,0, 2,7,0, 13,11, 2,15, 3, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.brass7",  "Synth Oboe",             { 6,3, 17,15,15, 3,15,15,0, 1,7,0, 16, 0, 9, 0, 0, 0,0, 6,3,0, 21,15,11, 1, 4, 4,0, 4,3,0, 18,15,11, 1, 4, 4,0, 6,7,0 });
-	_create_opn_voice("valsound.brass8",  "Oboe 2",                 { 2,5, 19,18, 0, 9, 2,23,1, 1,0,0, 31,17, 0, 6, 3,28,0, 6,0,0, 31,20, 0, 5, 1,51,0, 8,0,0, 16,31, 0,11, 0, 0,1, 4,0,0 });
-	_create_opn_voice("valsound.brass9",  "Attack Brass (q2)",      { 4,4, 15, 9, 8, 8, 2,14,1, 4,7,0, 18,15, 1, 8, 3, 0,0, 4,3,0, 16, 9, 8, 8, 2,12,1, 2,3,0, 31,15, 1, 8, 3, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.brass10", "Sax",                    { 2,6, 13, 6, 0, 8, 1,14,2, 2,3,0, 15, 8, 0, 8, 1,30,1,10,7,0, 21, 7, 0, 8, 2,35,0, 1,3,0, 18, 4, 0, 9, 2, 0,1, 2,0,0 });
-	_create_opn_voice("valsound.brass11", "Soft Brass (lead)",      { 4,7, 16, 3, 0, 2, 1,30,0, 1,5,0, 18, 0, 0, 7, 0, 3,1, 4,0,0, 16, 0, 0, 2, 2,35,0, 1,1,0, 18, 5, 0, 7, 1, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.brass12", "Synth Brass 1 (old)",    { 5,7, 31, 7, 5,10, 2,28,0, 1,0,0, 31, 2, 5,10, 2, 0,0, 0,0,0, 31, 2, 5,10, 2, 2,0, 1,0,0, 31,10, 5,10,10, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.brass13", "Synth Brass 2 (old)",    { 5,7, 31,10, 1,10, 2,28,1, 2,0,0, 31,12, 1,10, 2, 2,0, 1,0,0, 31,12, 1,10, 2, 4,0, 2,0,0, 31,12, 1,10,10, 3,0, 4,0,0 });
-	_create_opn_voice("valsound.brass14", "Synth Brass 3",          { 4,7, 15, 9, 0, 9, 2,22,0, 2,7,0, 23, 4, 2, 9, 5, 0,0, 2,7,0, 14,10, 0, 9, 2,20,0, 2,3,0, 20, 4, 0, 9, 2, 0,0, 2,3,0 });
-	_create_opn_voice("valsound.brass15", "Synth Brass #4",         { 5,7, 20, 0, 0, 0, 0,22,0, 4,0,0, 18,12, 0, 8, 1, 0,0, 8,0,0, 20,12, 0, 8, 1, 0,0, 4,6,0, 22,12, 0, 8, 1, 0,0, 4,2,0 });
-	_create_opn_voice("valsound.brass16", "Synth Brass 5 (long)",   { 4,7, 29, 2, 2, 0, 3,28,0, 2,7,0, 29, 0, 2, 8, 5, 4,0, 4,7,0, 21, 2, 2, 0, 2,32,0, 1,3,0, 29, 0, 2, 8, 5, 4,0, 2,3,0 });
-	_create_opn_voice("valsound.brass17", "Synth Brass 6",          { 2,7, 30, 8, 8, 5, 3,25,0, 1,1,0, 25,10, 8, 6, 4,30,0, 2,1,0, 20,10, 5, 6, 3,40,0, 1,5,0, 20, 5, 5, 7, 5, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.brass18", "Trumpet",                { 2,7, 13, 6, 0, 8, 1,25,2, 2,3,0, 15, 8, 0, 8, 1,32,1, 6,7,0, 21, 7, 0, 8, 2,42,0, 2,3,0, 18, 4, 0, 8, 2, 0,1, 2,0,0 });
-	_create_opn_voice("valsound.brass19", "Trumpet 2",              { 2,6, 13, 6, 0, 8, 1,14,2, 2,3,0, 15, 8, 0, 8, 1,30,1,12,7,0, 21, 7, 0, 8, 2,38,0, 2,3,0, 18, 4, 0, 8, 2, 0,2, 2,0,0 });
-	_create_opn_voice("valsound.brass20", "Twin Horn (or OL=25)",   { 4,6, 14, 6, 0,11, 3,32,0, 4,3,0, 16, 8, 0, 9, 2, 0,0, 4,3,0, 14, 6, 0,11, 3,33,0, 3,7,0, 16, 8, 0, 9, 2, 0,0, 3,7,0 });
-
-	_begin_category("valsound.guitar");
-	_create_opn_voice("valsound.guitar1",  "Guitar VeloLow",             { 1,3, 31,11, 6, 0, 2,45,1, 7,0,0, 31, 7, 5, 0, 5,35,1, 2,0,0, 31, 7, 6, 0, 5,40,1, 1,0,0, 31,13, 5, 5, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.guitar2",  "Guitar VeloHigh",            { 1,4, 31,11, 6, 0, 2,43,1, 9,0,0, 31, 7, 5, 0, 5,35,1, 2,0,0, 31, 7, 6, 0, 5,35,1, 1,0,0, 31,13, 6, 5, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.guitar3",  "A.Guitar #3",                { 1,7, 31,10, 8, 4, 2,34,2,13,0,0, 31, 9, 7, 4, 2,36,0, 2,0,0, 31, 9, 8, 4, 2,38,0, 1,0,0, 31, 4, 2, 8, 2, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.guitar4",  "Cutting E.Guitar",           { 3,5, 21, 7, 1, 0, 1,18,0, 4,0,0, 24, 0, 4, 9, 1,15,0, 6,0,0, 22,20, 2, 7,13, 5,0, 2,3,0, 31,12, 0, 6, 1, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.guitar5",  "Dis. Synth (old)",           { 5,7, 31, 0, 0,12, 1,18,1, 1,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0, 31, 0, 1,12, 1, 4,1, 0,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0 });
-	_create_opn_voice("valsound.guitar6",  "Dis. Guitar (dra-spi)",      { 0,7, 16,15, 1, 3, 3,26,0, 3,3,0, 19,31, 1, 3, 0,27,0, 1,0,0, 26,31, 1, 3, 0,26,0, 1,5,0, 27,31, 1, 8, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.guitar7",  "Dis. Guitar (3-)",           { 1,7, 31,15, 1, 3, 3,30,1, 3,3,0, 31, 0, 1,10, 1,25,1, 1,0,0, 31, 0, 1,10, 1,22,1, 1,5,0, 31,13, 1, 7, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.guitar8",  "Dis. Guitar (3+)",           { 0,5, 31, 4, 0, 0, 1, 8,0, 3,0,0, 18, 1, 0, 8, 0,25,0,15,0,0, 31, 4, 0, 0, 1,23,0, 7,7,0, 31,12, 0, 9, 0, 0,0, 1,1,0 });
-	_create_opn_voice("valsound.guitar9",  "Feedback Guitar 1",          { 3,7, 31,13, 0, 2, 2,26,0, 6,3,0, 18, 7, 4,10, 5,24,0, 3,3,0, 31, 0, 0, 8, 0,22,0, 4,0,0, 31, 0, 0, 7, 1, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.guitar10", "Hard Dis. Guitar 1",         { 0,5, 31, 4, 4, 6, 1, 8,0, 3,0,0, 18, 1, 4, 0, 1,27,0,12,0,0, 31, 4, 4, 0, 1,22,0, 2,3,0, 31,12, 0, 8, 1, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.guitar11", "Hard Dis. Guitar 3",         { 0,5, 31, 4, 1, 0, 0,11,0, 3,0,0, 18, 1, 4, 7, 0,23,0,15,0,0, 31, 4, 2, 0, 0,24,0, 5,1,0, 31,12, 0, 7, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.guitar12", "Dis. Guitar ('94 Hard)",     { 0,7, 31, 0, 0,11, 0,21,0, 9,7,0, 31,15, 0,10, 1,26,0, 2,3,0, 31, 5, 0, 8, 1,25,0, 1,3,0, 31, 0, 0, 7, 0, 4,0, 2,7,0 });
-	_create_opn_voice("valsound.guitar13", "New Dis. Guitar 1",          { 0,5, 31, 5, 0, 0, 0,20,0, 2,3,0, 18, 5, 4, 7, 1,20,1, 5,3,0, 31, 6, 5, 0, 0,22,0, 1,7,0, 31,12, 0, 8, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.guitar14", "New Dis. Guitar 2",          { 0,5, 31, 5, 0, 0, 0,20,0, 3,3,0, 18, 5, 4, 7, 1,20,1, 7,3,0, 31, 6, 5, 0, 0,22,0, 1,7,0, 31,12, 0, 8, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.guitar15", "New Dis. Guitar 3",          { 3,5, 31, 5, 0, 0,10, 8,0, 3,0,0, 31, 1, 0, 8, 0,20,0,15,0,0, 31, 4, 0,15, 0,22,0, 1,3,0, 31,12, 0, 8, 1, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.guitar16", "Overdriven Guitar (AL=013)", { 1,7, 31, 5, 0, 0, 1,30,0, 3,0,0, 18, 5, 0, 8, 1,21,0, 2,2,0, 31, 5, 4, 0, 1,29,0, 1,6,0, 31,11, 0, 8, 1, 0,0, 1,2,0 });
-	_create_opn_voice("valsound.guitar17", "Metal Strings",              { 3,7, 26,16, 7, 4, 8,24,2, 8,7,0, 22,15, 6, 4, 9,22,2,12,2,0, 26, 9, 2, 7, 8,43,1, 3,0,0, 30, 8, 2, 8, 8, 0,2, 4,0,0 });
-	_create_opn_voice("valsound.guitar18", "Soft Dis. Guitar",           { 0,7, 16,15, 1, 9, 3,26,0, 6,3,0, 19,15, 1, 0, 0,27,0, 3,0,0, 26,15, 2, 0, 2,26,0, 1,5,0, 21,31, 0, 7, 0, 0,0, 1,0,0 });
-
-	_begin_category("valsound.lead");
-	_create_opn_voice("valsound.lead1",  "Acoustic Code",            { 4,4, 15, 0, 0,12, 0,28,0, 8,3,0, 17, 6, 1,12, 1, 0,1, 8,3,0, 15, 0, 0,12, 0,21,0, 4,7,0, 17, 6, 1,12, 1, 0,1, 4,7,0 });
-	_create_opn_voice("valsound.lead2",  "Analog Synth 1",           { 1,6, 31,10, 0, 8, 5,18,0,10,0,0, 31, 5, 1, 8, 2,30,0, 2,0,0, 31, 5, 1, 8, 2,50,0, 8,0,0, 31, 5, 1, 8, 2, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.lead3",  "Bosco Lead",               { 6,5, 28, 2, 2, 6, 0,20,0, 5,7,0, 10, 4, 4, 6, 0,10,0, 2,3,0, 15, 2, 2, 6, 0, 0,0, 3,7,0, 15, 4, 4, 6, 0, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.lead4",  "Cosmo Lead",               { 3,7, 31, 0, 0, 0, 0,25,0, 0,3,0, 15, 0, 0, 1, 0,25,0, 1,7,0, 22, 0, 0, 1, 0,23,0, 1,7,0, 18, 0, 0, 6, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead5",  "Cosmo Lead 2",             { 3,7, 31, 0, 0, 0, 0,33,0, 0,3,0, 15, 0, 0, 1, 0,30,0, 1,7,0, 22, 0, 0, 1, 0,28,0, 0,7,0, 18, 0, 0, 6, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead6",  "Digital Lead #1",          { 2,7, 31, 0, 0, 0, 0,26,0, 1,0,0, 31, 0, 0, 0, 0,37,0, 2,3,0, 31, 0, 0, 0, 0,27,0, 2,7,0, 31,12, 0,15, 1, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead7",  "Double Sin Wave",          { 7,4, 18, 4, 0,10, 1, 0,0, 1,3,0, 18, 4, 0, 7, 1, 0,0, 4,3,0, 17, 4, 0,10, 1, 0,0, 1,7,0, 14, 4, 0, 7, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.lead8",  "E.Organ 2 (bright)",       { 6,7, 31, 0, 0, 9, 0,33,0, 5,7,0, 31,13, 0, 9, 1, 0,0, 3,3,0, 31, 0, 0, 9, 0, 3,0, 2,3,0, 31, 0, 0, 9, 0, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.lead9",  "E.Organ 2 (voice)",        { 6,3, 31,15, 0,15, 3,35,0, 7,7,0, 31, 0, 0, 9, 0, 0,0, 3,3,0, 31,15, 3,11, 1, 4,0, 1,3,0, 31,15, 0,11, 1, 4,0, 2,7,0 });
-	_create_opn_voice("valsound.lead10", "E.Organ 4 (click)",        { 6,3, 31, 0, 0, 4, 1,33,0, 2,0,0, 31, 0, 0,10, 1, 0,0, 1,3,0, 31,12, 0,10, 1, 0,0, 4,7,0, 31,16, 0,12, 6, 0,1, 8,3,0 });
-	_create_opn_voice("valsound.lead11", "E.Organ 5 (click)",        { 6,2, 31, 0, 0, 4, 1,35,0, 2,0,0, 31, 0, 0,10, 1, 0,0, 2,3,0, 31,12, 0,10, 1, 0,0, 4,7,0, 28,16, 0,14, 8, 0,1, 8,3,0 });
-	_create_opn_voice("valsound.lead12", "E.Organ 6",                { 6,7, 31,15, 0, 0, 1,33,0, 7,7,0, 31,10, 0, 9, 1, 0,0, 4,3,0, 31, 0, 0, 9, 0, 3,0, 1,3,0, 31, 0, 0, 9, 0, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.lead13", "E.Organ 7 (church)",       { 6,7, 31, 0, 0, 9, 0,33,0, 4,7,0, 31, 0, 0, 9, 0, 0,0, 4,3,0, 31, 0, 0, 9, 0, 0,0, 2,3,0, 31, 0, 0, 9, 0, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.lead14", "Metal Lead",               { 0,7, 25, 5, 0,15, 4,22,0, 2,3,0, 21, 2, 0,12, 3,26,0, 7,0,0, 18, 7, 5, 8, 4,27,0, 6,7,0, 21, 5, 3, 8, 2, 0,0, 4,0,0 });
-	_create_opn_voice("valsound.lead15", "Metal Lead 3",             { 2,7, 31,10, 0, 0, 1,25,0, 4,3,0, 31, 5, 0, 4,15,25,0, 0,3,0, 31, 9, 0, 6,10,37,0, 4,7,0, 31, 0, 0, 9, 0, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.lead16", "Mono Lead",                { 3,7, 24,11, 1, 0, 8,42,2, 4,2,0, 24, 9, 1, 0, 5,19,2, 4,6,0, 23, 9, 2, 0,10,25,2, 8,1,0, 23, 5, 3,11, 8, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.lead17", "PSG like PC88 (long)",     { 1,7, 31, 0, 0,15, 0,27,0, 2,0,0, 31, 0, 0,15, 0,50,0, 1,0,0, 31, 0, 0,15, 0,40,0, 2,0,0, 31, 0, 0,15, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead18", "PSG Cut 1",                { 5,7, 31, 0, 0, 0, 0,30,0, 2,0,0, 31,15, 0,15, 3, 0,0, 1,0,0, 31,15, 0,15, 3, 0,0, 1,0,0, 31,15, 0,15, 3, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead19", "Attack Synth",             { 0,7, 31,15, 1, 0, 1,40,0, 8,0,0, 31,15, 1, 0, 1,20,1, 4,0,0, 31,15, 1, 0, 1,37,0, 1,0,0, 31,15, 1, 8, 3, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead20", "Sin Wave",                 { 6,2, 31, 0, 0,15, 0,43,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.lead21", "Synth & Bell 2",           { 4,7, 21, 0, 1,11, 0,29,1, 2,3,0, 14, 8, 0,13, 1, 8,0, 4,3,0, 31,11, 0, 0, 2,35,0,14,3,0, 31, 8, 5,10,15, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.lead22", "Chorus #2 (voice) & Bell", { 4,7, 21, 0, 1,11, 0,35,1, 2,3,0, 14, 8, 0,13, 1, 0,0, 2,3,0, 31,12, 0, 0, 2,44,0,14,3,0, 31, 9, 5,10,15, 0,0, 8,7,0 });
-	_create_opn_voice("valsound.lead23", "Synth 8-4 (cut)",          { 4,7, 31, 0, 0, 0, 0,30,1, 8,3,0, 18,13, 9, 7, 1, 0,1, 8,3,0, 31, 0, 0, 0, 0,22,1, 4,7,0, 21,13, 9, 7, 1, 0,1, 4,7,0 });
-	_create_opn_voice("valsound.lead24", "Synth 8-4 (long)",         { 4,7, 31, 0, 0, 0, 0,30,1, 8,3,0, 18,13, 1, 7, 1, 0,1, 8,3,0, 31, 0, 0, 0, 0,22,1, 4,7,0, 21,13, 1, 7, 1, 0,1, 4,7,0 });
-	_create_opn_voice("valsound.lead25", "Acoustic Code #2",         { 4,7, 31, 0, 0, 0, 0,28,0, 4,3,0, 31,10, 0, 7, 1, 0,0, 4,3,0, 31, 0, 0, 0, 0,21,0, 4,7,0, 31,10, 0, 7, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.lead26", "Acoustic Code #3",         { 4,7, 31, 0, 0, 0, 0,28,0, 4,3,0, 31,10, 0, 7, 1, 0,0, 8,3,0, 31, 0, 0, 0, 0,21,0, 4,7,0, 31,10, 0, 7, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.lead27", "Synth FB 4 (long)",        { 3,7, 25, 7, 0, 0, 5,23,0, 2,7,0, 17, 0, 0, 9, 0,32,0, 4,3,0, 25, 7, 0, 0, 6,27,0, 2,3,0, 16, 8, 0, 9, 1, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.lead28", "Synth FB 5 (long)",        { 4,7, 22, 4, 0, 0, 3,22,0, 2,3,0, 16, 8, 0, 9, 2, 0,0, 8,3,0, 22, 0, 0, 0, 0,15,0, 2,7,0, 16, 8, 0, 9, 2, 0,0, 8,7,0 });
-	_create_opn_voice("valsound.lead29", "Synth Lead 0",             { 4,6, 24, 7, 1, 0, 0,23,0, 1,3,0, 23, 8, 0, 6, 1, 0,0, 1,3,0, 24, 7, 1, 0, 0,12,0, 1,7,0, 15, 8, 0, 8, 1, 8,0, 3,7,0 });
-	_create_opn_voice("valsound.lead30", "Synth Lead 1",             { 3,7, 14,10, 0,15, 1,25,0, 2,0,0, 31, 0, 7,15, 0,15,0, 1,3,0, 31, 0, 0,15, 0,30,0, 2,7,0, 31, 0, 0,15, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead31", "Synth Lead 2",             { 2,7, 31, 4, 2, 8, 1,25,0, 4,3,0, 14,14, 0, 8, 5,32,1, 4,0,0, 21, 0, 2, 8, 0,35,0, 2,7,0, 21, 4, 1, 8, 3, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.lead32", "Synth Lead 3",             { 3,7, 20, 0, 0, 0, 0,29,0, 2,3,0, 18,12, 0, 8, 1,25,0, 2,7,0, 20,12, 0, 8, 1,30,0, 1,3,0, 22,12, 0, 8, 1, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.lead33", "Synth Lead 4",             { 4,5, 25,31, 1, 3, 1,10,0, 2,3,0, 31,10, 1,10, 2, 0,0, 4,7,0, 25,31, 1, 3, 1, 5,1, 2,7,0, 31,10, 1,10, 2, 0,0, 4,3,0 });
-	_create_opn_voice("valsound.lead34", "Synth Lead 5",             { 4,6, 31,10, 0, 8, 2,16,0,11,7,0, 31, 3, 0, 8, 2,18,0, 1,7,0, 31, 3, 0, 8, 2,50,0, 8,3,0, 31, 3, 0, 8, 2, 0,0, 2,3,0 });
-	_create_opn_voice("valsound.lead35", "Synth Lead 6",             { 4,5, 31, 0, 0, 0, 0,22,0, 2,7,0, 18,10, 0, 6, 1, 0,0, 8,7,0, 31, 0, 0, 0, 0,23,0, 4,3,0, 18,10, 0, 6, 1, 0,0, 4,3,0 });
-	_create_opn_voice("valsound.lead36", "Synth Lead 7 (soft FB)",   { 1,7, 31, 0, 0, 0, 0,23,0, 2,1,0, 31,10, 8, 0, 5,20,0, 2,7,0, 15,12, 0,12, 2,36,0, 6,5,0, 18, 0, 0, 6, 0, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.lead37", "Synth PSG",                { 0,7, 31, 1, 3, 0,15,21,0, 2,3,0, 31, 1, 6, 0,15,41,0, 4,3,0, 31, 1, 3, 0,15,22,0, 1,3,0, 31,13, 0, 6, 2, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.lead38", "Synth PSG 2",              { 0,7, 17, 1, 3, 8,15,32,0, 8,3,0, 19, 1, 6, 8,15,35,0, 4,3,0, 22, 1, 3, 8,15,20,0, 2,3,0, 31,11, 0, 8, 2, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.lead39", "Synth PSG 3",              { 5,7, 31, 0, 0, 0, 0,24,0, 2,0,0, 31,15, 0, 9, 3, 6,0, 1,0,0, 31,15, 0, 9, 3, 6,0, 1,0,0, 31,15, 0, 9, 3, 6,0, 2,0,0 });
-	_create_opn_voice("valsound.lead40", "Synth PSG 4",              { 5,7, 31, 0, 0, 0, 0,22,0, 1,0,0, 31,15, 1, 9, 3, 0,0, 1,0,0, 31,15, 1, 9, 3, 0,0, 0,0,0, 31,15, 2, 9, 4,10,0, 2,0,0 });
-	_create_opn_voice("valsound.lead41", "Synth PSG 5",              { 1,7, 31, 0, 0,15, 0,28,0, 5,0,0, 31, 0, 0,15, 0,45,0, 3,0,0, 31, 0, 0,15, 0,45,0, 2,0,0, 31, 0, 0,15, 0, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.lead42", "Sin Water Synth",          { 6,0, 31, 0, 0,15, 0,44,0, 1,0,0, 24, 0, 0,15, 0, 2,0, 1,0,0, 25,21, 0,15,15,14,0, 6,0,0, 24, 0, 0,15, 0, 4,0, 2,0,0 });
-
-	_begin_category("valsound.percus");
-	_create_opn_voice("valsound.percus1",  "Bass Drum 2",                { 0,0, 30,26, 0,13,15,26,0, 1,0,0, 30,28, 0,14,15,37,0,15,3,0, 30,16, 0, 8,15, 5,0, 0,0,0, 29,16, 0, 8,15, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.percus2",  "Bass Drum 3 (o1f)",          { 2,5, 24,19, 0, 0,15,30,2, 1,3,0, 31,18,13,14,15,30,1, 0,0,0, 31,19,13, 8,15, 5,1, 1,7,0, 31,16,15,12,15, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.percus3",  "Bass Drum RUFINA (o2c)",     { 5,5, 29,20,18,15, 5,11,1, 0,2,0, 31,16,18,15, 5, 2,1, 0,0,0, 31,16,17,15, 3, 0,1, 0,0,0, 31,15,18,15, 4, 0,1, 0,0,0 });
-	_create_opn_voice("valsound.percus4",  "Bass Drum (-vBend)",         { 3,7, 31, 8, 0, 1, 5, 8,2,15,1,0, 31,21, 4, 1,12,18,2, 1,0,0, 31,26, 0,15,15,14,2, 0,0,0, 31,13,10,15,15, 0,2, 0,0,0 });
-	_create_opn_voice("valsound.percus5",  "Bass Drum 808 2 (-vBend)",   { 6,3, 31,16,10,15,15,15,0, 0,0,0, 31,15,10,15,15, 0,0, 0,0,0, 28,15,20,15,15, 0,0, 2,3,0, 26,15,20,15,15, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.percus6",  "Cho-Cho 3 (o2e)",            { 4,2, 18,18, 0,14,15, 0,3, 4,7,0, 17,17, 0,14,15, 0,2, 2,3,0, 18,18, 0,14,15, 0,3, 4,3,0, 17,17, 0,14,15, 0,2, 2,7,0 });
-	_create_opn_voice("valsound.percus7",  "Cowbell 1",                  { 3,7, 31,18,19, 6, 2, 8,1,12,1,0, 31,18,12, 6, 2,35,1, 7,2,0, 31,17,13, 6, 3,32,1, 7,3,0, 31,19,15, 9, 1, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.percus8",  "Crash Cymbal (noise)",       { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 21,10,11,13, 5, 0,1, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 31, 9, 9, 9,15, 5,2,15,3,0 });
-	_create_opn_voice("valsound.percus9",  "Crash Noise",                { 0,7, 23, 2, 8, 2,15, 0,0,15,3,0, 25, 2, 8, 2,15,14,1,12,7,0, 22, 2, 8, 5,15, 4,0, 3,3,0, 23, 7, 8, 5,15, 0,0, 6,7,0 });
-	_create_opn_voice("valsound.percus10", "Crash Noise (short)",        { 0,7, 23, 2, 8, 2,15, 0,2,15,3,0, 25, 2, 8, 2,15,14,3,12,7,0, 22, 2, 8, 5,15, 4,2, 3,3,0, 23, 7, 8, 5,15, 0,2, 6,7,0 });
-	_create_opn_voice("valsound.percus11", "Ethnic Percus. 0",           { 3,7, 31,19, 6, 3,13,40,1,10,3,0, 31,12, 4, 0, 5,34,1, 4,3,0, 31,16, 6,10,14,36,1, 2,7,0, 31,14, 6, 6,15, 0,1, 0,0,0 });
-	_create_opn_voice("valsound.percus12", "Ethnic Percus. 1",           { 4,6, 31,16, 0, 5,15,35,0, 0,3,0, 31, 5,15,15,15, 0,0, 0,3,0, 31,21, 0,15,11,15,0, 4,1,0, 31,20,21, 9, 2, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.percus13", "Heavy Bass Drum 1",          { 5,0, 31,15, 0, 8,15,10,0, 0,0,0, 31,13, 0, 8,15, 0,0, 0,0,0, 31,13, 0, 8,15, 0,0, 0,0,0, 31,24, 0, 9,15,20,0, 1,0,0 });
-	_create_opn_voice("valsound.percus14", "Heavy Bass Drum 2",          { 5,3, 31,16,10, 8,15,10,0, 0,0,0, 31,15,10, 8,15, 0,0, 0,0,0, 31,10,10, 8,14, 0,0, 0,0,0, 31,20,10, 8,15,10,0, 1,0,0 });
-	_create_opn_voice("valsound.percus15", "Heavy Snare Drum 1",         { 4,7, 31, 0, 0, 0, 0, 0,0,15,0,0, 28, 0,15,13, 0, 0,0, 4,0,0, 31,18,15, 7, 4, 0,1, 0,0,0, 31, 5,12, 7, 0, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.percus16", "Closed Hi-Hat 3",            { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 18,17,18,13, 5, 0,0, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 18,16,13, 9,15, 5,1,15,3,0 });
-	_create_opn_voice("valsound.percus17", "Closed Hi-Hat 4",            { 4,7, 31,11, 0, 0, 5, 0,1,15,0,0, 31,17,12, 9, 9, 0,1, 0,0,0, 31, 0, 0,15, 0, 0,1, 0,0,0, 25,19,20,15,15, 7,0,15,0,0 });
-	_create_opn_voice("valsound.percus18", "Closed Hi-Hat 5",            { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 21,18,18,13, 5, 0,0, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 31,17,13, 9,15, 5,1,15,3,0 });
-	_create_opn_voice("valsound.percus19", "Closed Hi-Hat 6 -808-",      { 0,7, 27, 0,10, 0,15,39,0,15,0,0, 31, 4,10,14,15,30,0,11,0,0, 31,10,10,14,15, 5,1, 9,7,0, 31,19,10,15,15, 0,1, 9,3,0 });
-	_create_opn_voice("valsound.percus20", "Metal Hi-Hat #7 (o3-6)",     { 4,7, 31,16,10, 8,10, 0,0,15,3,0, 31,18, 7,12,15, 0,1, 1,3,0, 31,10,10, 6,10, 2,0,15,7,0, 21,18, 7,12,15, 0,1, 0,7,0 });
-	_create_opn_voice("valsound.percus21", "Closed Hi-Hat #8 (o4)",      { 4,7, 25,19, 0, 9, 3, 0,1,15,0,0, 22,19,16,14, 5, 0,1, 1,0,0, 31,10,15,15, 5, 0,0,15,0,0, 31,19,19,15, 2, 0,1,15,0,0 });
-	_create_opn_voice("valsound.percus22", "Open Hi-Hat (o4e-g+)",       { 4,5, 31, 5, 6, 0, 5, 0,2,15,7,0, 31,10, 4, 7, 8,19,2, 3,1,0, 31,20, 6, 3, 3, 0,2, 1,7,0, 31,25, 6, 7,10, 6,3, 7,0,0 });
-	_create_opn_voice("valsound.percus23", "Open Metal Hi-Hat 2 (o4c-)", { 4,7, 31,14, 0, 8, 3, 0,1,15,3,0, 31,15, 8,12,13, 0,1, 7,3,0, 31,13, 0, 6, 3, 1,0,10,7,0, 31,15,11,12,12, 0,1, 7,7,0 });
-	_create_opn_voice("valsound.percus24", "Open Metal Hi-Hat 3",        { 4,7, 31,14, 0, 8, 3, 0,1,15,3,0, 31,15, 8,12,13, 0,0, 7,3,0, 31,13, 0, 6, 1, 1,0,10,7,0, 31,15,11,12, 7, 0,0, 7,7,0 });
-	_create_opn_voice("valsound.percus25", "Open Hi-Hat #4 (o4f)",       { 4,6, 31,15, 0, 9, 1, 0,0,15,0,0, 31,20, 5,14, 5, 3,0, 4,0,0, 31,10, 9, 9, 1, 0,0,10,0,0, 31,22, 5,14, 5, 0,1, 7,0,0 });
-	_create_opn_voice("valsound.percus26", "Metal Ride (o4c,o5c)",       { 4,5, 20, 5, 0, 0, 5,11,2,15,3,0, 18,11, 9, 7,11, 0,2, 8,3,0, 31,19, 0, 3, 3, 0,1,15,7,0, 16,12, 9, 7,11, 0,2, 7,7,0 });
-	_create_opn_voice("valsound.percus27", "Rim Shot #1 (o3c)",          { 0,7, 31,11, 0,15,15,37,1,15,1,0, 31,12, 0,15,15,40,1,10,2,0, 31,17, 0,15,15,13,2, 0,3,0, 31,16, 0,15,15, 0,2, 0,7,0 });
-	_create_opn_voice("valsound.percus28", "Snare Drum (light)",         { 4,7, 31, 0, 0, 7, 0, 0,0,15,0,0, 31,15,15, 9, 2, 0,0,15,0,0, 31,21, 0,15,11,10,0, 4,1,0, 31,19,17, 9, 2, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.percus29", "Snare Drum (lighter)",       { 4,6, 31, 0, 0,14, 0, 0,0,10,3,0, 31,15,15,14, 1, 0,0,12,7,0, 31,15, 0,14,15, 0,3, 2,3,0, 31,15, 0,14,15, 0,2, 0,7,0 });
-	_create_opn_voice("valsound.percus30", "Snare Drum 808 (o2-o3)",     { 4,7, 31, 0, 0, 0, 0, 5,0,15,7,0, 31,18,17,15, 1, 0,0, 9,3,0, 31,19, 0,15,15, 0,0, 0,7,0, 26,21,16,15,15, 0,0, 0,3,0 });
-	_create_opn_voice("valsound.percus31", "Snare 4 -808- (o2)",         { 4,7, 31,12, 0,12, 4, 0,1, 7,3,0, 27,15,18,15, 1, 0,1,15,3,0, 31,20,15,12,15,11,0, 1,7,0, 31,19,15,15,15, 0,1, 1,7,0 });
-	_create_opn_voice("valsound.percus32", "Snare 5 Franger (o1-2)",     { 4,7, 31,16, 0, 0, 2, 6,0,15,7,0, 31,18,15,15, 0, 0,0, 9,3,0, 28,20, 0,15,15, 0,0, 0,7,0, 25,16,15,15,15, 0,0, 0,3,0 });
-	_create_opn_voice("valsound.percus33", "Old Tom",                    { 4,7, 31,11, 0, 1,15, 0,0,15,3,0, 31,20,14,15, 5, 0,0, 1,3,0, 31,16,15, 5,15,48,0, 0,7,0, 31,11,15,15,15, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.percus34", "Synth Tom 2 (AL=3)",         { 3,7, 31, 4, 0, 1, 0, 0,1,15,1,0, 31,21, 4, 1,10,15,1, 1,0,0, 31,26, 0,15,15, 0,1, 0,0,0, 31,11, 0, 7,15, 0,1, 0,0,0 });
-	_create_opn_voice("valsound.percus35", "Synth Tom #3 (noisy)",       { 3,7, 31,20, 0, 0, 2, 0,0,15,3,0, 31,18,13, 6, 8,28,0, 0,3,0, 31,16, 9,12, 5,44,0, 1,7,0, 31,14, 4,12, 1, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.percus36", "Synth Tom #3",               { 1,7, 31,18,10, 0, 1, 0,0,15,3,0, 31,15,10, 6, 5, 0,0, 5,3,0, 31,17,12,12, 6,37,0, 1,7,0, 31,14, 4,12, 1, 0,0, 0,7,0 });
-	_create_opn_voice("valsound.percus37", "Synth Tom #4 (-DX7-)",       { 3,7, 31, 4, 0, 1, 0, 0,1,11,0,0, 31,21, 4, 1, 6,25,1, 1,3,0, 31,26, 0,15,15, 0,1, 0,0,0, 31,11, 0, 7,15, 0,1, 0,0,0 });
-	_create_opn_voice("valsound.percus38", "Triangle 1 (o5c)",           { 4,5, 31,18, 0,11, 2, 9,0,14,3,0, 31,21, 7,12, 4, 0,0, 8,3,0, 31,22, 0,12,15, 0,0,15,7,0, 31,20, 6,15,15, 0,0, 7,7,0 });
-
-	_begin_category("valsound.piano");
-	_create_opn_voice("valsound.piano1",  "Acoustic Piano 2 (attack)", { 4,5, 31, 5, 0, 0, 0,23,1, 1,3,0, 20,10, 3, 7, 8, 0,1, 1,3,0, 31, 3, 0, 0, 0,25,1, 1,7,0, 31,12, 3, 7,10, 2,1, 1,7,0 });
-	_create_opn_voice("valsound.piano2",  "Clavichord 1 (backing)",    { 2,7, 31, 8, 3, 6, 2,40,2, 1,3,0, 31, 7, 4, 6, 2,37,1, 5,2,0, 31, 7, 2, 6, 1,30,1, 3,7,0, 28,30, 9, 7, 0, 0,2, 1,4,0 });
-	_create_opn_voice("valsound.piano3",  "Clavichord 2",              { 2,6, 31,15, 8, 6, 2,35,0,12,3,0, 31, 6, 2, 6, 2,32,0, 3,0,0, 31, 6, 2, 6, 1,32,0, 1,7,0, 31, 8, 6, 7, 4, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.piano4",  "Deep Piano 1",              { 2,5, 31, 9, 4, 0, 2,38,0, 0,3,0, 22, 7, 3, 9, 3,31,1, 3,0,0, 31, 7, 3, 2, 3,27,1, 0,7,0, 28, 7, 1, 7, 1, 0,1, 0,0,0 });
-	_create_opn_voice("valsound.piano5",  "Deep Piano 3",              { 2,0, 31,20, 9, 0, 2, 8,1, 0,7,0, 31,11, 3, 1, 1,23,1, 4,3,0, 31,13, 5, 2, 2,30,0, 0,3,0, 31, 0, 4, 6, 0, 0,1, 1,7,0 });
-	_create_opn_voice("valsound.piano6",  "E.Piano #2",                { 4,6, 22, 5, 0, 3, 5,30,0, 2,3,0, 16, 8, 8, 7, 2, 0,1, 2,3,0, 20, 5, 0, 3, 5,34,0, 4,7,0, 17, 8, 7, 7, 2, 0,1, 2,7,0 });
-	_create_opn_voice("valsound.piano7",  "E.Piano #3",                { 4,7, 22, 5, 0, 3, 5,41,0, 1,3,0, 16, 8, 8, 7, 2, 0,1, 2,3,0, 31,18, 0, 3,10,44,0, 8,7,0, 31, 9, 7, 7, 2, 3,1, 1,7,0 });
-	_create_opn_voice("valsound.piano8",  "E.Piano #4 (2+)",           { 4,6, 31, 5, 0,15, 5,46,2, 2,3,0, 31, 9, 8,15, 3, 0,2, 2,3,0, 31, 5, 0,15, 5,44,2, 4,7,0, 31, 9, 7,15, 3, 0,2, 2,7,0 });
-	_create_opn_voice("valsound.piano9",  "E.Piano #5 (bell)",         { 4,7, 31, 7, 0, 9, 5,35,0, 6,3,0, 31,11, 7,14, 4, 5,1, 2,3,0, 31,10, 9, 9, 5,35,0,12,7,0, 31,11, 7,14, 4, 5,0, 2,7,0 });
-	_create_opn_voice("valsound.piano10", "E.Piano #6",                { 4,7, 29,20, 0, 0, 3,34,0, 8,3,0, 17, 8, 0, 7, 6, 2,0, 4,3,0, 30, 0, 0, 0, 0,25,0, 4,7,0, 18, 8, 0, 7, 6, 2,0, 4,7,0 });
-	_create_opn_voice("valsound.piano11", "E.Piano #7",                { 4,7, 31,15, 0,10,15,40,0,15,0,0, 31,10, 0, 7,15,15,0, 1,0,0, 31,10, 0, 5,15,20,0, 1,0,0, 31,10, 0, 7,15, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.piano12", "Harpsichord 1",             { 2,5, 31,13, 0,15,10,30,1, 0,3,0, 31,11, 2, 0, 3,32,1, 7,3,0, 31, 2, 0, 0, 1,30,0, 0,7,0, 31, 6, 6, 7, 1, 0,1, 4,7,0 });
-	_create_opn_voice("valsound.piano13", "Harpsichord 2",             { 2,7, 31, 4, 0, 5, 1,30,2, 0,3,0, 31, 9, 1, 2, 1,40,2,12,0,0, 31, 4, 3, 6, 1,30,1, 3,7,0, 31,11, 5, 8, 4, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.piano14", "Piano 1 (ML1,10,5,1)",      { 2,7, 28, 4, 0, 5, 1,37,2, 1,3,0, 22, 9, 1, 2, 1,47,2,12,0,0, 29, 4, 3, 6, 1,37,1, 3,7,0, 18, 8, 0, 6, 6, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.piano15", "Piano 3",                   { 2,7, 31, 4, 2, 0, 1,35,2, 1,3,0, 24, 0, 1, 5, 0,38,3, 1,0,0, 28, 0, 0, 5, 0,42,2, 4,5,0, 28, 7, 4, 6, 4, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.piano16", "Piano 4",                   { 2,7, 31, 4, 0, 5, 1,37,2, 1,3,0, 31, 9, 1, 2, 1,47,2,10,0,0, 31, 4, 3, 6, 1,37,1, 2,7,0, 31, 8, 0, 6, 6, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.piano17", "Digital Piano #5",          { 3,7, 28, 4, 0, 7, 1,27,1, 1,4,0, 28,14, 7, 4, 3,42,2,14,3,0, 26, 4, 3, 8, 2,38,0, 3,7,0, 25, 7, 8, 7, 0, 0,2, 1,6,0 });
-	_create_opn_voice("valsound.piano18", "Piano 6 (high-tone)",       { 2,7, 28, 4, 0, 5, 1,39,2, 1,3,0, 31,13, 1, 2, 2,50,2,14,0,0, 29, 4, 3, 6, 1,41,1, 3,7,0, 21, 8, 6, 6, 6, 0,2, 1,0,0 });
-	_create_opn_voice("valsound.piano19", "Panning Harpsichord",       { 2,7, 31, 2,10, 6,14,40,3,12,3,0, 25, 2,15, 6,14,32,0, 9,0,0, 30, 2, 4, 6,14,34,3, 5,7,0, 20, 2, 8, 6,14, 0,3, 1,0,0 });
-	_create_opn_voice("valsound.piano20", "Yam Harpsichord",           { 1,4, 31, 6, 5, 6, 7,40,0,10,0,0, 31, 6, 4, 5, 5,35,0, 2,0,0, 31, 6, 5, 5, 5,24,0, 1,0,0, 31, 7, 6, 7, 5, 0,0, 1,0,0 });
-
-	_begin_category("valsound.se");
-	_create_opn_voice("valsound.se1", "S.Effect 1 (detune, o2c)", { 0,4, 31, 7, 3, 0, 1,12,0, 0,1,0, 31,10, 0, 8, 3,25,0, 0,2,0, 31, 6, 4, 8, 8, 0,0, 4,3,0, 31,12, 0, 8, 0, 0,0,12,7,0 });
-	_create_opn_voice("valsound.se2", "S.Effect 2 (o0-1-2)",      { 1,2, 31, 6, 7,15, 3, 8,0, 0,3,0, 31, 6, 9,15, 6, 8,0, 0,7,0,  6, 6, 6,15, 1,10,0,12,3,0, 31, 5, 4,15, 2, 0,0, 0,0,0 });
-	_create_opn_voice("valsound.se3", "S.Effect 3 (FB + noise)",  { 4,6,  4, 3, 0,15, 4, 0,0, 0,7,0,  8, 7, 7,15, 1, 0,0, 7,7,0,  5, 0, 0,15, 0, 0,0, 0,3,0,  8, 6, 3,15, 1, 0,0, 4,3,0 });
-
-	_begin_category("valsound.special");
-	_create_opn_voice("valsound.special1", "Digital 1",                { 3,6, 31,12, 3, 5, 5,26,0,14,7,0, 31,16, 6, 0, 3,28,0, 8,3,0, 31, 0,12, 0, 0,30,0, 0,0,0, 31,15,12,12, 2, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.special2", "Digital 2",                { 0,7, 31,15, 0,12, 3,27,0,10,7,0, 31,16, 0, 0, 4,30,0,15,3,0, 31,15, 0, 0, 2,30,0, 2,0,0, 31,15, 0,12, 2, 0,0, 1,7,0 });
-	_create_opn_voice("valsound.special3", "Digital Bass 3 (o2-o3)",   { 0,7, 31, 0, 0, 9, 0,27,0,12,1,0, 31,10, 0, 9, 1,25,0, 0,2,0, 31,10, 0, 9, 1,25,0,12,3,0, 31,12, 0,14, 2, 3,0, 1,7,0 });
-	_create_opn_voice("valsound.special4", "Digital Guitar 3 (o2-o3)", { 0,7, 31, 0, 0, 9, 0,27,0,12,1,0, 31,10, 0, 9, 1,25,0, 0,2,0, 31,10, 0, 9, 1,25,0, 3,3,0, 31,12, 0,14, 2, 3,0, 1,7,0 });
-	_create_opn_voice("valsound.special5", "Digital 4 (o4a)",          { 5,0, 31,31, 0, 0, 0,61,0, 9,0,0, 31,31, 0,13, 0, 3,0, 3,0,0, 31,31, 0,13, 0,15,0, 9,0,0, 31,31, 0,13, 0, 6,0, 6,0,0 });
-
-	_begin_category("valsound.strpad");
-	_create_opn_voice("valsound.strpad1",  "Accordion 1",              { 4,6, 17, 0, 0, 0, 0,20,0, 4,3,0, 16, 9, 0,12, 2, 0,0, 8,3,0, 15, 0, 0, 7, 0,36,0, 4,7,0, 15, 9, 0,12, 2, 0,0, 8,7,0 });
-	_create_opn_voice("valsound.strpad2",  "Accordion 2",              { 4,6, 21, 0, 1,11, 0,22,1, 4,3,0, 14, 8, 0,13, 1, 0,0, 4,3,0, 21, 0, 1,10, 0,30,1, 4,7,0, 14, 8, 1,13, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.strpad3",  "Accordion 3",              { 4,7, 31, 5, 0, 0, 0,25,0, 4,7,0, 14, 8, 0,13, 1, 0,0, 4,7,0, 31, 8, 0, 0,10,25,0, 2,3,0, 14, 6, 0,13, 1, 0,0, 4,3,0 });
-	_create_opn_voice("valsound.strpad4",  "Chorus #2 (voice)",        { 4,6, 21, 0, 1,11, 0,40,1, 4,3,0, 14, 8, 0,13, 1, 0,0, 4,3,0, 21, 0, 1,10, 0,37,1, 4,7,0, 14, 8, 1,13, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.strpad5",  "Chorus #3",                { 4,4, 21, 0, 0, 2, 0,42,0, 4,3,0, 18, 4, 0, 9, 1, 0,0, 8,3,0, 21, 0, 0, 2, 0,45,0, 4,7,0, 18, 4, 0, 9, 1, 0,0, 4,7,0 });
-	_create_opn_voice("valsound.strpad6",  "Chorus #4",                { 6,3, 21, 0, 0, 2, 0,39,0, 4,0,0, 18, 4, 0, 9, 1, 0,0, 4,1,0, 18,10, 0, 9, 1, 0,0, 4,3,0, 18, 8, 0, 9, 2, 0,0, 2,7,0 });
-	_create_opn_voice("valsound.strpad7",  "Fretless Strings 1",       { 2,7, 25,10, 0, 5, 1,29,1, 1,1,0, 25,11, 0, 8, 5,15,1, 5,1,0, 28,13, 0, 6, 2,45,1, 1,0,0, 14, 4, 0, 6, 0, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.strpad8",  "Fretless Strings 2",       { 2,0, 21, 7, 0, 7, 3,37,1, 1,3,0, 20,11, 0,12, 3,15,1, 5,7,0, 16, 8, 0,12, 3,45,1, 1,0,0, 14, 5, 0,12, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.strpad9",  "Fretless Strings 3",       { 2,7, 25,10, 0, 5, 1,35,1, 1,3,0, 25,11, 0, 8, 5,13,1, 5,0,0, 28,13, 0, 6, 2,45,1, 1,7,0, 14, 4, 0, 6, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.strpad10", "Fretless Strings 4 (low)", { 2,7, 25,10, 0, 5, 1,29,1, 0,3,0, 25,11, 0, 8, 5,20,1, 4,0,0, 28,13, 0, 6, 2,38,1, 1,7,0, 14, 4, 0, 6, 1, 0,1, 1,0,0 });
-	_create_opn_voice("valsound.strpad11", "Pizzicato #1 (Koto 2)",    { 0,6, 31, 7, 8, 1, 2,30,3, 3,7,0, 31, 5, 9, 1, 1,30,3, 2,0,0, 31, 5, 8, 3, 2,35,3, 1,0,0, 31,11, 7, 5, 5, 0,2, 1,3,0 });
-	_create_opn_voice("valsound.strpad12", "Soundtrack (Modoki)",      { 4,7, 31, 0, 0, 0, 0,30,1, 2,3,0, 18,13, 4, 7, 1, 0,1, 2,3,0, 31, 0, 0, 0, 0,22,1, 3,7,0, 21,13, 4, 7, 1, 0,1, 3,7,0 });
-	_create_opn_voice("valsound.strpad13", "Strings",                  { 2,7, 15, 9, 0, 5, 1,27,2, 2,3,0, 15, 0, 0, 5,15,31,2, 2,0,0, 15, 0, 0, 5, 0,27,1, 2,0,0, 13, 3, 0, 8, 0, 0,1, 2,7,0 });
-	_create_opn_voice("valsound.strpad14", "Synth Accordion",          { 4,7, 18, 0, 0,11, 0,21,1, 2,3,0, 15, 9, 0,13, 2, 0,1, 8,3,0, 18, 0, 0,11, 0,20,1, 2,7,0, 14, 9, 0,13, 2, 0,1, 4,7,0 });
-	_create_opn_voice("valsound.strpad15", "Phaser Synth",             { 0,7, 27,31, 5, 5, 5, 8,0, 1,4,0, 26,31, 4, 5, 4,18,0, 1,5,0, 19,31, 0, 5, 2,18,0, 1,6,0, 16,15, 0, 6, 2, 0,0, 3,4,0 });
-	_create_opn_voice("valsound.strpad16", "FB Synth",                 { 3,7, 31, 6, 0, 0, 4,22,0, 2,0,0, 18, 0, 0, 8, 0,28,0, 4,6,0, 20, 5, 0, 8, 2,28,0, 2,1,0, 20, 4, 0, 8, 1, 0,0, 2,2,0 });
-	_create_opn_voice("valsound.strpad17", "Synth Strings (MB)",       { 3,7, 21, 0, 0, 0, 0,30,0, 1,1,0, 14, 7, 7, 6, 3,25,0, 2,6,0, 15, 0, 0, 5, 0,38,0, 5,6,0, 18, 0, 0, 6, 0, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.strpad18", "Synth Strings #2",         { 2,7, 20, 1, 0, 8, 1,32,0, 2,7,0, 15, 4, 0, 8, 1,28,0, 2,0,0, 22, 1, 0, 8, 1,34,0, 2,3,0, 14, 2, 0, 9, 1, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.strpad19", "Synth Sweep Pad #1",       { 5,6, 31, 7, 0, 9, 5,18,0, 4,0,0, 31,15, 0,14, 1, 5,0, 8,0,0, 31,16, 0,15, 2, 5,0, 4,0,0, 31,26, 0,14, 2, 5,0, 8,1,0 });
-	_create_opn_voice("valsound.strpad20", "Twin Synth #1 (calm)",     { 4,2, 16, 3, 0, 0, 2,25,0, 4,3,0, 19,12, 0, 6, 1, 0,0, 4,3,0, 16, 3, 0, 0, 2,20,0, 3,7,0, 19,12, 0, 6, 1, 0,0, 3,7,0 });
-	_create_opn_voice("valsound.strpad21", "Twin Synth #2 (FB)",       { 4,6, 16, 3, 0, 0, 2,20,0, 4,7,0, 19,12, 0, 6, 1, 0,0, 8,3,0, 16, 3, 0, 0, 2, 6,0, 3,3,0, 19,12, 0, 6, 1, 8,0, 6,7,0 });
-	_create_opn_voice("valsound.strpad22", "Twin Synth #3 (FB)",       { 4,6, 16, 6, 5, 0, 2,20,0, 4,3,0, 19,12, 0, 6, 1, 0,0, 8,3,0, 16, 6, 5, 0, 2, 6,0, 3,7,0, 19,12, 0, 6, 1, 8,0, 6,7,0 });
-	_create_opn_voice("valsound.strpad23", "Vocoder Voice 1",          { 4,7, 31, 8, 5,12,15,20,0, 4,7,0, 31, 0, 0,15, 0, 0,0, 8,7,0, 31, 8, 5,12,15,24,0, 3,3,0, 31, 0, 0,15, 0, 0,0, 6,3,0 });
-	_create_opn_voice("valsound.strpad24", "Voice (o3-o5)",            { 6,0, 10, 0, 1, 3, 0,70,0, 1,0,0, 12, 0, 0, 5, 0, 7,2, 3,3,0, 12, 0, 1, 6, 2, 0,1, 2,7,0, 18, 0, 0, 6, 0,17,1, 0,3,0 });
-	_create_opn_voice("valsound.strpad25", "Voice 2 (o3-o5)",          { 6,0, 10, 0, 1, 3, 0,70,0, 0,0,0, 12, 0, 0, 5, 0, 6,2, 3,3,0, 12, 0, 1, 6, 2, 0,1, 2,7,0, 18, 0, 0, 6, 0,10,1, 1,3,0 });
-
-	_begin_category("valsound.wind");
-	_create_opn_voice("valsound.wind1", "Clarinet #1",              { 3,7, 31, 0, 0, 7, 0,35,0, 4,0,0, 25,14, 0, 4, 2,42,0, 4,0,0, 31, 0, 0, 8, 0,38,0, 2,0,0, 18, 7, 0, 8, 1, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.wind2", "Clarinet #2 (brighter)",   { 3,7, 31, 0, 0, 7, 0,40,0, 8,0,0, 27,17, 0, 4, 4,45,0, 8,0,0, 31, 0, 0, 8, 0,37,0, 4,0,0, 18, 7, 0, 8, 1, 0,0, 1,0,0 });
-	_create_opn_voice("valsound.wind3", "E.Flute",                  { 3,0, 20, 0, 0,10, 0,38,0, 6,0,0, 14,16, 0,10, 5,36,0, 2,3,0, 18,18, 0,10, 3,40,0, 4,0,0, 14,12, 0,10, 1, 0,1, 2,0,0 });
-	_create_opn_voice("valsound.wind4", "E.Flute 2",                { 3,5, 20, 0, 0,10, 0,28,0, 2,3,0, 14,16, 0,10, 5,40,0, 2,3,0, 18,18, 0,10, 3,34,0, 4,0,0, 14,12, 0,10, 1, 0,1, 2,7,0 });
-	_create_opn_voice("valsound.wind5", "Flute + Bell",             { 4,5, 16, 0, 0, 8, 1,47,0, 8,3,0, 14, 0, 0, 8, 0, 0,0, 4,3,0, 31,12, 0, 8, 2,45,0,14,7,0, 31, 8, 0, 8,15, 0,0, 8,7,0 });
-	_create_opn_voice("valsound.wind6", "Old Flute",                { 2,7, 20, 5, 0,14, 1,50,0, 4,0,0, 15,15, 0,14, 2,45,0, 8,0,0, 18,15, 0,14, 2,50,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 });
-	_create_opn_voice("valsound.wind7", "Whistle 1",                { 2,7, 20, 5, 0,14, 1,60,0, 4,0,0, 15,15, 0,14, 2,55,0,12,0,0, 18,15, 0,14, 2,60,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 });
-	_create_opn_voice("valsound.wind8", "Whistle 2",                { 2,7, 20, 5, 0,14, 1,55,0, 2,0,0, 15,15, 0,14, 2,55,0, 8,0,0, 18,15, 0,14, 2,60,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 });
-
-	_begin_category("valsound.world");
-	_create_opn_voice("valsound.world1", "Banjo (Harpsichord)",     { 1,7, 31, 7, 0,10,15,38,0,12,7,0, 31, 8, 6, 7, 3,52,2,10,1,0, 31,12, 6, 7, 3,25,0, 1,0,0, 31,11, 7, 7, 3, 0,2, 3,5,0 });
-	_create_opn_voice("valsound.world2", "Koto 1",                  { 3,0, 31, 0, 0,10, 0,38,0, 6,0,0, 24,13, 0,10, 5,40,0, 2,3,0, 28,15, 0,10, 3,40,0, 4,0,0, 24,12, 8,10, 2, 0,1, 2,0,0 });
-	_create_opn_voice("valsound.world3", "Koto 2",                  { 0,7, 31, 7, 3, 3, 2,30,3, 3,7,0, 31, 5, 3, 3, 1,30,3, 2,0,0, 31, 5, 3, 5, 2,30,3, 1,0,0, 31,10, 3, 7, 2, 0,3, 1,3,0 });
-	_create_opn_voice("valsound.world4", "Sitar 1",                 { 0,6, 18, 5, 3, 1, 2,30,1, 3,7,0, 31, 5, 4, 1, 1,28,1, 2,0,0, 31, 5, 3, 3, 2,35,1, 1,0,0, 31,10, 2, 5, 4, 0,0, 1,3,0 });
-	_create_opn_voice("valsound.world5", "Shamisen 2",              { 3,7, 31,16, 6, 7, 2,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 6,0,0, 31, 6, 6, 7, 1,40,0, 1,7,0, 31,15, 6, 7, 5, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.world6", "Shamisen 1",              { 2,7, 31,16, 6, 7, 2,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 8,0,0, 31, 6, 6, 7, 1,40,0, 1,7,0, 31,15, 6, 7, 5, 0,0, 2,0,0 });
-	_create_opn_voice("valsound.world7", "Synth Shamisen",          { 2,7, 31,16, 6, 7, 1,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 7,0,0, 31, 6, 6, 7, 0,40,0, 1,7,0, 31,15, 6, 7, 2, 0,0, 2,0,0 });
+	static const FMPreset valsound_bass_presets[] = {
+		{ "valsound.bass1",  "Analog Bass #2 (+FBsynth)",  { 6,7, 31, 0, 0,12, 1,18,1, 1,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0, 31, 0, 0, 9, 0, 3,0, 1,7,0, 31, 0, 0, 9, 0, 3,0, 1,3,0 } },
+		{ "valsound.bass2",  "Analog Bass",                { 5,6, 31, 0, 0, 0, 0,41,0, 1,0,0, 20, 0, 0,10, 0, 0,0, 1,1,0, 24, 0, 0, 8, 0, 0,0, 1,2,0, 20, 0, 0,10, 0, 0,0, 1,3,0 } },
+		{ "valsound.bass3",  "Analog Bass #2 (q2)",        { 6,4, 21, 5, 0, 0, 2,35,0, 0,0,0, 26,10, 0,11, 1, 0,0, 1,0,0, 27, 0, 0,11, 0, 0,0, 1,3,0, 27,14, 0,11, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass4",  "Chopper Bass 0",             { 0,5, 28,14,15,15, 4,25,2,10,1,0, 31,14,10, 9, 3,34,2, 0,2,0, 31,14, 9, 9, 2,23,0, 0,3,0, 31, 6, 5,11, 2, 0,0, 0,7,0 } },
+		{ "valsound.bass5",  "Chopper Bass 1",             { 0,5, 28,14,15,15, 4,30,1,14,1,0, 31,14,10, 9, 2,35,1, 3,2,0, 31,14, 9, 9, 2,25,0, 0,3,0, 31, 6, 5,11, 1, 0,0, 0,7,0 } },
+		{ "valsound.bass6",  "Chopper Bass 2 (cut)",       { 0,4, 31,15,28, 5, 2,28,3,15,6,0, 31,10,15, 4, 4,41,3, 4,6,0, 31, 8, 3, 5, 1,21,2, 0,6,0, 31, 2, 2, 5,15, 0,2, 0,6,0 } },
+		{ "valsound.bass7",  "Chopper Bass 3",             { 0,5, 31,18, 2,13, 9,28,2,13,1,0, 31,10,15, 4, 4,41,3, 1,2,0, 31, 8, 3, 5, 1,21,2, 0,3,0, 31, 2, 2,12,15, 0,2, 0,7,0 } },
+		{ "valsound.bass8",  "Elec.Chopper Bass +4",       { 0,5, 31,18, 2,13, 9,28,2,13,1,0, 31,10,15, 4, 4,41,3, 1,2,0, 31, 8, 3, 5, 1,21,2, 0,3,0, 31, 2, 2,12,15, 0,2, 1,7,0 } },
+		{ "valsound.bass9",  "Effect Bass 1",              { 4,3, 23, 5, 4, 7, 2, 0,0, 1,3,0, 30, 2, 2, 8, 2, 0,1, 7,3,0, 24, 5, 4, 7, 2, 0,0, 1,7,0, 31, 2, 2, 8, 2, 0,1,10,7,0 } },
+		{ "valsound.bass10", "Effect Bass 2 (to UP)",      { 4,3,  3, 6, 5,15, 2, 0,0, 1,3,0,  7, 4, 3,15, 2, 0,1, 7,3,0,  3, 6, 5,15, 2, 0,0, 1,7,0,  7, 4, 3,15, 2, 0,1,10,7,0 } },
+		{ "valsound.bass11", "Effect Bass 3",              { 4,3, 22, 5, 6, 0, 0, 9,0, 1,3,0, 19, 3, 4, 7, 1, 0,0, 7,3,0, 23, 0, 0, 0, 0,19,0, 1,7,0, 20, 2, 0, 7, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass12", "Mohaaa",                     { 0,5,  7, 0, 0,15, 0,21,0, 1,0,0,  6, 0, 0,15, 0,18,0, 2,0,0,  8, 0, 0,15, 0,23,0, 1,0,0, 18, 0, 0,15, 0, 0,0, 2,0,0 } },
+		{ "valsound.bass13", "Effect FB Bass #5",          { 0,7, 31, 6, 2,15, 3,20,0, 1,3,0, 31, 6, 2,15, 6,14,2, 2,0,0,  6, 6, 2,15, 1, 8,0, 1,7,0, 31, 5, 1,15, 2, 0,0, 2,0,0 } },
+		{ "valsound.bass14", "Magical Bass",               { 0,7, 31, 8, 0, 6,10,38,1, 1,3,0, 28,18, 5, 6,13,47,1,10,7,0, 31, 7, 7, 6, 8,23,2, 0,2,0, 28, 9, 6, 8, 1, 0,2, 0,0,0 } },
+		{ "valsound.bass15", "E.Bass #6",                  { 0,7, 31,15, 0,10, 5,35,1,14,3,0, 31,14, 7, 7, 4,41,1, 4,7,0, 31,14, 3, 0, 2,18,1, 0,3,0, 31,12, 8, 8, 1, 0,0, 0,7,0 } },
+		{ "valsound.bass16", "E.Bass #7",                  { 3,7, 31,15, 0,10, 5,29,1,10,7,0, 31,13, 7, 7, 4,46,1, 4,7,0, 31,14, 5, 0, 2,19,1, 0,3,0, 31,12, 4, 8, 1, 0,0, 0,0,0 } },
+		{ "valsound.bass17", "E.Bass 70",                  { 2,5, 31, 8, 0, 0, 3,34,0, 0,3,0, 31,14, 6, 9, 2,42,0, 8,0,0, 31,16, 3, 0, 2,20,0, 0,7,0, 31,12, 5, 8, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass18", "VAL006 Bass (like Euro)",    { 0,4, 31, 7, 7,11, 2,25,3, 6,0,0, 31, 6, 6,11, 1,55,3, 4,7,0, 31, 9, 6,11, 1,18,2, 0,3,0, 31, 6, 8,11,15, 0,2, 1,0,0 } },
+		{ "valsound.bass19", "E.Bass x2",                  { 2,7, 31,14, 8, 3, 1,33,0, 0,1,0, 31,17, 8, 9, 5,30,0,14,2,0, 31,15, 8, 5, 5,35,0, 4,3,0, 31,15, 8, 6, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass20", "E.Bass x4",                  { 2,7, 31,14, 3, 0, 2,33,1, 3,3,0, 23,16, 4,12, 3,30,2,10,0,0, 31,13, 3,11, 3,27,1, 0,7,0, 31, 7, 5, 9, 1, 0,3, 1,0,0 } },
+		{ "valsound.bass21", "Metal Pick Bass x5",         { 3,7, 31,14, 0, 6,13,51,2,13,0,0, 31,13, 0, 6,13,21,0, 1,0,0, 31, 9, 0, 6,13,23,0, 0,0,0, 31, 9, 0, 7,13, 0,0, 0,0,0 } },
+		{ "valsound.bass22", "Groove Bass 1",              { 5,3, 31, 0, 0, 0, 0,38,0, 0,0,0, 21, 0, 0,13, 0, 5,0, 0,0,0, 21, 0, 0,13, 0, 3,0, 1,0,0, 21, 0, 0,13, 0, 3,0, 1,0,0 } },
+		{ "valsound.bass23", "Analog Bass Groove #2",      { 6,5, 31, 0, 0, 0, 0,41,0, 2,0,0, 31, 0, 0,10, 0, 2,0, 1,0,0, 31, 0, 0,10, 0, 1,0, 1,7,0, 31, 0, 0,10, 0, 1,0, 1,3,0 } },
+		{ "valsound.bass24", "Harmonics #1",               { 6,6, 31,12, 9, 0, 2,45,1, 2,3,0, 31,10, 8, 6, 1, 0,1, 1,7,0, 31,13, 8, 5, 2, 0,1, 2,7,0, 31,16,12, 5,10, 0,1, 0,3,0 } },
+		{ "valsound.bass25", "Low Bass x1",                { 5,3, 31, 0, 9,15, 0,25,2, 0,0,0, 31,15, 6, 8, 1, 0,1, 0,1,0, 31,15, 6, 8, 1, 0,1, 1,2,0, 31,15, 0, 7, 2, 0,1, 1,3,0 } },
+		{ "valsound.bass26", "Low Bass x2 (little FB)",    { 5,6, 21, 0, 9, 0, 0,24,2, 0,0,0, 21,15, 6, 8, 1, 0,1, 0,1,0, 21,15, 6, 8, 1, 0,1, 1,2,0, 27,15, 0, 7, 2, 0,1, 1,3,0 } },
+		{ "valsound.bass27", "Low Bass x1 (rezzo.)",       { 5,3, 31, 0, 9,15, 0,30,2, 0,0,0, 31,15, 6,12, 1, 2,1, 0,1,0, 31,15, 6,12, 1, 2,1, 1,2,0, 31,15,10,12, 2, 2,1, 4,3,0 } },
+		{ "valsound.bass28", "Low Bass Picked",            { 5,7, 31, 5, 0, 0,11,33,1, 0,0,0, 30,12, 4, 9, 1, 0,1, 0,0,0, 27,14, 8, 9, 3, 0,1, 1,0,0, 27,14, 7,12,15, 6,1, 5,0,0 } },
+		{ "valsound.bass29", "Metal Bass",                 { 0,5, 20,10, 9,15, 1,22,0, 0,7,0, 17, 9, 0, 0, 2,22,0, 1,7,0, 21, 9, 0, 0, 1,18,0, 0,3,0, 18, 8, 0, 8, 1, 0,0, 1,3,0 } },
+		{ "valsound.bass30", "E.N. Bass 1",                { 3,7, 27,14, 0, 4, 4,25,0, 7,0,0, 31,12, 0, 4, 3,45,0, 2,0,0, 31,19, 0, 4, 5,15,0, 0,0,0, 31,12, 6, 7, 1, 0,0, 0,0,0 } },
+		{ "valsound.bass31", "PSG Bass 1",                 { 5,7, 31,14, 0, 0, 0,22,0, 0,0,0, 31,14, 3, 8, 5, 0,0, 1,3,0, 31,14, 3, 8, 3, 0,0, 0,0,0, 31,16, 3, 8, 3, 0,0, 1,7,0 } },
+		{ "valsound.bass32", "PSG Bass 2",                 { 5,7, 31,14, 0, 0, 0,22,0, 1,0,0, 31,14, 3, 8, 5, 0,0, 2,3,0, 31,14, 3, 8, 3, 0,0, 0,0,0, 31,16, 3, 8, 3, 0,0, 1,7,0 } },
+		{ "valsound.bass33", "Rezonance-type Bass #1",     { 2,0, 24,19, 2,13,10,33,1, 3,3,0, 26,16, 5,14, 6,28,1, 0,0,0, 15,14, 6, 8, 5,14,1, 0,0,0, 31, 7, 5, 9, 2, 0,0, 2,7,0 } },
+		{ "valsound.bass34", "Slap Bass",                  { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 8, 8, 7, 5,23,3, 7,7,0, 31, 5, 6, 7, 1,37,0, 0,3,0, 31, 8, 6, 7, 5, 0,0, 1,7,0 } },
+		{ "valsound.bass35", "Slap Bass 1",                { 2,7, 31,14, 7, 8, 2,33,0, 0,7,0, 21,15, 6, 7, 4,18,2, 6,7,0, 31, 5, 6, 7, 1,40,0, 0,3,0, 31,12, 7, 7, 5, 0,0, 1,3,0 } },
+		{ "valsound.bass36", "Slap Bass 2 (1+)",           { 2,7, 31,14, 7, 8, 2,33,0, 0,7,0, 21,15, 6, 7, 4,28,2, 7,7,0, 31, 5, 6, 7, 1,40,0, 0,3,0, 31,12, 7, 7, 5, 0,0, 1,3,0 } },
+		{ "valsound.bass37", "Slap Bass #3",               { 2,7, 31,14, 7, 0, 5,32,0, 3,7,0, 31,16, 1,12, 4,35,0,10,0,0, 31,11, 2, 0, 3,23,1, 0,3,0, 31,12, 5, 7, 1, 0,0, 0,0,0 } },
+		{ "valsound.bass38", "Slap Bass (pull)",           { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 8, 8, 9, 5,23,3,10,7,0, 31, 5, 6,10, 1,37,0, 0,3,0, 31,16, 6,11, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass39", "Slap Bass (mute)",           { 2,2, 31,18, 7,11,12,33,0, 0,7,0, 21,11, 8,11,15,23,3, 7,7,0, 31,15, 6,11,11,37,0, 0,3,0, 31,15, 6,13,11, 0,0, 1,7,0 } },
+		{ "valsound.bass40", "Slap Bass (pick)",           { 2,2, 31,10, 7, 8, 2,33,0, 0,7,0, 21, 9, 8, 7, 5,23,3, 7,7,0, 31, 5, 6, 8, 1,37,0, 0,3,0, 31,11, 6,10, 5, 0,0, 1,7,0 } },
+		{ "valsound.bass41", "Super Bass #2",              { 2,2, 24,18, 2,13, 9,12,2, 3,3,0, 26,16, 5,14, 9,24,1, 1,0,0, 31,12, 2, 8, 3,22,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass42", "SP Bass #3 (soft)",          { 2,3, 24,18, 2,13, 9,25,2, 3,3,0, 26,16, 5,14, 9,24,1, 1,0,0, 31,12, 2, 8, 3,32,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass43", "SP Bass #4 (soft*2)",        { 2,1, 24,18, 2,13,10,28,2, 3,3,0, 26,16, 5,14, 6,24,1, 0,0,0, 31,12, 2, 8, 3,30,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass44", "SP Bass #5 (attack)",        { 0,5, 19,18, 2,15,10,30,2, 0,3,0, 31,16, 5,14, 5,24,1, 0,0,0, 31,12, 2, 8, 3,30,1, 0,7,0, 31,10, 7, 9, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass45", "SP Bass #6 (rezz+pipebass)", { 2,3, 24,18, 2,13, 9,35,2,12,3,0, 26,16, 5,14, 9,25,1, 2,0,0, 31,12, 2, 8, 3,32,1, 0,7,0, 31, 7, 5, 9, 2, 0,0, 1,0,0 } },
+		{ "valsound.bass46", "Synth Bass 1",               { 4,3, 30, 0, 0, 0, 0,23,0, 1,3,0, 27, 4, 0, 7, 1, 0,0, 1,3,0, 30, 0, 0, 0, 0,18,0, 1,7,0, 25, 4, 0, 7, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass47", "Synth Bass 2 (myon)",        { 5,7, 14, 0, 9,12, 0,26,2, 0,0,0, 14,15, 6, 8, 1, 0,1, 0,1,0, 20,15, 6, 8, 1, 0,1, 1,2,0, 18,15, 0,12, 2, 0,1, 1,3,0 } },
+		{ "valsound.bass48", "Synth Bass #3 (cho!)",       { 3,7, 31,11, 9, 0, 4,32,1, 1,3,0, 31,15, 7, 8, 5,41,1, 8,7,0, 26,18, 7,10, 6, 4,1, 0,3,0, 31, 9, 6, 7, 1, 0,0, 0,7,0 } },
+		{ "valsound.bass49", "Synth Wind Bass #4",         { 2,7, 31,13, 9, 0, 4,32,1, 0,3,0, 31,15, 7, 8, 4,21,1, 1,0,0, 26,18, 7, 8, 3,21,1, 1,7,0, 31, 9, 6, 7, 1, 0,0, 0,0,0 } },
+		{ "valsound.bass50", "Synth Bass #5 (q2)",         { 4,4, 20, 0, 0, 8, 7,17,0, 0,3,0, 18, 7, 4,11, 0, 0,0, 1,3,0, 18, 0, 0, 9, 0,22,0, 1,7,0, 15, 0, 0,11, 1, 0,0, 1,7,0 } },
+		{ "valsound.bass51", "Old Wood Bass",              { 5,7, 31,15, 0,13, 2,28,1, 0,0,0, 31,10, 1,12, 1, 4,0, 2,0,0, 25,10, 1,12, 1, 4,0, 1,0,0, 31,10, 1,12, 1, 4,0, 2,0,0 } },
+		{ "valsound.bass52", "Wood Bass (bright)",         { 2,7, 31,13, 3,10, 2,32,1, 0,7,0, 31,12, 4,10, 3,20,1, 0,0,0, 31,17, 0,10, 7,15,1, 2,3,0, 31, 6, 1,10, 5, 0,1, 1,0,0 } },
+		{ "valsound.bass53", "Wood Bass x2 (bow)",         { 4,5, 31,11, 5, 0, 3,25,1, 0,3,0, 31,10, 9, 8, 4, 0,1, 1,3,0, 23,12, 5, 0, 4,14,1, 0,7,0, 31,12, 9, 7, 5, 0,1, 2,7,0 } },
+		{ "valsound.bass54", "Wood Bass 3 (muted1)",       { 5,5, 31,15, 0,15, 2,38,1, 0,0,0, 31,10, 1,12, 1, 4,0, 2,0,0, 25,10, 1,12, 1, 2,0, 1,0,0, 31,10, 1,12, 1, 4,0, 1,0,0 } },
+	};
+	_register_fm_presets("valsound.bass", PRESET_OPN, valsound_bass_presets, std::size(valsound_bass_presets));
+
+	static const FMPreset valsound_bell_presets[] = {
+		{ "valsound.bell1",  "Calm Bell",                { 4,3, 31,12, 0,10, 5,38,0, 6,3,0, 31, 8, 4, 6,11, 4,0, 2,3,0, 31,12, 4, 6, 2,40,1, 6,7,0, 31, 6, 4, 6,11, 0,0, 2,7,0 } },
+		{ "valsound.bell2",  "China Bell Double",        { 4,7, 21,15, 8, 0, 3,27,1, 8,3,0, 31,13, 5, 6, 4, 0,1, 4,3,0, 21,15, 8, 0, 3,25,1, 6,7,0, 31,13, 5, 6, 4, 0,1, 3,7,0 } },
+		{ "valsound.bell3",  "Church Bell 2",            { 4,0, 26, 3, 0, 2,15,35,2, 4,3,0, 31, 6, 0, 3,15, 7,1,11,0,0, 31, 6, 0, 1,14,41,2, 6,7,0, 31, 7, 0, 3,15, 0,0,11,7,0 } },
+		{ "valsound.bell4",  "Church Bell",              { 4,0, 26, 3, 0, 2,15,35,2, 4,3,0, 31, 6, 0, 3,15, 7,1,11,0,0, 31, 6, 0, 1,14,41,2, 4,7,0, 31, 7, 0, 3,15, 0,0,15,7,0 } },
+		{ "valsound.bell5",  "Glocken 1",                { 4,3, 31,24, 0,12,15,32,0,14,2,0, 31,15, 0, 8,15, 0,0, 2,0,0, 31,20, 0, 4,15,27,0,15,0,0, 31,14, 0, 5,15, 0,0, 2,0,0 } },
+		{ "valsound.bell6",  "Harp #1",                  { 1,7, 31,10,10, 6, 5,26,0, 3,0,0, 31,10,10, 7, 5,50,1, 2,0,0, 31,13,10, 7,13,40,0, 2,0,0, 31,14, 5, 7,10, 0,0, 1,0,0 } },
+		{ "valsound.bell7",  "Harp #2",                  { 1,3, 31, 9, 0, 0,15,40,2, 6,3,0, 31,11, 0, 8,15,30,2, 1,7,0, 31, 8, 0, 0,15,40,2, 1,0,0, 31, 8, 0, 8,14, 0,2, 1,0,0 } },
+		{ "valsound.bell8",  "Kirakira",                 { 1,7, 21,11, 6, 0,12,31,2, 6,2,0, 21,12, 8, 0,12,26,2,10,6,0, 28,11, 7, 0,12,32,1, 2,0,0, 28, 4, 2, 4, 5, 0,1, 2,0,0 } },
+		{ "valsound.bell9",  "Marimba",                  { 4,6, 22,16, 7, 3,15,36,2,15,3,0, 16,10,13, 7,10, 0,2, 1,3,0, 19,18, 7, 3, 8,26,1, 6,7,0, 16,11,12, 7,10, 3,2, 2,7,0 } },
+		{ "valsound.bell10", "Old Bell",                 { 4,6, 27, 4, 0, 5,14,34,0, 3,3,0, 31, 7, 0, 6,14, 0,1, 1,0,0, 31, 7, 0, 3,13,41,0,14,7,0, 31, 8, 0, 6,14,16,0, 4,7,0 } },
+		{ "valsound.bell11", "Percus. Bell",             { 5,3, 31,12, 0, 9, 5,38,0,12,0,0, 31,15, 4, 5,11, 9,0, 3,0,0, 31,12, 4, 8,12, 9,0, 2,3,0, 31, 6, 4, 8,11, 9,0, 1,7,0 } },
+		{ "valsound.bell12", "Pretty Bell",              { 6,6, 31,12, 9, 0, 3,43,1, 2,0,0, 31, 9, 8, 6, 3, 0,1, 1,3,0, 31,13, 8, 5, 3, 0,1, 4,7,0, 31,16,16, 5,13,13,1,15,0,0 } },
+		{ "valsound.bell13", "Synth Bell #0 (from OPM)", { 6,2, 31, 5, 5, 5, 2,30,0, 7,7,0, 31, 8, 5, 7,15, 0,0, 3,7,0, 31, 6, 7, 7, 5, 0,0, 0,3,0, 31, 8, 5, 5, 2,10,0, 1,3,0 } },
+		{ "valsound.bell14", "Synth Bell #1 (o5)",       { 6,3, 31, 5, 5, 5, 2,33,1, 8,3,0, 27,11, 0, 6,15, 0,1, 2,3,0, 31, 6, 7, 6, 5, 0,2, 0,7,0, 31,11, 8, 6, 3, 0,1, 1,7,0 } },
+		{ "valsound.bell15", "Synth Bell 2",             { 6,5, 31, 8, 9, 0, 5,33,1, 7,3,0, 31, 9, 7, 8, 2, 0,1, 3,7,0, 31,12, 7, 8, 1, 0,1, 2,3,0, 31, 9, 7, 7, 1, 0,0, 1,7,0 } },
+		{ "valsound.bell16", "Vibraphone (AMS-modu.)",   { 4,5, 24,14, 0, 7,15,50,1,12,3,0, 24,10, 0, 7,15, 0,1, 4,7,0, 26,14, 0, 6,15,57,1, 4,7,0, 26, 8, 0, 6,15, 0,2, 4,3,0 } },
+		{ "valsound.bell17", "Twin Marinba 2 (g&c)",     { 4,5, 18, 9, 5,14,12,33,1,14,3,0, 31,16, 6, 9, 7, 0,1, 4,3,0, 18, 9, 5,14,12,33,1, 7,7,0, 31,16, 6, 9, 7, 0,1, 3,7,0 } },
+		{ "valsound.bell18", "Twin Marinba 1 (g&c)",     { 4,2, 31,10, 5, 0,12,30,1, 8,3,0, 31,16, 6, 9, 9, 0,1, 4,3,0, 31,10, 5, 0,12,30,1, 6,7,0, 31,16, 6, 9, 9, 0,1, 3,7,0 } },
+	};
+	_register_fm_presets("valsound.bell", PRESET_OPN, valsound_bell_presets, std::size(valsound_bell_presets));
+
+	static const FMPreset valsound_brass_presets[] = {
+		{ "valsound.brass1",  "Brass Strings",          { 5,7, 20, 0, 0, 0, 0,27,0, 1,0,0, 15, 3, 0, 6, 1, 5,0, 2,1,0, 14, 4, 0, 6, 1, 5,0, 1,2,0, 15, 4, 0, 6, 1, 5,0, 1,3,0 } },
+		{ "valsound.brass2",  "E.Trumpet (mute)",       { 2,7, 13, 6, 0, 8, 1,26,2, 2,3,0, 15, 8, 0, 8, 1,32,1, 2,7,0, 21,15, 0, 8,11,20,0, 2,3,0, 18, 4, 0, 8, 2, 0,1, 8,0,0 } },
+		{ "valsound.brass3",  "Horn 2",                 { 4,7, 15,11, 2, 0, 2,23,0, 2,3,0, 13,12, 2,15, 2, 0,0, 2,3,0, 15,13, 5, 0, 1,27,0, 2,7,0, 13,11, 2,15, 2, 0,0, 2,7,0 } },
+		{ "valsound.brass4",  "Alpine Horn #3",         { 5,7, 15,10, 0, 6, 5,35,0, 1,0,0, 15, 5, 0, 8, 2, 6,0, 2,2,0, 15, 5, 0, 8, 2, 6,0, 1,5,0, 15, 5, 0, 8, 2, 6,0, 1,0,0 } },
+		{ "valsound.brass5",  "Lead Brass",             { 2,7, 18, 4, 2, 8, 1,27,0, 2,3,0, 14,14, 0, 8, 5,33,1, 8,0,0, 20, 0, 2, 8, 0,36,0, 2,7,0, 17, 4, 1, 8, 3, 0,0, 2,0,0 } },
+		{ "valsound.brass6",  "Normal Horn",            { 4,7, 15,13, 2,15, 1,36,0, 2,3,0, 13,12, 2,15, 3, 0,0, 2,3,0, 15,13, 5,15, 2,25,0, 2,7,0, 13,11, 2,15, 3, 0,0, 2,7,0 } },
+		{ "valsound.brass7",  "Synth Oboe",             { 6,3, 17,15,15, 3,15,15,0, 1,7,0, 16, 0, 9, 0, 0, 0,0, 6,3,0, 21,15,11, 1, 4, 4,0, 4,3,0, 18,15,11, 1, 4, 4,0, 6,7,0 } },
+		{ "valsound.brass8",  "Oboe 2",                 { 2,5, 19,18, 0, 9, 2,23,1, 1,0,0, 31,17, 0, 6, 3,28,0, 6,0,0, 31,20, 0, 5, 1,51,0, 8,0,0, 16,31, 0,11, 0, 0,1, 4,0,0 } },
+		{ "valsound.brass9",  "Attack Brass (q2)",      { 4,4, 15, 9, 8, 8, 2,14,1, 4,7,0, 18,15, 1, 8, 3, 0,0, 4,3,0, 16, 9, 8, 8, 2,12,1, 2,3,0, 31,15, 1, 8, 3, 0,0, 2,7,0 } },
+		{ "valsound.brass10", "Sax",                    { 2,6, 13, 6, 0, 8, 1,14,2, 2,3,0, 15, 8, 0, 8, 1,30,1,10,7,0, 21, 7, 0, 8, 2,35,0, 1,3,0, 18, 4, 0, 9, 2, 0,1, 2,0,0 } },
+		{ "valsound.brass11", "Soft Brass (lead)",      { 4,7, 16, 3, 0, 2, 1,30,0, 1,5,0, 18, 0, 0, 7, 0, 3,1, 4,0,0, 16, 0, 0, 2, 2,35,0, 1,1,0, 18, 5, 0, 7, 1, 0,0, 1,0,0 } },
+		{ "valsound.brass12", "Synth Brass 1 (old)",    { 5,7, 31, 7, 5,10, 2,28,0, 1,0,0, 31, 2, 5,10, 2, 0,0, 0,0,0, 31, 2, 5,10, 2, 2,0, 1,0,0, 31,10, 5,10,10, 0,0, 2,0,0 } },
+		{ "valsound.brass13", "Synth Brass 2 (old)",    { 5,7, 31,10, 1,10, 2,28,1, 2,0,0, 31,12, 1,10, 2, 2,0, 1,0,0, 31,12, 1,10, 2, 4,0, 2,0,0, 31,12, 1,10,10, 3,0, 4,0,0 } },
+		{ "valsound.brass14", "Synth Brass 3",          { 4,7, 15, 9, 0, 9, 2,22,0, 2,7,0, 23, 4, 2, 9, 5, 0,0, 2,7,0, 14,10, 0, 9, 2,20,0, 2,3,0, 20, 4, 0, 9, 2, 0,0, 2,3,0 } },
+		{ "valsound.brass15", "Synth Brass #4",         { 5,7, 20, 0, 0, 0, 0,22,0, 4,0,0, 18,12, 0, 8, 1, 0,0, 8,0,0, 20,12, 0, 8, 1, 0,0, 4,6,0, 22,12, 0, 8, 1, 0,0, 4,2,0 } },
+		{ "valsound.brass16", "Synth Brass 5 (long)",   { 4,7, 29, 2, 2, 0, 3,28,0, 2,7,0, 29, 0, 2, 8, 5, 4,0, 4,7,0, 21, 2, 2, 0, 2,32,0, 1,3,0, 29, 0, 2, 8, 5, 4,0, 2,3,0 } },
+		{ "valsound.brass17", "Synth Brass 6",          { 2,7, 30, 8, 8, 5, 3,25,0, 1,1,0, 25,10, 8, 6, 4,30,0, 2,1,0, 20,10, 5, 6, 3,40,0, 1,5,0, 20, 5, 5, 7, 5, 0,0, 1,3,0 } },
+		{ "valsound.brass18", "Trumpet",                { 2,7, 13, 6, 0, 8, 1,25,2, 2,3,0, 15, 8, 0, 8, 1,32,1, 6,7,0, 21, 7, 0, 8, 2,42,0, 2,3,0, 18, 4, 0, 8, 2, 0,1, 2,0,0 } },
+		{ "valsound.brass19", "Trumpet 2",              { 2,6, 13, 6, 0, 8, 1,14,2, 2,3,0, 15, 8, 0, 8, 1,30,1,12,7,0, 21, 7, 0, 8, 2,38,0, 2,3,0, 18, 4, 0, 8, 2, 0,2, 2,0,0 } },
+		{ "valsound.brass20", "Twin Horn (or OL=25)",   { 4,6, 14, 6, 0,11, 3,32,0, 4,3,0, 16, 8, 0, 9, 2, 0,0, 4,3,0, 14, 6, 0,11, 3,33,0, 3,7,0, 16, 8, 0, 9, 2, 0,0, 3,7,0 } },
+	};
+	_register_fm_presets("valsound.brass", PRESET_OPN, valsound_brass_presets, std::size(valsound_brass_presets));
+
+	static const FMPreset valsound_guitar_presets[] = {
+		{ "valsound.guitar1",  "Guitar VeloLow",             { 1,3, 31,11, 6, 0, 2,45,1, 7,0,0, 31, 7, 5, 0, 5,35,1, 2,0,0, 31, 7, 6, 0, 5,40,1, 1,0,0, 31,13, 5, 5, 1, 0,1, 1,0,0 } },
+		{ "valsound.guitar2",  "Guitar VeloHigh",            { 1,4, 31,11, 6, 0, 2,43,1, 9,0,0, 31, 7, 5, 0, 5,35,1, 2,0,0, 31, 7, 6, 0, 5,35,1, 1,0,0, 31,13, 6, 5, 1, 0,1, 1,0,0 } },
+		{ "valsound.guitar3",  "A.Guitar #3",                { 1,7, 31,10, 8, 4, 2,34,2,13,0,0, 31, 9, 7, 4, 2,36,0, 2,0,0, 31, 9, 8, 4, 2,38,0, 1,0,0, 31, 4, 2, 8, 2, 0,1, 1,0,0 } },
+		{ "valsound.guitar4",  "Cutting E.Guitar",           { 3,5, 21, 7, 1, 0, 1,18,0, 4,0,0, 24, 0, 4, 9, 1,15,0, 6,0,0, 22,20, 2, 7,13, 5,0, 2,3,0, 31,12, 0, 6, 1, 0,0, 2,7,0 } },
+		{ "valsound.guitar5",  "Dis. Synth (old)",           { 5,7, 31, 0, 0,12, 1,18,1, 1,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0, 31, 0, 1,12, 1, 4,1, 0,0,0, 31, 0, 1,12, 1, 4,1, 2,0,0 } },
+		{ "valsound.guitar6",  "Dis. Guitar (dra-spi)",      { 0,7, 16,15, 1, 3, 3,26,0, 3,3,0, 19,31, 1, 3, 0,27,0, 1,0,0, 26,31, 1, 3, 0,26,0, 1,5,0, 27,31, 1, 8, 0, 0,0, 1,0,0 } },
+		{ "valsound.guitar7",  "Dis. Guitar (3-)",           { 1,7, 31,15, 1, 3, 3,30,1, 3,3,0, 31, 0, 1,10, 1,25,1, 1,0,0, 31, 0, 1,10, 1,22,1, 1,5,0, 31,13, 1, 7, 1, 0,1, 1,0,0 } },
+		{ "valsound.guitar8",  "Dis. Guitar (3+)",           { 0,5, 31, 4, 0, 0, 1, 8,0, 3,0,0, 18, 1, 0, 8, 0,25,0,15,0,0, 31, 4, 0, 0, 1,23,0, 7,7,0, 31,12, 0, 9, 0, 0,0, 1,1,0 } },
+		{ "valsound.guitar9",  "Feedback Guitar 1",          { 3,7, 31,13, 0, 2, 2,26,0, 6,3,0, 18, 7, 4,10, 5,24,0, 3,3,0, 31, 0, 0, 8, 0,22,0, 4,0,0, 31, 0, 0, 7, 1, 0,0, 2,7,0 } },
+		{ "valsound.guitar10", "Hard Dis. Guitar 1",         { 0,5, 31, 4, 4, 6, 1, 8,0, 3,0,0, 18, 1, 4, 0, 1,27,0,12,0,0, 31, 4, 4, 0, 1,22,0, 2,3,0, 31,12, 0, 8, 1, 0,0, 2,7,0 } },
+		{ "valsound.guitar11", "Hard Dis. Guitar 3",         { 0,5, 31, 4, 1, 0, 0,11,0, 3,0,0, 18, 1, 4, 7, 0,23,0,15,0,0, 31, 4, 2, 0, 0,24,0, 5,1,0, 31,12, 0, 7, 1, 0,0, 1,7,0 } },
+		{ "valsound.guitar12", "Dis. Guitar ('94 Hard)",     { 0,7, 31, 0, 0,11, 0,21,0, 9,7,0, 31,15, 0,10, 1,26,0, 2,3,0, 31, 5, 0, 8, 1,25,0, 1,3,0, 31, 0, 0, 7, 0, 4,0, 2,7,0 } },
+		{ "valsound.guitar13", "New Dis. Guitar 1",          { 0,5, 31, 5, 0, 0, 0,20,0, 2,3,0, 18, 5, 4, 7, 1,20,1, 5,3,0, 31, 6, 5, 0, 0,22,0, 1,7,0, 31,12, 0, 8, 1, 0,0, 1,7,0 } },
+		{ "valsound.guitar14", "New Dis. Guitar 2",          { 0,5, 31, 5, 0, 0, 0,20,0, 3,3,0, 18, 5, 4, 7, 1,20,1, 7,3,0, 31, 6, 5, 0, 0,22,0, 1,7,0, 31,12, 0, 8, 1, 0,0, 1,7,0 } },
+		{ "valsound.guitar15", "New Dis. Guitar 3",          { 3,5, 31, 5, 0, 0,10, 8,0, 3,0,0, 31, 1, 0, 8, 0,20,0,15,0,0, 31, 4, 0,15, 0,22,0, 1,3,0, 31,12, 0, 8, 1, 0,0, 1,7,0 } },
+		{ "valsound.guitar16", "Overdriven Guitar (AL=013)", { 1,7, 31, 5, 0, 0, 1,30,0, 3,0,0, 18, 5, 0, 8, 1,21,0, 2,2,0, 31, 5, 4, 0, 1,29,0, 1,6,0, 31,11, 0, 8, 1, 0,0, 1,2,0 } },
+		{ "valsound.guitar17", "Metal Strings",              { 3,7, 26,16, 7, 4, 8,24,2, 8,7,0, 22,15, 6, 4, 9,22,2,12,2,0, 26, 9, 2, 7, 8,43,1, 3,0,0, 30, 8, 2, 8, 8, 0,2, 4,0,0 } },
+		{ "valsound.guitar18", "Soft Dis. Guitar",           { 0,7, 16,15, 1, 9, 3,26,0, 6,3,0, 19,15, 1, 0, 0,27,0, 3,0,0, 26,15, 2, 0, 2,26,0, 1,5,0, 21,31, 0, 7, 0, 0,0, 1,0,0 } },
+	};
+	_register_fm_presets("valsound.guitar", PRESET_OPN, valsound_guitar_presets, std::size(valsound_guitar_presets));
+
+	static const FMPreset valsound_lead_presets[] = {
+		{ "valsound.lead1",  "Acoustic Code",            { 4,4, 15, 0, 0,12, 0,28,0, 8,3,0, 17, 6, 1,12, 1, 0,1, 8,3,0, 15, 0, 0,12, 0,21,0, 4,7,0, 17, 6, 1,12, 1, 0,1, 4,7,0 } },
+		{ "valsound.lead2",  "Analog Synth 1",           { 1,6, 31,10, 0, 8, 5,18,0,10,0,0, 31, 5, 1, 8, 2,30,0, 2,0,0, 31, 5, 1, 8, 2,50,0, 8,0,0, 31, 5, 1, 8, 2, 0,0, 2,0,0 } },
+		{ "valsound.lead3",  "Bosco Lead",               { 6,5, 28, 2, 2, 6, 0,20,0, 5,7,0, 10, 4, 4, 6, 0,10,0, 2,3,0, 15, 2, 2, 6, 0, 0,0, 3,7,0, 15, 4, 4, 6, 0, 0,0, 1,3,0 } },
+		{ "valsound.lead4",  "Cosmo Lead",               { 3,7, 31, 0, 0, 0, 0,25,0, 0,3,0, 15, 0, 0, 1, 0,25,0, 1,7,0, 22, 0, 0, 1, 0,23,0, 1,7,0, 18, 0, 0, 6, 0, 0,0, 1,0,0 } },
+		{ "valsound.lead5",  "Cosmo Lead 2",             { 3,7, 31, 0, 0, 0, 0,33,0, 0,3,0, 15, 0, 0, 1, 0,30,0, 1,7,0, 22, 0, 0, 1, 0,28,0, 0,7,0, 18, 0, 0, 6, 0, 0,0, 1,0,0 } },
+		{ "valsound.lead6",  "Digital Lead #1",          { 2,7, 31, 0, 0, 0, 0,26,0, 1,0,0, 31, 0, 0, 0, 0,37,0, 2,3,0, 31, 0, 0, 0, 0,27,0, 2,7,0, 31,12, 0,15, 1, 0,0, 1,0,0 } },
+		{ "valsound.lead7",  "Double Sin Wave",          { 7,4, 18, 4, 0,10, 1, 0,0, 1,3,0, 18, 4, 0, 7, 1, 0,0, 4,3,0, 17, 4, 0,10, 1, 0,0, 1,7,0, 14, 4, 0, 7, 1, 0,0, 4,7,0 } },
+		{ "valsound.lead8",  "E.Organ 2 (bright)",       { 6,7, 31, 0, 0, 9, 0,33,0, 5,7,0, 31,13, 0, 9, 1, 0,0, 3,3,0, 31, 0, 0, 9, 0, 3,0, 2,3,0, 31, 0, 0, 9, 0, 0,0, 1,7,0 } },
+		{ "valsound.lead9",  "E.Organ 2 (voice)",        { 6,3, 31,15, 0,15, 3,35,0, 7,7,0, 31, 0, 0, 9, 0, 0,0, 3,3,0, 31,15, 3,11, 1, 4,0, 1,3,0, 31,15, 0,11, 1, 4,0, 2,7,0 } },
+		{ "valsound.lead10", "E.Organ 4 (click)",        { 6,3, 31, 0, 0, 4, 1,33,0, 2,0,0, 31, 0, 0,10, 1, 0,0, 1,3,0, 31,12, 0,10, 1, 0,0, 4,7,0, 31,16, 0,12, 6, 0,1, 8,3,0 } },
+		{ "valsound.lead11", "E.Organ 5 (click)",        { 6,2, 31, 0, 0, 4, 1,35,0, 2,0,0, 31, 0, 0,10, 1, 0,0, 2,3,0, 31,12, 0,10, 1, 0,0, 4,7,0, 28,16, 0,14, 8, 0,1, 8,3,0 } },
+		{ "valsound.lead12", "E.Organ 6",                { 6,7, 31,15, 0, 0, 1,33,0, 7,7,0, 31,10, 0, 9, 1, 0,0, 4,3,0, 31, 0, 0, 9, 0, 3,0, 1,3,0, 31, 0, 0, 9, 0, 0,0, 2,7,0 } },
+		{ "valsound.lead13", "E.Organ 7 (church)",       { 6,7, 31, 0, 0, 9, 0,33,0, 4,7,0, 31, 0, 0, 9, 0, 0,0, 4,3,0, 31, 0, 0, 9, 0, 0,0, 2,3,0, 31, 0, 0, 9, 0, 0,0, 1,7,0 } },
+		{ "valsound.lead14", "Metal Lead",               { 0,7, 25, 5, 0,15, 4,22,0, 2,3,0, 21, 2, 0,12, 3,26,0, 7,0,0, 18, 7, 5, 8, 4,27,0, 6,7,0, 21, 5, 3, 8, 2, 0,0, 4,0,0 } },
+		{ "valsound.lead15", "Metal Lead 3",             { 2,7, 31,10, 0, 0, 1,25,0, 4,3,0, 31, 5, 0, 4,15,25,0, 0,3,0, 31, 9, 0, 6,10,37,0, 4,7,0, 31, 0, 0, 9, 0, 0,0, 2,7,0 } },
+		{ "valsound.lead16", "Mono Lead",                { 3,7, 24,11, 1, 0, 8,42,2, 4,2,0, 24, 9, 1, 0, 5,19,2, 4,6,0, 23, 9, 2, 0,10,25,2, 8,1,0, 23, 5, 3,11, 8, 0,1, 1,0,0 } },
+		{ "valsound.lead17", "PSG like PC88 (long)",     { 1,7, 31, 0, 0,15, 0,27,0, 2,0,0, 31, 0, 0,15, 0,50,0, 1,0,0, 31, 0, 0,15, 0,40,0, 2,0,0, 31, 0, 0,15, 0, 0,0, 1,0,0 } },
+		{ "valsound.lead18", "PSG Cut 1",                { 5,7, 31, 0, 0, 0, 0,30,0, 2,0,0, 31,15, 0,15, 3, 0,0, 1,0,0, 31,15, 0,15, 3, 0,0, 1,0,0, 31,15, 0,15, 3, 0,0, 1,0,0 } },
+		{ "valsound.lead19", "Attack Synth",             { 0,7, 31,15, 1, 0, 1,40,0, 8,0,0, 31,15, 1, 0, 1,20,1, 4,0,0, 31,15, 1, 0, 1,37,0, 1,0,0, 31,15, 1, 8, 3, 0,0, 1,0,0 } },
+		{ "valsound.lead20", "Sin Wave",                 { 6,2, 31, 0, 0,15, 0,43,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0, 31, 0, 0,15, 0, 0,0, 0,0,0 } },
+		{ "valsound.lead21", "Synth & Bell 2",           { 4,7, 21, 0, 1,11, 0,29,1, 2,3,0, 14, 8, 0,13, 1, 8,0, 4,3,0, 31,11, 0, 0, 2,35,0,14,3,0, 31, 8, 5,10,15, 0,0, 4,7,0 } },
+		{ "valsound.lead22", "Chorus #2 (voice) & Bell", { 4,7, 21, 0, 1,11, 0,35,1, 2,3,0, 14, 8, 0,13, 1, 0,0, 2,3,0, 31,12, 0, 0, 2,44,0,14,3,0, 31, 9, 5,10,15, 0,0, 8,7,0 } },
+		{ "valsound.lead23", "Synth 8-4 (cut)",          { 4,7, 31, 0, 0, 0, 0,30,1, 8,3,0, 18,13, 9, 7, 1, 0,1, 8,3,0, 31, 0, 0, 0, 0,22,1, 4,7,0, 21,13, 9, 7, 1, 0,1, 4,7,0 } },
+		{ "valsound.lead24", "Synth 8-4 (long)",         { 4,7, 31, 0, 0, 0, 0,30,1, 8,3,0, 18,13, 1, 7, 1, 0,1, 8,3,0, 31, 0, 0, 0, 0,22,1, 4,7,0, 21,13, 1, 7, 1, 0,1, 4,7,0 } },
+		{ "valsound.lead25", "Acoustic Code #2",         { 4,7, 31, 0, 0, 0, 0,28,0, 4,3,0, 31,10, 0, 7, 1, 0,0, 4,3,0, 31, 0, 0, 0, 0,21,0, 4,7,0, 31,10, 0, 7, 1, 0,0, 4,7,0 } },
+		{ "valsound.lead26", "Acoustic Code #3",         { 4,7, 31, 0, 0, 0, 0,28,0, 4,3,0, 31,10, 0, 7, 1, 0,0, 8,3,0, 31, 0, 0, 0, 0,21,0, 4,7,0, 31,10, 0, 7, 1, 0,0, 4,7,0 } },
+		{ "valsound.lead27", "Synth FB 4 (long)",        { 3,7, 25, 7, 0, 0, 5,23,0, 2,7,0, 17, 0, 0, 9, 0,32,0, 4,3,0, 25, 7, 0, 0, 6,27,0, 2,3,0, 16, 8, 0, 9, 1, 0,0, 2,0,0 } },
+		{ "valsound.lead28", "Synth FB 5 (long)",        { 4,7, 22, 4, 0, 0, 3,22,0, 2,3,0, 16, 8, 0, 9, 2, 0,0, 8,3,0, 22, 0, 0, 0, 0,15,0, 2,7,0, 16, 8, 0, 9, 2, 0,0, 8,7,0 } },
+		{ "valsound.lead29", "Synth Lead 0",             { 4,6, 24, 7, 1, 0, 0,23,0, 1,3,0, 23, 8, 0, 6, 1, 0,0, 1,3,0, 24, 7, 1, 0, 0,12,0, 1,7,0, 15, 8, 0, 8, 1, 8,0, 3,7,0 } },
+		{ "valsound.lead30", "Synth Lead 1",             { 3,7, 14,10, 0,15, 1,25,0, 2,0,0, 31, 0, 7,15, 0,15,0, 1,3,0, 31, 0, 0,15, 0,30,0, 2,7,0, 31, 0, 0,15, 0, 0,0, 1,0,0 } },
+		{ "valsound.lead31", "Synth Lead 2",             { 2,7, 31, 4, 2, 8, 1,25,0, 4,3,0, 14,14, 0, 8, 5,32,1, 4,0,0, 21, 0, 2, 8, 0,35,0, 2,7,0, 21, 4, 1, 8, 3, 0,0, 2,0,0 } },
+		{ "valsound.lead32", "Synth Lead 3",             { 3,7, 20, 0, 0, 0, 0,29,0, 2,3,0, 18,12, 0, 8, 1,25,0, 2,7,0, 20,12, 0, 8, 1,30,0, 1,3,0, 22,12, 0, 8, 1, 0,0, 2,0,0 } },
+		{ "valsound.lead33", "Synth Lead 4",             { 4,5, 25,31, 1, 3, 1,10,0, 2,3,0, 31,10, 1,10, 2, 0,0, 4,7,0, 25,31, 1, 3, 1, 5,1, 2,7,0, 31,10, 1,10, 2, 0,0, 4,3,0 } },
+		{ "valsound.lead34", "Synth Lead 5",             { 4,6, 31,10, 0, 8, 2,16,0,11,7,0, 31, 3, 0, 8, 2,18,0, 1,7,0, 31, 3, 0, 8, 2,50,0, 8,3,0, 31, 3, 0, 8, 2, 0,0, 2,3,0 } },
+		{ "valsound.lead35", "Synth Lead 6",             { 4,5, 31, 0, 0, 0, 0,22,0, 2,7,0, 18,10, 0, 6, 1, 0,0, 8,7,0, 31, 0, 0, 0, 0,23,0, 4,3,0, 18,10, 0, 6, 1, 0,0, 4,3,0 } },
+		{ "valsound.lead36", "Synth Lead 7 (soft FB)",   { 1,7, 31, 0, 0, 0, 0,23,0, 2,1,0, 31,10, 8, 0, 5,20,0, 2,7,0, 15,12, 0,12, 2,36,0, 6,5,0, 18, 0, 0, 6, 0, 0,0, 2,0,0 } },
+		{ "valsound.lead37", "Synth PSG",                { 0,7, 31, 1, 3, 0,15,21,0, 2,3,0, 31, 1, 6, 0,15,41,0, 4,3,0, 31, 1, 3, 0,15,22,0, 1,3,0, 31,13, 0, 6, 2, 0,0, 1,3,0 } },
+		{ "valsound.lead38", "Synth PSG 2",              { 0,7, 17, 1, 3, 8,15,32,0, 8,3,0, 19, 1, 6, 8,15,35,0, 4,3,0, 22, 1, 3, 8,15,20,0, 2,3,0, 31,11, 0, 8, 2, 0,0, 1,3,0 } },
+		{ "valsound.lead39", "Synth PSG 3",              { 5,7, 31, 0, 0, 0, 0,24,0, 2,0,0, 31,15, 0, 9, 3, 6,0, 1,0,0, 31,15, 0, 9, 3, 6,0, 1,0,0, 31,15, 0, 9, 3, 6,0, 2,0,0 } },
+		{ "valsound.lead40", "Synth PSG 4",              { 5,7, 31, 0, 0, 0, 0,22,0, 1,0,0, 31,15, 1, 9, 3, 0,0, 1,0,0, 31,15, 1, 9, 3, 0,0, 0,0,0, 31,15, 2, 9, 4,10,0, 2,0,0 } },
+		{ "valsound.lead41", "Synth PSG 5",              { 1,7, 31, 0, 0,15, 0,28,0, 5,0,0, 31, 0, 0,15, 0,45,0, 3,0,0, 31, 0, 0,15, 0,45,0, 2,0,0, 31, 0, 0,15, 0, 0,0, 1,0,0 } },
+		{ "valsound.lead42", "Sin Water Synth",          { 6,0, 31, 0, 0,15, 0,44,0, 1,0,0, 24, 0, 0,15, 0, 2,0, 1,0,0, 25,21, 0,15,15,14,0, 6,0,0, 24, 0, 0,15, 0, 4,0, 2,0,0 } },
+	};
+	_register_fm_presets("valsound.lead", PRESET_OPN, valsound_lead_presets, std::size(valsound_lead_presets));
+
+	static const FMPreset valsound_percus_presets[] = {
+		{ "valsound.percus1",  "Bass Drum 2",                { 0,0, 30,26, 0,13,15,26,0, 1,0,0, 30,28, 0,14,15,37,0,15,3,0, 30,16, 0, 8,15, 5,0, 0,0,0, 29,16, 0, 8,15, 0,0, 0,0,0 } },
+		{ "valsound.percus2",  "Bass Drum 3 (o1f)",          { 2,5, 24,19, 0, 0,15,30,2, 1,3,0, 31,18,13,14,15,30,1, 0,0,0, 31,19,13, 8,15, 5,1, 1,7,0, 31,16,15,12,15, 0,1, 1,0,0 } },
+		{ "valsound.percus3",  "Bass Drum RUFINA (o2c)",     { 5,5, 29,20,18,15, 5,11,1, 0,2,0, 31,16,18,15, 5, 2,1, 0,0,0, 31,16,17,15, 3, 0,1, 0,0,0, 31,15,18,15, 4, 0,1, 0,0,0 } },
+		{ "valsound.percus4",  "Bass Drum (-vBend)",         { 3,7, 31, 8, 0, 1, 5, 8,2,15,1,0, 31,21, 4, 1,12,18,2, 1,0,0, 31,26, 0,15,15,14,2, 0,0,0, 31,13,10,15,15, 0,2, 0,0,0 } },
+		{ "valsound.percus5",  "Bass Drum 808 2 (-vBend)",   { 6,3, 31,16,10,15,15,15,0, 0,0,0, 31,15,10,15,15, 0,0, 0,0,0, 28,15,20,15,15, 0,0, 2,3,0, 26,15,20,15,15, 0,0, 2,7,0 } },
+		{ "valsound.percus6",  "Cho-Cho 3 (o2e)",            { 4,2, 18,18, 0,14,15, 0,3, 4,7,0, 17,17, 0,14,15, 0,2, 2,3,0, 18,18, 0,14,15, 0,3, 4,3,0, 17,17, 0,14,15, 0,2, 2,7,0 } },
+		{ "valsound.percus7",  "Cowbell 1",                  { 3,7, 31,18,19, 6, 2, 8,1,12,1,0, 31,18,12, 6, 2,35,1, 7,2,0, 31,17,13, 6, 3,32,1, 7,3,0, 31,19,15, 9, 1, 0,0, 2,7,0 } },
+		{ "valsound.percus8",  "Crash Cymbal (noise)",       { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 21,10,11,13, 5, 0,1, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 31, 9, 9, 9,15, 5,2,15,3,0 } },
+		{ "valsound.percus9",  "Crash Noise",                { 0,7, 23, 2, 8, 2,15, 0,0,15,3,0, 25, 2, 8, 2,15,14,1,12,7,0, 22, 2, 8, 5,15, 4,0, 3,3,0, 23, 7, 8, 5,15, 0,0, 6,7,0 } },
+		{ "valsound.percus10", "Crash Noise (short)",        { 0,7, 23, 2, 8, 2,15, 0,2,15,3,0, 25, 2, 8, 2,15,14,3,12,7,0, 22, 2, 8, 5,15, 4,2, 3,3,0, 23, 7, 8, 5,15, 0,2, 6,7,0 } },
+		{ "valsound.percus11", "Ethnic Percus. 0",           { 3,7, 31,19, 6, 3,13,40,1,10,3,0, 31,12, 4, 0, 5,34,1, 4,3,0, 31,16, 6,10,14,36,1, 2,7,0, 31,14, 6, 6,15, 0,1, 0,0,0 } },
+		{ "valsound.percus12", "Ethnic Percus. 1",           { 4,6, 31,16, 0, 5,15,35,0, 0,3,0, 31, 5,15,15,15, 0,0, 0,3,0, 31,21, 0,15,11,15,0, 4,1,0, 31,20,21, 9, 2, 0,0, 0,7,0 } },
+		{ "valsound.percus13", "Heavy Bass Drum 1",          { 5,0, 31,15, 0, 8,15,10,0, 0,0,0, 31,13, 0, 8,15, 0,0, 0,0,0, 31,13, 0, 8,15, 0,0, 0,0,0, 31,24, 0, 9,15,20,0, 1,0,0 } },
+		{ "valsound.percus14", "Heavy Bass Drum 2",          { 5,3, 31,16,10, 8,15,10,0, 0,0,0, 31,15,10, 8,15, 0,0, 0,0,0, 31,10,10, 8,14, 0,0, 0,0,0, 31,20,10, 8,15,10,0, 1,0,0 } },
+		{ "valsound.percus15", "Heavy Snare Drum 1",         { 4,7, 31, 0, 0, 0, 0, 0,0,15,0,0, 28, 0,15,13, 0, 0,0, 4,0,0, 31,18,15, 7, 4, 0,1, 0,0,0, 31, 5,12, 7, 0, 0,0, 0,0,0 } },
+		{ "valsound.percus16", "Closed Hi-Hat 3",            { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 18,17,18,13, 5, 0,0, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 18,16,13, 9,15, 5,1,15,3,0 } },
+		{ "valsound.percus17", "Closed Hi-Hat 4",            { 4,7, 31,11, 0, 0, 5, 0,1,15,0,0, 31,17,12, 9, 9, 0,1, 0,0,0, 31, 0, 0,15, 0, 0,1, 0,0,0, 25,19,20,15,15, 7,0,15,0,0 } },
+		{ "valsound.percus18", "Closed Hi-Hat 5",            { 4,7, 31, 0, 0, 0, 0, 0,0,15,7,0, 21,18,18,13, 5, 0,0, 0,7,0, 31, 0, 0,14, 0, 0,0, 8,3,0, 31,17,13, 9,15, 5,1,15,3,0 } },
+		{ "valsound.percus19", "Closed Hi-Hat 6 -808-",      { 0,7, 27, 0,10, 0,15,39,0,15,0,0, 31, 4,10,14,15,30,0,11,0,0, 31,10,10,14,15, 5,1, 9,7,0, 31,19,10,15,15, 0,1, 9,3,0 } },
+		{ "valsound.percus20", "Metal Hi-Hat #7 (o3-6)",     { 4,7, 31,16,10, 8,10, 0,0,15,3,0, 31,18, 7,12,15, 0,1, 1,3,0, 31,10,10, 6,10, 2,0,15,7,0, 21,18, 7,12,15, 0,1, 0,7,0 } },
+		{ "valsound.percus21", "Closed Hi-Hat #8 (o4)",      { 4,7, 25,19, 0, 9, 3, 0,1,15,0,0, 22,19,16,14, 5, 0,1, 1,0,0, 31,10,15,15, 5, 0,0,15,0,0, 31,19,19,15, 2, 0,1,15,0,0 } },
+		{ "valsound.percus22", "Open Hi-Hat (o4e-g+)",       { 4,5, 31, 5, 6, 0, 5, 0,2,15,7,0, 31,10, 4, 7, 8,19,2, 3,1,0, 31,20, 6, 3, 3, 0,2, 1,7,0, 31,25, 6, 7,10, 6,3, 7,0,0 } },
+		{ "valsound.percus23", "Open Metal Hi-Hat 2 (o4c-)", { 4,7, 31,14, 0, 8, 3, 0,1,15,3,0, 31,15, 8,12,13, 0,1, 7,3,0, 31,13, 0, 6, 3, 1,0,10,7,0, 31,15,11,12,12, 0,1, 7,7,0 } },
+		{ "valsound.percus24", "Open Metal Hi-Hat 3",        { 4,7, 31,14, 0, 8, 3, 0,1,15,3,0, 31,15, 8,12,13, 0,0, 7,3,0, 31,13, 0, 6, 1, 1,0,10,7,0, 31,15,11,12, 7, 0,0, 7,7,0 } },
+		{ "valsound.percus25", "Open Hi-Hat #4 (o4f)",       { 4,6, 31,15, 0, 9, 1, 0,0,15,0,0, 31,20, 5,14, 5, 3,0, 4,0,0, 31,10, 9, 9, 1, 0,0,10,0,0, 31,22, 5,14, 5, 0,1, 7,0,0 } },
+		{ "valsound.percus26", "Metal Ride (o4c,o5c)",       { 4,5, 20, 5, 0, 0, 5,11,2,15,3,0, 18,11, 9, 7,11, 0,2, 8,3,0, 31,19, 0, 3, 3, 0,1,15,7,0, 16,12, 9, 7,11, 0,2, 7,7,0 } },
+		{ "valsound.percus27", "Rim Shot #1 (o3c)",          { 0,7, 31,11, 0,15,15,37,1,15,1,0, 31,12, 0,15,15,40,1,10,2,0, 31,17, 0,15,15,13,2, 0,3,0, 31,16, 0,15,15, 0,2, 0,7,0 } },
+		{ "valsound.percus28", "Snare Drum (light)",         { 4,7, 31, 0, 0, 7, 0, 0,0,15,0,0, 31,15,15, 9, 2, 0,0,15,0,0, 31,21, 0,15,11,10,0, 4,1,0, 31,19,17, 9, 2, 0,0, 0,7,0 } },
+		{ "valsound.percus29", "Snare Drum (lighter)",       { 4,6, 31, 0, 0,14, 0, 0,0,10,3,0, 31,15,15,14, 1, 0,0,12,7,0, 31,15, 0,14,15, 0,3, 2,3,0, 31,15, 0,14,15, 0,2, 0,7,0 } },
+		{ "valsound.percus30", "Snare Drum 808 (o2-o3)",     { 4,7, 31, 0, 0, 0, 0, 5,0,15,7,0, 31,18,17,15, 1, 0,0, 9,3,0, 31,19, 0,15,15, 0,0, 0,7,0, 26,21,16,15,15, 0,0, 0,3,0 } },
+		{ "valsound.percus31", "Snare 4 -808- (o2)",         { 4,7, 31,12, 0,12, 4, 0,1, 7,3,0, 27,15,18,15, 1, 0,1,15,3,0, 31,20,15,12,15,11,0, 1,7,0, 31,19,15,15,15, 0,1, 1,7,0 } },
+		{ "valsound.percus32", "Snare 5 Franger (o1-2)",     { 4,7, 31,16, 0, 0, 2, 6,0,15,7,0, 31,18,15,15, 0, 0,0, 9,3,0, 28,20, 0,15,15, 0,0, 0,7,0, 25,16,15,15,15, 0,0, 0,3,0 } },
+		{ "valsound.percus33", "Old Tom",                    { 4,7, 31,11, 0, 1,15, 0,0,15,3,0, 31,20,14,15, 5, 0,0, 1,3,0, 31,16,15, 5,15,48,0, 0,7,0, 31,11,15,15,15, 0,0, 0,7,0 } },
+		{ "valsound.percus34", "Synth Tom 2 (AL=3)",         { 3,7, 31, 4, 0, 1, 0, 0,1,15,1,0, 31,21, 4, 1,10,15,1, 1,0,0, 31,26, 0,15,15, 0,1, 0,0,0, 31,11, 0, 7,15, 0,1, 0,0,0 } },
+		{ "valsound.percus35", "Synth Tom #3 (noisy)",       { 3,7, 31,20, 0, 0, 2, 0,0,15,3,0, 31,18,13, 6, 8,28,0, 0,3,0, 31,16, 9,12, 5,44,0, 1,7,0, 31,14, 4,12, 1, 0,0, 0,7,0 } },
+		{ "valsound.percus36", "Synth Tom #3",               { 1,7, 31,18,10, 0, 1, 0,0,15,3,0, 31,15,10, 6, 5, 0,0, 5,3,0, 31,17,12,12, 6,37,0, 1,7,0, 31,14, 4,12, 1, 0,0, 0,7,0 } },
+		{ "valsound.percus37", "Synth Tom #4 (-DX7-)",       { 3,7, 31, 4, 0, 1, 0, 0,1,11,0,0, 31,21, 4, 1, 6,25,1, 1,3,0, 31,26, 0,15,15, 0,1, 0,0,0, 31,11, 0, 7,15, 0,1, 0,0,0 } },
+		{ "valsound.percus38", "Triangle 1 (o5c)",           { 4,5, 31,18, 0,11, 2, 9,0,14,3,0, 31,21, 7,12, 4, 0,0, 8,3,0, 31,22, 0,12,15, 0,0,15,7,0, 31,20, 6,15,15, 0,0, 7,7,0 } },
+	};
+	_register_fm_presets("valsound.percus", PRESET_OPN, valsound_percus_presets, std::size(valsound_percus_presets));
+
+	static const FMPreset valsound_piano_presets[] = {
+		{ "valsound.piano1",  "Acoustic Piano 2 (attack)", { 4,5, 31, 5, 0, 0, 0,23,1, 1,3,0, 20,10, 3, 7, 8, 0,1, 1,3,0, 31, 3, 0, 0, 0,25,1, 1,7,0, 31,12, 3, 7,10, 2,1, 1,7,0 } },
+		{ "valsound.piano2",  "Clavichord 1 (backing)",    { 2,7, 31, 8, 3, 6, 2,40,2, 1,3,0, 31, 7, 4, 6, 2,37,1, 5,2,0, 31, 7, 2, 6, 1,30,1, 3,7,0, 28,30, 9, 7, 0, 0,2, 1,4,0 } },
+		{ "valsound.piano3",  "Clavichord 2",              { 2,6, 31,15, 8, 6, 2,35,0,12,3,0, 31, 6, 2, 6, 2,32,0, 3,0,0, 31, 6, 2, 6, 1,32,0, 1,7,0, 31, 8, 6, 7, 4, 0,0, 2,0,0 } },
+		{ "valsound.piano4",  "Deep Piano 1",              { 2,5, 31, 9, 4, 0, 2,38,0, 0,3,0, 22, 7, 3, 9, 3,31,1, 3,0,0, 31, 7, 3, 2, 3,27,1, 0,7,0, 28, 7, 1, 7, 1, 0,1, 0,0,0 } },
+		{ "valsound.piano5",  "Deep Piano 3",              { 2,0, 31,20, 9, 0, 2, 8,1, 0,7,0, 31,11, 3, 1, 1,23,1, 4,3,0, 31,13, 5, 2, 2,30,0, 0,3,0, 31, 0, 4, 6, 0, 0,1, 1,7,0 } },
+		{ "valsound.piano6",  "E.Piano #2",                { 4,6, 22, 5, 0, 3, 5,30,0, 2,3,0, 16, 8, 8, 7, 2, 0,1, 2,3,0, 20, 5, 0, 3, 5,34,0, 4,7,0, 17, 8, 7, 7, 2, 0,1, 2,7,0 } },
+		{ "valsound.piano7",  "E.Piano #3",                { 4,7, 22, 5, 0, 3, 5,41,0, 1,3,0, 16, 8, 8, 7, 2, 0,1, 2,3,0, 31,18, 0, 3,10,44,0, 8,7,0, 31, 9, 7, 7, 2, 3,1, 1,7,0 } },
+		{ "valsound.piano8",  "E.Piano #4 (2+)",           { 4,6, 31, 5, 0,15, 5,46,2, 2,3,0, 31, 9, 8,15, 3, 0,2, 2,3,0, 31, 5, 0,15, 5,44,2, 4,7,0, 31, 9, 7,15, 3, 0,2, 2,7,0 } },
+		{ "valsound.piano9",  "E.Piano #5 (bell)",         { 4,7, 31, 7, 0, 9, 5,35,0, 6,3,0, 31,11, 7,14, 4, 5,1, 2,3,0, 31,10, 9, 9, 5,35,0,12,7,0, 31,11, 7,14, 4, 5,0, 2,7,0 } },
+		{ "valsound.piano10", "E.Piano #6",                { 4,7, 29,20, 0, 0, 3,34,0, 8,3,0, 17, 8, 0, 7, 6, 2,0, 4,3,0, 30, 0, 0, 0, 0,25,0, 4,7,0, 18, 8, 0, 7, 6, 2,0, 4,7,0 } },
+		{ "valsound.piano11", "E.Piano #7",                { 4,7, 31,15, 0,10,15,40,0,15,0,0, 31,10, 0, 7,15,15,0, 1,0,0, 31,10, 0, 5,15,20,0, 1,0,0, 31,10, 0, 7,15, 0,0, 1,0,0 } },
+		{ "valsound.piano12", "Harpsichord 1",             { 2,5, 31,13, 0,15,10,30,1, 0,3,0, 31,11, 2, 0, 3,32,1, 7,3,0, 31, 2, 0, 0, 1,30,0, 0,7,0, 31, 6, 6, 7, 1, 0,1, 4,7,0 } },
+		{ "valsound.piano13", "Harpsichord 2",             { 2,7, 31, 4, 0, 5, 1,30,2, 0,3,0, 31, 9, 1, 2, 1,40,2,12,0,0, 31, 4, 3, 6, 1,30,1, 3,7,0, 31,11, 5, 8, 4, 0,2, 1,0,0 } },
+		{ "valsound.piano14", "Piano 1 (ML1,10,5,1)",      { 2,7, 28, 4, 0, 5, 1,37,2, 1,3,0, 22, 9, 1, 2, 1,47,2,12,0,0, 29, 4, 3, 6, 1,37,1, 3,7,0, 18, 8, 0, 6, 6, 0,2, 1,0,0 } },
+		{ "valsound.piano15", "Piano 3",                   { 2,7, 31, 4, 2, 0, 1,35,2, 1,3,0, 24, 0, 1, 5, 0,38,3, 1,0,0, 28, 0, 0, 5, 0,42,2, 4,5,0, 28, 7, 4, 6, 4, 0,2, 1,0,0 } },
+		{ "valsound.piano16", "Piano 4",                   { 2,7, 31, 4, 0, 5, 1,37,2, 1,3,0, 31, 9, 1, 2, 1,47,2,10,0,0, 31, 4, 3, 6, 1,37,1, 2,7,0, 31, 8, 0, 6, 6, 0,1, 1,0,0 } },
+		{ "valsound.piano17", "Digital Piano #5",          { 3,7, 28, 4, 0, 7, 1,27,1, 1,4,0, 28,14, 7, 4, 3,42,2,14,3,0, 26, 4, 3, 8, 2,38,0, 3,7,0, 25, 7, 8, 7, 0, 0,2, 1,6,0 } },
+		{ "valsound.piano18", "Piano 6 (high-tone)",       { 2,7, 28, 4, 0, 5, 1,39,2, 1,3,0, 31,13, 1, 2, 2,50,2,14,0,0, 29, 4, 3, 6, 1,41,1, 3,7,0, 21, 8, 6, 6, 6, 0,2, 1,0,0 } },
+		{ "valsound.piano19", "Panning Harpsichord",       { 2,7, 31, 2,10, 6,14,40,3,12,3,0, 25, 2,15, 6,14,32,0, 9,0,0, 30, 2, 4, 6,14,34,3, 5,7,0, 20, 2, 8, 6,14, 0,3, 1,0,0 } },
+		{ "valsound.piano20", "Yam Harpsichord",           { 1,4, 31, 6, 5, 6, 7,40,0,10,0,0, 31, 6, 4, 5, 5,35,0, 2,0,0, 31, 6, 5, 5, 5,24,0, 1,0,0, 31, 7, 6, 7, 5, 0,0, 1,0,0 } },
+	};
+	_register_fm_presets("valsound.piano", PRESET_OPN, valsound_piano_presets, std::size(valsound_piano_presets));
+
+	static const FMPreset valsound_se_presets[] = {
+		{ "valsound.se1", "S.Effect 1 (detune, o2c)", { 0,4, 31, 7, 3, 0, 1,12,0, 0,1,0, 31,10, 0, 8, 3,25,0, 0,2,0, 31, 6, 4, 8, 8, 0,0, 4,3,0, 31,12, 0, 8, 0, 0,0,12,7,0 } },
+		{ "valsound.se2", "S.Effect 2 (o0-1-2)",      { 1,2, 31, 6, 7,15, 3, 8,0, 0,3,0, 31, 6, 9,15, 6, 8,0, 0,7,0,  6, 6, 6,15, 1,10,0,12,3,0, 31, 5, 4,15, 2, 0,0, 0,0,0 } },
+		{ "valsound.se3", "S.Effect 3 (FB + noise)",  { 4,6,  4, 3, 0,15, 4, 0,0, 0,7,0,  8, 7, 7,15, 1, 0,0, 7,7,0,  5, 0, 0,15, 0, 0,0, 0,3,0,  8, 6, 3,15, 1, 0,0, 4,3,0 } },
+	};
+	_register_fm_presets("valsound.se", PRESET_OPN, valsound_se_presets, std::size(valsound_se_presets));
+
+	static const FMPreset valsound_special_presets[] = {
+		{ "valsound.special1", "Digital 1",                { 3,6, 31,12, 3, 5, 5,26,0,14,7,0, 31,16, 6, 0, 3,28,0, 8,3,0, 31, 0,12, 0, 0,30,0, 0,0,0, 31,15,12,12, 2, 0,0, 1,7,0 } },
+		{ "valsound.special2", "Digital 2",                { 0,7, 31,15, 0,12, 3,27,0,10,7,0, 31,16, 0, 0, 4,30,0,15,3,0, 31,15, 0, 0, 2,30,0, 2,0,0, 31,15, 0,12, 2, 0,0, 1,7,0 } },
+		{ "valsound.special3", "Digital Bass 3 (o2-o3)",   { 0,7, 31, 0, 0, 9, 0,27,0,12,1,0, 31,10, 0, 9, 1,25,0, 0,2,0, 31,10, 0, 9, 1,25,0,12,3,0, 31,12, 0,14, 2, 3,0, 1,7,0 } },
+		{ "valsound.special4", "Digital Guitar 3 (o2-o3)", { 0,7, 31, 0, 0, 9, 0,27,0,12,1,0, 31,10, 0, 9, 1,25,0, 0,2,0, 31,10, 0, 9, 1,25,0, 3,3,0, 31,12, 0,14, 2, 3,0, 1,7,0 } },
+		{ "valsound.special5", "Digital 4 (o4a)",          { 5,0, 31,31, 0, 0, 0,61,0, 9,0,0, 31,31, 0,13, 0, 3,0, 3,0,0, 31,31, 0,13, 0,15,0, 9,0,0, 31,31, 0,13, 0, 6,0, 6,0,0 } },
+	};
+	_register_fm_presets("valsound.special", PRESET_OPN, valsound_special_presets, std::size(valsound_special_presets));
+
+	static const FMPreset valsound_strpad_presets[] = {
+		{ "valsound.strpad1",  "Accordion 1",              { 4,6, 17, 0, 0, 0, 0,20,0, 4,3,0, 16, 9, 0,12, 2, 0,0, 8,3,0, 15, 0, 0, 7, 0,36,0, 4,7,0, 15, 9, 0,12, 2, 0,0, 8,7,0 } },
+		{ "valsound.strpad2",  "Accordion 2",              { 4,6, 21, 0, 1,11, 0,22,1, 4,3,0, 14, 8, 0,13, 1, 0,0, 4,3,0, 21, 0, 1,10, 0,30,1, 4,7,0, 14, 8, 1,13, 1, 0,0, 4,7,0 } },
+		{ "valsound.strpad3",  "Accordion 3",              { 4,7, 31, 5, 0, 0, 0,25,0, 4,7,0, 14, 8, 0,13, 1, 0,0, 4,7,0, 31, 8, 0, 0,10,25,0, 2,3,0, 14, 6, 0,13, 1, 0,0, 4,3,0 } },
+		{ "valsound.strpad4",  "Chorus #2 (voice)",        { 4,6, 21, 0, 1,11, 0,40,1, 4,3,0, 14, 8, 0,13, 1, 0,0, 4,3,0, 21, 0, 1,10, 0,37,1, 4,7,0, 14, 8, 1,13, 1, 0,0, 4,7,0 } },
+		{ "valsound.strpad5",  "Chorus #3",                { 4,4, 21, 0, 0, 2, 0,42,0, 4,3,0, 18, 4, 0, 9, 1, 0,0, 8,3,0, 21, 0, 0, 2, 0,45,0, 4,7,0, 18, 4, 0, 9, 1, 0,0, 4,7,0 } },
+		{ "valsound.strpad6",  "Chorus #4",                { 6,3, 21, 0, 0, 2, 0,39,0, 4,0,0, 18, 4, 0, 9, 1, 0,0, 4,1,0, 18,10, 0, 9, 1, 0,0, 4,3,0, 18, 8, 0, 9, 2, 0,0, 2,7,0 } },
+		{ "valsound.strpad7",  "Fretless Strings 1",       { 2,7, 25,10, 0, 5, 1,29,1, 1,1,0, 25,11, 0, 8, 5,15,1, 5,1,0, 28,13, 0, 6, 2,45,1, 1,0,0, 14, 4, 0, 6, 0, 0,1, 1,0,0 } },
+		{ "valsound.strpad8",  "Fretless Strings 2",       { 2,0, 21, 7, 0, 7, 3,37,1, 1,3,0, 20,11, 0,12, 3,15,1, 5,7,0, 16, 8, 0,12, 3,45,1, 1,0,0, 14, 5, 0,12, 1, 0,1, 1,0,0 } },
+		{ "valsound.strpad9",  "Fretless Strings 3",       { 2,7, 25,10, 0, 5, 1,35,1, 1,3,0, 25,11, 0, 8, 5,13,1, 5,0,0, 28,13, 0, 6, 2,45,1, 1,7,0, 14, 4, 0, 6, 1, 0,1, 1,0,0 } },
+		{ "valsound.strpad10", "Fretless Strings 4 (low)", { 2,7, 25,10, 0, 5, 1,29,1, 0,3,0, 25,11, 0, 8, 5,20,1, 4,0,0, 28,13, 0, 6, 2,38,1, 1,7,0, 14, 4, 0, 6, 1, 0,1, 1,0,0 } },
+		{ "valsound.strpad11", "Pizzicato #1 (Koto 2)",    { 0,6, 31, 7, 8, 1, 2,30,3, 3,7,0, 31, 5, 9, 1, 1,30,3, 2,0,0, 31, 5, 8, 3, 2,35,3, 1,0,0, 31,11, 7, 5, 5, 0,2, 1,3,0 } },
+		{ "valsound.strpad12", "Soundtrack (Modoki)",      { 4,7, 31, 0, 0, 0, 0,30,1, 2,3,0, 18,13, 4, 7, 1, 0,1, 2,3,0, 31, 0, 0, 0, 0,22,1, 3,7,0, 21,13, 4, 7, 1, 0,1, 3,7,0 } },
+		{ "valsound.strpad13", "Strings",                  { 2,7, 15, 9, 0, 5, 1,27,2, 2,3,0, 15, 0, 0, 5,15,31,2, 2,0,0, 15, 0, 0, 5, 0,27,1, 2,0,0, 13, 3, 0, 8, 0, 0,1, 2,7,0 } },
+		{ "valsound.strpad14", "Synth Accordion",          { 4,7, 18, 0, 0,11, 0,21,1, 2,3,0, 15, 9, 0,13, 2, 0,1, 8,3,0, 18, 0, 0,11, 0,20,1, 2,7,0, 14, 9, 0,13, 2, 0,1, 4,7,0 } },
+		{ "valsound.strpad15", "Phaser Synth",             { 0,7, 27,31, 5, 5, 5, 8,0, 1,4,0, 26,31, 4, 5, 4,18,0, 1,5,0, 19,31, 0, 5, 2,18,0, 1,6,0, 16,15, 0, 6, 2, 0,0, 3,4,0 } },
+		{ "valsound.strpad16", "FB Synth",                 { 3,7, 31, 6, 0, 0, 4,22,0, 2,0,0, 18, 0, 0, 8, 0,28,0, 4,6,0, 20, 5, 0, 8, 2,28,0, 2,1,0, 20, 4, 0, 8, 1, 0,0, 2,2,0 } },
+		{ "valsound.strpad17", "Synth Strings (MB)",       { 3,7, 21, 0, 0, 0, 0,30,0, 1,1,0, 14, 7, 7, 6, 3,25,0, 2,6,0, 15, 0, 0, 5, 0,38,0, 5,6,0, 18, 0, 0, 6, 0, 0,0, 2,0,0 } },
+		{ "valsound.strpad18", "Synth Strings #2",         { 2,7, 20, 1, 0, 8, 1,32,0, 2,7,0, 15, 4, 0, 8, 1,28,0, 2,0,0, 22, 1, 0, 8, 1,34,0, 2,3,0, 14, 2, 0, 9, 1, 0,0, 2,0,0 } },
+		{ "valsound.strpad19", "Synth Sweep Pad #1",       { 5,6, 31, 7, 0, 9, 5,18,0, 4,0,0, 31,15, 0,14, 1, 5,0, 8,0,0, 31,16, 0,15, 2, 5,0, 4,0,0, 31,26, 0,14, 2, 5,0, 8,1,0 } },
+		{ "valsound.strpad20", "Twin Synth #1 (calm)",     { 4,2, 16, 3, 0, 0, 2,25,0, 4,3,0, 19,12, 0, 6, 1, 0,0, 4,3,0, 16, 3, 0, 0, 2,20,0, 3,7,0, 19,12, 0, 6, 1, 0,0, 3,7,0 } },
+		{ "valsound.strpad21", "Twin Synth #2 (FB)",       { 4,6, 16, 3, 0, 0, 2,20,0, 4,7,0, 19,12, 0, 6, 1, 0,0, 8,3,0, 16, 3, 0, 0, 2, 6,0, 3,3,0, 19,12, 0, 6, 1, 8,0, 6,7,0 } },
+		{ "valsound.strpad22", "Twin Synth #3 (FB)",       { 4,6, 16, 6, 5, 0, 2,20,0, 4,3,0, 19,12, 0, 6, 1, 0,0, 8,3,0, 16, 6, 5, 0, 2, 6,0, 3,7,0, 19,12, 0, 6, 1, 8,0, 6,7,0 } },
+		{ "valsound.strpad23", "Vocoder Voice 1",          { 4,7, 31, 8, 5,12,15,20,0, 4,7,0, 31, 0, 0,15, 0, 0,0, 8,7,0, 31, 8, 5,12,15,24,0, 3,3,0, 31, 0, 0,15, 0, 0,0, 6,3,0 } },
+		{ "valsound.strpad24", "Voice (o3-o5)",            { 6,0, 10, 0, 1, 3, 0,70,0, 1,0,0, 12, 0, 0, 5, 0, 7,2, 3,3,0, 12, 0, 1, 6, 2, 0,1, 2,7,0, 18, 0, 0, 6, 0,17,1, 0,3,0 } },
+		{ "valsound.strpad25", "Voice 2 (o3-o5)",          { 6,0, 10, 0, 1, 3, 0,70,0, 0,0,0, 12, 0, 0, 5, 0, 6,2, 3,3,0, 12, 0, 1, 6, 2, 0,1, 2,7,0, 18, 0, 0, 6, 0,10,1, 1,3,0 } },
+	};
+	_register_fm_presets("valsound.strpad", PRESET_OPN, valsound_strpad_presets, std::size(valsound_strpad_presets));
+
+	static const FMPreset valsound_wind_presets[] = {
+		{ "valsound.wind1", "Clarinet #1",              { 3,7, 31, 0, 0, 7, 0,35,0, 4,0,0, 25,14, 0, 4, 2,42,0, 4,0,0, 31, 0, 0, 8, 0,38,0, 2,0,0, 18, 7, 0, 8, 1, 0,0, 1,0,0 } },
+		{ "valsound.wind2", "Clarinet #2 (brighter)",   { 3,7, 31, 0, 0, 7, 0,40,0, 8,0,0, 27,17, 0, 4, 4,45,0, 8,0,0, 31, 0, 0, 8, 0,37,0, 4,0,0, 18, 7, 0, 8, 1, 0,0, 1,0,0 } },
+		{ "valsound.wind3", "E.Flute",                  { 3,0, 20, 0, 0,10, 0,38,0, 6,0,0, 14,16, 0,10, 5,36,0, 2,3,0, 18,18, 0,10, 3,40,0, 4,0,0, 14,12, 0,10, 1, 0,1, 2,0,0 } },
+		{ "valsound.wind4", "E.Flute 2",                { 3,5, 20, 0, 0,10, 0,28,0, 2,3,0, 14,16, 0,10, 5,40,0, 2,3,0, 18,18, 0,10, 3,34,0, 4,0,0, 14,12, 0,10, 1, 0,1, 2,7,0 } },
+		{ "valsound.wind5", "Flute + Bell",             { 4,5, 16, 0, 0, 8, 1,47,0, 8,3,0, 14, 0, 0, 8, 0, 0,0, 4,3,0, 31,12, 0, 8, 2,45,0,14,7,0, 31, 8, 0, 8,15, 0,0, 8,7,0 } },
+		{ "valsound.wind6", "Old Flute",                { 2,7, 20, 5, 0,14, 1,50,0, 4,0,0, 15,15, 0,14, 2,45,0, 8,0,0, 18,15, 0,14, 2,50,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 } },
+		{ "valsound.wind7", "Whistle 1",                { 2,7, 20, 5, 0,14, 1,60,0, 4,0,0, 15,15, 0,14, 2,55,0,12,0,0, 18,15, 0,14, 2,60,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 } },
+		{ "valsound.wind8", "Whistle 2",                { 2,7, 20, 5, 0,14, 1,55,0, 2,0,0, 15,15, 0,14, 2,55,0, 8,0,0, 18,15, 0,14, 2,60,0, 8,0,0, 14, 2, 0,14, 0, 0,0, 4,0,0 } },
+	};
+	_register_fm_presets("valsound.wind", PRESET_OPN, valsound_wind_presets, std::size(valsound_wind_presets));
+
+	static const FMPreset valsound_world_presets[] = {
+		{ "valsound.world1", "Banjo (Harpsichord)",     { 1,7, 31, 7, 0,10,15,38,0,12,7,0, 31, 8, 6, 7, 3,52,2,10,1,0, 31,12, 6, 7, 3,25,0, 1,0,0, 31,11, 7, 7, 3, 0,2, 3,5,0 } },
+		{ "valsound.world2", "Koto 1",                  { 3,0, 31, 0, 0,10, 0,38,0, 6,0,0, 24,13, 0,10, 5,40,0, 2,3,0, 28,15, 0,10, 3,40,0, 4,0,0, 24,12, 8,10, 2, 0,1, 2,0,0 } },
+		{ "valsound.world3", "Koto 2",                  { 0,7, 31, 7, 3, 3, 2,30,3, 3,7,0, 31, 5, 3, 3, 1,30,3, 2,0,0, 31, 5, 3, 5, 2,30,3, 1,0,0, 31,10, 3, 7, 2, 0,3, 1,3,0 } },
+		{ "valsound.world4", "Sitar 1",                 { 0,6, 18, 5, 3, 1, 2,30,1, 3,7,0, 31, 5, 4, 1, 1,28,1, 2,0,0, 31, 5, 3, 3, 2,35,1, 1,0,0, 31,10, 2, 5, 4, 0,0, 1,3,0 } },
+		{ "valsound.world5", "Shamisen 2",              { 3,7, 31,16, 6, 7, 2,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 6,0,0, 31, 6, 6, 7, 1,40,0, 1,7,0, 31,15, 6, 7, 5, 0,0, 2,0,0 } },
+		{ "valsound.world6", "Shamisen 1",              { 2,7, 31,16, 6, 7, 2,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 8,0,0, 31, 6, 6, 7, 1,40,0, 1,7,0, 31,15, 6, 7, 5, 0,0, 2,0,0 } },
+		{ "valsound.world7", "Synth Shamisen",          { 2,7, 31,16, 6, 7, 1,33,0, 1,3,0, 31,16, 6, 7, 4,18,2, 7,0,0, 31, 6, 6, 7, 0,40,0, 1,7,0, 31,15, 6, 7, 2, 0,0, 2,0,0 } },
+	};
+	_register_fm_presets("valsound.world", PRESET_OPN, valsound_world_presets, std::size(valsound_world_presets));
 }
 
 void SiONVoicePresetUtil::_generate_midi_voices() {
 	// 128 voices from GM.
 
-	_begin_category("midi");
-	_create_ma3_voice("midi.piano1",  "GrandPno",  { 3,0,  8,15, 7, 0, 6,15,39,0,1, 1,0,0,  0,14, 3, 2, 3, 2,28,1,3, 5,0,0,  0,13, 1, 1, 4, 3,22,0,0, 1,0,0,  0,13, 3, 2, 6, 4, 0,1,2, 1,0,0 });
-	_create_ma3_voice("midi.piano2",  "BritePno",  { 3,0,  0,15, 2, 2, 2, 5,39,1,2, 1,0,0,  0,15, 2, 2, 3,15,28,0,2, 5,0,0,  0,15, 2, 2, 2,13,25,1,2, 1,0,0,  0,15, 2, 1, 5, 4,10,1,0, 1,0,0 });
-	_create_ma3_voice("midi.piano3",  "E.GrandP",  { 5,6,  0,13, 2, 2, 4, 6,20,1,1, 4,0,0,  0,13, 1, 1, 6, 7, 8,1,2, 1,0,0,  0,13, 3, 3, 4,14,11,1,1, 2,0,0,  0,13, 1, 1, 5,15, 8,1,2, 2,0,0 });
-	_create_ma3_voice("midi.piano4",  "HnkyTonk",  { 5,6,  0,15, 1, 2, 5,14,26,1,0, 1,3,2,  0,13, 3, 2,10, 3, 2,1,2, 2,7,2,  0,12, 1, 2, 5, 3,23,0,0, 1,7,0,  0,13, 3, 3,10, 3, 2,1,2, 2,3,2 });
-	_create_ma3_voice("midi.piano5",  "E.Piano1",  { 3,1,  0,11, 3, 2,10, 3,27,1,1, 3,0,1,  0,11, 2, 2, 9, 4,27,0,3, 3,0,0,  0,10, 4, 1, 4, 1,19,1,1, 2,0,0,  0,10, 1, 1, 7, 8, 5,1,0, 1,0,1 });
-	_create_ma3_voice("midi.piano6",  "E.Piano2",  { 5,5, 18,15, 4, 5,12,11,35,1,0, 7,0,2,  0,15, 2, 1, 8,15, 4,0,2, 1,0,2,  0,15, 0, 1,11, 1,18,1,1, 1,0,2,  0,15, 2, 1, 7,15, 4,1,0, 1,0,2 });
-	_create_ma3_voice("midi.piano7",  "Harpsi.",   { 6,4,  4,14, 2, 2, 5, 0, 0,1,1, 1,0,0,  3,15, 2, 0, 5, 3,20,1,3, 6,0,0,  4,15, 3, 0, 1, 6,28,1,2, 7,0,0,  5,14, 2, 2, 7,15, 4,1,0, 1,0,0 });
-	_create_ma3_voice("midi.piano8",  "Clavi.",    { 3,5,  5,15, 1, 1, 6,15,24,0,0, 1,0,2,  0,15, 1, 1, 5, 0,29,0,0, 1,0,2,  4,15, 3, 3, 7, 2,27,1,1, 7,0,2,  0,15, 2, 2, 9, 2, 8,1,0, 3,0,2 });
-
-	_create_ma3_voice("midi.chrom1",  "Celesta",   { 5,2,  2,14, 6, 6, 5,15,21,1,2, 9,0,0,  0,13, 4, 4, 4,14, 6,0,0, 1,0,0,  5,14, 6, 6, 6,12,22,1,3,11,0,0,  0,14, 4, 4, 4,14, 6,0,0, 1,0,0 });
-	_create_ma3_voice("midi.chrom2",  "Glocken",   { 7,0,  0,15, 9, 3, 4, 4, 9,1,0, 7,0,2,  0,15,11, 2, 3,11,15,1,0, 4,0,2,  0,15, 3, 2, 4, 4,18,1,1, 2,0,2,  0,15, 4, 3, 4,14, 4,0,0, 1,0,2 });
-	_create_ma3_voice("midi.chrom3",  "MusicBox",  { 5,0,  1, 5, 5, 2, 2, 0,32,1,2, 2,0,0,  0,15, 4, 3, 2, 0, 1,1,1, 1,3,0,  1,10, 5, 2, 2, 0,28,1,0, 9,0,0,  0,15, 2, 1, 1, 0, 6,1,0, 1,7,0 });
-	_create_ma3_voice("midi.chrom4",  "Vibes",     { 5,0,  0,12, 4, 2, 4, 2,23,0,0, 7,0,2,  0,13, 9, 2, 5, 6, 7,1,2, 4,0,2,  0,12, 4, 2, 3, 2,30,1,0, 8,0,2,  0,13, 2, 3, 4,15, 7,0,0, 1,0,1 });
-	_create_ma3_voice("midi.chrom5",  "Marimba",   { 5,7,  0,10, 7, 4, 4,15,40,1,1,12,0,0,  0,11, 4, 4, 5,15, 5,0,0, 1,0,0,  0,11, 7, 6, 4,15,33,1,0, 6,0,0,  0,13, 4, 5, 5,15, 5,1,0, 1,0,0 });
-	_create_ma3_voice("midi.chrom6",  "Xylophon",  { 5,2,  0,15, 9, 6, 6,13,24,0,2, 5,0,0,  0,15, 7, 5, 7,13, 3,0,0, 1,0,0,  0,15, 6, 6, 6,10,29,1,2, 5,0,0,  0,15, 6, 6, 7,14, 0,0,2, 1,0,0 });
-	_create_ma3_voice("midi.chrom7",  "TubulBel",  { 5,0, 16,15, 4, 3, 3, 5,16,0,1,10,0,1,  0,15, 3, 2, 3, 2, 5,0,0, 1,0,0,  8,15, 4, 3, 3, 5,16,0,1, 7,3,1,  0,15, 3, 2, 3, 2, 5,0,2, 2,7,0 });
-	_create_ma3_voice("midi.chrom8",  "Dulcimer",  { 6,3,  1,14,10, 4, 4,12, 6,0,2, 2,0,0,  1,11, 3, 3, 3, 5,20,0,1, 3,0,0,  0,13, 3, 3, 3, 0,10,0,0, 1,0,0,  0,12, 4, 4, 4, 6, 6,0,0, 1,0,0 });
-
-	_create_ma3_voice("midi.organ1",  "DrawOrgn",  { 2,0,  0,15, 4, 0,12, 0, 0,0,2, 0,0,1,  4,15, 5, 0,12, 0, 0,0,1, 1,0,0,  9,13, 5, 0,12, 1, 7,0,2, 3,1,1,  4,15, 1, 0,12, 0, 7,0,2, 2,0,1 });
-	_create_ma3_voice("midi.organ2",  "PercOrgn",  { 7,4,  0,14, 5, 0,10, 1, 3,0,2, 0,2,2,  0,13, 8, 0, 0, 5,29,0,0, 2,0,0,  0,14, 5, 0,10, 1, 1,0,2, 1,3,0,  0,14, 6, 0,10, 0, 1,0,2, 2,7,0 });
-	_create_ma3_voice("midi.organ3",  "RockOrgn",  { 7,4,  0,15,15, 0,13, 0, 9,0,1, 1,3,3, 21,11,15, 0,10, 1, 5,0,1, 1,0,2,  0,15,15, 0,14, 0, 9,0,0, 2,6,0, 17,15,15, 0,14, 0, 9,0,0, 0,7,1 });
-	_create_ma3_voice("midi.organ4",  "ChrchOrg",  { 7,0,  0, 9,15, 0, 5, 0,19,0,2, 3,0,0,  0,11, 7, 0, 2, 2,29,0,0, 7,0,0,  0, 8,15, 0, 5, 0, 4,0,2, 1,0,0,  5, 8, 7, 0, 5, 0, 4,0,2, 0,0,0 });
-	_create_ma3_voice("midi.organ5",  "ReedOrgn",  { 5,3, 16, 7, 8, 0, 5, 1,24,1,2, 2,0,0,  0, 5,15, 0, 6, 0, 0,1,2, 1,0,0,  5, 6,12, 0, 5, 3,10,1,1, 1,0,0,  0, 5,15, 0, 7, 0, 0,1,1, 2,0,0 });
-	_create_ma3_voice("midi.organ6",  "Acordion",  { 5,2, 17, 8, 2, 0, 0, 1,21,0,0, 3,6,0,  0, 7, 2, 0,10, 2, 2,0,1, 1,7,0, 17, 6,15, 0, 0, 1,18,0,0, 1,2,0,  0, 7,15, 0,10, 0, 7,0,2, 2,3,0 });
-	_create_ma3_voice("midi.organ7",  "Harmnica",  { 4,0,  0,15,15, 0, 9, 0,44,0,3,14,0,0,  0,15,15, 0, 8, 0,41,0,0,10,0,0,  0,15,15, 0, 8, 0,36,0,0, 1,0,0,  0, 6,15, 0, 8, 0, 3,0,2, 2,0,0 });
-	_create_ma3_voice("midi.organ8",  "TangoAcd",  { 5,4, 12, 7,12, 0, 0, 0,15,0,0, 2,1,1,  0, 7, 2, 0,10, 0,10,0,2, 2,1,0,  5, 7,15, 0, 0, 0,20,0,0, 1,0,0, 16, 7,15, 0,10, 0,10,0,0, 1,0,1 });
-
-	_create_ma3_voice("midi.guitar1", "NylonGtr",  { 5,6,  0,14, 1, 1, 4, 8,21,1,1, 1,0,0,  0,15, 3, 3, 7,15, 0,0,0, 1,0,0,  1,11, 5, 5, 5, 4,14,1,0, 3,0,0,  0,13, 4, 4, 9,15,13,0,2, 1,0,0 });
-	_create_ma3_voice("midi.guitar2", "SteelGtr",  { 4,4,  5,15, 7, 1, 4, 2,26,0,2, 9,0,2,  0,15, 3, 1, 8, 5,45,1,2,13,0,2,  0,15, 2, 1, 4, 1,23,1,2, 1,0,2,  0,13, 3, 2, 8,15, 4,0,0, 1,0,1 });
-	_create_ma3_voice("midi.guitar3", "Jazz Gtr",  { 3,0,  0,15, 7, 1, 7, 3,17,1,1, 1,0,2,  0,15, 5, 1, 4, 2,18,0,3, 5,0,2,  0,15, 2, 0, 7,15,31,0,1, 3,0,2,  0,12, 2, 0, 8,15, 4,0,0, 1,0,2 });
-	_create_ma3_voice("midi.guitar4", "CleanGtr",  { 5,0,  1,15,10, 2, 2, 1,15,0,1, 1,0,0,  0,15, 2, 2, 9,15, 3,0,2, 1,0,0,  4,15, 2, 2, 3, 6,16,1,1, 3,0,0,  0,14, 4, 4, 8, 6, 3,0,2, 1,0,0 });
-	_create_ma3_voice("midi.guitar5", "Mute.Gtr",  { 5,7,  0,13, 8, 6, 7, 7,17,1,0, 0,0,0,  0,14, 9, 3, 9, 7, 0,0,0, 0,0,0,  0,14, 3, 3, 8, 9, 4,0,3, 1,0,0,  0,11, 4, 3,10, 3, 0,1,0, 1,0,0 });
-	_create_ma3_voice("midi.guitar6", "Ovrdrive",  { 4,2, 12,15, 8, 0, 2,15,19,1,0, 0,7,2,  0,12, 1, 0, 1, 1,15,0,1, 2,3,2,  0,11, 2, 0,10, 1,15,0,0, 1,0,2,  0,11, 1, 1,10, 1,10,0,0, 2,0,2 });
-	_create_ma3_voice("midi.guitar7", "Dist.Gtr",  { 4,4,  3,11,12, 0, 2, 0, 8,0,1, 2,0,0,  0,12, 5, 0,10, 1,29,0,0, 1,0,0,  8,12, 5, 0,10, 1,23,0,0, 2,0,0,  6,12, 1, 0,10, 5,15,0,0, 1,0,0 });
-	_create_ma3_voice("midi.guitar8", "GtrHarmo",  { 5,5,  8,15, 2, 8, 7, 0,22,0,1, 0,0,0,  8,13, 3, 3, 9,15, 6,0,0, 2,0,0,  0,11, 2, 8, 7, 0,17,0,0, 0,0,0,  6,10, 7, 7, 7,15,13,0,0, 2,0,0 });
-
-	_create_ma3_voice("midi.bass1",   "Aco.Bass",  { 5,3,  0,11, 3, 3, 8,10,14,1,1, 1,0,0,  0,12, 3, 3, 8,11, 0,0,0, 1,0,0,  0, 9, 3, 3, 1, 1, 7,0,3, 1,0,0,  0,12, 3, 3, 8,10, 5,0,0, 1,0,0 });
-	_create_ma3_voice("midi.bass2",   "FngrBass",  { 3,6,  0,10, 2, 1, 3, 1,28,1,2, 1,0,2,  0, 9, 4, 3, 6, 4,58,1,0,12,0,2,  0,11, 3, 2, 3, 2,22,1,2, 1,0,2,  0,11, 1, 1, 8, 2, 0,1,0, 2,0,2 });
-	_create_ma3_voice("midi.bass3",   "PickBass",  { 3,5,  0,15, 7, 2, 3, 1,19,1,2, 1,0,2,  0,12,11, 4, 6, 7,21,1,0, 7,0,2,  0,15, 9, 2, 6, 2,23,1,2, 2,0,2,  0,11, 2, 6, 8, 6, 0,1,0, 1,0,2 });
-	_create_ma3_voice("midi.bass4",   "Fretless",  { 3,4,  0,12, 3, 2, 3, 1,29,1,2, 1,2,2,  0,10, 3, 3, 6, 3,25,1,2, 1,1,2,  0, 9, 3, 2, 6, 1,25,1,2, 1,0,2,  0,11, 1, 2, 8, 2, 0,1,0, 2,0,2 });
-	_create_ma3_voice("midi.bass5",   "SlapBas1",  { 3,3,  0,15, 7, 2, 3, 2,14,1,2, 1,0,2,  0,15, 6, 6, 6, 4,21,1,0, 9,0,2,  0,12, 9, 2, 6, 2,24,1,2, 1,0,2,  0,15, 2,15, 8,15, 3,1,0, 1,0,2 });
-	_create_ma3_voice("midi.bass6",   "SlapBas2",  { 3,2,  0,15, 7, 2, 3, 1,14,1,2, 1,0,2,  0,11, 5, 6, 7, 2,18,0,0,13,0,2,  0, 9, 9, 2, 6, 2,30,1,2, 1,0,2,  0,15, 2, 6, 8, 6, 6,1,0, 1,0,2 });
-	_create_ma3_voice("midi.bass7",   "SynBass1",  { 3,5,  0,14, 6, 2, 8, 5,14,0,0, 1,0,0,  8,14, 4, 1, 8, 6,39,0,1, 2,0,0,  0,14, 2, 1, 8, 6,35,0,0, 1,0,0,  0,14, 2, 2, 8, 9, 0,0,0, 1,0,0 });
-	_create_ma3_voice("midi.bass8",   "SynBass2",  { 5,6,  0,15, 5, 7, 8, 6,20,0,0, 2,0,2,  0,15, 1, 7, 8,12, 0,0,1, 2,0,2,  0,15, 3, 7, 7, 6,20,0,0, 1,0,2,  0,15, 2, 7, 8,12, 0,0,1, 1,0,2 });
-
-	_create_ma3_voice("midi.strings1", "Violin",    { 5,2, 12, 6, 0, 0, 3, 0,18,1,2, 1,0,0,  0, 6, 4, 0, 7, 2, 3,0,0, 1,5,0,  6,14, 5, 7,10, 0, 6,1,1, 4,0,0,  0, 6, 7, 7, 7,15, 3,0,2, 1,1,0 });
-	_create_ma3_voice("midi.strings2", "Viola",     { 5,2,  1, 6, 0, 0, 3, 0, 9,1,2, 1,0,0,  0, 6, 6, 0, 7, 1, 3,0,0, 1,0,0,  6,14, 6, 7, 7, 0, 8,1,1, 1,0,0,  0, 6, 7, 7, 7,15, 3,0,2, 1,0,0 });
-	_create_ma3_voice("midi.strings3", "Cello",     { 3,4,  1,15, 6, 0, 6, 0,16,0,0, 1,0,0,  0,15, 5,15,14,15,20,0,0, 5,0,2,  0,15, 5, 0, 7, 2,45,0,0, 1,0,0,  0, 6, 3, 0, 7, 1, 1,0,2, 3,0,0 });
-	_create_ma3_voice("midi.strings4", "ContraBs",  { 3,6,  0,15, 6, 0, 2, 0,25,0,0, 1,0,0, 17,15, 6,15,14,15,21,0,0, 5,0,2,  0,15, 6, 0, 4, 3,27,0,0, 3,0,0,  0, 6, 3, 0, 7, 1, 0,0,2, 2,0,0 });
-	_create_ma3_voice("midi.strings5", "Trem.Str",  { 5,3, 20, 7, 2, 0, 3, 1,22,1,2, 1,2,0,  0, 6, 3, 0, 6, 1, 2,0,0, 2,0,1, 12, 7, 3, 0, 4, 0,22,1,1, 1,4,0,  0, 6, 3, 0, 6, 1, 2,0,0, 1,0,2 });
-	_create_ma3_voice("midi.strings6", "Pizz.Str",  { 5,7,  0,15,11, 5,11, 9,20,0,0, 1,0,0,  0,14, 7, 8, 7, 2, 0,0,0, 1,0,0,  8,15, 7, 6, 5,15,17,0,1, 1,0,0,  0,12, 6, 5, 6,15, 0,0,0, 1,0,0 });
-	_create_ma3_voice("midi.strings7", "Harp",      { 3,6,  0,15, 8, 5, 8, 4,41,0,0, 2,0,0,  0,11, 8, 7, 9, 4,33,0,0, 5,0,0,  0,11, 7, 3, 2, 4,33,0,2, 1,0,0,  0,15, 4, 2, 2, 1, 4,1,0, 1,0,2 });
-	_create_ma3_voice("midi.strings8", "Timpani",   { 3,3,  0,15, 8, 4, 3, 3, 4,1,1, 1,0,2,  0,15, 2, 2, 2,15,33,1,0, 0,7,2,  0,15, 7, 3, 3, 0,28,1,2, 1,0,2,  8,15, 4, 3, 3,15, 0,1,0, 0,0,2 });
-
-	_create_ma3_voice("midi.ensemble1", "Strings1",  { 7,2,  7, 5,10, 0, 6, 0,11,0,2, 1,1,1,  4,12, 6, 0, 6, 1,24,0,0, 2,0,0,  0, 6, 6, 0, 6, 1, 7,0,2, 1,5,0, 12, 6, 5, 0, 6, 1, 5,0,0, 2,3,1 });
-	_create_ma3_voice("midi.ensemble2", "Strings2",  { 7,3,  9, 6,10, 0, 5, 0, 0,0,0, 1,3,0,  2,12, 6, 0, 5, 1,23,0,0, 1,0,1,  1, 5, 6, 0, 6, 0, 0,0,2, 1,5,0, 27, 5, 5, 0, 6, 1, 7,0,0, 1,7,0 });
-	_create_ma3_voice("midi.ensemble3", "Syn.Str1",  { 5,0,  0, 9, 8, 0, 2, 1,27,0,0, 1,6,0,  0, 7,15, 0, 5, 0, 7,0,0, 1,3,0,  4, 9,11, 0, 2, 0,20,1,0, 1,3,0,  0, 6,15, 0, 4, 0, 0,0,1, 1,7,0 });
-	_create_ma3_voice("midi.ensemble4", "Syn.Str2",  { 5,5,  9, 9, 8, 0, 2, 1,19,0,0, 1,0,0,  0, 6, 6, 0, 5, 0, 6,0,0, 1,0,0, 27, 8, 8, 0, 2, 0,10,0,0, 1,0,0,  0, 5, 7, 0, 4, 3, 0,0,1, 1,0,0 });
-	_create_ma3_voice("midi.ensemble5", "ChoirAah",  { 5,5,  7,12, 0, 0, 0,15,19,0,0, 6,0,0,  0, 6, 3, 0, 5, 6,23,0,2, 4,0,0,  8, 7,15, 0, 3, 0,30,0,1, 1,0,0,  0, 5,15, 0, 5, 0, 0,0,0, 2,0,0 });
-	_create_ma3_voice("midi.ensemble6", "VoiceOoh",  { 5,7,  7,12, 0, 0, 0,15,20,1,0, 5,0,1,  0, 7, 3, 0, 5, 6,20,0,2, 4,0,0, 10, 7, 7, 0, 4, 3,26,0,2, 1,0,0,  0, 9, 1, 0, 5, 0, 0,0,0, 1,0,0 });
-	_create_ma3_voice("midi.ensemble7", "SynVoice",  { 5,0,  0,10, 0, 0, 4,15,22,0,0, 1,0,0,  0, 7,15, 0, 5, 1, 8,0,2, 1,0,0,  9, 9,15, 0, 4, 0,26,0,1, 1,0,0,  0, 7,15, 0, 5, 0, 0,0,2, 3,0,0 });
-	_create_ma3_voice("midi.ensemble8", "Orch.Hit",  { 7,5,  8,15, 4, 4, 6, 6, 0,1,0, 4,0,1,  6,12, 5, 3, 3, 1, 0,0,0, 1,0,0,  6,12, 7, 6, 6, 0, 0,0,0, 1,0,0,  6,11, 7, 7, 6, 0, 0,0,0, 0,0,0 });
-
-	_create_ma3_voice("midi.brass1",    "Trumpet",   { 3,6,  1, 8, 8, 0, 5, 1,20,0,0, 1,0,0,  0,10, 8, 0, 5, 4,23,0,2, 3,0,0,  0, 7, 7, 0, 6, 1,26,0,2, 1,0,0,  0, 9,15, 0, 8, 0, 6,0,0, 1,0,0 });
-	_create_ma3_voice("midi.brass2",    "Trombone",  { 3,7,  8, 7, 6, 0, 7, 1,28,0,0, 1,0,0,  0, 9, 8, 0, 5, 4,15,0,2, 1,0,0,  1, 6, 7, 0, 7, 1,26,0,2, 1,0,0,  0, 8,15, 0, 8, 0, 5,0,0, 1,0,0 });
-	_create_ma3_voice("midi.brass3",    "Tuba",      { 3,7,  8, 6, 5, 0, 6, 2,34,0,0, 1,0,0,  1,12, 8, 0,11, 4,24,0,2, 1,0,0,  1, 9, 7, 0, 9, 3,17,0,2, 1,0,0,  0, 7,15, 0, 8, 0, 0,0,0, 2,0,0 });
-	_create_ma3_voice("midi.brass4",    "Mute.Trp",  { 5,0, 10, 7, 0, 0, 7, 5,26,0,0, 3,0,0,  2, 9,13, 0, 9, 4, 0,0,0, 0,0,0, 17, 7, 9, 0, 6, 1,19,0,0, 5,0,0,  2, 8, 7, 0, 9, 2, 0,0,0, 1,0,0 });
-	_create_ma3_voice("midi.brass5",    "Fr.Horn",   { 5,0,  8, 7, 9, 0, 0, 0,16,0,3, 1,2,0,  0, 9,14, 0, 7, 0, 1,0,2, 1,7,0,  0, 6, 9, 0, 2, 1,22,0,2, 1,6,1,  8,10,14, 0, 7, 0, 1,0,2, 1,3,0 });
-	_create_ma3_voice("midi.brass6",    "BrasSect",  { 5,6,  0, 8, 6, 0, 2, 1,22,0,0, 1,7,2,  0, 9,15, 0, 8, 0, 8,0,0, 1,7,2, 12, 7, 7, 0, 5, 1,22,0,0, 1,0,2,  0, 9, 8, 0, 8, 0, 7,0,0, 1,0,2 });
-	_create_ma3_voice("midi.brass7",    "SynBras1",  { 5,6,  0, 7, 6, 0, 8, 2,16,0,0, 1,7,2,  0, 9,15, 0,10, 0,10,0,0, 1,7,2,  0, 7, 6, 0, 8, 2,16,0,0, 1,0,2,  0, 9, 8, 0,10, 0,10,0,0, 1,0,2 });
-	_create_ma3_voice("midi.brass8",    "SynBras2",  { 3,6,  0, 6, 3, 0, 4, 1,28,0,0, 1,0,0,  1, 9, 7, 0, 5, 7,39,0,0, 6,0,0,  8, 7, 5, 3, 3,11,35,0,0, 1,0,0,  0,15,15, 0, 7, 0, 4,0,0, 1,0,0 });
-
-	_create_ma3_voice("midi.reed1",     "SprnoSax",  { 3,0,  0,15, 9, 6, 6, 3,29,1,0, 3,0,0,  0, 8, 2, 0, 6, 0,26,0,0, 1,0,0,  1, 8, 5, 0, 0, 0,12,0,1, 1,0,0,  0, 8, 6, 0, 8, 1, 3,0,0, 1,0,0 });
-	_create_ma3_voice("midi.reed2",     "Alto Sax",  { 5,4,  1, 9, 3, 0, 0, 0,10,1,2, 1,0,2,  0, 8, 2, 0, 9, 0, 9,0,0, 1,0,2,  9, 9, 3, 0, 0, 0,13,1,2, 1,0,2,  1, 9, 2, 0, 9, 0,21,0,0, 1,0,2 });
-	_create_ma3_voice("midi.reed3",     "TenorSax",  { 5,3,  1, 7, 3, 0, 0, 0, 5,1,2, 1,0,2,  8, 7, 2, 0, 9, 0,15,0,0, 1,0,2,  9, 7, 3, 0, 0, 0, 8,1,2, 1,0,2,  0, 7, 2, 0, 9, 0,13,0,2, 1,0,2 });
-	_create_ma3_voice("midi.reed4",     "Bari.Sax",  { 5,6,  0, 7, 3, 0, 5, 0,18,1,2, 1,0,0,  0, 7, 2, 0, 8, 2, 6,1,0, 2,0,0,  2, 7, 5, 0, 1, 0,14,1,1, 2,0,0,  0, 7, 4, 0, 8, 1, 5,1,0, 1,0,0 });
-	_create_ma3_voice("midi.reed5",     "Oboe",      { 5,0,  5,10, 0, 0, 4, 0,30,0,2, 1,0,0,  0, 9, 1, 1, 9, 0, 9,0,0, 3,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 0,10, 0,14,0,0, 2,0,0 });
-	_create_ma3_voice("midi.reed6",     "Eng.Horn",  { 5,0,  5,10, 0, 0, 4, 0,34,0,2, 1,0,0,  0, 9, 1, 1, 9, 1,11,0,0, 3,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 1,10, 1,11,0,0, 2,0,0 });
-	_create_ma3_voice("midi.reed7",     "Bassoon",   { 5,0,  1,12, 7, 0, 0, 1,24,1,2, 1,0,0,  9, 7, 1, 0, 8, 1, 0,1,2, 3,0,0,  1,12, 7, 0, 0, 1,24,1,2, 1,0,0,  9, 7, 1, 0, 8, 1, 3,1,0, 3,1,0 });
-	_create_ma3_voice("midi.reed8",     "Clarinet",  { 5,7,  0, 7, 2, 0, 1, 1,37,1,2, 2,0,0,  0, 8, 2, 0, 8, 1, 3,0,0, 1,0,0,  0, 5, 2, 0, 1, 1,26,1,1, 4,0,0,  0, 7, 2, 0, 8, 1, 3,0,0, 1,0,0 });
-
-	_create_ma3_voice("midi.pipe1",     "Piccolo",   { 5,7,  2,10,12, 0, 7, 1,12,0,0, 5,0,0,  0, 9, 7, 0, 8,15,39,0,0, 1,0,0,  1, 8, 5, 0, 7, 1,30,0,0, 1,0,0,  0, 8, 5, 0,10, 0, 6,0,0, 1,0,0 });
-	_create_ma3_voice("midi.pipe2",     "Flute",     { 5,7,  0,13,10, 0, 1, 1, 7,0,0, 3,0,0,  0, 7, 8, 0,11, 3,37,0,0, 3,0,0,  0,14, 8, 0, 9, 0,39,0,0, 1,0,1, 16, 6, 5, 0,10, 0, 1,0,0, 1,0,0 });
-	_create_ma3_voice("midi.pipe3",     "Recorder",  { 5,7,  3, 9, 6, 7,10, 0,58,0,0, 2,0,1,  8, 8, 5, 0,10, 0, 4,0,0, 1,0,0, 24,10, 9, 6, 6, 9,15,0,0, 7,0,0,  0, 8, 5, 0,10, 0,36,0,0, 1,0,1 });
-	_create_ma3_voice("midi.pipe4",     "PanFlute",  { 5,7,  0,10, 0, 0, 6, 0, 0,0,1,13,0,1,  3,11,10, 1,10, 0,35,0,0,10,0,1,  0, 8,15, 0, 4, 0,44,0,0, 2,0,0,  0, 8, 0, 0, 9, 0, 5,0,0, 1,0,1 });
-	_create_ma3_voice("midi.pipe5",     "Bottle",    { 5,7, 10,12,12, 0, 7, 1,12,1,0, 5,0,0,  0, 7, 7, 0, 9, 6,27,0,0, 1,0,0,  8, 7, 8, 0, 8, 3,11,0,3, 2,0,1,  0, 7, 5, 0, 8, 0, 1,0,0, 1,0,0 });
-	_create_ma3_voice("midi.pipe6",     "Shakhchi",  { 5,7,  2,10,12, 0, 5, 1, 6,0,0, 5,0,0,  8, 6, 7, 0, 9, 5,23,0,0, 1,0,1, 18,10, 8, 0, 3, 3, 2,0,1, 0,0,2,  0, 6, 5, 0, 9, 0, 1,0,0, 1,0,0 });
-	_create_ma3_voice("midi.pipe7",     "Whistle",   { 2,0,  0, 6,10, 0, 6, 0, 5,0,0, 1,0,0,  0, 8, 8, 0, 7, 0, 5,0,0, 1,0,2, 17, 6,10, 9, 7, 0,44,0,0, 1,0,2,  8, 6, 8, 0, 7, 0, 5,0,0, 1,7,2 });
-	_create_ma3_voice("midi.pipe8",     "Ocarina",   { 5,7,  3, 8, 6, 7, 8, 0,60,0,1, 2,0,0,  0, 8, 5, 0, 9, 0, 0,0,0, 1,0,0, 24,10, 9, 6, 6, 9,15,0,0, 1,0,0,  8, 7, 5, 0,10, 0,26,0,0, 1,0,0 });
-
-	_create_ma3_voice("midi.lead1", "SquareLd",  { 5,0,  8,15,15, 0, 7, 4,46,0,3, 1,0,0,  8,10,15, 0,10, 0, 3,0,2, 1,0,0,  8,15,15, 0, 2, 3,38,0,3, 2,0,0,  8,10,15, 0,10, 0, 3,0,2, 1,0,0 });
-	_create_ma3_voice("midi.lead2", "Saw.Lead",  { 5,7,  0,15, 0, 0, 7, 0,26,0,0, 1,7,2,  8,13,15, 0, 7, 0,10,0,0, 1,7,2, 20,15,15, 0, 3, 0,20,0,1, 1,0,2,  8,14,15, 0, 8, 0,10,0,0, 1,0,2 });
-	_create_ma3_voice("midi.lead3", "CaliopLd",  { 5,7,  8,12, 4, 0, 7, 8, 0,0,0, 4,0,1,  8,12, 6, 0, 6, 7,20,0,1, 4,0,2,  0, 8, 6, 0, 5, 5, 3,0,1, 2,0,0, 16, 6, 4, 0, 8, 1, 2,0,0, 1,0,1 });
-	_create_ma3_voice("midi.lead4", "ChiffLd",   { 5,0,  8, 7, 7, 0, 2, 6, 4,0,1, 1,4,0,  8,15, 6, 0, 8, 0,11,0,0, 1,0,0,  8, 7, 7, 0, 2, 6, 3,0,1, 1,1,0,  8,15, 6, 0, 8, 0,11,0,0, 1,2,0 });
-	_create_ma3_voice("midi.lead5", "CharanLd",  { 5,0,  1, 9, 2, 0, 6, 2, 8,0,2, 1,4,2, 12, 9, 1, 0, 8, 2,14,0,0, 2,0,0,  1, 9, 2, 0, 6, 2,10,0,2, 1,1,2, 12, 9, 1, 0, 8, 2,14,0,0, 2,1,0 });
-	_create_ma3_voice("midi.lead6", "Voice Ld",  { 5,0,  6, 4, 0, 0, 0,15,13,0,0, 7,0,0,  0, 7, 3, 0, 8, 6,19,0,0, 2,0,0,  8, 7,15, 0, 9, 0,28,0,1, 1,0,1,  0, 7,15, 0, 8, 0, 2,0,0, 1,0,0 });
-	_create_ma3_voice("midi.lead7", "Fifth Ld",  { 7,0, 24,12, 1, 1, 8, 1,21,0,0, 1,0,2,  0,12, 1, 1, 6, 2,15,0,0, 1,1,2,  0,12, 0, 0, 8, 0,26,0,0, 2,4,2, 16,12, 1, 1, 8, 1, 6,0,0, 3,1,2 });
-	_create_ma3_voice("midi.lead8", "Bass &Ld",  { 5,0,  1,11, 2, 0, 3, 0,22,0,0, 1,0,0, 16,10, 2, 0, 9, 0,17,0,0, 1,0,0,  0,12, 3, 4, 4, 5,11,0,2, 1,0,0,  0,13, 3, 0, 9, 6,12,0,0, 1,0,0 });
-
-	_create_ma3_voice("midi.pad1",  "NewAgePd",  { 5,5,  1,15,15, 3, 3, 0,38,1,0, 7,0,2,  0,15, 7, 4, 4, 0,11,0,2, 5,0,2,  1, 6, 1, 0, 1, 0,24,0,2, 1,7,0,  0, 8, 1, 0, 5, 1, 0,0,2, 1,0,0 });
-	_create_ma3_voice("midi.pad2",  "Warm Pad",  { 5,7,  0,10, 0, 0, 5, 0,40,0,0, 1,1,0,  0, 3, 0, 0, 4, 0, 2,0,0, 1,0,0,  0,10, 0, 0, 3, 0,47,0,0, 1,3,0,  0, 3, 0, 0, 4, 0, 2,0,0, 1,2,0 });
-	_create_ma3_voice("midi.pad3",  "PolySyPd",  { 5,0,  3, 6, 5, 0, 4, 1,34,0,0, 1,7,0,  0,10, 5, 0, 6, 1, 2,0,2, 2,6,0, 27, 6, 3, 0, 3, 1,34,0,0, 1,0,0,  8, 9, 3, 0, 5, 0, 0,0,2, 1,2,0 });
-	_create_ma3_voice("midi.pad4",  "ChoirPad",  { 5,2,  8,10, 0, 0, 0,15,33,0,0, 1,7,2,  0, 4, 3, 0, 7, 3,22,0,2, 8,0,0,  0, 7, 3, 0, 3, 0,33,0,1, 1,0,0,  0, 6,15, 0, 5, 0, 0,0,0, 2,3,0 });
-	_create_ma3_voice("midi.pad5",  "BowedPad",  { 5,4,  0, 2, 1, 0, 3, 4,42,0,2, 7,0,0,  0, 6, 2, 0, 5, 3, 0,0,0, 1,0,0,  0, 2, 1, 0, 3, 4,42,0,2, 7,1,0,  0, 6, 2, 0, 5, 3, 0,0,0, 1,2,0 });
-	_create_ma3_voice("midi.pad6",  "MetalPad",  { 5,6, 10,15, 2, 0, 3, 0,23,1,2, 1,0,0,  0, 5, 6, 0, 4, 0, 3,0,2, 1,5,0,  0,15, 6, 0, 3, 3, 7,1,1, 1,0,0,  0, 5, 7, 0, 4, 0, 4,0,1, 1,1,0 });
-	_create_ma3_voice("midi.pad7",  "Halo Pad",  { 5,6,  0, 4, 1, 0, 3, 1,37,0,0, 1,5,2,  0, 6, 2, 0, 5, 0, 0,0,2, 1,7,0,  0,12, 5, 0, 4, 1,30,0,0, 1,3,2,  0, 8, 2, 0, 5, 0, 0,0,2, 1,0,0 });
-	_create_ma3_voice("midi.pad8",  "SweepPad",  { 5,0,  0, 4, 8, 0, 3, 0,30,0,0, 1,5,0,  0, 3, 8, 0, 4, 0, 0,0,2, 1,3,0,  0, 3, 1, 0, 4, 0,34,0,2, 2,2,0,  0, 7, 2, 0, 5, 0, 0,0,2, 1,7,0 });
-
-	_create_ma3_voice("midi.fx1", "Rain",      { 5,1,  0,15, 8, 0, 6, 8, 2,1,3,10,0,2, 16, 8, 5, 1, 2, 0, 0,1,0, 1,0,3,  0,15, 8, 0, 6, 8, 2,1,3,10,2,2, 16, 8, 5, 1, 2, 0, 0,1,0, 1,3,2 });
-	_create_ma3_voice("midi.fx2", "SoundTrk",  { 5,3,  0, 6, 3, 0, 3, 3,18,0,2, 3,0,0,  0, 4, 2, 0, 4, 0, 9,0,1, 3,0,0, 16, 6, 3, 0, 3, 3,16,0,0, 1,0,0,  0, 4, 1, 0, 4, 1, 3,0,2, 1,0,0 });
-	_create_ma3_voice("midi.fx3", "Crystal",   { 5,5,  0,15, 8, 1, 5, 4,20,0,1, 6,0,2,  0,12, 2, 2, 4, 7, 9,0,0, 1,0,2,  0,15, 8, 1, 5, 4,20,0,1,14,2,2,  0,12, 2, 2, 4, 7, 9,0,0, 1,2,2 });
-	_create_ma3_voice("midi.fx4", "Atmosphr",  { 5,4, 20, 6, 3, 2, 4,15,21,0,1, 1,0,0,  0,15, 3, 0, 4, 3, 0,0,0, 1,0,0, 20,12, 3, 0, 4,15,16,0,1, 2,3,0,  0, 9, 6, 5, 4, 3,12,0,0, 2,7,0 });
-	_create_ma3_voice("midi.fx5", "Bright",    { 2,0, 11,15, 1, 1, 4, 5, 7,0,2, 1,3,0,  9,15, 2, 5, 4,15, 7,0,0, 1,3,0, 11,15, 1, 1, 4, 5, 7,0,2, 1,1,0,  9,15, 2, 5, 4,15, 7,0,0, 1,1,0 });
-	_create_ma3_voice("midi.fx6", "Goblins",   { 5,4, 13, 1, 1, 0, 1, 2,18,0,2, 3,7,2,  0, 2, 1, 0, 4, 1, 9,0,2, 3,0,0,  0, 2, 1, 0, 2, 0,20,0,0, 1,0,2,  0, 3, 1, 0, 3, 0, 3,0,2, 1,4,2 });
-	_create_ma3_voice("midi.fx7", "Echoes",    { 5,0,  0, 4, 3, 0, 0, 5,34,0,0, 2,0,0,  0,10, 2, 0,12, 0,14,0,2, 1,0,0, 16, 3, 3, 0, 2, 2,35,0,0, 1,0,1,  0,10,15, 0, 3, 0, 0,0,0, 1,0,0 });
-	_create_ma3_voice("midi.fx8", "Sci-Fi",    { 5,2,  1, 5, 3, 0, 3, 8,25,0,1, 2,0,0,  4, 6, 1, 1, 4, 2, 6,0,0, 1,7,0,  1, 5, 3, 0, 3, 8,25,0,1, 2,3,0,  4, 6, 1, 1, 4, 2, 6,0,0, 1,3,0 });
-
-	_create_ma3_voice("midi.world1",  "Sitar",     { 5,3,  0,13, 2, 3, 2, 5,10,0,2, 2,0,2,  9,15, 2, 6, 4,15, 8,0,0, 7,0,2,  8,13, 2, 3, 2, 5, 3,0,2, 1,1,2, 17,15, 2, 6, 4,15, 8,0,0, 4,1,2 });
-	_create_ma3_voice("midi.world2",  "Banjo",     { 5,0,  4,13, 3, 2, 1, 1,10,1,0, 1,0,0,  0,13, 3, 3, 5,14, 0,1,2, 3,0,0,  1,15, 7, 4, 2, 1,15,0,0, 6,0,0,  1,15, 7, 8, 8,14, 0,0,2, 1,0,0 });
-	_create_ma3_voice("midi.world3",  "Shamisen",  { 3,4,  8,15, 1, 1, 3, 2,26,0,0, 1,0,2,  0,15,10, 5, 6, 7,20,0,0, 3,0,2, 16,15, 8, 3, 3, 3,24,0,0, 5,0,2,  8,15, 4, 4, 4,15, 1,1,0, 3,0,2 });
-	_create_ma3_voice("midi.world4",  "Koto",      { 3,6,  8,15, 7, 5, 5, 2,20,0,2, 3,0,0, 16,15, 9, 8, 8, 4,21,0,2, 5,0,0,  0,15, 2, 2, 3,15,42,0,0, 1,0,0,  0,15, 2, 2, 2,15, 3,1,0, 1,0,2 });
-	_create_ma3_voice("midi.world5",  "Kalimba",   { 5,6,  4,15,10, 5, 6,10, 8,0,1, 4,3,2,  0,12, 2, 3, 5, 0, 8,0,0, 1,0,2,  0,15, 8, 5, 6,10,14,0,1, 5,2,2,  0,12, 2, 4, 4, 0, 8,1,0, 1,4,2 });
-	_create_ma3_voice("midi.world6",  "Bagpipe",   { 5,1,  9,11, 9, 0,12, 1,16,0,2, 1,0,2,  8, 7,15, 0,13, 0,11,0,0, 3,1,2,  0,10, 9, 0, 9, 3, 0,0,0, 1,0,2,  1, 8, 6, 0,13, 0,10,0,0, 4,0,2 });
-	_create_ma3_voice("midi.world7",  "Fiddle",    { 5,2,  1, 8, 9, 0, 3, 1, 7,1,2, 1,0,0,  0, 6, 6, 0, 7, 2, 0,0,0, 1,0,2,  4,12, 6, 7, 7, 0, 9,1,1, 2,0,0,  0, 9, 3, 7, 8,14,25,0,2, 1,0,0 });
-	_create_ma3_voice("midi.world8",  "Shanai",    { 5,0,  5,10, 0, 0, 4, 0,16,0,2, 1,0,0,  0, 9, 1, 1, 9, 0,13,0,0, 6,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 0,10, 0,15,0,0, 2,0,0 });
-
-	_create_ma3_voice("midi.percus1",  "TnklBell",  { 5,3,  0,15, 6, 3, 4, 5,16,0,1,14,0,2,  0,12, 6, 7, 6,14,11,0,2, 2,0,2,  1,12, 6, 2, 2, 5,30,0,0, 7,7,2,  0,15, 5, 4, 5,13, 1,0,0, 6,0,2 });
-	_create_ma3_voice("midi.percus2",  "Agogo",     { 5,1,  0,14,10, 4, 4, 2,23,0,0, 7,0,2,  0,15, 7, 6, 6, 1, 8,0,0, 5,0,2,  0,14, 9, 6, 4, 2,33,0,0,10,7,2,  0,15, 7, 6, 6, 7, 4,0,0, 2,0,2 });
-	_create_ma3_voice("midi.percus3",  "SteelDrm",  { 7,0, 16, 4, 4, 4, 5, 2, 0,1,0, 2,0,2,  0, 6, 6, 3, 4, 0,22,0,0, 2,0,2,  0,14, 4, 4, 4, 2, 0,1,0, 2,0,2,  2,15, 4, 4, 4, 2, 0,1,0, 0,3,0 });
-	_create_ma3_voice("midi.percus4",  "WoodBlok",  { 5,5,  0,15,10, 9, 9, 2,33,1,2, 5,1,2,  0,15,10, 7, 7, 2, 0,1,0, 2,3,2,  0,15,10,10, 8, 2,28,0,0,10,3,2,  0,15,10, 7, 7, 2, 0,0,0, 2,0,2 });
-	_create_ma3_voice("midi.percus5",  "TaikoDrm",  { 4,7,  4,15,11, 4, 3, 5,24,0,0, 0,0,0,  0,15,12,10, 3, 1,19,0,0, 4,0,0,  0,15,12, 4, 3, 4,11,0,0, 3,0,0,  0,15,14, 5, 5, 0, 0,0,0, 0,0,0 });
-	_create_ma3_voice("midi.percus6",  "MelodTom",  { 5,7,  4,15, 9, 8, 8, 5,14,0,2, 1,0,2,  0,15, 3, 5, 5,14, 0,0,0, 0,0,2,  1,15, 3, 4, 4, 5,12,1,2, 0,0,2,  0,15, 4, 4, 4,14, 0,1,0, 0,0,2 });
-	_create_ma3_voice("midi.percus7",  "Syn.Drum",  { 5,2, 12,14,11, 8,10, 2, 0,1,0, 0,7,0,  0,12, 3, 0, 4,15, 0,1,0, 0,0,0, 24,15, 4, 0, 4, 7, 0,0,0, 0,0,2, 22,15, 7, 0, 7,15, 0,0,0, 0,0,2 });
-	_create_ma3_voice("midi.percus8",  "RevCymbl",  { 5,7,  0, 4,15, 0, 0, 0, 0,0,0,14,0,2,  8, 2,15,15,15,15, 6,0,0, 9,0,1,  0, 4,15, 0, 0, 0, 0,0,0,14,0,2,  3, 2,15,15,15,15, 6,0,0,14,0,2 });
-
-	_create_ma3_voice("midi.se1",  "FretNoiz",  { 5,7,  8,15, 8, 4, 6, 2, 0,0,2, 6,0,2,  2, 8, 6, 4,10, 8,15,0,2, 3,0,2, 10,15, 6, 2, 6, 2, 0,0,0, 6,0,2,  2, 8, 8, 8,10, 8, 0,0,2, 6,0,2 });
-	_create_ma3_voice("midi.se2",  "BrthNoiz",  { 5,7,  2,10,12, 0, 5, 1,14,0,0, 5,0,0,  0, 7, 8, 8, 9,15, 5,0,0, 1,0,0,  0,10,12, 0, 5, 1, 9,0,0, 8,0,0,  0, 8, 8, 7, 9,15,12,0,0, 1,0,0 });
-	_create_ma3_voice("midi.se3",  "Seashore",  { 3,7,  0,15,15, 0, 0, 0, 4,0,0, 3,0,0,  4,15, 2, 2, 2,15,21,0,0, 0,0,0,  1,15, 0, 4, 4,15,12,0,0, 0,0,0,  0, 1, 2, 4, 4,15, 0,0,0, 0,0,0 });
-	_create_ma3_voice("midi.se4",  "Tweet",     { 5,0,  0, 3, 7, 3, 3,10,21,1,2, 5,0,2,  0, 5, 6, 7, 7, 3, 0,1,1,10,0,2,  0, 3, 7, 3, 3,10,21,1,2, 5,0,2,  0, 5, 6, 4, 4, 3, 0,1,1,10,7,3 });
-	_create_ma3_voice("midi.se5",  "Telphone",  { 5,5,  2,11, 2, 0, 0, 6,28,1,1, 5,0,2,  0,15, 4, 3, 3, 1, 3,1,0, 4,0,2,  2,11, 2, 0, 0, 6,28,1,1, 5,0,2,  0,15, 4, 3, 3, 1,15,1,0, 4,7,2 });
-	_create_ma3_voice("midi.se6",  "Helicptr",  { 5,5, 14,15, 6, 0, 0, 0, 1,0,0,15,0,2,  0, 2, 0, 0, 5, 0, 4,0,0, 0,0,2, 14,15, 0, 0, 0, 0,24,0,0, 0,0,2,  0, 2, 0, 0, 5, 0,11,0,0, 0,0,2 });
-	_create_ma3_voice("midi.se7",  "Applause",  { 5,7, 24,15,12, 0, 1, 0, 0,0,0, 0,0,0,  0, 4, 2, 0, 5, 0, 8,0,0, 0,0,0, 24, 6, 0, 0, 1,15, 0,0,0, 9,0,1,  0, 3, 0, 7, 7,15, 7,0,0, 3,0,0 });
-	_create_ma3_voice("midi.se8",  "Gunshot",   { 5,7,  0,15, 3, 0, 0,15,11,0,0, 5,0,0,  6,15, 6, 8, 8,11, 4,0,0,15,0,0,  1,15, 2, 0, 0,15, 2,0,0, 5,0,0,  6,15, 6, 8, 8,11,26,0,0, 5,0,0 });
+	static const FMPreset midi_presets[] = {
+		{ "midi.piano1",  "GrandPno",  { 3,0,  8,15, 7, 0, 6,15,39,0,1, 1,0,0,  0,14, 3, 2, 3, 2,28,1,3, 5,0,0,  0,13, 1, 1, 4, 3,22,0,0, 1,0,0,  0,13, 3, 2, 6, 4, 0,1,2, 1,0,0 } },
+		{ "midi.piano2",  "BritePno",  { 3,0,  0,15, 2, 2, 2, 5,39,1,2, 1,0,0,  0,15, 2, 2, 3,15,28,0,2, 5,0,0,  0,15, 2, 2, 2,13,25,1,2, 1,0,0,  0,15, 2, 1, 5, 4,10,1,0, 1,0,0 } },
+		{ "midi.piano3",  "E.GrandP",  { 5,6,  0,13, 2, 2, 4, 6,20,1,1, 4,0,0,  0,13, 1, 1, 6, 7, 8,1,2, 1,0,0,  0,13, 3, 3, 4,14,11,1,1, 2,0,0,  0,13, 1, 1, 5,15, 8,1,2, 2,0,0 } },
+		{ "midi.piano4",  "HnkyTonk",  { 5,6,  0,15, 1, 2, 5,14,26,1,0, 1,3,2,  0,13, 3, 2,10, 3, 2,1,2, 2,7,2,  0,12, 1, 2, 5, 3,23,0,0, 1,7,0,  0,13, 3, 3,10, 3, 2,1,2, 2,3,2 } },
+		{ "midi.piano5",  "E.Piano1",  { 3,1,  0,11, 3, 2,10, 3,27,1,1, 3,0,1,  0,11, 2, 2, 9, 4,27,0,3, 3,0,0,  0,10, 4, 1, 4, 1,19,1,1, 2,0,0,  0,10, 1, 1, 7, 8, 5,1,0, 1,0,1 } },
+		{ "midi.piano6",  "E.Piano2",  { 5,5, 18,15, 4, 5,12,11,35,1,0, 7,0,2,  0,15, 2, 1, 8,15, 4,0,2, 1,0,2,  0,15, 0, 1,11, 1,18,1,1, 1,0,2,  0,15, 2, 1, 7,15, 4,1,0, 1,0,2 } },
+		{ "midi.piano7",  "Harpsi.",   { 6,4,  4,14, 2, 2, 5, 0, 0,1,1, 1,0,0,  3,15, 2, 0, 5, 3,20,1,3, 6,0,0,  4,15, 3, 0, 1, 6,28,1,2, 7,0,0,  5,14, 2, 2, 7,15, 4,1,0, 1,0,0 } },
+		{ "midi.piano8",  "Clavi.",    { 3,5,  5,15, 1, 1, 6,15,24,0,0, 1,0,2,  0,15, 1, 1, 5, 0,29,0,0, 1,0,2,  4,15, 3, 3, 7, 2,27,1,1, 7,0,2,  0,15, 2, 2, 9, 2, 8,1,0, 3,0,2 } },
+
+		{ "midi.chrom1",  "Celesta",   { 5,2,  2,14, 6, 6, 5,15,21,1,2, 9,0,0,  0,13, 4, 4, 4,14, 6,0,0, 1,0,0,  5,14, 6, 6, 6,12,22,1,3,11,0,0,  0,14, 4, 4, 4,14, 6,0,0, 1,0,0 } },
+		{ "midi.chrom2",  "Glocken",   { 7,0,  0,15, 9, 3, 4, 4, 9,1,0, 7,0,2,  0,15,11, 2, 3,11,15,1,0, 4,0,2,  0,15, 3, 2, 4, 4,18,1,1, 2,0,2,  0,15, 4, 3, 4,14, 4,0,0, 1,0,2 } },
+		{ "midi.chrom3",  "MusicBox",  { 5,0,  1, 5, 5, 2, 2, 0,32,1,2, 2,0,0,  0,15, 4, 3, 2, 0, 1,1,1, 1,3,0,  1,10, 5, 2, 2, 0,28,1,0, 9,0,0,  0,15, 2, 1, 1, 0, 6,1,0, 1,7,0 } },
+		{ "midi.chrom4",  "Vibes",     { 5,0,  0,12, 4, 2, 4, 2,23,0,0, 7,0,2,  0,13, 9, 2, 5, 6, 7,1,2, 4,0,2,  0,12, 4, 2, 3, 2,30,1,0, 8,0,2,  0,13, 2, 3, 4,15, 7,0,0, 1,0,1 } },
+		{ "midi.chrom5",  "Marimba",   { 5,7,  0,10, 7, 4, 4,15,40,1,1,12,0,0,  0,11, 4, 4, 5,15, 5,0,0, 1,0,0,  0,11, 7, 6, 4,15,33,1,0, 6,0,0,  0,13, 4, 5, 5,15, 5,1,0, 1,0,0 } },
+		{ "midi.chrom6",  "Xylophon",  { 5,2,  0,15, 9, 6, 6,13,24,0,2, 5,0,0,  0,15, 7, 5, 7,13, 3,0,0, 1,0,0,  0,15, 6, 6, 6,10,29,1,2, 5,0,0,  0,15, 6, 6, 7,14, 0,0,2, 1,0,0 } },
+		{ "midi.chrom7",  "TubulBel",  { 5,0, 16,15, 4, 3, 3, 5,16,0,1,10,0,1,  0,15, 3, 2, 3, 2, 5,0,0, 1,0,0,  8,15, 4, 3, 3, 5,16,0,1, 7,3,1,  0,15, 3, 2, 3, 2, 5,0,2, 2,7,0 } },
+		{ "midi.chrom8",  "Dulcimer",  { 6,3,  1,14,10, 4, 4,12, 6,0,2, 2,0,0,  1,11, 3, 3, 3, 5,20,0,1, 3,0,0,  0,13, 3, 3, 3, 0,10,0,0, 1,0,0,  0,12, 4, 4, 4, 6, 6,0,0, 1,0,0 } },
+
+		{ "midi.organ1",  "DrawOrgn",  { 2,0,  0,15, 4, 0,12, 0, 0,0,2, 0,0,1,  4,15, 5, 0,12, 0, 0,0,1, 1,0,0,  9,13, 5, 0,12, 1, 7,0,2, 3,1,1,  4,15, 1, 0,12, 0, 7,0,2, 2,0,1 } },
+		{ "midi.organ2",  "PercOrgn",  { 7,4,  0,14, 5, 0,10, 1, 3,0,2, 0,2,2,  0,13, 8, 0, 0, 5,29,0,0, 2,0,0,  0,14, 5, 0,10, 1, 1,0,2, 1,3,0,  0,14, 6, 0,10, 0, 1,0,2, 2,7,0 } },
+		{ "midi.organ3",  "RockOrgn",  { 7,4,  0,15,15, 0,13, 0, 9,0,1, 1,3,3, 21,11,15, 0,10, 1, 5,0,1, 1,0,2,  0,15,15, 0,14, 0, 9,0,0, 2,6,0, 17,15,15, 0,14, 0, 9,0,0, 0,7,1 } },
+		{ "midi.organ4",  "ChrchOrg",  { 7,0,  0, 9,15, 0, 5, 0,19,0,2, 3,0,0,  0,11, 7, 0, 2, 2,29,0,0, 7,0,0,  0, 8,15, 0, 5, 0, 4,0,2, 1,0,0,  5, 8, 7, 0, 5, 0, 4,0,2, 0,0,0 } },
+		{ "midi.organ5",  "ReedOrgn",  { 5,3, 16, 7, 8, 0, 5, 1,24,1,2, 2,0,0,  0, 5,15, 0, 6, 0, 0,1,2, 1,0,0,  5, 6,12, 0, 5, 3,10,1,1, 1,0,0,  0, 5,15, 0, 7, 0, 0,1,1, 2,0,0 } },
+		{ "midi.organ6",  "Acordion",  { 5,2, 17, 8, 2, 0, 0, 1,21,0,0, 3,6,0,  0, 7, 2, 0,10, 2, 2,0,1, 1,7,0, 17, 6,15, 0, 0, 1,18,0,0, 1,2,0,  0, 7,15, 0,10, 0, 7,0,2, 2,3,0 } },
+		{ "midi.organ7",  "Harmnica",  { 4,0,  0,15,15, 0, 9, 0,44,0,3,14,0,0,  0,15,15, 0, 8, 0,41,0,0,10,0,0,  0,15,15, 0, 8, 0,36,0,0, 1,0,0,  0, 6,15, 0, 8, 0, 3,0,2, 2,0,0 } },
+		{ "midi.organ8",  "TangoAcd",  { 5,4, 12, 7,12, 0, 0, 0,15,0,0, 2,1,1,  0, 7, 2, 0,10, 0,10,0,2, 2,1,0,  5, 7,15, 0, 0, 0,20,0,0, 1,0,0, 16, 7,15, 0,10, 0,10,0,0, 1,0,1 } },
+
+		{ "midi.guitar1", "NylonGtr",  { 5,6,  0,14, 1, 1, 4, 8,21,1,1, 1,0,0,  0,15, 3, 3, 7,15, 0,0,0, 1,0,0,  1,11, 5, 5, 5, 4,14,1,0, 3,0,0,  0,13, 4, 4, 9,15,13,0,2, 1,0,0 } },
+		{ "midi.guitar2", "SteelGtr",  { 4,4,  5,15, 7, 1, 4, 2,26,0,2, 9,0,2,  0,15, 3, 1, 8, 5,45,1,2,13,0,2,  0,15, 2, 1, 4, 1,23,1,2, 1,0,2,  0,13, 3, 2, 8,15, 4,0,0, 1,0,1 } },
+		{ "midi.guitar3", "Jazz Gtr",  { 3,0,  0,15, 7, 1, 7, 3,17,1,1, 1,0,2,  0,15, 5, 1, 4, 2,18,0,3, 5,0,2,  0,15, 2, 0, 7,15,31,0,1, 3,0,2,  0,12, 2, 0, 8,15, 4,0,0, 1,0,2 } },
+		{ "midi.guitar4", "CleanGtr",  { 5,0,  1,15,10, 2, 2, 1,15,0,1, 1,0,0,  0,15, 2, 2, 9,15, 3,0,2, 1,0,0,  4,15, 2, 2, 3, 6,16,1,1, 3,0,0,  0,14, 4, 4, 8, 6, 3,0,2, 1,0,0 } },
+		{ "midi.guitar5", "Mute.Gtr",  { 5,7,  0,13, 8, 6, 7, 7,17,1,0, 0,0,0,  0,14, 9, 3, 9, 7, 0,0,0, 0,0,0,  0,14, 3, 3, 8, 9, 4,0,3, 1,0,0,  0,11, 4, 3,10, 3, 0,1,0, 1,0,0 } },
+		{ "midi.guitar6", "Ovrdrive",  { 4,2, 12,15, 8, 0, 2,15,19,1,0, 0,7,2,  0,12, 1, 0, 1, 1,15,0,1, 2,3,2,  0,11, 2, 0,10, 1,15,0,0, 1,0,2,  0,11, 1, 1,10, 1,10,0,0, 2,0,2 } },
+		{ "midi.guitar7", "Dist.Gtr",  { 4,4,  3,11,12, 0, 2, 0, 8,0,1, 2,0,0,  0,12, 5, 0,10, 1,29,0,0, 1,0,0,  8,12, 5, 0,10, 1,23,0,0, 2,0,0,  6,12, 1, 0,10, 5,15,0,0, 1,0,0 } },
+		{ "midi.guitar8", "GtrHarmo",  { 5,5,  8,15, 2, 8, 7, 0,22,0,1, 0,0,0,  8,13, 3, 3, 9,15, 6,0,0, 2,0,0,  0,11, 2, 8, 7, 0,17,0,0, 0,0,0,  6,10, 7, 7, 7,15,13,0,0, 2,0,0 } },
+
+		{ "midi.bass1",   "Aco.Bass",  { 5,3,  0,11, 3, 3, 8,10,14,1,1, 1,0,0,  0,12, 3, 3, 8,11, 0,0,0, 1,0,0,  0, 9, 3, 3, 1, 1, 7,0,3, 1,0,0,  0,12, 3, 3, 8,10, 5,0,0, 1,0,0 } },
+		{ "midi.bass2",   "FngrBass",  { 3,6,  0,10, 2, 1, 3, 1,28,1,2, 1,0,2,  0, 9, 4, 3, 6, 4,58,1,0,12,0,2,  0,11, 3, 2, 3, 2,22,1,2, 1,0,2,  0,11, 1, 1, 8, 2, 0,1,0, 2,0,2 } },
+		{ "midi.bass3",   "PickBass",  { 3,5,  0,15, 7, 2, 3, 1,19,1,2, 1,0,2,  0,12,11, 4, 6, 7,21,1,0, 7,0,2,  0,15, 9, 2, 6, 2,23,1,2, 2,0,2,  0,11, 2, 6, 8, 6, 0,1,0, 1,0,2 } },
+		{ "midi.bass4",   "Fretless",  { 3,4,  0,12, 3, 2, 3, 1,29,1,2, 1,2,2,  0,10, 3, 3, 6, 3,25,1,2, 1,1,2,  0, 9, 3, 2, 6, 1,25,1,2, 1,0,2,  0,11, 1, 2, 8, 2, 0,1,0, 2,0,2 } },
+		{ "midi.bass5",   "SlapBas1",  { 3,3,  0,15, 7, 2, 3, 2,14,1,2, 1,0,2,  0,15, 6, 6, 6, 4,21,1,0, 9,0,2,  0,12, 9, 2, 6, 2,24,1,2, 1,0,2,  0,15, 2,15, 8,15, 3,1,0, 1,0,2 } },
+		{ "midi.bass6",   "SlapBas2",  { 3,2,  0,15, 7, 2, 3, 1,14,1,2, 1,0,2,  0,11, 5, 6, 7, 2,18,0,0,13,0,2,  0, 9, 9, 2, 6, 2,30,1,2, 1,0,2,  0,15, 2, 6, 8, 6, 6,1,0, 1,0,2 } },
+		{ "midi.bass7",   "SynBass1",  { 3,5,  0,14, 6, 2, 8, 5,14,0,0, 1,0,0,  8,14, 4, 1, 8, 6,39,0,1, 2,0,0,  0,14, 2, 1, 8, 6,35,0,0, 1,0,0,  0,14, 2, 2, 8, 9, 0,0,0, 1,0,0 } },
+		{ "midi.bass8",   "SynBass2",  { 5,6,  0,15, 5, 7, 8, 6,20,0,0, 2,0,2,  0,15, 1, 7, 8,12, 0,0,1, 2,0,2,  0,15, 3, 7, 7, 6,20,0,0, 1,0,2,  0,15, 2, 7, 8,12, 0,0,1, 1,0,2 } },
+
+		{ "midi.strings1", "Violin",    { 5,2, 12, 6, 0, 0, 3, 0,18,1,2, 1,0,0,  0, 6, 4, 0, 7, 2, 3,0,0, 1,5,0,  6,14, 5, 7,10, 0, 6,1,1, 4,0,0,  0, 6, 7, 7, 7,15, 3,0,2, 1,1,0 } },
+		{ "midi.strings2", "Viola",     { 5,2,  1, 6, 0, 0, 3, 0, 9,1,2, 1,0,0,  0, 6, 6, 0, 7, 1, 3,0,0, 1,0,0,  6,14, 6, 7, 7, 0, 8,1,1, 1,0,0,  0, 6, 7, 7, 7,15, 3,0,2, 1,0,0 } },
+		{ "midi.strings3", "Cello",     { 3,4,  1,15, 6, 0, 6, 0,16,0,0, 1,0,0,  0,15, 5,15,14,15,20,0,0, 5,0,2,  0,15, 5, 0, 7, 2,45,0,0, 1,0,0,  0, 6, 3, 0, 7, 1, 1,0,2, 3,0,0 } },
+		{ "midi.strings4", "ContraBs",  { 3,6,  0,15, 6, 0, 2, 0,25,0,0, 1,0,0, 17,15, 6,15,14,15,21,0,0, 5,0,2,  0,15, 6, 0, 4, 3,27,0,0, 3,0,0,  0, 6, 3, 0, 7, 1, 0,0,2, 2,0,0 } },
+		{ "midi.strings5", "Trem.Str",  { 5,3, 20, 7, 2, 0, 3, 1,22,1,2, 1,2,0,  0, 6, 3, 0, 6, 1, 2,0,0, 2,0,1, 12, 7, 3, 0, 4, 0,22,1,1, 1,4,0,  0, 6, 3, 0, 6, 1, 2,0,0, 1,0,2 } },
+		{ "midi.strings6", "Pizz.Str",  { 5,7,  0,15,11, 5,11, 9,20,0,0, 1,0,0,  0,14, 7, 8, 7, 2, 0,0,0, 1,0,0,  8,15, 7, 6, 5,15,17,0,1, 1,0,0,  0,12, 6, 5, 6,15, 0,0,0, 1,0,0 } },
+		{ "midi.strings7", "Harp",      { 3,6,  0,15, 8, 5, 8, 4,41,0,0, 2,0,0,  0,11, 8, 7, 9, 4,33,0,0, 5,0,0,  0,11, 7, 3, 2, 4,33,0,2, 1,0,0,  0,15, 4, 2, 2, 1, 4,1,0, 1,0,2 } },
+		{ "midi.strings8", "Timpani",   { 3,3,  0,15, 8, 4, 3, 3, 4,1,1, 1,0,2,  0,15, 2, 2, 2,15,33,1,0, 0,7,2,  0,15, 7, 3, 3, 0,28,1,2, 1,0,2,  8,15, 4, 3, 3,15, 0,1,0, 0,0,2 } },
+
+		{ "midi.ensemble1", "Strings1",  { 7,2,  7, 5,10, 0, 6, 0,11,0,2, 1,1,1,  4,12, 6, 0, 6, 1,24,0,0, 2,0,0,  0, 6, 6, 0, 6, 1, 7,0,2, 1,5,0, 12, 6, 5, 0, 6, 1, 5,0,0, 2,3,1 } },
+		{ "midi.ensemble2", "Strings2",  { 7,3,  9, 6,10, 0, 5, 0, 0,0,0, 1,3,0,  2,12, 6, 0, 5, 1,23,0,0, 1,0,1,  1, 5, 6, 0, 6, 0, 0,0,2, 1,5,0, 27, 5, 5, 0, 6, 1, 7,0,0, 1,7,0 } },
+		{ "midi.ensemble3", "Syn.Str1",  { 5,0,  0, 9, 8, 0, 2, 1,27,0,0, 1,6,0,  0, 7,15, 0, 5, 0, 7,0,0, 1,3,0,  4, 9,11, 0, 2, 0,20,1,0, 1,3,0,  0, 6,15, 0, 4, 0, 0,0,1, 1,7,0 } },
+		{ "midi.ensemble4", "Syn.Str2",  { 5,5,  9, 9, 8, 0, 2, 1,19,0,0, 1,0,0,  0, 6, 6, 0, 5, 0, 6,0,0, 1,0,0, 27, 8, 8, 0, 2, 0,10,0,0, 1,0,0,  0, 5, 7, 0, 4, 3, 0,0,1, 1,0,0 } },
+		{ "midi.ensemble5", "ChoirAah",  { 5,5,  7,12, 0, 0, 0,15,19,0,0, 6,0,0,  0, 6, 3, 0, 5, 6,23,0,2, 4,0,0,  8, 7,15, 0, 3, 0,30,0,1, 1,0,0,  0, 5,15, 0, 5, 0, 0,0,0, 2,0,0 } },
+		{ "midi.ensemble6", "VoiceOoh",  { 5,7,  7,12, 0, 0, 0,15,20,1,0, 5,0,1,  0, 7, 3, 0, 5, 6,20,0,2, 4,0,0, 10, 7, 7, 0, 4, 3,26,0,2, 1,0,0,  0, 9, 1, 0, 5, 0, 0,0,0, 1,0,0 } },
+		{ "midi.ensemble7", "SynVoice",  { 5,0,  0,10, 0, 0, 4,15,22,0,0, 1,0,0,  0, 7,15, 0, 5, 1, 8,0,2, 1,0,0,  9, 9,15, 0, 4, 0,26,0,1, 1,0,0,  0, 7,15, 0, 5, 0, 0,0,2, 3,0,0 } },
+		{ "midi.ensemble8", "Orch.Hit",  { 7,5,  8,15, 4, 4, 6, 6, 0,1,0, 4,0,1,  6,12, 5, 3, 3, 1, 0,0,0, 1,0,0,  6,12, 7, 6, 6, 0, 0,0,0, 1,0,0,  6,11, 7, 7, 6, 0, 0,0,0, 0,0,0 } },
+
+		{ "midi.brass1",    "Trumpet",   { 3,6,  1, 8, 8, 0, 5, 1,20,0,0, 1,0,0,  0,10, 8, 0, 5, 4,23,0,2, 3,0,0,  0, 7, 7, 0, 6, 1,26,0,2, 1,0,0,  0, 9,15, 0, 8, 0, 6,0,0, 1,0,0 } },
+		{ "midi.brass2",    "Trombone",  { 3,7,  8, 7, 6, 0, 7, 1,28,0,0, 1,0,0,  0, 9, 8, 0, 5, 4,15,0,2, 1,0,0,  1, 6, 7, 0, 7, 1,26,0,2, 1,0,0,  0, 8,15, 0, 8, 0, 5,0,0, 1,0,0 } },
+		{ "midi.brass3",    "Tuba",      { 3,7,  8, 6, 5, 0, 6, 2,34,0,0, 1,0,0,  1,12, 8, 0,11, 4,24,0,2, 1,0,0,  1, 9, 7, 0, 9, 3,17,0,2, 1,0,0,  0, 7,15, 0, 8, 0, 0,0,0, 2,0,0 } },
+		{ "midi.brass4",    "Mute.Trp",  { 5,0, 10, 7, 0, 0, 7, 5,26,0,0, 3,0,0,  2, 9,13, 0, 9, 4, 0,0,0, 0,0,0, 17, 7, 9, 0, 6, 1,19,0,0, 5,0,0,  2, 8, 7, 0, 9, 2, 0,0,0, 1,0,0 } },
+		{ "midi.brass5",    "Fr.Horn",   { 5,0,  8, 7, 9, 0, 0, 0,16,0,3, 1,2,0,  0, 9,14, 0, 7, 0, 1,0,2, 1,7,0,  0, 6, 9, 0, 2, 1,22,0,2, 1,6,1,  8,10,14, 0, 7, 0, 1,0,2, 1,3,0 } },
+		{ "midi.brass6",    "BrasSect",  { 5,6,  0, 8, 6, 0, 2, 1,22,0,0, 1,7,2,  0, 9,15, 0, 8, 0, 8,0,0, 1,7,2, 12, 7, 7, 0, 5, 1,22,0,0, 1,0,2,  0, 9, 8, 0, 8, 0, 7,0,0, 1,0,2 } },
+		{ "midi.brass7",    "SynBras1",  { 5,6,  0, 7, 6, 0, 8, 2,16,0,0, 1,7,2,  0, 9,15, 0,10, 0,10,0,0, 1,7,2,  0, 7, 6, 0, 8, 2,16,0,0, 1,0,2,  0, 9, 8, 0,10, 0,10,0,0, 1,0,2 } },
+		{ "midi.brass8",    "SynBras2",  { 3,6,  0, 6, 3, 0, 4, 1,28,0,0, 1,0,0,  1, 9, 7, 0, 5, 7,39,0,0, 6,0,0,  8, 7, 5, 3, 3,11,35,0,0, 1,0,0,  0,15,15, 0, 7, 0, 4,0,0, 1,0,0 } },
+
+		{ "midi.reed1",     "SprnoSax",  { 3,0,  0,15, 9, 6, 6, 3,29,1,0, 3,0,0,  0, 8, 2, 0, 6, 0,26,0,0, 1,0,0,  1, 8, 5, 0, 0, 0,12,0,1, 1,0,0,  0, 8, 6, 0, 8, 1, 3,0,0, 1,0,0 } },
+		{ "midi.reed2",     "Alto Sax",  { 5,4,  1, 9, 3, 0, 0, 0,10,1,2, 1,0,2,  0, 8, 2, 0, 9, 0, 9,0,0, 1,0,2,  9, 9, 3, 0, 0, 0,13,1,2, 1,0,2,  1, 9, 2, 0, 9, 0,21,0,0, 1,0,2 } },
+		{ "midi.reed3",     "TenorSax",  { 5,3,  1, 7, 3, 0, 0, 0, 5,1,2, 1,0,2,  8, 7, 2, 0, 9, 0,15,0,0, 1,0,2,  9, 7, 3, 0, 0, 0, 8,1,2, 1,0,2,  0, 7, 2, 0, 9, 0,13,0,2, 1,0,2 } },
+		{ "midi.reed4",     "Bari.Sax",  { 5,6,  0, 7, 3, 0, 5, 0,18,1,2, 1,0,0,  0, 7, 2, 0, 8, 2, 6,1,0, 2,0,0,  2, 7, 5, 0, 1, 0,14,1,1, 2,0,0,  0, 7, 4, 0, 8, 1, 5,1,0, 1,0,0 } },
+		{ "midi.reed5",     "Oboe",      { 5,0,  5,10, 0, 0, 4, 0,30,0,2, 1,0,0,  0, 9, 1, 1, 9, 0, 9,0,0, 3,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 0,10, 0,14,0,0, 2,0,0 } },
+		{ "midi.reed6",     "Eng.Horn",  { 5,0,  5,10, 0, 0, 4, 0,34,0,2, 1,0,0,  0, 9, 1, 1, 9, 1,11,0,0, 3,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 1,10, 1,11,0,0, 2,0,0 } },
+		{ "midi.reed7",     "Bassoon",   { 5,0,  1,12, 7, 0, 0, 1,24,1,2, 1,0,0,  9, 7, 1, 0, 8, 1, 0,1,2, 3,0,0,  1,12, 7, 0, 0, 1,24,1,2, 1,0,0,  9, 7, 1, 0, 8, 1, 3,1,0, 3,1,0 } },
+		{ "midi.reed8",     "Clarinet",  { 5,7,  0, 7, 2, 0, 1, 1,37,1,2, 2,0,0,  0, 8, 2, 0, 8, 1, 3,0,0, 1,0,0,  0, 5, 2, 0, 1, 1,26,1,1, 4,0,0,  0, 7, 2, 0, 8, 1, 3,0,0, 1,0,0 } },
+
+		{ "midi.pipe1",     "Piccolo",   { 5,7,  2,10,12, 0, 7, 1,12,0,0, 5,0,0,  0, 9, 7, 0, 8,15,39,0,0, 1,0,0,  1, 8, 5, 0, 7, 1,30,0,0, 1,0,0,  0, 8, 5, 0,10, 0, 6,0,0, 1,0,0 } },
+		{ "midi.pipe2",     "Flute",     { 5,7,  0,13,10, 0, 1, 1, 7,0,0, 3,0,0,  0, 7, 8, 0,11, 3,37,0,0, 3,0,0,  0,14, 8, 0, 9, 0,39,0,0, 1,0,1, 16, 6, 5, 0,10, 0, 1,0,0, 1,0,0 } },
+		{ "midi.pipe3",     "Recorder",  { 5,7,  3, 9, 6, 7,10, 0,58,0,0, 2,0,1,  8, 8, 5, 0,10, 0, 4,0,0, 1,0,0, 24,10, 9, 6, 6, 9,15,0,0, 7,0,0,  0, 8, 5, 0,10, 0,36,0,0, 1,0,1 } },
+		{ "midi.pipe4",     "PanFlute",  { 5,7,  0,10, 0, 0, 6, 0, 0,0,1,13,0,1,  3,11,10, 1,10, 0,35,0,0,10,0,1,  0, 8,15, 0, 4, 0,44,0,0, 2,0,0,  0, 8, 0, 0, 9, 0, 5,0,0, 1,0,1 } },
+		{ "midi.pipe5",     "Bottle",    { 5,7, 10,12,12, 0, 7, 1,12,1,0, 5,0,0,  0, 7, 7, 0, 9, 6,27,0,0, 1,0,0,  8, 7, 8, 0, 8, 3,11,0,3, 2,0,1,  0, 7, 5, 0, 8, 0, 1,0,0, 1,0,0 } },
+		{ "midi.pipe6",     "Shakhchi",  { 5,7,  2,10,12, 0, 5, 1, 6,0,0, 5,0,0,  8, 6, 7, 0, 9, 5,23,0,0, 1,0,1, 18,10, 8, 0, 3, 3, 2,0,1, 0,0,2,  0, 6, 5, 0, 9, 0, 1,0,0, 1,0,0 } },
+		{ "midi.pipe7",     "Whistle",   { 2,0,  0, 6,10, 0, 6, 0, 5,0,0, 1,0,0,  0, 8, 8, 0, 7, 0, 5,0,0, 1,0,2, 17, 6,10, 9, 7, 0,44,0,0, 1,0,2,  8, 6, 8, 0, 7, 0, 5,0,0, 1,7,2 } },
+		{ "midi.pipe8",     "Ocarina",   { 5,7,  3, 8, 6, 7, 8, 0,60,0,1, 2,0,0,  0, 8, 5, 0, 9, 0, 0,0,0, 1,0,0, 24,10, 9, 6, 6, 9,15,0,0, 1,0,0,  8, 7, 5, 0,10, 0,26,0,0, 1,0,0 } },
+
+		{ "midi.lead1", "SquareLd",  { 5,0,  8,15,15, 0, 7, 4,46,0,3, 1,0,0,  8,10,15, 0,10, 0, 3,0,2, 1,0,0,  8,15,15, 0, 2, 3,38,0,3, 2,0,0,  8,10,15, 0,10, 0, 3,0,2, 1,0,0 } },
+		{ "midi.lead2", "Saw.Lead",  { 5,7,  0,15, 0, 0, 7, 0,26,0,0, 1,7,2,  8,13,15, 0, 7, 0,10,0,0, 1,7,2, 20,15,15, 0, 3, 0,20,0,1, 1,0,2,  8,14,15, 0, 8, 0,10,0,0, 1,0,2 } },
+		{ "midi.lead3", "CaliopLd",  { 5,7,  8,12, 4, 0, 7, 8, 0,0,0, 4,0,1,  8,12, 6, 0, 6, 7,20,0,1, 4,0,2,  0, 8, 6, 0, 5, 5, 3,0,1, 2,0,0, 16, 6, 4, 0, 8, 1, 2,0,0, 1,0,1 } },
+		{ "midi.lead4", "ChiffLd",   { 5,0,  8, 7, 7, 0, 2, 6, 4,0,1, 1,4,0,  8,15, 6, 0, 8, 0,11,0,0, 1,0,0,  8, 7, 7, 0, 2, 6, 3,0,1, 1,1,0,  8,15, 6, 0, 8, 0,11,0,0, 1,2,0 } },
+		{ "midi.lead5", "CharanLd",  { 5,0,  1, 9, 2, 0, 6, 2, 8,0,2, 1,4,2, 12, 9, 1, 0, 8, 2,14,0,0, 2,0,0,  1, 9, 2, 0, 6, 2,10,0,2, 1,1,2, 12, 9, 1, 0, 8, 2,14,0,0, 2,1,0 } },
+		{ "midi.lead6", "Voice Ld",  { 5,0,  6, 4, 0, 0, 0,15,13,0,0, 7,0,0,  0, 7, 3, 0, 8, 6,19,0,0, 2,0,0,  8, 7,15, 0, 9, 0,28,0,1, 1,0,1,  0, 7,15, 0, 8, 0, 2,0,0, 1,0,0 } },
+		{ "midi.lead7", "Fifth Ld",  { 7,0, 24,12, 1, 1, 8, 1,21,0,0, 1,0,2,  0,12, 1, 1, 6, 2,15,0,0, 1,1,2,  0,12, 0, 0, 8, 0,26,0,0, 2,4,2, 16,12, 1, 1, 8, 1, 6,0,0, 3,1,2 } },
+		{ "midi.lead8", "Bass &Ld",  { 5,0,  1,11, 2, 0, 3, 0,22,0,0, 1,0,0, 16,10, 2, 0, 9, 0,17,0,0, 1,0,0,  0,12, 3, 4, 4, 5,11,0,2, 1,0,0,  0,13, 3, 0, 9, 6,12,0,0, 1,0,0 } },
+
+		{ "midi.pad1",  "NewAgePd",  { 5,5,  1,15,15, 3, 3, 0,38,1,0, 7,0,2,  0,15, 7, 4, 4, 0,11,0,2, 5,0,2,  1, 6, 1, 0, 1, 0,24,0,2, 1,7,0,  0, 8, 1, 0, 5, 1, 0,0,2, 1,0,0 } },
+		{ "midi.pad2",  "Warm Pad",  { 5,7,  0,10, 0, 0, 5, 0,40,0,0, 1,1,0,  0, 3, 0, 0, 4, 0, 2,0,0, 1,0,0,  0,10, 0, 0, 3, 0,47,0,0, 1,3,0,  0, 3, 0, 0, 4, 0, 2,0,0, 1,2,0 } },
+		{ "midi.pad3",  "PolySyPd",  { 5,0,  3, 6, 5, 0, 4, 1,34,0,0, 1,7,0,  0,10, 5, 0, 6, 1, 2,0,2, 2,6,0, 27, 6, 3, 0, 3, 1,34,0,0, 1,0,0,  8, 9, 3, 0, 5, 0, 0,0,2, 1,2,0 } },
+		{ "midi.pad4",  "ChoirPad",  { 5,2,  8,10, 0, 0, 0,15,33,0,0, 1,7,2,  0, 4, 3, 0, 7, 3,22,0,2, 8,0,0,  0, 7, 3, 0, 3, 0,33,0,1, 1,0,0,  0, 6,15, 0, 5, 0, 0,0,0, 2,3,0 } },
+		{ "midi.pad5",  "BowedPad",  { 5,4,  0, 2, 1, 0, 3, 4,42,0,2, 7,0,0,  0, 6, 2, 0, 5, 3, 0,0,0, 1,0,0,  0, 2, 1, 0, 3, 4,42,0,2, 7,1,0,  0, 6, 2, 0, 5, 3, 0,0,0, 1,2,0 } },
+		{ "midi.pad6",  "MetalPad",  { 5,6, 10,15, 2, 0, 3, 0,23,1,2, 1,0,0,  0, 5, 6, 0, 4, 0, 3,0,2, 1,5,0,  0,15, 6, 0, 3, 3, 7,1,1, 1,0,0,  0, 5, 7, 0, 4, 0, 4,0,1, 1,1,0 } },
+		{ "midi.pad7",  "Halo Pad",  { 5,6,  0, 4, 1, 0, 3, 1,37,0,0, 1,5,2,  0, 6, 2, 0, 5, 0, 0,0,2, 1,7,0,  0,12, 5, 0, 4, 1,30,0,0, 1,3,2,  0, 8, 2, 0, 5, 0, 0,0,2, 1,0,0 } },
+		{ "midi.pad8",  "SweepPad",  { 5,0,  0, 4, 8, 0, 3, 0,30,0,0, 1,5,0,  0, 3, 8, 0, 4, 0, 0,0,2, 1,3,0,  0, 3, 1, 0, 4, 0,34,0,2, 2,2,0,  0, 7, 2, 0, 5, 0, 0,0,2, 1,7,0 } },
+
+		{ "midi.fx1", "Rain",      { 5,1,  0,15, 8, 0, 6, 8, 2,1,3,10,0,2, 16, 8, 5, 1, 2, 0, 0,1,0, 1,0,3,  0,15, 8, 0, 6, 8, 2,1,3,10,2,2, 16, 8, 5, 1, 2, 0, 0,1,0, 1,3,2 } },
+		{ "midi.fx2", "SoundTrk",  { 5,3,  0, 6, 3, 0, 3, 3,18,0,2, 3,0,0,  0, 4, 2, 0, 4, 0, 9,0,1, 3,0,0, 16, 6, 3, 0, 3, 3,16,0,0, 1,0,0,  0, 4, 1, 0, 4, 1, 3,0,2, 1,0,0 } },
+		{ "midi.fx3", "Crystal",   { 5,5,  0,15, 8, 1, 5, 4,20,0,1, 6,0,2,  0,12, 2, 2, 4, 7, 9,0,0, 1,0,2,  0,15, 8, 1, 5, 4,20,0,1,14,2,2,  0,12, 2, 2, 4, 7, 9,0,0, 1,2,2 } },
+		{ "midi.fx4", "Atmosphr",  { 5,4, 20, 6, 3, 2, 4,15,21,0,1, 1,0,0,  0,15, 3, 0, 4, 3, 0,0,0, 1,0,0, 20,12, 3, 0, 4,15,16,0,1, 2,3,0,  0, 9, 6, 5, 4, 3,12,0,0, 2,7,0 } },
+		{ "midi.fx5", "Bright",    { 2,0, 11,15, 1, 1, 4, 5, 7,0,2, 1,3,0,  9,15, 2, 5, 4,15, 7,0,0, 1,3,0, 11,15, 1, 1, 4, 5, 7,0,2, 1,1,0,  9,15, 2, 5, 4,15, 7,0,0, 1,1,0 } },
+		{ "midi.fx6", "Goblins",   { 5,4, 13, 1, 1, 0, 1, 2,18,0,2, 3,7,2,  0, 2, 1, 0, 4, 1, 9,0,2, 3,0,0,  0, 2, 1, 0, 2, 0,20,0,0, 1,0,2,  0, 3, 1, 0, 3, 0, 3,0,2, 1,4,2 } },
+		{ "midi.fx7", "Echoes",    { 5,0,  0, 4, 3, 0, 0, 5,34,0,0, 2,0,0,  0,10, 2, 0,12, 0,14,0,2, 1,0,0, 16, 3, 3, 0, 2, 2,35,0,0, 1,0,1,  0,10,15, 0, 3, 0, 0,0,0, 1,0,0 } },
+		{ "midi.fx8", "Sci-Fi",    { 5,2,  1, 5, 3, 0, 3, 8,25,0,1, 2,0,0,  4, 6, 1, 1, 4, 2, 6,0,0, 1,7,0,  1, 5, 3, 0, 3, 8,25,0,1, 2,3,0,  4, 6, 1, 1, 4, 2, 6,0,0, 1,3,0 } },
+
+		{ "midi.world1",  "Sitar",     { 5,3,  0,13, 2, 3, 2, 5,10,0,2, 2,0,2,  9,15, 2, 6, 4,15, 8,0,0, 7,0,2,  8,13, 2, 3, 2, 5, 3,0,2, 1,1,2, 17,15, 2, 6, 4,15, 8,0,0, 4,1,2 } },
+		{ "midi.world2",  "Banjo",     { 5,0,  4,13, 3, 2, 1, 1,10,1,0, 1,0,0,  0,13, 3, 3, 5,14, 0,1,2, 3,0,0,  1,15, 7, 4, 2, 1,15,0,0, 6,0,0,  1,15, 7, 8, 8,14, 0,0,2, 1,0,0 } },
+		{ "midi.world3",  "Shamisen",  { 3,4,  8,15, 1, 1, 3, 2,26,0,0, 1,0,2,  0,15,10, 5, 6, 7,20,0,0, 3,0,2, 16,15, 8, 3, 3, 3,24,0,0, 5,0,2,  8,15, 4, 4, 4,15, 1,1,0, 3,0,2 } },
+		{ "midi.world4",  "Koto",      { 3,6,  8,15, 7, 5, 5, 2,20,0,2, 3,0,0, 16,15, 9, 8, 8, 4,21,0,2, 5,0,0,  0,15, 2, 2, 3,15,42,0,0, 1,0,0,  0,15, 2, 2, 2,15, 3,1,0, 1,0,2 } },
+		{ "midi.world5",  "Kalimba",   { 5,6,  4,15,10, 5, 6,10, 8,0,1, 4,3,2,  0,12, 2, 3, 5, 0, 8,0,0, 1,0,2,  0,15, 8, 5, 6,10,14,0,1, 5,2,2,  0,12, 2, 4, 4, 0, 8,1,0, 1,4,2 } },
+		{ "midi.world6",  "Bagpipe",   { 5,1,  9,11, 9, 0,12, 1,16,0,2, 1,0,2,  8, 7,15, 0,13, 0,11,0,0, 3,1,2,  0,10, 9, 0, 9, 3, 0,0,0, 1,0,2,  1, 8, 6, 0,13, 0,10,0,0, 4,0,2 } },
+		{ "midi.world7",  "Fiddle",    { 5,2,  1, 8, 9, 0, 3, 1, 7,1,2, 1,0,0,  0, 6, 6, 0, 7, 2, 0,0,0, 1,0,2,  4,12, 6, 7, 7, 0, 9,1,1, 2,0,0,  0, 9, 3, 7, 8,14,25,0,2, 1,0,0 } },
+		{ "midi.world8",  "Shanai",    { 5,0,  5,10, 0, 0, 4, 0,16,0,2, 1,0,0,  0, 9, 1, 1, 9, 0,13,0,0, 6,0,0,  0,11, 0, 0, 4, 2,24,0,0, 1,0,1,  0,10, 0, 0,10, 0,15,0,0, 2,0,0 } },
+
+		{ "midi.percus1",  "TnklBell",  { 5,3,  0,15, 6, 3, 4, 5,16,0,1,14,0,2,  0,12, 6, 7, 6,14,11,0,2, 2,0,2,  1,12, 6, 2, 2, 5,30,0,0, 7,7,2,  0,15, 5, 4, 5,13, 1,0,0, 6,0,2 } },
+		{ "midi.percus2",  "Agogo",     { 5,1,  0,14,10, 4, 4, 2,23,0,0, 7,0,2,  0,15, 7, 6, 6, 1, 8,0,0, 5,0,2,  0,14, 9, 6, 4, 2,33,0,0,10,7,2,  0,15, 7, 6, 6, 7, 4,0,0, 2,0,2 } },
+		{ "midi.percus3",  "SteelDrm",  { 7,0, 16, 4, 4, 4, 5, 2, 0,1,0, 2,0,2,  0, 6, 6, 3, 4, 0,22,0,0, 2,0,2,  0,14, 4, 4, 4, 2, 0,1,0, 2,0,2,  2,15, 4, 4, 4, 2, 0,1,0, 0,3,0 } },
+		{ "midi.percus4",  "WoodBlok",  { 5,5,  0,15,10, 9, 9, 2,33,1,2, 5,1,2,  0,15,10, 7, 7, 2, 0,1,0, 2,3,2,  0,15,10,10, 8, 2,28,0,0,10,3,2,  0,15,10, 7, 7, 2, 0,0,0, 2,0,2 } },
+		{ "midi.percus5",  "TaikoDrm",  { 4,7,  4,15,11, 4, 3, 5,24,0,0, 0,0,0,  0,15,12,10, 3, 1,19,0,0, 4,0,0,  0,15,12, 4, 3, 4,11,0,0, 3,0,0,  0,15,14, 5, 5, 0, 0,0,0, 0,0,0 } },
+		{ "midi.percus6",  "MelodTom",  { 5,7,  4,15, 9, 8, 8, 5,14,0,2, 1,0,2,  0,15, 3, 5, 5,14, 0,0,0, 0,0,2,  1,15, 3, 4, 4, 5,12,1,2, 0,0,2,  0,15, 4, 4, 4,14, 0,1,0, 0,0,2 } },
+		{ "midi.percus7",  "Syn.Drum",  { 5,2, 12,14,11, 8,10, 2, 0,1,0, 0,7,0,  0,12, 3, 0, 4,15, 0,1,0, 0,0,0, 24,15, 4, 0, 4, 7, 0,0,0, 0,0,2, 22,15, 7, 0, 7,15, 0,0,0, 0,0,2 } },
+		{ "midi.percus8",  "RevCymbl",  { 5,7,  0, 4,15, 0, 0, 0, 0,0,0,14,0,2,  8, 2,15,15,15,15, 6,0,0, 9,0,1,  0, 4,15, 0, 0, 0, 0,0,0,14,0,2,  3, 2,15,15,15,15, 6,0,0,14,0,2 } },
+
+		{ "midi.se1",  "FretNoiz",  { 5,7,  8,15, 8, 4, 6, 2, 0,0,2, 6,0,2,  2, 8, 6, 4,10, 8,15,0,2, 3,0,2, 10,15, 6, 2, 6, 2, 0,0,0, 6,0,2,  2, 8, 8, 8,10, 8, 0,0,2, 6,0,2 } },
+		{ "midi.se2",  "BrthNoiz",  { 5,7,  2,10,12, 0, 5, 1,14,0,0, 5,0,0,  0, 7, 8, 8, 9,15, 5,0,0, 1,0,0,  0,10,12, 0, 5, 1, 9,0,0, 8,0,0,  0, 8, 8, 7, 9,15,12,0,0, 1,0,0 } },
+		{ "midi.se3",  "Seashore",  { 3,7,  0,15,15, 0, 0, 0, 4,0,0, 3,0,0,  4,15, 2, 2, 2,15,21,0,0, 0,0,0,  1,15, 0, 4, 4,15,12,0,0, 0,0,0,  0, 1, 2, 4, 4,15, 0,0,0, 0,0,0 } },
+		{ "midi.se4",  "Tweet",     { 5,0,  0, 3, 7, 3, 3,10,21,1,2, 5,0,2,  0, 5, 6, 7, 7, 3, 0,1,1,10,0,2,  0, 3, 7, 3, 3,10,21,1,2, 5,0,2,  0, 5, 6, 4, 4, 3, 0,1,1,10,7,3 } },
+		{ "midi.se5",  "Telphone",  { 5,5,  2,11, 2, 0, 0, 6,28,1,1, 5,0,2,  0,15, 4, 3, 3, 1, 3,1,0, 4,0,2,  2,11, 2, 0, 0, 6,28,1,1, 5,0,2,  0,15, 4, 3, 3, 1,15,1,0, 4,7,2 } },
+		{ "midi.se6",  "Helicptr",  { 5,5, 14,15, 6, 0, 0, 0, 1,0,0,15,0,2,  0, 2, 0, 0, 5, 0, 4,0,0, 0,0,2, 14,15, 0, 0, 0, 0,24,0,0, 0,0,2,  0, 2, 0, 0, 5, 0,11,0,0, 0,0,2 } },
+		{ "midi.se7",  "Applause",  { 5,7, 24,15,12, 0, 1, 0, 0,0,0, 0,0,0,  0, 4, 2, 0, 5, 0, 8,0,0, 0,0,0, 24, 6, 0, 0, 1,15, 0,0,0, 9,0,1,  0, 3, 0, 7, 7,15, 7,0,0, 3,0,0 } },
+		{ "midi.se8",  "Gunshot",   { 5,7,  0,15, 3, 0, 0,15,11,0,0, 5,0,0,  6,15, 6, 8, 8,11, 4,0,0,15,0,0,  1,15, 2, 0, 0,15, 2,0,0, 5,0,0,  6,15, 6, 8, 8,11,26,0,0, 5,0,0 } },
+	};
+	_register_fm_presets("midi", PRESET_MA3, midi_presets, std::size(midi_presets));
 }
 
 void SiONVoicePresetUtil::_generate_mididrum_voices() {
@@ -501,68 +548,70 @@ void SiONVoicePresetUtil::_generate_mididrum_voices() {
 
 	// TODO: Some standard kit drums seem to be missing?
 
-	_begin_category("midi.drum");
-	_create_ma3_voice("midi.drum24",  "Seq Click H",      { 5,6,  4,15, 0,15,15, 0,56,0,0, 6,0,2,  0,15, 8,15,15,12, 0,1,0, 5,0,2,  6,15,11,15,15,11,39,0,0,10,0,2,  0,14,11,15,15,15, 1,1,0, 5,0,2 });
-	_create_ma3_voice("midi.drum25",  "Brush Tap",        { 5,7,  0,15, 8, 0, 0, 3, 0,0,0, 5,0,2,  0, 9, 8, 8,11,11, 0,0,2, 0,0,2,  6,15, 8, 6,14, 3,36,0,0,12,0,2,  6,12,13, 8, 8, 0,44,0,2, 1,0,2 });
-	_create_ma3_voice("midi.drum26",  "Brush Swirl L",    { 5,7, 18,15, 5, 0, 6, 0, 0,0,0, 0,0,2,  3, 9, 8, 0,10, 6, 0,0,0, 0,0,3, 16,15, 0, 0,15,15, 0,0,0, 0,0,0,  0, 3, 6, 3,15, 6,21,0,0, 1,0,3 });
-	_create_ma3_voice("midi.drum27",  "Brush Slap",       { 5,7,  0,15, 0, 0, 0, 0, 0,0,0, 4,0,2, 13,12, 8, 6,12, 9, 0,0,0,14,0,2,  7,11,10, 4, 7,13, 9,0,0, 0,0,2,  0, 8, 8,11,11,13, 0,0,2, 0,0,2 });
-	_create_ma3_voice("midi.drum28",  "Brush Swirl H",    { 5,7, 18,15, 5, 0, 3, 0, 0,0,0, 5,5,2,  3, 9, 6, 0,10, 6, 0,0,0, 3,0,3, 16,15, 0, 0,15,15, 0,0,0, 9,0,0, 20, 3, 6, 3,15, 6,16,0,0, 3,0,3 });
-	_create_ma3_voice("midi.drum29",  "Snare Roll",       { 5,7,  2, 7, 0, 0, 2, 0,13,0,0, 8,3,1, 26,15, 5, 0, 9, 3, 0,0,0, 0,6,0,  0,15,10, 8, 4, 3, 8,0,0, 3,0,2,  0,14, 6, 7, 7, 5, 0,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum30",  "Castanet",         { 5,6,  1,15, 7, 5, 9,15, 2,0,0, 7,0,2,  6,10, 8, 5,15,15, 0,1,0, 5,0,2,  5,15, 5, 6, 5, 0,39,0,0, 2,0,2,  0,12,10, 9, 9,10,20,0,0, 5,0,2 });
-	_create_ma3_voice("midi.drum31",  "Snare L",          { 5,7, 24,15,12, 0, 0, 1, 9,0,0, 0,0,2,  0,15, 7, 7, 7, 3, 0,0,0, 0,0,2,  0,14,11, 7, 5,15,48,0,0, 7,0,2,  0,15,10, 6, 0, 0,28,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum32",  "Sticks",           { 6,7, 20,15, 9,12, 8, 9, 0,0,1,15,0,2,  3,13,10, 2, 8,11, 0,0,0,10,0,2,  3,13, 8, 2, 5, 5,21,0,1,11,0,2,  8,12,11, 9, 7,11, 0,0,0,13,0,2 });
-	_create_ma3_voice("midi.drum33",  "Bass Drum L",      { 5,1,  4,15,10,11, 6,15, 0,0,0, 2,0,2,  0,15, 6, 6, 5, 7,16,0,0, 2,0,2,  1,11, 9, 7, 4, 7,13,0,0, 5,0,2, 12,15, 7, 8, 5, 7, 0,0,0, 1,0,2 });
-	_create_ma3_voice("midi.drum34",  "Open Rim Shot",    { 5,7,  2,15, 0, 5, 5, 0, 5,1,0,12,0,2,  0,15, 7, 7, 7, 7, 0,1,0,11,0,2,  0,15,10, 6, 6, 8, 0,0,0,12,0,2,  2,15, 7, 7, 7, 7, 0,0,0, 7,0,2 });
-	_create_ma3_voice("midi.drum35",  "Bass Drum M",      { 5,6,  6,15,13, 7, 7,15, 0,0,0,13,0,2,  0,15, 7, 7, 4, 7, 0,0,0, 2,0,2, 10,15, 9, 7, 6, 7,19,0,0, 3,0,2, 12,15, 8,10, 6,11, 0,0,0, 2,0,2 });
-	_create_ma3_voice("midi.drum36",  "Bass Drum H",      { 5,6,  6,15,13, 7, 6,15,14,0,0,13,0,2,  0,15, 7, 7, 7, 7,12,0,0, 2,0,2,  2,15, 9, 7, 4, 7, 9,0,0, 2,0,2, 12,15, 7, 8, 6, 7, 0,0,0, 1,0,2 });
-	_create_ma3_voice("midi.drum37",  "Side Stick",       { 5,6,  1,15, 2, 0, 8, 5, 8,0,0,10,0,2,  6,13, 9, 3, 3,15, 0,1,0, 7,0,2, 18,11, 0, 0, 9,13, 0,0,0, 9,0,2, 18,13, 9,11, 9,11, 0,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum38",  "Snare M",          { 5,7, 13,15, 0, 5, 7, 0, 7,1,0,12,0,2,  0,15, 7,10, 9, 7, 0,1,0, 8,0,2,  0,15, 5, 7, 8, 6, 0,0,0,12,0,2,  2,15, 7, 7, 6, 7, 1,0,0, 7,0,2 });
-	_create_ma3_voice("midi.drum39",  "Hand Clap",        { 5,7,  0,15, 4, 4, 6, 0, 2,0,0, 0,0,2,  5,15, 6, 9, 4, 1, 0,0,0, 0,0,2, 27,15, 8, 0,15, 1, 0,0,2,13,1,2,  2,15,10, 9, 8, 5, 0,0,2,15,0,2 });
-	_create_ma3_voice("midi.drum40",  "Snare H",          { 5,7,  2,15, 1, 0, 7, 0,10,0,0,12,0,2,  0,15, 7,11, 7,13, 0,0,0,11,0,0, 28,15,10, 6, 5, 8, 9,0,0, 9,0,2, 18,15, 8,10, 6, 1, 0,0,0, 7,0,2 });
-	_create_ma3_voice("midi.drum41",  "Floor Tom L",      { 5,4,  6,13,10, 6, 6,15, 9,0,0,12,0,2,  0,15,10, 7,11, 7, 0,0,0, 5,0,2,  1,15, 3, 5, 5,15,21,0,0, 0,0,2,  0,15, 6, 5, 6, 7, 0,0,0, 5,0,2 });
-	_create_ma3_voice("midi.drum42",  "Hi-Hat Closed",    { 5,7,  0,15, 0, 0, 0, 3, 2,0,0,15,0,2,  0,11, 8,12, 8,11, 0,0,2, 0,0,2, 14,15, 3, 3,13, 3,12,0,0, 0,0,2, 11,11,10, 8,11, 0, 0,0,2,13,0,2 });
-	_create_ma3_voice("midi.drum43",  "Floor Tom H",      { 5,0,  6,12, 5, 6, 6,15, 0,0,0,12,0,2, 19,15, 9, 7,11, 7, 0,0,0,11,0,2,  1,15, 4, 4, 5,15,26,0,0, 0,0,2,  0,15, 6, 4, 6, 5, 0,0,0, 5,0,2 });
-	_create_ma3_voice("midi.drum44",  "Hi-Hat Pedal",     { 5,7,  0,15, 0, 0, 0, 3, 0,0,0,12,0,2,  0, 7, 8, 8, 8,11,15,0,2, 0,0,2, 20,15, 3, 5,14, 3, 8,0,0, 6,0,2, 11, 8, 3, 8, 8, 0, 0,0,2, 5,0,2 });
-	_create_ma3_voice("midi.drum45",  "Low Tom",          { 5,0,  6,12, 5, 6, 6,15, 1,0,0,10,0,2, 18,15, 8, 7, 9, 7, 0,0,0, 1,0,2,  1,15, 3, 5, 5,15,17,0,0, 0,0,2,  0,15, 6, 5, 5, 7, 0,0,0, 5,0,2 });
-	_create_ma3_voice("midi.drum46",  "Hi-Hat Open",      { 5,7,  0,15, 0, 0, 0, 3, 2,0,0,15,0,2,  0,11, 7, 6, 8,11, 1,0,2, 0,0,2, 14,15, 3, 3,13, 3,12,0,0, 0,0,2, 11,11, 9, 5,11, 0, 9,0,2,13,0,2 });
-	_create_ma3_voice("midi.drum47",  "Mid Tom L",        { 5,0,  6,12, 5, 6, 6,15, 0,0,0,10,0,2, 18,15, 9, 7,10, 6, 0,0,0, 8,0,2,  0,15, 4, 2, 5,15,28,0,0, 0,0,2,  0,15, 6, 5, 7, 7, 2,0,0, 4,0,2 });
-	_create_ma3_voice("midi.drum48",  "Mid Tom H",        { 5,0,  6,12, 4, 6, 5,15, 9,0,0,10,0,2, 19,15, 9, 7, 7, 7, 0,0,0, 1,0,2,  1,15, 4, 5, 5,15,39,0,0, 1,0,2,  0,15, 6, 6, 7, 7, 3,0,0, 4,0,2 });
-	_create_ma3_voice("midi.drum49",  "Crash Cymbal 1",   { 5,3, 16,15, 9, 0, 6, 0,14,0,0,13,0,2, 18, 9, 3, 4, 5, 2, 3,0,0,11,0,0,  0,11, 3, 0, 4, 0, 0,0,0,15,0,2,  6,12, 4, 5, 5, 7,13,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum50",  "High Tom",         { 5,0,  6,12, 4, 6, 7,15, 4,0,0, 8,0,2, 19,15,10, 7, 8, 7, 0,0,0, 6,0,2,  5,15, 5, 5, 6,15,50,0,0, 1,0,2,  0,12, 6, 5, 6, 7, 0,0,0, 5,0,2 });
-	_create_ma3_voice("midi.drum51",  "Ride Cymbal 1",    { 5,7,  0,15, 7, 0, 0, 4, 9,0,2,15,0,2, 14,14, 4, 4, 4,14, 3,0,0, 9,0,2,  0,15, 0, 0, 0, 4, 8,0,2,14,0,2, 11,15, 4, 2, 5,13,16,0,0,14,0,2 });
-	_create_ma3_voice("midi.drum52",  "Chinese Cymbal",   { 5,7,  0,15, 3, 7, 2, 1,31,0,0, 0,0,2, 30,14, 3, 5, 2, 0, 0,1,0, 5,0,0,  0,15, 1, 8, 3, 6,15,0,0, 2,0,2,  6, 9, 2, 5, 3, 0, 9,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum53",  "Ride Cymbal Cup",  { 5,7, 19,15, 7, 0, 0, 4,22,0,2,15,0,2, 12,15, 5, 4, 4,14, 0,0,0,15,0,2, 19,15, 0, 0, 0, 4,12,0,2,12,0,2, 11,15, 5, 2, 5,13,27,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum54",  "Tambourine",       { 5,6,  0, 8, 7, 4, 1, 2,10,0,0,11,0,2, 13,14, 7,12,11, 5, 0,0,0, 5,0,2,  8, 8, 7, 5, 2, 2, 0,0,0,11,0,2,  8,13, 7,12, 7, 6, 0,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum55",  "Splash Cymbal",    { 5,7, 25,12, 6, 3, 3, 0, 0,0,0, 8,0,0,  3, 9, 3, 4, 3,12, 0,1,0,13,0,0, 13, 5, 0, 3, 3, 0, 1,0,0, 5,0,0, 19,12, 3, 5, 8, 6, 0,1,0,15,0,0 });
-	_create_ma3_voice("midi.drum56",  "Cowbell",          { 5,4,  0,15, 9, 8, 5, 3, 0,1,2, 3,0,2,  0,10, 7, 5, 3, 3, 0,1,0, 0,0,2,  2,15,15,11, 9,10, 3,1,0, 4,0,2,  0,15,12, 5, 5, 3,32,1,0, 1,0,2 });
-	_create_ma3_voice("midi.drum57",  "Crash Cymbal 2",   { 5,7,  0,15, 6, 0, 0, 0, 0,0,2, 9,0,2,  0, 9, 4, 2, 2, 0, 0,1,0, 0,0,0,  0,15, 3, 0, 0, 0, 0,0,2,15,0,2,  2, 9, 6, 3, 4, 3, 8,0,0, 7,4,2 });
-	_create_ma3_voice("midi.drum58",  "Vibraslap",        { 5,7, 29,13, 1, 2, 6, 0, 0,0,0, 1,2,1,  8,15, 6, 5, 9, 2, 0,0,0, 0,6,0, 29,15, 5, 4, 4, 0,29,0,0, 6,0,2, 30,15, 6, 5, 4, 0, 0,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum59",  "Ride Cymbal 2",    { 5,7,  7,15, 0, 0, 6, 0, 5,0,0,14,0,3, 14,14, 5, 5, 4,11,16,0,0,15,0,2,  6,15, 0, 0, 0, 4, 7,0,2, 9,0,2, 11,15, 5, 3, 5,14, 0,0,0, 9,0,2 });
-	_create_ma3_voice("midi.drum60",  "Bongo H",          { 5,3,  0,15, 5,12,12, 0, 0,0,0, 6,0,2,  0,15, 5, 8, 7, 0, 0,0,0,11,0,2,  0,15, 5,12,12, 0, 2,0,0,15,0,2,  0,15, 4, 7, 3, 0, 0,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum61",  "Bongo L",          { 5,3,  0,15, 5,12,12, 0, 0,0,0, 6,0,2,  0,15, 5, 8, 7, 0, 7,0,0,11,0,2,  0,15, 5,12,12, 0, 6,0,0,15,0,2,  0,15, 5, 8, 3, 0, 0,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum62",  "Conga H Mute",     { 5,4,  0,14,14,10,10, 1, 6,0,0, 0,2,2,  8,15, 8, 9,10, 1, 0,0,0, 1,0,2,  0,15, 0, 0, 0, 0,44,0,0, 0,0,2,  0,15,13, 9,10, 1, 7,0,0, 0,0,2 });
-	_create_ma3_voice("midi.drum63",  "Conga H Open",     { 5,7,  3,10,10, 5, 8,12,38,0,0,10,0,2,  0,12, 6, 7, 9, 4, 0,0,0,12,0,2,  0,15,10, 6, 8, 8, 0,0,0,12,0,2,  2,15, 7, 7, 9, 7, 0,0,0, 2,0,2 });
-	_create_ma3_voice("midi.drum64",  "Conga L",          { 5,7,  3,10,10, 5, 8,12,31,0,0,10,0,2,  0,12, 5, 6, 9, 4, 0,0,0,12,0,2,  0,15,10, 6, 8, 8, 0,0,0,12,0,2, 10,15, 7, 7, 9, 7, 0,0,0, 2,0,2 });
-	_create_ma3_voice("midi.drum65",  "Timbale H",        { 3,6,  0,12, 7, 0, 8, 0,22,0,0, 2,0,2,  0,15, 9, 6, 8, 0,49,0,0, 7,0,2,  4,13, 6,10, 6, 1,26,0,0, 9,0,2,  6,15, 9, 6, 8, 0, 6,0,0, 9,0,2 });
-	_create_ma3_voice("midi.drum66",  "Timbale L",        { 3,6,  0,12, 7, 0, 8, 0,22,0,0, 2,0,2,  0,15, 9, 6, 8, 0,49,0,0, 7,0,2,  4,13, 6,10, 6, 1,23,0,0,12,0,2,  6,15, 9, 6, 8, 0, 4,0,0, 9,0,2 });
-	_create_ma3_voice("midi.drum67",  "Agogo H",          { 5,5,  0,14,12, 6, 6, 2,21,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2,  0,14,12, 6, 5, 2,26,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2 });
-	_create_ma3_voice("midi.drum68",  "Agogo L",          { 5,5,  0,14,12, 6, 6, 2,21,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2,  0,14,12, 5, 5, 2,13,0,0, 7,0,2,  0,15, 8, 6, 6, 1,29,0,0, 2,0,2 });
-	_create_ma3_voice("midi.drum69",  "Cabasa",           { 3,7,  0,15, 0, 3, 5, 6, 0,0,0, 7,0,2,  0,14, 8, 4, 4,10,24,1,0,15,0,2,  0,14, 4, 2, 6, 4, 0,0,0,15,0,2,  6, 8,11, 9, 4, 0, 2,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum70",  "Maracas",          { 4,7,  0,15, 0, 3, 5, 6, 4,0,0,15,0,2,  0, 8, 8, 4, 4, 6, 3,1,0,15,0,2,  6,12, 9, 3, 3,15, 0,0,0,15,0,2, 12, 7,10,10, 3, 8, 0,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum71",  "Samba Whistle H",  { 5,5,  1,15, 0, 0, 7, 0,10,0,0, 0,0,1,  0,12, 1, 0,12, 1,43,0,0,14,0,1,  0,15, 0, 0, 7, 0,23,0,0, 0,0,2,  0, 8, 1, 0,12, 0, 6,0,0,15,0,1 });
-	_create_ma3_voice("midi.drum72",  "Samba Whistle L",  { 5,5,  1,15, 0, 0, 7, 0,10,0,0, 0,0,1,  0,12, 1, 0,12, 1,43,0,0,14,0,1,  0,15, 0, 0, 7, 0,23,0,0, 0,0,2,  0, 8, 1, 0,12, 0, 6,0,0,15,0,1 });
-	_create_ma3_voice("midi.drum73",  "Guiro Short",      { 3,7,  1,12, 2, 6, 0, 0,12,0,0, 1,0,0,  4,12, 3, 6,10, 0, 0,0,0, 3,0,0, 11,13, 1, 0, 6, 0,32,0,0,14,5,0,  7,15, 7,12,15, 6, 0,1,0, 0,1,0 });
-	_create_ma3_voice("midi.drum74",  "Guiro Long",       { 3,7,  1,12, 2, 6, 0, 0,14,0,0, 1,0,0,  4,12, 3, 6,10, 0, 0,0,0, 3,0,0, 11,15, 0, 0, 6, 0,32,0,0,13,0,0,  7, 9, 6,14,12, 6, 5,0,0, 0,2,0 });
-	_create_ma3_voice("midi.drum75",  "Claves",           { 4,0,  0,13, 7, 6, 6,10,11,0,0, 7,0,2,  0,15,14,11, 3,10,13,0,0, 7,0,2,  0,15,11, 8, 0,12, 0,1,0, 0,0,2,  8,15, 3, 8, 8, 0, 0,1,0,15,0,2 });
-	_create_ma3_voice("midi.drum76",  "Wood Block H",     { 4,0,  0,14, 6, 6, 6,10,63,0,0,15,0,2,  0,15, 6, 6, 5,11, 0,0,0, 6,0,2,  2,13,12, 0,10,12, 0,1,0, 7,0,2,  8,15, 7,12, 7, 4, 0,1,0, 3,0,2 });
-	_create_ma3_voice("midi.drum77",  "Wood Block L",     { 4,0,  0,14, 6, 6, 6,10,63,0,0,15,0,2,  0,15, 6, 6, 5,11, 0,0,0, 6,0,2,  2,15,10, 0,10,12,16,1,0,10,0,2, 16,12, 7,12,12, 4, 0,1,0, 3,0,2 });
-	_create_ma3_voice("midi.drum78",  "Cuica Mute",       { 5,0,  0,13,10,12,13,11,15,0,2, 0,0,2,  0, 6, 0, 6, 5, 0, 6,0,0, 6,0,2,  0,15, 8, 8,12, 0,14,0,0, 0,0,2,  0, 6, 0, 7, 7, 0, 2,0,0, 6,0,2 });
-	_create_ma3_voice("midi.drum79",  "Cuica Open",       { 5,1, 16, 9, 8,15, 8,15,12,0,0, 0,0,0,  8, 7, 6, 8, 8, 4, 0,0,0,14,0,0,  0,15, 7, 0, 0, 0,36,0,0, 2,0,2,  0,13, 7,11,11,12,18,0,0,11,0,2 });
-	_create_ma3_voice("midi.drum80",  "Triangle Mute",    { 7,0, 22,15,12, 8, 4, 0, 5,0,0, 9,0,2,  4,11, 5, 9, 5, 6, 0,0,0,15,0,2,  6,15,11,12, 7, 3, 7,0,0,14,0,2,  0,14,13, 8,11,15, 6,0,0, 6,0,2 });
-	_create_ma3_voice("midi.drum81",  "Triangle Open",    { 7,0, 22,15, 5, 5, 4, 0, 3,0,0, 9,0,2,  4,11, 5, 9, 5, 6, 0,0,0,15,0,2,  6,15, 9, 9, 7, 3, 8,0,0,14,0,2,  0,14, 5, 5,11,15, 3,0,0, 6,0,2 });
-	_create_ma3_voice("midi.drum82",  "Shaker",           { 4,7,  0, 9, 0, 3, 5, 6, 0,0,0, 7,0,2,  0, 9, 6, 4, 4, 6, 4,1,0, 3,0,2,  0,14, 4, 2, 6, 4, 1,0,0,12,0,2,  6, 9,10, 9, 4, 8, 2,0,0,15,0,2 });
-	_create_ma3_voice("midi.drum83",  "Jingle Bell",      { 5,0,  2, 7, 6, 0, 0, 0,20,0,0, 6,0,2,  3, 6,11, 5, 5, 4, 0,0,0, 2,0,2,  2, 3, 0, 0, 2, 0, 7,1,0, 6,0,2,  2, 7, 5, 2, 6,15, 0,0,0, 9,0,2 });
-	_create_ma3_voice("midi.drum84",  "Bell Tree",        { 5,7, 19,12, 4, 2, 0, 0,24,0,0, 3,0,2,  2, 4, 3, 5, 5, 4, 0,0,0, 2,0,3,  2, 3, 0, 0, 2, 0, 7,1,0, 7,0,3, 13, 5, 4, 2, 6, 6, 2,0,0, 3,0,3 });
+	static const FMPreset midi_drum_presets[] = {
+		{ "midi.drum24",  "Seq Click H",      { 5,6,  4,15, 0,15,15, 0,56,0,0, 6,0,2,  0,15, 8,15,15,12, 0,1,0, 5,0,2,  6,15,11,15,15,11,39,0,0,10,0,2,  0,14,11,15,15,15, 1,1,0, 5,0,2 } },
+		{ "midi.drum25",  "Brush Tap",        { 5,7,  0,15, 8, 0, 0, 3, 0,0,0, 5,0,2,  0, 9, 8, 8,11,11, 0,0,2, 0,0,2,  6,15, 8, 6,14, 3,36,0,0,12,0,2,  6,12,13, 8, 8, 0,44,0,2, 1,0,2 } },
+		{ "midi.drum26",  "Brush Swirl L",    { 5,7, 18,15, 5, 0, 6, 0, 0,0,0, 0,0,2,  3, 9, 8, 0,10, 6, 0,0,0, 0,0,3, 16,15, 0, 0,15,15, 0,0,0, 0,0,0,  0, 3, 6, 3,15, 6,21,0,0, 1,0,3 } },
+		{ "midi.drum27",  "Brush Slap",       { 5,7,  0,15, 0, 0, 0, 0, 0,0,0, 4,0,2, 13,12, 8, 6,12, 9, 0,0,0,14,0,2,  7,11,10, 4, 7,13, 9,0,0, 0,0,2,  0, 8, 8,11,11,13, 0,0,2, 0,0,2 } },
+		{ "midi.drum28",  "Brush Swirl H",    { 5,7, 18,15, 5, 0, 3, 0, 0,0,0, 5,5,2,  3, 9, 6, 0,10, 6, 0,0,0, 3,0,3, 16,15, 0, 0,15,15, 0,0,0, 9,0,0, 20, 3, 6, 3,15, 6,16,0,0, 3,0,3 } },
+		{ "midi.drum29",  "Snare Roll",       { 5,7,  2, 7, 0, 0, 2, 0,13,0,0, 8,3,1, 26,15, 5, 0, 9, 3, 0,0,0, 0,6,0,  0,15,10, 8, 4, 3, 8,0,0, 3,0,2,  0,14, 6, 7, 7, 5, 0,0,0, 0,0,2 } },
+		{ "midi.drum30",  "Castanet",         { 5,6,  1,15, 7, 5, 9,15, 2,0,0, 7,0,2,  6,10, 8, 5,15,15, 0,1,0, 5,0,2,  5,15, 5, 6, 5, 0,39,0,0, 2,0,2,  0,12,10, 9, 9,10,20,0,0, 5,0,2 } },
+		{ "midi.drum31",  "Snare L",          { 5,7, 24,15,12, 0, 0, 1, 9,0,0, 0,0,2,  0,15, 7, 7, 7, 3, 0,0,0, 0,0,2,  0,14,11, 7, 5,15,48,0,0, 7,0,2,  0,15,10, 6, 0, 0,28,0,0, 0,0,2 } },
+		{ "midi.drum32",  "Sticks",           { 6,7, 20,15, 9,12, 8, 9, 0,0,1,15,0,2,  3,13,10, 2, 8,11, 0,0,0,10,0,2,  3,13, 8, 2, 5, 5,21,0,1,11,0,2,  8,12,11, 9, 7,11, 0,0,0,13,0,2 } },
+		{ "midi.drum33",  "Bass Drum L",      { 5,1,  4,15,10,11, 6,15, 0,0,0, 2,0,2,  0,15, 6, 6, 5, 7,16,0,0, 2,0,2,  1,11, 9, 7, 4, 7,13,0,0, 5,0,2, 12,15, 7, 8, 5, 7, 0,0,0, 1,0,2 } },
+		{ "midi.drum34",  "Open Rim Shot",    { 5,7,  2,15, 0, 5, 5, 0, 5,1,0,12,0,2,  0,15, 7, 7, 7, 7, 0,1,0,11,0,2,  0,15,10, 6, 6, 8, 0,0,0,12,0,2,  2,15, 7, 7, 7, 7, 0,0,0, 7,0,2 } },
+		{ "midi.drum35",  "Bass Drum M",      { 5,6,  6,15,13, 7, 7,15, 0,0,0,13,0,2,  0,15, 7, 7, 4, 7, 0,0,0, 2,0,2, 10,15, 9, 7, 6, 7,19,0,0, 3,0,2, 12,15, 8,10, 6,11, 0,0,0, 2,0,2 } },
+		{ "midi.drum36",  "Bass Drum H",      { 5,6,  6,15,13, 7, 6,15,14,0,0,13,0,2,  0,15, 7, 7, 7, 7,12,0,0, 2,0,2,  2,15, 9, 7, 4, 7, 9,0,0, 2,0,2, 12,15, 7, 8, 6, 7, 0,0,0, 1,0,2 } },
+		{ "midi.drum37",  "Side Stick",       { 5,6,  1,15, 2, 0, 8, 5, 8,0,0,10,0,2,  6,13, 9, 3, 3,15, 0,1,0, 7,0,2, 18,11, 0, 0, 9,13, 0,0,0, 9,0,2, 18,13, 9,11, 9,11, 0,0,0, 0,0,2 } },
+		{ "midi.drum38",  "Snare M",          { 5,7, 13,15, 0, 5, 7, 0, 7,1,0,12,0,2,  0,15, 7,10, 9, 7, 0,1,0, 8,0,2,  0,15, 5, 7, 8, 6, 0,0,0,12,0,2,  2,15, 7, 7, 6, 7, 1,0,0, 7,0,2 } },
+		{ "midi.drum39",  "Hand Clap",        { 5,7,  0,15, 4, 4, 6, 0, 2,0,0, 0,0,2,  5,15, 6, 9, 4, 1, 0,0,0, 0,0,2, 27,15, 8, 0,15, 1, 0,0,2,13,1,2,  2,15,10, 9, 8, 5, 0,0,2,15,0,2 } },
+		{ "midi.drum40",  "Snare H",          { 5,7,  2,15, 1, 0, 7, 0,10,0,0,12,0,2,  0,15, 7,11, 7,13, 0,0,0,11,0,0, 28,15,10, 6, 5, 8, 9,0,0, 9,0,2, 18,15, 8,10, 6, 1, 0,0,0, 7,0,2 } },
+		{ "midi.drum41",  "Floor Tom L",      { 5,4,  6,13,10, 6, 6,15, 9,0,0,12,0,2,  0,15,10, 7,11, 7, 0,0,0, 5,0,2,  1,15, 3, 5, 5,15,21,0,0, 0,0,2,  0,15, 6, 5, 6, 7, 0,0,0, 5,0,2 } },
+		{ "midi.drum42",  "Hi-Hat Closed",    { 5,7,  0,15, 0, 0, 0, 3, 2,0,0,15,0,2,  0,11, 8,12, 8,11, 0,0,2, 0,0,2, 14,15, 3, 3,13, 3,12,0,0, 0,0,2, 11,11,10, 8,11, 0, 0,0,2,13,0,2 } },
+		{ "midi.drum43",  "Floor Tom H",      { 5,0,  6,12, 5, 6, 6,15, 0,0,0,12,0,2, 19,15, 9, 7,11, 7, 0,0,0,11,0,2,  1,15, 4, 4, 5,15,26,0,0, 0,0,2,  0,15, 6, 4, 6, 5, 0,0,0, 5,0,2 } },
+		{ "midi.drum44",  "Hi-Hat Pedal",     { 5,7,  0,15, 0, 0, 0, 3, 0,0,0,12,0,2,  0, 7, 8, 8, 8,11,15,0,2, 0,0,2, 20,15, 3, 5,14, 3, 8,0,0, 6,0,2, 11, 8, 3, 8, 8, 0, 0,0,2, 5,0,2 } },
+		{ "midi.drum45",  "Low Tom",          { 5,0,  6,12, 5, 6, 6,15, 1,0,0,10,0,2, 18,15, 8, 7, 9, 7, 0,0,0, 1,0,2,  1,15, 3, 5, 5,15,17,0,0, 0,0,2,  0,15, 6, 5, 5, 7, 0,0,0, 5,0,2 } },
+		{ "midi.drum46",  "Hi-Hat Open",      { 5,7,  0,15, 0, 0, 0, 3, 2,0,0,15,0,2,  0,11, 7, 6, 8,11, 1,0,2, 0,0,2, 14,15, 3, 3,13, 3,12,0,0, 0,0,2, 11,11, 9, 5,11, 0, 9,0,2,13,0,2 } },
+		{ "midi.drum47",  "Mid Tom L",        { 5,0,  6,12, 5, 6, 6,15, 0,0,0,10,0,2, 18,15, 9, 7,10, 6, 0,0,0, 8,0,2,  0,15, 4, 2, 5,15,28,0,0, 0,0,2,  0,15, 6, 5, 7, 7, 2,0,0, 4,0,2 } },
+		{ "midi.drum48",  "Mid Tom H",        { 5,0,  6,12, 4, 6, 5,15, 9,0,0,10,0,2, 19,15, 9, 7, 7, 7, 0,0,0, 1,0,2,  1,15, 4, 5, 5,15,39,0,0, 1,0,2,  0,15, 6, 6, 7, 7, 3,0,0, 4,0,2 } },
+		{ "midi.drum49",  "Crash Cymbal 1",   { 5,3, 16,15, 9, 0, 6, 0,14,0,0,13,0,2, 18, 9, 3, 4, 5, 2, 3,0,0,11,0,0,  0,11, 3, 0, 4, 0, 0,0,0,15,0,2,  6,12, 4, 5, 5, 7,13,0,0,15,0,2 } },
+		{ "midi.drum50",  "High Tom",         { 5,0,  6,12, 4, 6, 7,15, 4,0,0, 8,0,2, 19,15,10, 7, 8, 7, 0,0,0, 6,0,2,  5,15, 5, 5, 6,15,50,0,0, 1,0,2,  0,12, 6, 5, 6, 7, 0,0,0, 5,0,2 } },
+		{ "midi.drum51",  "Ride Cymbal 1",    { 5,7,  0,15, 7, 0, 0, 4, 9,0,2,15,0,2, 14,14, 4, 4, 4,14, 3,0,0, 9,0,2,  0,15, 0, 0, 0, 4, 8,0,2,14,0,2, 11,15, 4, 2, 5,13,16,0,0,14,0,2 } },
+		{ "midi.drum52",  "Chinese Cymbal",   { 5,7,  0,15, 3, 7, 2, 1,31,0,0, 0,0,2, 30,14, 3, 5, 2, 0, 0,1,0, 5,0,0,  0,15, 1, 8, 3, 6,15,0,0, 2,0,2,  6, 9, 2, 5, 3, 0, 9,0,0, 0,0,2 } },
+		{ "midi.drum53",  "Ride Cymbal Cup",  { 5,7, 19,15, 7, 0, 0, 4,22,0,2,15,0,2, 12,15, 5, 4, 4,14, 0,0,0,15,0,2, 19,15, 0, 0, 0, 4,12,0,2,12,0,2, 11,15, 5, 2, 5,13,27,0,0,15,0,2 } },
+		{ "midi.drum54",  "Tambourine",       { 5,6,  0, 8, 7, 4, 1, 2,10,0,0,11,0,2, 13,14, 7,12,11, 5, 0,0,0, 5,0,2,  8, 8, 7, 5, 2, 2, 0,0,0,11,0,2,  8,13, 7,12, 7, 6, 0,0,0,15,0,2 } },
+		{ "midi.drum55",  "Splash Cymbal",    { 5,7, 25,12, 6, 3, 3, 0, 0,0,0, 8,0,0,  3, 9, 3, 4, 3,12, 0,1,0,13,0,0, 13, 5, 0, 3, 3, 0, 1,0,0, 5,0,0, 19,12, 3, 5, 8, 6, 0,1,0,15,0,0 } },
+		{ "midi.drum56",  "Cowbell",          { 5,4,  0,15, 9, 8, 5, 3, 0,1,2, 3,0,2,  0,10, 7, 5, 3, 3, 0,1,0, 0,0,2,  2,15,15,11, 9,10, 3,1,0, 4,0,2,  0,15,12, 5, 5, 3,32,1,0, 1,0,2 } },
+		{ "midi.drum57",  "Crash Cymbal 2",   { 5,7,  0,15, 6, 0, 0, 0, 0,0,2, 9,0,2,  0, 9, 4, 2, 2, 0, 0,1,0, 0,0,0,  0,15, 3, 0, 0, 0, 0,0,2,15,0,2,  2, 9, 6, 3, 4, 3, 8,0,0, 7,4,2 } },
+		{ "midi.drum58",  "Vibraslap",        { 5,7, 29,13, 1, 2, 6, 0, 0,0,0, 1,2,1,  8,15, 6, 5, 9, 2, 0,0,0, 0,6,0, 29,15, 5, 4, 4, 0,29,0,0, 6,0,2, 30,15, 6, 5, 4, 0, 0,0,0, 0,0,2 } },
+		{ "midi.drum59",  "Ride Cymbal 2",    { 5,7,  7,15, 0, 0, 6, 0, 5,0,0,14,0,3, 14,14, 5, 5, 4,11,16,0,0,15,0,2,  6,15, 0, 0, 0, 4, 7,0,2, 9,0,2, 11,15, 5, 3, 5,14, 0,0,0, 9,0,2 } },
+		{ "midi.drum60",  "Bongo H",          { 5,3,  0,15, 5,12,12, 0, 0,0,0, 6,0,2,  0,15, 5, 8, 7, 0, 0,0,0,11,0,2,  0,15, 5,12,12, 0, 2,0,0,15,0,2,  0,15, 4, 7, 3, 0, 0,0,0,15,0,2 } },
+		{ "midi.drum61",  "Bongo L",          { 5,3,  0,15, 5,12,12, 0, 0,0,0, 6,0,2,  0,15, 5, 8, 7, 0, 7,0,0,11,0,2,  0,15, 5,12,12, 0, 6,0,0,15,0,2,  0,15, 5, 8, 3, 0, 0,0,0,15,0,2 } },
+		{ "midi.drum62",  "Conga H Mute",     { 5,4,  0,14,14,10,10, 1, 6,0,0, 0,2,2,  8,15, 8, 9,10, 1, 0,0,0, 1,0,2,  0,15, 0, 0, 0, 0,44,0,0, 0,0,2,  0,15,13, 9,10, 1, 7,0,0, 0,0,2 } },
+		{ "midi.drum63",  "Conga H Open",     { 5,7,  3,10,10, 5, 8,12,38,0,0,10,0,2,  0,12, 6, 7, 9, 4, 0,0,0,12,0,2,  0,15,10, 6, 8, 8, 0,0,0,12,0,2,  2,15, 7, 7, 9, 7, 0,0,0, 2,0,2 } },
+		{ "midi.drum64",  "Conga L",          { 5,7,  3,10,10, 5, 8,12,31,0,0,10,0,2,  0,12, 5, 6, 9, 4, 0,0,0,12,0,2,  0,15,10, 6, 8, 8, 0,0,0,12,0,2, 10,15, 7, 7, 9, 7, 0,0,0, 2,0,2 } },
+		{ "midi.drum65",  "Timbale H",        { 3,6,  0,12, 7, 0, 8, 0,22,0,0, 2,0,2,  0,15, 9, 6, 8, 0,49,0,0, 7,0,2,  4,13, 6,10, 6, 1,26,0,0, 9,0,2,  6,15, 9, 6, 8, 0, 6,0,0, 9,0,2 } },
+		{ "midi.drum66",  "Timbale L",        { 3,6,  0,12, 7, 0, 8, 0,22,0,0, 2,0,2,  0,15, 9, 6, 8, 0,49,0,0, 7,0,2,  4,13, 6,10, 6, 1,23,0,0,12,0,2,  6,15, 9, 6, 8, 0, 4,0,0, 9,0,2 } },
+		{ "midi.drum67",  "Agogo H",          { 5,5,  0,14,12, 6, 6, 2,21,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2,  0,14,12, 6, 5, 2,26,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2 } },
+		{ "midi.drum68",  "Agogo L",          { 5,5,  0,14,12, 6, 6, 2,21,0,0, 7,0,2,  0,15, 8, 6, 6, 1,10,0,0, 2,0,2,  0,14,12, 5, 5, 2,13,0,0, 7,0,2,  0,15, 8, 6, 6, 1,29,0,0, 2,0,2 } },
+		{ "midi.drum69",  "Cabasa",           { 3,7,  0,15, 0, 3, 5, 6, 0,0,0, 7,0,2,  0,14, 8, 4, 4,10,24,1,0,15,0,2,  0,14, 4, 2, 6, 4, 0,0,0,15,0,2,  6, 8,11, 9, 4, 0, 2,0,0,15,0,2 } },
+		{ "midi.drum70",  "Maracas",          { 4,7,  0,15, 0, 3, 5, 6, 4,0,0,15,0,2,  0, 8, 8, 4, 4, 6, 3,1,0,15,0,2,  6,12, 9, 3, 3,15, 0,0,0,15,0,2, 12, 7,10,10, 3, 8, 0,0,0,15,0,2 } },
+		{ "midi.drum71",  "Samba Whistle H",  { 5,5,  1,15, 0, 0, 7, 0,10,0,0, 0,0,1,  0,12, 1, 0,12, 1,43,0,0,14,0,1,  0,15, 0, 0, 7, 0,23,0,0, 0,0,2,  0, 8, 1, 0,12, 0, 6,0,0,15,0,1 } },
+		{ "midi.drum72",  "Samba Whistle L",  { 5,5,  1,15, 0, 0, 7, 0,10,0,0, 0,0,1,  0,12, 1, 0,12, 1,43,0,0,14,0,1,  0,15, 0, 0, 7, 0,23,0,0, 0,0,2,  0, 8, 1, 0,12, 0, 6,0,0,15,0,1 } },
+		{ "midi.drum73",  "Guiro Short",      { 3,7,  1,12, 2, 6, 0, 0,12,0,0, 1,0,0,  4,12, 3, 6,10, 0, 0,0,0, 3,0,0, 11,13, 1, 0, 6, 0,32,0,0,14,5,0,  7,15, 7,12,15, 6, 0,1,0, 0,1,0 } },
+		{ "midi.drum74",  "Guiro Long",       { 3,7,  1,12, 2, 6, 0, 0,14,0,0, 1,0,0,  4,12, 3, 6,10, 0, 0,0,0, 3,0,0, 11,15, 0, 0, 6, 0,32,0,0,13,0,0,  7, 9, 6,14,12, 6, 5,0,0, 0,2,0 } },
+		{ "midi.drum75",  "Claves",           { 4,0,  0,13, 7, 6, 6,10,11,0,0, 7,0,2,  0,15,14,11, 3,10,13,0,0, 7,0,2,  0,15,11, 8, 0,12, 0,1,0, 0,0,2,  8,15, 3, 8, 8, 0, 0,1,0,15,0,2 } },
+		{ "midi.drum76",  "Wood Block H",     { 4,0,  0,14, 6, 6, 6,10,63,0,0,15,0,2,  0,15, 6, 6, 5,11, 0,0,0, 6,0,2,  2,13,12, 0,10,12, 0,1,0, 7,0,2,  8,15, 7,12, 7, 4, 0,1,0, 3,0,2 } },
+		{ "midi.drum77",  "Wood Block L",     { 4,0,  0,14, 6, 6, 6,10,63,0,0,15,0,2,  0,15, 6, 6, 5,11, 0,0,0, 6,0,2,  2,15,10, 0,10,12,16,1,0,10,0,2, 16,12, 7,12,12, 4, 0,1,0, 3,0,2 } },
+		{ "midi.drum78",  "Cuica Mute",       { 5,0,  0,13,10,12,13,11,15,0,2, 0,0,2,  0, 6, 0, 6, 5, 0, 6,0,0, 6,0,2,  0,15, 8, 8,12, 0,14,0,0, 0,0,2,  0, 6, 0, 7, 7, 0, 2,0,0, 6,0,2 } },
+		{ "midi.drum79",  "Cuica Open",       { 5,1, 16, 9, 8,15, 8,15,12,0,0, 0,0,0,  8, 7, 6, 8, 8, 4, 0,0,0,14,0,0,  0,15, 7, 0, 0, 0,36,0,0, 2,0,2,  0,13, 7,11,11,12,18,0,0,11,0,2 } },
+		{ "midi.drum80",  "Triangle Mute",    { 7,0, 22,15,12, 8, 4, 0, 5,0,0, 9,0,2,  4,11, 5, 9, 5, 6, 0,0,0,15,0,2,  6,15,11,12, 7, 3, 7,0,0,14,0,2,  0,14,13, 8,11,15, 6,0,0, 6,0,2 } },
+		{ "midi.drum81",  "Triangle Open",    { 7,0, 22,15, 5, 5, 4, 0, 3,0,0, 9,0,2,  4,11, 5, 9, 5, 6, 0,0,0,15,0,2,  6,15, 9, 9, 7, 3, 8,0,0,14,0,2,  0,14, 5, 5,11,15, 3,0,0, 6,0,2 } },
+		{ "midi.drum82",  "Shaker",           { 4,7,  0, 9, 0, 3, 5, 6, 0,0,0, 7,0,2,  0, 9, 6, 4, 4, 6, 4,1,0, 3,0,2,  0,14, 4, 2, 6, 4, 1,0,0,12,0,2,  6, 9,10, 9, 4, 8, 2,0,0,15,0,2 } },
+		{ "midi.drum83",  "Jingle Bell",      { 5,0,  2, 7, 6, 0, 0, 0,20,0,0, 6,0,2,  3, 6,11, 5, 5, 4, 0,0,0, 2,0,2,  2, 3, 0, 0, 2, 0, 7,1,0, 6,0,2,  2, 7, 5, 2, 6,15, 0,0,0, 9,0,2 } },
+		{ "midi.drum84",  "Bell Tree",        { 5,7, 19,12, 4, 2, 0, 0,24,0,0, 3,0,2,  2, 4, 3, 5, 5, 4, 0,0,0, 2,0,3,  2, 3, 0, 0, 2, 0, 7,1,0, 7,0,3, 13, 5, 4, 2, 6, 6, 2,0,0, 3,0,3 } },
+	};
+	_register_fm_presets("midi.drum", PRESET_MA3, midi_drum_presets, std::size(midi_drum_presets));
 }
 
 void SiONVoicePresetUtil::_generate_wave_table_voices() {
@@ -579,257 +628,261 @@ void SiONVoicePresetUtil::_generate_wave_table_voices() {
 	// In the original code these hex strings were stored alongside the wave table, however they were never accessed
 	// nor could be reasonably used. This information is worth preserving though, so we're keeping them in comments.
 
-	_register_wave_table({ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1717,915,557,337,191,93,33,5,5,33,93,191,337,557,915,1717 });                   // 0d253c5163717a7f7f7a7163513c250df3dbc4af9d8f868181868f9dafc4dbf3
-	_register_wave_table({ 828,440,266,160,90,42,14,0,0,14,42,90,160,266,440,828,829,441,267,161,91,43,15,1,1,15,43,91,161,267,441,829 });                           // 2a46596771787d7f7f7d78716759462ad6baa7998f8883808083888f99a7bad6
-	_register_wave_table({ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1,107,231,379,563,813,1189,2001,2000,1188,812,562,378,230,106,0 });             // 0d253c5163717a7f7f7a7163513c250d8091a2b3c4d5e6f7091a2b3c4d5e6f7f
-	_register_wave_table({ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1209,435,137,15,15,137,435,1209,1208,434,136,14,14,136,434,1208 });             // 0d253c5163717a7f7f7a7163513c250de7b996828296b9e719476a7e7e6a4719
-	_register_wave_table({ 4,32,92,190,336,556,914,1716,1,33,93,191,337,557,915,1717,1717,915,557,337,191,93,33,1,1716,914,556,336,190,92,32,4 });                   // 7f6f5e4d3c2b1a098091a2b3c4d5e6f7f7e6d5c4b3a29180091a2b3c4d5e6f7f
-	_register_wave_table({ 2001,1189,813,563,379,231,107,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,106,230,378,562,812,1188,2000 });                                       // f7e6d5c4b3a29180808080808080808080808080808080807f6f5e4d3c2b1a09
-	_register_wave_table({ 1,51,103,159,221,289,363,445,537,643,767,915,1101,1349,1727,2537,2536,1726,1348,1100,914,766,642,536,444,362,288,220,158,102,50,0 });     // 80889199a1a9b2bac2cad3dbe3ebf4fc040c151d252d363e464e575f676f787f
-	_register_wave_table({ 2001,535,129,1,1,69,143,225,317,423,545,695,879,1129,1505,2317,2316,1504,1128,878,694,544,422,316,224,142,68,0,0,128,534,2000 });         // f7c29480808b96a1adb8c3ced9e4effa06111c27323d48535f6a757f7f6c3e09
-	_register_wave_table({ 2000,1188,812,562,378,230,106,0,0,106,230,378,562,812,1188,2000,2001,1189,813,563,379,231,107,1,1,107,231,379,563,813,1189,2001 });       // 091a2b3c4d5e6f7f7f6f5e4d3c2b1a09f7e6d5c4b3a291808091a2b3c4d5e6f7
-	_register_wave_table({ 6654,1024,512,212,0,248,626,1438,6654,1025,513,213,1,249,627,1439,6654,1024,512,212,0,248,626,1438,6654,1025,513,213,1,249,627,1439 });   // 002040607f5b371200e0c0a080a5c9ee002040607f5b371200e0c0a080a5c9ee
-	_register_wave_table({ 1208,434,136,14,14,136,434,1208,1209,435,137,15,15,137,435,1209,1084,352,88,14,92,362,1118,1119,363,93,15,89,353,1085,0,1 });             // 19476a7e7e6a4719e7b996828296b9e71d4f727e714e1ce4b28f828eb1e37f80
-	_register_wave_table({ 1540,740,436,310,310,436,740,1540,462,132,0,0,132,462,1422,1671,1670,1423,463,133,1,1,133,463,1541,741,437,311,311,437,741,1541 });       // 102e455252452e1043687d7d684312f30deebd98838398bdf0d2bbaeaebbd2f0
-	_register_wave_table({ 2000,1188,812,562,378,230,106,0,0,106,230,378,562,812,1188,2000,1439,627,249,1,1,249,627,1439,1438,626,248,0,0,248,626,1438 });           // 091a2b3c4d5e6f7f7f6f5e4d3c2b1a09eec9a58080a5c9ee12375b7f7f5b3712
-	_register_wave_table({ 1668,868,512,296,156,66,16,0,0,16,66,156,296,512,868,1668,1439,627,249,1,1,249,627,1439,1438,626,248,0,0,248,626,1438 });                 // 0d28405668757d7f7f7d75685640280deec9a58080a5c9ee12375b7f7f5b3712
-	_register_wave_table({ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 });                                                                       // 7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f80808080808080808080808080808080
-	_register_wave_table({ 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 });                                                                       // 7f7f7f7f7f7f7f7f808080808080808080808080808080808080808080808080
-	_register_wave_table({ 0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 });                                                                       // 7f7f7f7f80808080808080808080808080808080808080808080808080808080
-	_register_wave_table({ 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1 });                                                                       // 7f7f7f7f7f7f7f7f80808080808080807f7f7f8080807f7f7f7f7f8080808080
-	_register_wave_table({ 6654,6654,6654,6654,0,0,0,1,1,1,6654,6654,6654,6654,6654,0,0,0,1,1,1,6654,6654,6654,6654,6654,0,0,0,1,1,1 });                             // 000000007f7f7f80808000000000007f7f7f80808000000000007f7f7f808080
-	_register_wave_table({ 1,6654,6654,0,0,0,6654,1,1,1,1,6654,6654,6654,6654,0,0,0,0,0,1,0,41,633,5396,944,724,724,944,5396,633,41 });                              // 8000007f7f7f0080808080000000007f7f7f7f7f807f87ca002430302400ca87
-	_register_wave_table({ 6654,6654,6654,1,6,6,6,6,6654,6654,6654,6654,1,6654,6654,1,1,1,1,6654,1,1,1,6654,6654,6654,1,1,1,6654,1,1 });                             // 000000807f7f7f7f000000008000008080808000808080000000808080008080
-	_register_wave_table({ 1,379,1189,1188,378,0,0,378,1188,1189,379,1,295,553,1043,4105,1066,562,302,144,50,0,0,50,144,302,562,1066,4105,1043,553,295 });           // 80b3e61a4d7f7f4d1ae6b380aac3e1001e3c5569787f7f7869553c1e00e1c3aa
-	_register_wave_table({ 1188,378,0,0,378,1188,757,6654,757,6654,1917,1111,745,513,349,231,141,79,35,9,1,1,9,35,79,141,231,349,513,745,1111,1917 });               // 1a4d7f7f4d1ad200d200f6e4d1c0b0a2968d8681808081868d96a2b0c0d1e4f6
-	_register_wave_table({ 1188,378,0,0,378,1188,1853,1171,831,607,445,321,225,151,95,53,25,7,1,1,7,25,53,95,151,225,321,445,607,831,1171,1853 });                   // 1a4d7f7f4d1af6e6d6c8baada1978f89848180808184898f97a1adbac8d6e6f6
-	_register_wave_table({ 1324,512,134,0,300,812,6654,813,301,1,135,513,1325,1324,512,134,0,300,812,6654,1269,599,773,1537,1096,1884,6654,6654,0,0,0,0 });          // 15406b7f552b00d5ab8095c0eb15406b7f552b00e9c7d3f01d0a00007f7f7f7f
-	_register_wave_table({ 1324,512,134,0,300,812,6654,813,301,1,135,513,1325,1324,512,134,0,300,812,6654,1269,599,773,1537,1096,1884,6654,6654,6654,824,824,824 }); // 15406b7f552b00d5ab8095c0eb15406b7f552b00e9c7d3f01d0a0000002a2a2a
-	_register_wave_table({ 1668,834,482,274,142,60,14,0,0,14,60,142,274,482,834,1668,1068,38,806,494,30,293,1049,20,56,18,1845,39,1190,272,1260,11 });               // 0d2943586a767d7f7f7d766a5843290d1e7a2b427baae17d767df5861a591782
-	_register_wave_table({ 1290,134,56,272,956,834,104,60,330,174,2,0,56,994,603,529,2845,700,1186,411,1,25,1,141,185,1,315,1685,1235,307,105,319 });                // 166a765823296f7552657f7f7621c8c2fd311ab7818581979d81adf3e8ac92ad
-	_register_wave_table({ 1028,32,820,197,112,546,80,1775,26,933,46,330,502,97,620,4,1029,33,821,196,113,547,81,1774,27,932,47,331,503,96,621,5 });                 // 207b2a9e6e3d73f47cdc78524190377fe085d66292c38d0c842488aebf70c981
-
-	_begin_category("svmidi");
-	_create_wave_table_voice("svmidi.piano1",  "SV.GrandPno", 13,63,24,14,32,4,2);
-	_create_wave_table_voice("svmidi.piano2",  "SV.BritePno",  4,63,24,14,32,4,2);
-	_create_wave_table_voice("svmidi.piano3",  "SV.E.GrandP", 20,63,24,14,32,4,2);
-	_create_wave_table_voice("svmidi.piano4",  "SV.HnkyTonk", 11,63,24,14,32,4,2);
-	_create_wave_table_voice("svmidi.piano5",  "SV.E.Piano1", 27,63,24,14,32,4,2);
-	_create_wave_table_voice("svmidi.piano6",  "SV.E.Piano2", 23,63,24,12,32,4,0);
-	_create_wave_table_voice("svmidi.piano7",  "SV.Harpsi.",  15,48,48,18,32,3,4);
-	_create_wave_table_voice("svmidi.piano8",  "SV.Clavi.",   26,63,32,12,32,2,4);
-
-	_create_wave_table_voice("svmidi.chrom1", "SV.Celesta",  27,48,36,16,24,4,4);
-	_create_wave_table_voice("svmidi.chrom2", "SV.Glocken",  28,48,36,12,24,5,4);
-	_create_wave_table_voice("svmidi.chrom3", "SV.MusicBox", 27,63,36,24,24,2,4);
-	_create_wave_table_voice("svmidi.chrom4", "SV.Vibes",    27,63,40,12,24,2,4);
-	_create_wave_table_voice("svmidi.chrom5", "SV.Marimba",   8,63,40,24,24,0,4);
-	_create_wave_table_voice("svmidi.chrom6", "SV.Xylophon", 11,63,40,24,24,0,4);
-	_create_wave_table_voice("svmidi.chrom7", "SV.TubulBel", 28,63,36,12,16,1,4,0);
-	_create_wave_table_voice("svmidi.chrom8", "SV.Dulcimer", 16,63,44,12,24,4,4);
-
-	_create_wave_table_voice("svmidi.organ1", "SV.DrawOrgn", 11,63,32,0,40,2,4);
-	_create_wave_table_voice("svmidi.organ2", "SV.PercOrgn", 12,63,32,0,40,2,0);
-	_create_wave_table_voice("svmidi.organ3", "SV.RockOrgn",  4,63,32,0,40,2,4);
-	_create_wave_table_voice("svmidi.organ4", "SV.ChrchOrg", 11,40,32,0,24,2,4);
-	_create_wave_table_voice("svmidi.organ5", "SV.ReedOrgn", 25,63, 0,0,40,15,4);
-	_create_wave_table_voice("svmidi.organ6", "SV.Acordion", 17,30,32,0,40,4,4);
-	_create_wave_table_voice("svmidi.organ7", "SV.Harmnica", 20,30,32,0,32,4,4);
-	_create_wave_table_voice("svmidi.organ8", "SV.TangoAcd", 17,36,32,0,40,2,4);
-
-	_create_wave_table_voice("svmidi.guitar1", "SV.NylonGtr", 11,63,44,16,32,3,-3);
-	_create_wave_table_voice("svmidi.guitar2", "SV.SteelGtr", 16,63,44,16,32,3,-2);
-	_create_wave_table_voice("svmidi.guitar3", "SV.Jazz Gtr", 21,40,32,16,32,3,-3);
-	_create_wave_table_voice("svmidi.guitar4", "SV.CleanGtr", 17,44,44,16,32,3,0);
-	_create_wave_table_voice("svmidi.guitar5", "SV.Mute.Gtr",  2,40,40,16,32,3,0,0);
-	_create_wave_table_voice("svmidi.guitar6", "SV.Ovrdrive", 24,40,28, 8,32,1,0,0);
-	_create_wave_table_voice("svmidi.guitar7", "SV.Dist.Gtr", 20,40,28, 8,32,1,0,0);
-	_create_wave_table_voice("svmidi.guitar8", "SV.GtrHarmo", 10,48,32,22,32,6,2);
-
-	_create_wave_table_voice("svmidi.bass1", "SV.Aco.Bass",  8,48,32,8,32,2,-4);
-	_create_wave_table_voice("svmidi.bass2", "SV.FngrBass", 13,48,32,8,32,2,-4);
-	_create_wave_table_voice("svmidi.bass3", "SV.PickBass",  7,48,40,8,32,2,-4);
-	_create_wave_table_voice("svmidi.bass4", "SV.Fretless",  7,36,32,8,32,2,-4);
-	_create_wave_table_voice("svmidi.bass5", "SV.SlapBas1", 11,63,40,8,32,3,-4);
-	_create_wave_table_voice("svmidi.bass6", "SV.SlapBas2", 13,63,40,8,32,3,-4);
-	_create_wave_table_voice("svmidi.bass7", "SV.SynBass1",  2,40,40,8,32,2,-1);
-	_create_wave_table_voice("svmidi.bass8", "SV.SynBass2", 10,48,40,8,32,2, 0);
-
-	_create_wave_table_voice("svmidi.strings1", "SV.Violin",   19,24,4,4,32,15,6);
-	_create_wave_table_voice("svmidi.strings2", "SV.Viola",     3,24,4,8,32,15,6);
-	_create_wave_table_voice("svmidi.strings3", "SV.Cello",    17,28,4,8,32,15,6);
-	_create_wave_table_voice("svmidi.strings4", "SV.ContraBs", 17,24,4,8,32,15,6);
-	_create_wave_table_voice("svmidi.strings5", "SV.Trem.Str", 10,24,4,8,32,15,6);
-	_create_wave_table_voice("svmidi.strings6", "SV.Pizz.Str",  2,40,36,24,32,6,4);
-	_create_wave_table_voice("svmidi.strings7", "SV.Harp",      8,40,36,24,24,6,4);
-	_create_wave_table_voice("svmidi.strings8", "SV.Timpani",   8,40,36,24,24,6,4,0);
-
-	_create_wave_table_voice("svmidi.ensemble1", "SV.Strings1",  2,36,1,1,32,15,7);
-	_create_wave_table_voice("svmidi.ensemble2", "SV.Strings2", 23,24,1,1,32,15,6);
-	_create_wave_table_voice("svmidi.ensemble3", "SV.Syn.Str1",  2,36,1,1,32,15,7);
-	_create_wave_table_voice("svmidi.ensemble4", "SV.Syn.Str2", 23,24,1,1,32,15,6);
-	_create_wave_table_voice("svmidi.ensemble5", "SV.ChoirAah", 21,36,3,3,32,15,6);
-	_create_wave_table_voice("svmidi.ensemble6", "SV.VoiceOoh", 11,24,3,3,32,15,6);
-	_create_wave_table_voice("svmidi.ensemble7", "SV.SynVoice", 12,24,3,3,32,15,6);
-	_create_wave_table_voice("svmidi.ensemble8", "SV.Orch.Hit", 26,40,32,24,32,8,2,-3);
-
-	_create_wave_table_voice("svmidi.brass1", "SV.Trumpet",  10,38,32,8,32,3,0);
-	_create_wave_table_voice("svmidi.brass2", "SV.Trombone", 10,30,44,8,32,1,3);
-	_create_wave_table_voice("svmidi.brass3", "SV.Tuba",     15,30,32,8,32,1,4);
-	_create_wave_table_voice("svmidi.brass4", "SV.Mute.Trp", 18,32,44,8,32,1,4);
-	_create_wave_table_voice("svmidi.brass5", "SV.Fr.Horn",  11,32,44,8,32,1,4);
-	_create_wave_table_voice("svmidi.brass6", "SV.BrasSect", 19,32,44,8,32,1,4);
-	_create_wave_table_voice("svmidi.brass7", "SV.SynBras1",  2,36,28,8,32,2,2);
-	_create_wave_table_voice("svmidi.brass8", "SV.SynBras2", 13,28,32,8,32,2,2);
-
-	_create_wave_table_voice("svmidi.reed1", "SV.SprnoSax", 6,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed2", "SV.Alto Sax", 5,32,44,8,32,1,-2);
-	_create_wave_table_voice("svmidi.reed3", "SV.TenorSax", 10,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed4", "SV.Bari.Sax", 10,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed5", "SV.Oboe",     21,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed6", "SV.Eng.Horn", 3,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed7", "SV.Bassoon",  3,32,44,8,32,1,2);
-	_create_wave_table_voice("svmidi.reed8", "SV.Clarinet", 12,32,44,8,32,1,2);
-
-	_create_wave_table_voice("svmidi.pipe1", "SV.Piccolo",  9,32,44,8,32,2,0);
-	_create_wave_table_voice("svmidi.pipe2", "SV.Flute",    3,28,36,8,32,3,-2);
-	_create_wave_table_voice("svmidi.pipe3", "SV.Recorder", 8,32,44,8,32,2,0);
-	_create_wave_table_voice("svmidi.pipe4", "SV.PanFlute",12,32,44,8,32,2,0,2);
-	_create_wave_table_voice("svmidi.pipe5", "SV.Bottle",  21,28,36,8,32,3,0,0);
-	_create_wave_table_voice("svmidi.pipe6", "SV.Shakhchi",18,28,36,8,32,3,0,0);
-	_create_wave_table_voice("svmidi.pipe7", "SV.Whistle",  3,28,36,8,32,4,0,2);
-	_create_wave_table_voice("svmidi.pipe8", "SV.Ocarina",  1,32,36,8,32,4,0,2);
-
-	_create_wave_table_voice("svmidi.lead1", "SV.SquareLd", 14,63,0,0,32,15,7);
-	_create_wave_table_voice("svmidi.lead2", "SV.Saw.Lead",  6,63,0,0,32,15,6);
-	_create_wave_table_voice("svmidi.lead3", "SV.CaliopLd", 11,63,32,0,32,3,0);
-	_create_wave_table_voice("svmidi.lead4", "SV.ChiffLd",  18,63,32,0,32,3,0);
-	_create_wave_table_voice("svmidi.lead5", "SV.CharanLd", 17,63,32,0,32,3,1);
-	_create_wave_table_voice("svmidi.lead6", "SV.Voice Ld", 19,63,32,0,32,3,4);
-	_create_wave_table_voice("svmidi.lead7", "SV.Fifth Ld", 18,63,0,0,32,15,8,0);
-	_create_wave_table_voice("svmidi.lead8", "SV.Bass &Ld", 17,63,0,0,32,15,7,0);
-
-	_create_wave_table_voice("svmidi.pad1", "SV.NewAgePd", 27,40,12,0,28,6,4);
-	_create_wave_table_voice("svmidi.pad2", "SV.Warm Pad", 23,24,12,0,24,6,4);
-	_create_wave_table_voice("svmidi.pad3", "SV.PolySyPd",  2,28,12,0,28,6,4);
-	_create_wave_table_voice("svmidi.pad4", "SV.ChoirPad", 11,24,12,0,28,6,4);
-	_create_wave_table_voice("svmidi.pad5", "SV.BowedPad",  1,16,12,0,24,6,4);
-	_create_wave_table_voice("svmidi.pad6", "SV.MetalPad", 20,24,12,0,24,6,4);
-	_create_wave_table_voice("svmidi.pad7", "SV.Halo Pad", 21,24,12,0,28,6,4);
-	_create_wave_table_voice("svmidi.pad8", "SV.SweepPad", 17,16,12,0,24,6,4);
-
-	_create_wave_table_voice("svmidi.fx1", "SV.Rain",      3,28,12,0,24,6,4);
-	_create_wave_table_voice("svmidi.fx2", "SV.SoundTrk", 18,24,12,0,24,6,4);
-	_create_wave_table_voice("svmidi.fx3", "SV.Crystal",  28,40,20,0,24,4,2);
-	_create_wave_table_voice("svmidi.fx4", "SV.Atmosphr", 27,40,20,0,24,4,4);
-	_create_wave_table_voice("svmidi.fx5", "SV.Bright",   21,36,20,0,24,4,4);
-	_create_wave_table_voice("svmidi.fx6", "SV.Goblins",  27,32,20,0,24,4,4);
-	_create_wave_table_voice("svmidi.fx7", "SV.Echoes",   13,36,20,12,24,3,4);
-	_create_wave_table_voice("svmidi.fx8", "SV.Sci-Fi",   28,32,20,0,24,4,4);
-
-	_create_wave_table_voice("svmidi.world1", "SV.Sitar",    18,63,16,16,28,3,4,0);
-	_create_wave_table_voice("svmidi.world2", "SV.Banjo",     3,63,36,20,28,2,4);
-	_create_wave_table_voice("svmidi.world3", "SV.Shamisen", 25,63,24,20,28,3,4);
-	_create_wave_table_voice("svmidi.world4", "SV.Koto",     24,63,24,20,28,3,4);
-	_create_wave_table_voice("svmidi.world5", "SV.Kalimba",  27,63,36,20,28,2,4);
-	_create_wave_table_voice("svmidi.world6", "SV.Bagpipe",  17,63,0,0,36,15,4);
-	_create_wave_table_voice("svmidi.world7", "SV.Fiddle",   10,63,0,0,36,15,4);
-	_create_wave_table_voice("svmidi.world8", "SV.Shanai",   16,63,0,0,36,15,4);
-
-	_create_wave_table_voice("svmidi.percus1", "SV.TnklBell", 28,63,24,24,28,15,4);
-	_create_wave_table_voice("svmidi.percus2", "SV.Agogo",    27,63,24,24,28,15,4);
-	_create_wave_table_voice("svmidi.percus3", "SV.SteelDrm", 11,44,26,26,26,15,4);
-	_create_wave_table_voice("svmidi.percus4", "SV.WoodBlok", 14,44,32,28,28, 8,4,2);
-	_create_wave_table_voice("svmidi.percus5", "SV.TaikoDrm",  3,40,36,28,28, 8,4,0);
-	_create_single_drum_voice("svmidi.percus6", "SV.MelodTom", 40,63,32,32,32,15,4,-120);
-	_create_single_drum_voice("svmidi.percus7", "SV.Syn.Drum", 41,63,32,32,32,15,4,-120);
-	_create_single_drum_voice("svmidi.percus8", "SV.RevCymbl", 19,10,40,40,40,15,4);
-
-	_create_wave_table_voice("svmidi.se1", "SV.FretNoiz", 10,40,36,28,28,8,4,4);
-	_create_wave_table_voice("svmidi.se2", "SV.BrthNoiz", 17,40,36,28,28,8,4,4);
-	_create_percussive_voice("svmidi.se3", "SV.Seashore", 16, 10,12,0,116);
-	_create_wave_table_voice("svmidi.se4", "SV.Tweet",    18,40,36,28,28,8,4,4);
-	_create_wave_table_voice("svmidi.se5", "SV.Telphone",  0,63,0,0,32,15,4,2);
-	_create_percussive_voice("svmidi.se6", "SV.Helicptr", 17, 24,12,0,72);
-	_create_percussive_voice("svmidi.se7", "SV.Applause", 17, 12,10,0,100);
-	_create_percussive_voice("svmidi.se8", "SV.Gunshot",  17, 63,28,0,72,1);
+	static const int16_t wave_table_wavelets[][WAVE_TABLE_LENGTH] = {
+		{ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1717,915,557,337,191,93,33,5,5,33,93,191,337,557,915,1717 },                  // 0d253c5163717a7f7f7a7163513c250df3dbc4af9d8f868181868f9dafc4dbf3
+		{ 828,440,266,160,90,42,14,0,0,14,42,90,160,266,440,828,829,441,267,161,91,43,15,1,1,15,43,91,161,267,441,829 },                          // 2a46596771787d7f7f7d78716759462ad6baa7998f8883808083888f99a7bad6
+		{ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1,107,231,379,563,813,1189,2001,2000,1188,812,562,378,230,106,0 },            // 0d253c5163717a7f7f7a7163513c250d8091a2b3c4d5e6f7091a2b3c4d5e6f7f
+		{ 1716,914,556,336,190,92,32,4,4,32,92,190,336,556,914,1716,1209,435,137,15,15,137,435,1209,1208,434,136,14,14,136,434,1208 },            // 0d253c5163717a7f7f7a7163513c250de7b996828296b9e719476a7e7e6a4719
+		{ 4,32,92,190,336,556,914,1716,1,33,93,191,337,557,915,1717,1717,915,557,337,191,93,33,1,1716,914,556,336,190,92,32,4 },                  // 7f6f5e4d3c2b1a098091a2b3c4d5e6f7f7e6d5c4b3a29180091a2b3c4d5e6f7f
+		{ 2001,1189,813,563,379,231,107,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,106,230,378,562,812,1188,2000 },                                      // f7e6d5c4b3a29180808080808080808080808080808080807f6f5e4d3c2b1a09
+		{ 1,51,103,159,221,289,363,445,537,643,767,915,1101,1349,1727,2537,2536,1726,1348,1100,914,766,642,536,444,362,288,220,158,102,50,0 },    // 80889199a1a9b2bac2cad3dbe3ebf4fc040c151d252d363e464e575f676f787f
+		{ 2001,535,129,1,1,69,143,225,317,423,545,695,879,1129,1505,2317,2316,1504,1128,878,694,544,422,316,224,142,68,0,0,128,534,2000 },        // f7c29480808b96a1adb8c3ced9e4effa06111c27323d48535f6a757f7f6c3e09
+		{ 2000,1188,812,562,378,230,106,0,0,106,230,378,562,812,1188,2000,2001,1189,813,563,379,231,107,1,1,107,231,379,563,813,1189,2001 },      // 091a2b3c4d5e6f7f7f6f5e4d3c2b1a09f7e6d5c4b3a291808091a2b3c4d5e6f7
+		{ 6654,1024,512,212,0,248,626,1438,6654,1025,513,213,1,249,627,1439,6654,1024,512,212,0,248,626,1438,6654,1025,513,213,1,249,627,1439 },  // 002040607f5b371200e0c0a080a5c9ee002040607f5b371200e0c0a080a5c9ee
+		{ 1208,434,136,14,14,136,434,1208,1209,435,137,15,15,137,435,1209,1084,352,88,14,92,362,1118,1119,363,93,15,89,353,1085,0,1 },            // 19476a7e7e6a4719e7b996828296b9e71d4f727e714e1ce4b28f828eb1e37f80
+		{ 1540,740,436,310,310,436,740,1540,462,132,0,0,132,462,1422,1671,1670,1423,463,133,1,1,133,463,1541,741,437,311,311,437,741,1541 },      // 102e455252452e1043687d7d684312f30deebd98838398bdf0d2bbaeaebbd2f0
+		{ 2000,1188,812,562,378,230,106,0,0,106,230,378,562,812,1188,2000,1439,627,249,1,1,249,627,1439,1438,626,248,0,0,248,626,1438 },          // 091a2b3c4d5e6f7f7f6f5e4d3c2b1a09eec9a58080a5c9ee12375b7f7f5b3712
+		{ 1668,868,512,296,156,66,16,0,0,16,66,156,296,512,868,1668,1439,627,249,1,1,249,627,1439,1438,626,248,0,0,248,626,1438 },                // 0d28405668757d7f7f7d75685640280deec9a58080a5c9ee12375b7f7f5b3712
+		{ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },                                                                      // 7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f80808080808080808080808080808080
+		{ 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },                                                                      // 7f7f7f7f7f7f7f7f808080808080808080808080808080808080808080808080
+		{ 0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 },                                                                      // 7f7f7f7f80808080808080808080808080808080808080808080808080808080
+		{ 0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1 },                                                                      // 7f7f7f7f7f7f7f7f80808080808080807f7f7f8080807f7f7f7f7f8080808080
+		{ 6654,6654,6654,6654,0,0,0,1,1,1,6654,6654,6654,6654,6654,0,0,0,1,1,1,6654,6654,6654,6654,6654,0,0,0,1,1,1 },                            // 000000007f7f7f80808000000000007f7f7f80808000000000007f7f7f808080
+		{ 1,6654,6654,0,0,0,6654,1,1,1,1,6654,6654,6654,6654,0,0,0,0,0,1,0,41,633,5396,944,724,724,944,5396,633,41 },                             // 8000007f7f7f0080808080000000007f7f7f7f7f807f87ca002430302400ca87
+		{ 6654,6654,6654,1,6,6,6,6,6654,6654,6654,6654,1,6654,6654,1,1,1,1,6654,1,1,1,6654,6654,6654,1,1,1,6654,1,1 },                            // 000000807f7f7f7f000000008000008080808000808080000000808080008080
+		{ 1,379,1189,1188,378,0,0,378,1188,1189,379,1,295,553,1043,4105,1066,562,302,144,50,0,0,50,144,302,562,1066,4105,1043,553,295 },          // 80b3e61a4d7f7f4d1ae6b380aac3e1001e3c5569787f7f7869553c1e00e1c3aa
+		{ 1188,378,0,0,378,1188,757,6654,757,6654,1917,1111,745,513,349,231,141,79,35,9,1,1,9,35,79,141,231,349,513,745,1111,1917 },              // 1a4d7f7f4d1ad200d200f6e4d1c0b0a2968d8681808081868d96a2b0c0d1e4f6
+		{ 1188,378,0,0,378,1188,1853,1171,831,607,445,321,225,151,95,53,25,7,1,1,7,25,53,95,151,225,321,445,607,831,1171,1853 },                  // 1a4d7f7f4d1af6e6d6c8baada1978f89848180808184898f97a1adbac8d6e6f6
+		{ 1324,512,134,0,300,812,6654,813,301,1,135,513,1325,1324,512,134,0,300,812,6654,1269,599,773,1537,1096,1884,6654,6654,0,0,0,0 },         // 15406b7f552b00d5ab8095c0eb15406b7f552b00e9c7d3f01d0a00007f7f7f7f
+		{ 1324,512,134,0,300,812,6654,813,301,1,135,513,1325,1324,512,134,0,300,812,6654,1269,599,773,1537,1096,1884,6654,6654,6654,824,824,824 }, // 15406b7f552b00d5ab8095c0eb15406b7f552b00e9c7d3f01d0a0000002a2a2a
+		{ 1668,834,482,274,142,60,14,0,0,14,60,142,274,482,834,1668,1068,38,806,494,30,293,1049,20,56,18,1845,39,1190,272,1260,11 },              // 0d2943586a767d7f7f7d766a5843290d1e7a2b427baae17d767df5861a591782
+		{ 1290,134,56,272,956,834,104,60,330,174,2,0,56,994,603,529,2845,700,1186,411,1,25,1,141,185,1,315,1685,1235,307,105,319 },               // 166a765823296f7552657f7f7621c8c2fd311ab7818581979d81adf3e8ac92ad
+		{ 1028,32,820,197,112,546,80,1775,26,933,46,330,502,97,620,4,1029,33,821,196,113,547,81,1774,27,932,47,331,503,96,621,5 },                // 207b2a9e6e3d73f47cdc78524190377fe085d66292c38d0c842488aebf70c981
+	};
+	_register_wave_tables(wave_table_wavelets, std::size(wave_table_wavelets));
+
+	static const SimplePreset svmidi_presets[] = {
+		{ PRESET_WAVE_TABLE, "svmidi.piano1",  "SV.GrandPno", { 13,63,24,14,32,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano2",  "SV.BritePno",  { 4,63,24,14,32,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano3",  "SV.E.GrandP", { 20,63,24,14,32,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano4",  "SV.HnkyTonk", { 11,63,24,14,32,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano5",  "SV.E.Piano1", { 27,63,24,14,32,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano6",  "SV.E.Piano2", { 23,63,24,12,32,4,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano7",  "SV.Harpsi.",  { 15,48,48,18,32,3,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.piano8",  "SV.Clavi.",   { 26,63,32,12,32,2,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.chrom1", "SV.Celesta",  { 27,48,36,16,24,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom2", "SV.Glocken",  { 28,48,36,12,24,5,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom3", "SV.MusicBox", { 27,63,36,24,24,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom4", "SV.Vibes",    { 27,63,40,12,24,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom5", "SV.Marimba",   { 8,63,40,24,24,0,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom6", "SV.Xylophon", { 11,63,40,24,24,0,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom7", "SV.TubulBel", { 28,63,36,12,16,1,4,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.chrom8", "SV.Dulcimer", { 16,63,44,12,24,4,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.organ1", "SV.DrawOrgn", { 11,63,32,0,40,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ2", "SV.PercOrgn", { 12,63,32,0,40,2,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ3", "SV.RockOrgn",  { 4,63,32,0,40,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ4", "SV.ChrchOrg", { 11,40,32,0,24,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ5", "SV.ReedOrgn", { 25,63, 0,0,40,15,4, 1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ6", "SV.Acordion", { 17,30,32,0,40,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ7", "SV.Harmnica", { 20,30,32,0,32,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.organ8", "SV.TangoAcd", { 17,36,32,0,40,2,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.guitar1", "SV.NylonGtr", { 11,63,44,16,32,3,-3,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar2", "SV.SteelGtr", { 16,63,44,16,32,3,-2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar3", "SV.Jazz Gtr", { 21,40,32,16,32,3,-3,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar4", "SV.CleanGtr", { 17,44,44,16,32,3,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar5", "SV.Mute.Gtr",  { 2,40,40,16,32,3,0,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar6", "SV.Ovrdrive", { 24,40,28, 8,32,1,0,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar7", "SV.Dist.Gtr", { 20,40,28, 8,32,1,0,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.guitar8", "SV.GtrHarmo", { 10,48,32,22,32,6,2,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.bass1", "SV.Aco.Bass",  { 8,48,32,8,32,2,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass2", "SV.FngrBass", { 13,48,32,8,32,2,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass3", "SV.PickBass",  { 7,48,40,8,32,2,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass4", "SV.Fretless",  { 7,36,32,8,32,2,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass5", "SV.SlapBas1", { 11,63,40,8,32,3,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass6", "SV.SlapBas2", { 13,63,40,8,32,3,-4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass7", "SV.SynBass1",  { 2,40,40,8,32,2,-1,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.bass8", "SV.SynBass2", { 10,48,40,8,32,2, 0, 1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.strings1", "SV.Violin",   { 19,24,4,4,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings2", "SV.Viola",     { 3,24,4,8,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings3", "SV.Cello",    { 17,28,4,8,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings4", "SV.ContraBs", { 17,24,4,8,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings5", "SV.Trem.Str", { 10,24,4,8,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings6", "SV.Pizz.Str",  { 2,40,36,24,32,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings7", "SV.Harp",      { 8,40,36,24,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.strings8", "SV.Timpani",   { 8,40,36,24,24,6,4,0 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble1", "SV.Strings1",  { 2,36,1,1,32,15,7,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble2", "SV.Strings2", { 23,24,1,1,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble3", "SV.Syn.Str1",  { 2,36,1,1,32,15,7,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble4", "SV.Syn.Str2", { 23,24,1,1,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble5", "SV.ChoirAah", { 21,36,3,3,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble6", "SV.VoiceOoh", { 11,24,3,3,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble7", "SV.SynVoice", { 12,24,3,3,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.ensemble8", "SV.Orch.Hit", { 26,40,32,24,32,8,2,-3 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.brass1", "SV.Trumpet",  { 10,38,32,8,32,3,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass2", "SV.Trombone", { 10,30,44,8,32,1,3,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass3", "SV.Tuba",     { 15,30,32,8,32,1,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass4", "SV.Mute.Trp", { 18,32,44,8,32,1,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass5", "SV.Fr.Horn",  { 11,32,44,8,32,1,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass6", "SV.BrasSect", { 19,32,44,8,32,1,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass7", "SV.SynBras1",  { 2,36,28,8,32,2,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.brass8", "SV.SynBras2", { 13,28,32,8,32,2,2,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.reed1", "SV.SprnoSax", { 6,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed2", "SV.Alto Sax", { 5,32,44,8,32,1,-2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed3", "SV.TenorSax", { 10,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed4", "SV.Bari.Sax", { 10,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed5", "SV.Oboe",     { 21,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed6", "SV.Eng.Horn", { 3,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed7", "SV.Bassoon",  { 3,32,44,8,32,1,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.reed8", "SV.Clarinet", { 12,32,44,8,32,1,2,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.pipe1", "SV.Piccolo",  { 9,32,44,8,32,2,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe2", "SV.Flute",    { 3,28,36,8,32,3,-2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe3", "SV.Recorder", { 8,32,44,8,32,2,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe4", "SV.PanFlute",{ 12,32,44,8,32,2,0,2 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe5", "SV.Bottle",  { 21,28,36,8,32,3,0,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe6", "SV.Shakhchi",{ 18,28,36,8,32,3,0,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe7", "SV.Whistle",  { 3,28,36,8,32,4,0,2 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pipe8", "SV.Ocarina",  { 1,32,36,8,32,4,0,2 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.lead1", "SV.SquareLd", { 14,63,0,0,32,15,7,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead2", "SV.Saw.Lead",  { 6,63,0,0,32,15,6,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead3", "SV.CaliopLd", { 11,63,32,0,32,3,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead4", "SV.ChiffLd",  { 18,63,32,0,32,3,0,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead5", "SV.CharanLd", { 17,63,32,0,32,3,1,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead6", "SV.Voice Ld", { 19,63,32,0,32,3,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead7", "SV.Fifth Ld", { 18,63,0,0,32,15,8,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.lead8", "SV.Bass &Ld", { 17,63,0,0,32,15,7,0 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.pad1", "SV.NewAgePd", { 27,40,12,0,28,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad2", "SV.Warm Pad", { 23,24,12,0,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad3", "SV.PolySyPd",  { 2,28,12,0,28,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad4", "SV.ChoirPad", { 11,24,12,0,28,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad5", "SV.BowedPad",  { 1,16,12,0,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad6", "SV.MetalPad", { 20,24,12,0,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad7", "SV.Halo Pad", { 21,24,12,0,28,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.pad8", "SV.SweepPad", { 17,16,12,0,24,6,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.fx1", "SV.Rain",      { 3,28,12,0,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx2", "SV.SoundTrk", { 18,24,12,0,24,6,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx3", "SV.Crystal",  { 28,40,20,0,24,4,2,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx4", "SV.Atmosphr", { 27,40,20,0,24,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx5", "SV.Bright",   { 21,36,20,0,24,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx6", "SV.Goblins",  { 27,32,20,0,24,4,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx7", "SV.Echoes",   { 13,36,20,12,24,3,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.fx8", "SV.Sci-Fi",   { 28,32,20,0,24,4,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.world1", "SV.Sitar",    { 18,63,16,16,28,3,4,0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world2", "SV.Banjo",     { 3,63,36,20,28,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world3", "SV.Shamisen", { 25,63,24,20,28,3,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world4", "SV.Koto",     { 24,63,24,20,28,3,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world5", "SV.Kalimba",  { 27,63,36,20,28,2,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world6", "SV.Bagpipe",  { 17,63,0,0,36,15,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world7", "SV.Fiddle",   { 10,63,0,0,36,15,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.world8", "SV.Shanai",   { 16,63,0,0,36,15,4,1 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.percus1", "SV.TnklBell", { 28,63,24,24,28,15,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.percus2", "SV.Agogo",    { 27,63,24,24,28,15,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.percus3", "SV.SteelDrm", { 11,44,26,26,26,15,4,1 } },
+		{ PRESET_WAVE_TABLE, "svmidi.percus4", "SV.WoodBlok", { 14,44,32,28,28, 8,4,2 } },
+		{ PRESET_WAVE_TABLE, "svmidi.percus5", "SV.TaikoDrm",  { 3,40,36,28,28, 8,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.percus6", "SV.MelodTom", { 40,63,32,32,32,15,4,-120 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.percus7", "SV.Syn.Drum", { 41,63,32,32,32,15,4,-120 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.percus8", "SV.RevCymbl", { 19,10,40,40,40,15,4,0 } },
+
+		{ PRESET_WAVE_TABLE, "svmidi.se1", "SV.FretNoiz", { 10,40,36,28,28,8,4,4 } },
+		{ PRESET_WAVE_TABLE, "svmidi.se2", "SV.BrthNoiz", { 17,40,36,28,28,8,4,4 } },
+		{ PRESET_PERCUSSIVE, "svmidi.se3", "SV.Seashore", { 16, 10,12,0,116, 0 } },
+		{ PRESET_WAVE_TABLE, "svmidi.se4", "SV.Tweet",    { 18,40,36,28,28,8,4,4 } },
+		{ PRESET_WAVE_TABLE, "svmidi.se5", "SV.Telphone",  { 0,63,0,0,32,15,4,2 } },
+		{ PRESET_PERCUSSIVE, "svmidi.se6", "SV.Helicptr", { 17, 24,12,0,72, 0 } },
+		{ PRESET_PERCUSSIVE, "svmidi.se7", "SV.Applause", { 17, 12,10,0,100, 0 } },
+		{ PRESET_PERCUSSIVE, "svmidi.se8", "SV.Gunshot",  { 17, 63,28,0,72,1 } },
+	};
+	_register_simple_presets("svmidi", svmidi_presets, std::size(svmidi_presets));
 }
 
 void SiONVoicePresetUtil::_generate_single_drum_voices() {
 	// 60 voices from GM drum
 
-	_begin_category("svmidi.drum");
-	_create_single_drum_voice("svmidi.drum24",  "Seq Click H",      5,63,40,40,40,15,4,64);
-	_create_single_drum_voice("svmidi.drum25",  "Brush Tap",       17,40,36,36,36,15,4);
-	_create_single_drum_voice("svmidi.drum26",  "Brush Swirl L",   17,32,28,28,28,15,4);
-	_create_single_drum_voice("svmidi.drum27",  "Brush Slap",      17,48,36,36,36,15,4);
-	_create_single_drum_voice("svmidi.drum28",  "Brush Swirl H",   17,48,28,28,28,15,4);
-	_create_single_drum_voice("svmidi.drum29",  "Snare Roll",      16,28,24,24,24,15,4);
-	_create_single_drum_voice("svmidi.drum30",  "Castanet",         5,48,40,40,40,15,4,0,4);
-	_create_single_drum_voice("svmidi.drum31",  "Snare L",         16,63,34,24,24, 8,0,0,0.25);
-	_create_single_drum_voice("svmidi.drum32",  "Sticks",           1,63,40,28,28, 8,6,0,4);
-	_create_single_drum_voice("svmidi.drum33",  "Bass Drum L",      5,63,40,28,38, 8,0,-128,0.5);
-	_create_single_drum_voice("svmidi.drum34",  "Open Rim Shot",   16,63,36,28,28, 6,6);
-	_create_single_drum_voice("svmidi.drum35",  "Bass Drum M",      5,63,40,28,38, 8,0,-128,0.5);
-	_create_single_drum_voice("svmidi.drum36",  "Bass Drum H",      5,63,40,28,38, 8,0,-128,0.5);
-	_create_single_drum_voice("svmidi.drum37",  "Side Stick",      16,63,40,28,28, 8,4);
-	_create_single_drum_voice("svmidi.drum38",  "Snare M",         17,63,34,24,24, 4,0,0,0.35);
-	_create_single_drum_voice("svmidi.drum39",  "Hand Clap",       17,63,38,38,38,15,6,128);
-	_create_single_drum_voice("svmidi.drum40",  "Snare H",         17,63,34,28,28, 4,0,0,0.5);
-	_create_single_drum_voice("svmidi.drum41",  "Floor Tom L",     44,63,32,32,32,15,0,-200,0.2);
-	_create_single_drum_voice("svmidi.drum42",  "Hi-Hat Closed",   19,63,40,40,40,15,4);
-	_create_single_drum_voice("svmidi.drum43",  "Floor Tom H",     44,63,32,32,32,15,0,-200,0.25);
-	_create_single_drum_voice("svmidi.drum44",  "Hi-Hat Pedal",    19,40,40,40,40,15,5);
-	_create_single_drum_voice("svmidi.drum45",  "Low Tom",         44,63,32,32,32,15,0,-200,0.375);
-	_create_single_drum_voice("svmidi.drum46",  "Hi-Hat Open",     19,63,36,16,16, 6,4);
-	_create_single_drum_voice("svmidi.drum47",  "Mid Tom L",       44,63,32,32,32,15,0,-200,0.5);
-	_create_single_drum_voice("svmidi.drum48",  "Mid Tom H",       44,63,32,32,32,15,0,-200,0.75);
-	_create_single_drum_voice("svmidi.drum49",  "Crash Cymbal 1",  19,63,30,24,24, 2,6);
-	_create_single_drum_voice("svmidi.drum50",  "High Tom",        44,63,32,32,32,15,0,-200,1);
-	_create_single_drum_voice("svmidi.drum51",  "Ride Cymbal 1",   18,63,40,28,28, 8,6,0,2.5);
-	_create_single_drum_voice("svmidi.drum52",  "Chinese Cymbal",  16,63,32,24,24, 3,6);
-	_create_single_drum_voice("svmidi.drum53",  "Ride Cymbal Cup", 18,63,36,24,24, 6,4);
-	_create_single_drum_voice("svmidi.drum54",  "Tambourine",      18,63,32,32,32,15,6,0,4);
-	_create_single_drum_voice("svmidi.drum55",  "Splash Cymbal",   17,63,32,24,24, 3,6);
-	_create_single_drum_voice("svmidi.drum56",  "Cowbell",         18,63,36,36,36,15,4);
-	_create_single_drum_voice("svmidi.drum57",  "Crash Cymbal 2",  19,63,30,24,24, 2,6);
-	_create_single_drum_voice("svmidi.drum58",  "Vibraslap",       18,63,36,36,36,15,4);
-	_create_single_drum_voice("svmidi.drum59",  "Ride Cymbal 2",   18,63,40,28,28, 8,6,0,1.5);
-	_create_single_drum_voice("svmidi.drum60",  "Bongo H",         40,63,36,36,36,15,4,-32,1.5);
-	_create_single_drum_voice("svmidi.drum61",  "Bongo L",         40,63,36,36,36,15,4,-32,1);
-	_create_single_drum_voice("svmidi.drum62",  "Conga H Mute",     1,63,40,40,40,15,4,-200,4);
-	_create_single_drum_voice("svmidi.drum63",  "Conga H Open",    45,63,36,36,36,15,4,-32,1.5);
-	_create_single_drum_voice("svmidi.drum64",  "Conga L",         45,63,36,36,36,15,4,-32,1);
-	_create_single_drum_voice("svmidi.drum65",  "Timbale H",       25,63,36,36,36,15,4,-64,2);
-	_create_single_drum_voice("svmidi.drum66",  "Timbale L",       25,63,36,36,36,15,4,-64,1.5);
-	_create_single_drum_voice("svmidi.drum67",  "Agogo H",          7,63,38,38,38,15,4,-64,1.5);
-	_create_single_drum_voice("svmidi.drum68",  "Agogo L",          7,63,38,38,38,15,4,-64);
-	_create_single_drum_voice("svmidi.drum69",  "Cabasa",          17,36,38,38,38,15,5);
-	_create_single_drum_voice("svmidi.drum70",  "Maracas",         19,32,36,36,36,15,6);
-	_create_single_drum_voice("svmidi.drum71",  "Samba Whistle H",  5,32,36, 8,36, 2,7,0,6.1);
-	_create_single_drum_voice("svmidi.drum72",  "Samba Whistle L",  5,32,36, 8,36, 2,7,0,5.1);
-	_create_single_drum_voice("svmidi.drum73",  "Guiro Short",     17,63,40,32,40, 4,4);
-	_create_single_drum_voice("svmidi.drum74",  "Guiro Long",      17,63,40,24,40, 4,4);
-	_create_single_drum_voice("svmidi.drum75",  "Claves",           5,63,48,40,40,15,4,8);
-	_create_single_drum_voice("svmidi.drum76",  "Wood Block H",     5,63,40,40,40,15,4,-128,4.1);
-	_create_single_drum_voice("svmidi.drum77",  "Wood Block L",     5,63,40,40,40,15,4,-128,3.1);
-	_create_single_drum_voice("svmidi.drum78",  "Cuica Mute",      42,63,32,32,36,15,4,32,0.8);
-	_create_single_drum_voice("svmidi.drum79",  "Cuica Open",      42,63,32,32,36,15,4,32,1.1);
-	_create_single_drum_voice("svmidi.drum80",  "Triangle Mute",    7,63,44,44,44, 6,2,0,7.5);
-	_create_single_drum_voice("svmidi.drum81",  "Triangle Open",    7,63,38,16,16, 6,2,0,7.5);
-	_create_single_drum_voice("svmidi.drum82",  "Shaker",          19,40,36,36,36,15,4);
-	_create_single_drum_voice("svmidi.drum83",  "Jingle Bell",      7,63,38,16,16, 6,4,0,7.5);
-	_create_single_drum_voice("svmidi.drum84",  "Bell Tree",       18,63,38,16,16, 6,4,0,4.5);
+	static const SimplePreset svmidi_drum_presets[] = {
+		{ PRESET_SINGLE_DRUM, "svmidi.drum24",  "Seq Click H",      { 5,63,40,40,40,15,4,64 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum25",  "Brush Tap",       { 17,40,36,36,36,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum26",  "Brush Swirl L",   { 17,32,28,28,28,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum27",  "Brush Slap",      { 17,48,36,36,36,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum28",  "Brush Swirl H",   { 17,48,28,28,28,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum29",  "Snare Roll",      { 16,28,24,24,24,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum30",  "Castanet",         { 5,48,40,40,40,15,4,0 }, 4 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum31",  "Snare L",         { 16,63,34,24,24, 8,0,0 }, 0.25 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum32",  "Sticks",           { 1,63,40,28,28, 8,6,0 }, 4 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum33",  "Bass Drum L",      { 5,63,40,28,38, 8,0,-128 }, 0.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum34",  "Open Rim Shot",   { 16,63,36,28,28, 6,6, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum35",  "Bass Drum M",      { 5,63,40,28,38, 8,0,-128 }, 0.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum36",  "Bass Drum H",      { 5,63,40,28,38, 8,0,-128 }, 0.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum37",  "Side Stick",      { 16,63,40,28,28, 8,4, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum38",  "Snare M",         { 17,63,34,24,24, 4,0,0 }, 0.35 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum39",  "Hand Clap",       { 17,63,38,38,38,15,6,128 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum40",  "Snare H",         { 17,63,34,28,28, 4,0,0 }, 0.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum41",  "Floor Tom L",     { 44,63,32,32,32,15,0,-200 }, 0.2 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum42",  "Hi-Hat Closed",   { 19,63,40,40,40,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum43",  "Floor Tom H",     { 44,63,32,32,32,15,0,-200 }, 0.25 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum44",  "Hi-Hat Pedal",    { 19,40,40,40,40,15,5,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum45",  "Low Tom",         { 44,63,32,32,32,15,0,-200 }, 0.375 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum46",  "Hi-Hat Open",     { 19,63,36,16,16, 6,4, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum47",  "Mid Tom L",       { 44,63,32,32,32,15,0,-200 }, 0.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum48",  "Mid Tom H",       { 44,63,32,32,32,15,0,-200 }, 0.75 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum49",  "Crash Cymbal 1",  { 19,63,30,24,24, 2,6, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum50",  "High Tom",        { 44,63,32,32,32,15,0,-200 }, 1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum51",  "Ride Cymbal 1",   { 18,63,40,28,28, 8,6,0 }, 2.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum52",  "Chinese Cymbal",  { 16,63,32,24,24, 3,6, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum53",  "Ride Cymbal Cup", { 18,63,36,24,24, 6,4, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum54",  "Tambourine",      { 18,63,32,32,32,15,6,0 }, 4 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum55",  "Splash Cymbal",   { 17,63,32,24,24, 3,6, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum56",  "Cowbell",         { 18,63,36,36,36,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum57",  "Crash Cymbal 2",  { 19,63,30,24,24, 2,6, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum58",  "Vibraslap",       { 18,63,36,36,36,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum59",  "Ride Cymbal 2",   { 18,63,40,28,28, 8,6,0 }, 1.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum60",  "Bongo H",         { 40,63,36,36,36,15,4,-32 }, 1.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum61",  "Bongo L",         { 40,63,36,36,36,15,4,-32 }, 1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum62",  "Conga H Mute",     { 1,63,40,40,40,15,4,-200 }, 4 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum63",  "Conga H Open",    { 45,63,36,36,36,15,4,-32 }, 1.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum64",  "Conga L",         { 45,63,36,36,36,15,4,-32 }, 1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum65",  "Timbale H",       { 25,63,36,36,36,15,4,-64 }, 2 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum66",  "Timbale L",       { 25,63,36,36,36,15,4,-64 }, 1.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum67",  "Agogo H",          { 7,63,38,38,38,15,4,-64 }, 1.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum68",  "Agogo L",          { 7,63,38,38,38,15,4,-64 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum69",  "Cabasa",          { 17,36,38,38,38,15,5,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum70",  "Maracas",         { 19,32,36,36,36,15,6,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum71",  "Samba Whistle H",  { 5,32,36, 8,36, 2,7,0 }, 6.1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum72",  "Samba Whistle L",  { 5,32,36, 8,36, 2,7,0 }, 5.1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum73",  "Guiro Short",     { 17,63,40,32,40, 4,4, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum74",  "Guiro Long",      { 17,63,40,24,40, 4,4, 0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum75",  "Claves",           { 5,63,48,40,40,15,4,8 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum76",  "Wood Block H",     { 5,63,40,40,40,15,4,-128 }, 4.1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum77",  "Wood Block L",     { 5,63,40,40,40,15,4,-128 }, 3.1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum78",  "Cuica Mute",      { 42,63,32,32,36,15,4,32 }, 0.8 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum79",  "Cuica Open",      { 42,63,32,32,36,15,4,32 }, 1.1 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum80",  "Triangle Mute",    { 7,63,44,44,44, 6,2,0 }, 7.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum81",  "Triangle Open",    { 7,63,38,16,16, 6,2,0 }, 7.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum82",  "Shaker",          { 19,40,36,36,36,15,4,0 } },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum83",  "Jingle Bell",      { 7,63,38,16,16, 6,4,0 }, 7.5 },
+		{ PRESET_SINGLE_DRUM, "svmidi.drum84",  "Bell Tree",       { 18,63,38,16,16, 6,4,0 }, 4.5 },
+	};
+	_register_simple_presets("svmidi.drum", svmidi_drum_presets, std::size(svmidi_drum_presets));
 }
 
-void SiONVoicePresetUtil::_create_basic_voice(const String &p_key, const String &p_name, int p_channel_num) {
-	Ref<SiONVoice> voice = memnew(SiONVoice(SiONModuleType::MODULE_GENERIC_PG, p_channel_num));
-
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+Ref<SiONVoice> SiONVoicePresetUtil::_create_basic_voice(int p_channel_num) const {
+	return memnew(SiONVoice(SiONModuleType::MODULE_GENERIC_PG, p_channel_num));
 }
 
-void SiONVoicePresetUtil::_create_percussive_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_release_rate, int p_release_sweep, int p_cutoff, int p_resonance) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_percussive_voice(int p_wave_shape, int p_attack_rate, int p_release_rate, int p_release_sweep, int p_cutoff, int p_resonance) const {
 	Ref<SiONVoice> voice = memnew(SiONVoice(SiONModuleType::MODULE_GENERIC_PG, p_wave_shape, p_attack_rate, p_release_rate));
 
 	if (p_attack_rate == 63) {
@@ -847,47 +900,50 @@ void SiONVoicePresetUtil::_create_percussive_voice(const String &p_key, const St
 	voice->set_release_sweep(p_release_sweep);
 	voice->set_filter_envelope(0, p_cutoff, p_resonance);
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
 }
 
-void SiONVoicePresetUtil::_create_analog_voice(const String &p_key, const String &p_name, int p_connection_type, int p_wave_shape1, int p_wave_shape2, int p_balance, int p_pitch_diff) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_analog_voice(int p_connection_type, int p_wave_shape1, int p_wave_shape2, int p_balance, int p_pitch_diff) const {
 	Ref<SiONVoice> voice = memnew(SiONVoice);
 	voice->set_analog_like(p_connection_type, p_wave_shape1, p_wave_shape2, p_balance, p_pitch_diff);
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
 }
 
-void SiONVoicePresetUtil::_create_opn_voice(const String &p_key, const String &p_name, Vector<int> p_params) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_opn_voice(const uint8_t *p_params) const {
+	TypedArray<int> params;
+	for (int i = 0; i < OPN_PARAM_COUNT; i++) {
+		params.push_back(p_params[i]);
+	}
+
 	Ref<SiONVoice> voice = memnew(SiONVoice);
-	TypedArray<int> params = make_typed_array_from_vector<int>(p_params);
 	voice->set_params_opn(params);
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
 }
 
-void SiONVoicePresetUtil::_create_ma3_voice(const String &p_key, const String &p_name, Vector<int> p_params) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_ma3_voice(const uint8_t *p_params) const {
+	TypedArray<int> params;
+	for (int i = 0; i < MA3_PARAM_COUNT; i++) {
+		params.push_back(p_params[i]);
+	}
+
 	Ref<SiONVoice> voice = memnew(SiONVoice);
-	TypedArray<int> params = make_typed_array_from_vector<int>(p_params);
 	voice->set_params_ma3(params);
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
 }
 
-void SiONVoicePresetUtil::_create_wave_table_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_multiple) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_wave_table_voice(int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_multiple) const {
 	Ref<SiONVoice> voice = memnew(SiONVoice(SiONModuleType::MODULE_SCC, p_wave_shape));
-	voice->set_wave_data(_wave_tables[p_wave_shape]);
+	voice->set_wave_data(_get_wave_table(p_wave_shape));
 	voice->set_envelope(p_attack_rate, p_decay_rate, p_sustain_rate, p_release_rate, p_sustain_level, p_total_level + 4);
 	voice->get_channel_params()->get_operator_params(0)->set_multiple(p_multiple);
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
 }
 
-void SiONVoicePresetUtil::_create_single_drum_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_release_sweep, double p_fine_multiple) {
+Ref<SiONVoice> SiONVoicePresetUtil::_create_single_drum_voice(int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_release_sweep, double p_fine_multiple) const {
 	Ref<SiONVoice> voice = memnew(SiONVoice(SiONModuleType::MODULE_GENERIC_PG, p_wave_shape));
 	voice->set_envelope(p_attack_rate, p_decay_rate, p_sustain_rate, p_release_rate, p_sustain_level, p_total_level);
 	voice->get_channel_params()->get_operator_params(0)->set_fine_multiple((int)(p_fine_multiple * 128));
@@ -897,27 +953,109 @@ void SiONVoicePresetUtil::_create_single_drum_voice(const String &p_key, const S
 		voice->set_default_gate_time(0);
 	}
 
-	voice->set_name(p_name);
-	_register_voice(p_key, voice);
+	return voice;
+}
+
+Ref<SiOPMWaveTable> SiONVoicePresetUtil::_get_wave_table(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, _wave_table_count, Ref<SiOPMWaveTable>());
+
+	Vector<int> wavelet;
+	wavelet.resize(WAVE_TABLE_LENGTH);
+	int *wavelet_ptr = wavelet.ptrw();
+	for (int i = 0; i < WAVE_TABLE_LENGTH; i++) {
+		wavelet_ptr[i] = _wave_table_wavelets[p_index][i];
+	}
+
+	// Voices built from the same table share it, as do other utility instances.
+	return InternPoolUtil::intern_wave_table(wavelet);
+}
+
+Ref<SiONVoice> SiONVoicePresetUtil::_build_voice(const PresetEntry &p_entry) const {
+	Ref<SiONVoice> voice;
+	const char *name = nullptr;
+
+	if (p_entry.fm) {
+		const FMPreset *preset = p_entry.fm;
+		name = preset->name;
+
+		switch (p_entry.type) {
+			case PRESET_OPN:
+				voice = _create_opn_voice(preset->params);
+				break;
+			case PRESET_MA3:
+				voice = _create_ma3_voice(preset->params);
+				break;
+			default:
+				break;
+		}
+	} else if (p_entry.simple) {
+		const SimplePreset *preset = p_entry.simple;
+		const int16_t *args = preset->args;
+		name = preset->name;
+
+		switch (preset->type) {
+			case PRESET_BASIC:
+				voice = _create_basic_voice(args[0]);
+				break;
+			case PRESET_PERCUSSIVE:
+				voice = _create_percussive_voice(args[0], args[1], args[2], args[3], args[4], args[5]);
+				break;
+			case PRESET_ANALOG:
+				voice = _create_analog_voice(args[0], args[1], args[2], args[3], args[4]);
+				break;
+			case PRESET_WAVE_TABLE:
+				voice = _create_wave_table_voice(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
+				break;
+			case PRESET_SINGLE_DRUM:
+				voice = _create_single_drum_voice(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], preset->fine_multiple);
+				break;
+			default:
+				break;
+		}
+	}
+
+	ERR_FAIL_COND_V_MSG(voice.is_null(), Ref<SiONVoice>(), "SiONVoicePresetUtil: Invalid voice preset definition.");
+
+	voice->set_name(name);
+	return voice;
+}
+
+void SiONVoicePresetUtil::_register_preset(const String &p_category, const String &p_key, const PresetEntry &p_entry) {
+	ERR_FAIL_COND(_preset_map.has(p_key));
+
+	_category_map[p_category].push_back(p_key);
+	_preset_map[p_key] = p_entry;
 }
 
-void SiONVoicePresetUtil::_begin_category(const String &p_key) {
-	ERR_FAIL_COND(_category_map.has(p_key));
+void SiONVoicePresetUtil::_register_simple_presets(const String &p_category, const SimplePreset *p_presets, int p_count) {
+	ERR_FAIL_COND(_category_map.has(p_category));
+	_category_map[p_category] = PackedStringArray();
+
+	for (int i = 0; i < p_count; i++) {
+		PresetEntry entry;
+		entry.type = p_presets[i].type;
+		entry.simple = &p_presets[i];
 
-	List<Ref<SiONVoice>> category;
-	_current_category = category;
-	_category_map[p_key] = category;
+		_register_preset(p_category, p_presets[i].key, entry);
+	}
 }
 
-void SiONVoicePresetUtil::_register_voice(const String &p_key, const Ref<SiONVoice> &p_voice) {
-	ERR_FAIL_COND(_voice_map.has(p_key));
+void SiONVoicePresetUtil::_register_fm_presets(const String &p_category, PresetType p_type, const FMPreset *p_presets, int p_count) {
+	ERR_FAIL_COND(_category_map.has(p_category));
+	_category_map[p_category] = PackedStringArray();
 
-	_current_category.push_back(p_voice);
-	_voice_map[p_key] = p_voice;
+	for (int i = 0; i < p_count; i++) {
+		PresetEntry entry;
+		entry.type = p_type;
+		entry.fm = &p_presets[i];
+
+		_register_preset(p_category, p_presets[i].key, entry);
+	}
 }
 
-void SiONVoicePresetUtil::_register_wave_table(Vector<int> p_wavelet) {
-	_wave_tables.push_back(memnew(SiOPMWaveTable(p_wavelet)));
+void SiONVoicePresetUtil::_register_wave_tables(const int16_t (*p_wavelets)[WAVE_TABLE_LENGTH], int p_count) {
+	_wave_table_wavelets = p_wavelets;
+	_wave_table_count = p_count;
 }
 
 //
@@ -931,17 +1069,45 @@ SiONVoicePresetUtil *SiONVoicePresetUtil::generate_voices(uint32_t p_flags) {
 PackedStringArray SiONVoicePresetUtil::get_voice_preset_keys() const {
 	PackedStringArray keys;
 
-	for (const KeyValue<String, Ref<SiONVoice>> &E : _voice_map) {
+	for (const KeyValue<String, PresetEntry> &E : _preset_map) {
 		keys.push_back(E.key);
 	}
 
 	return keys;
 }
 
+PackedStringArray SiONVoicePresetUtil::get_voice_preset_categories() const {
+	PackedStringArray categories;
+
+	for (const KeyValue<String, PackedStringArray> &E : _category_map) {
+		categories.push_back(E.key);
+	}
+
+	return categories;
+}
+
+PackedStringArray SiONVoicePresetUtil::get_category_voice_preset_keys(const String &p_category) const {
+	ERR_FAIL_COND_V_MSG(!_category_map.has(p_category), PackedStringArray(), vformat("SiONVoicePresetUtil: Nonexistent voice preset category '%s'.", p_category));
+
+	return _category_map[p_category];
+}
+
 Ref<SiONVoice> SiONVoicePresetUtil::get_voice_preset(const String &p_key) const {
-	ERR_FAIL_COND_V_MSG(!_voice_map.has(p_key), nullptr, vformat("SiONVoicePresetUtil: Nonexistent voice preset '%s'.", p_key));
+	HashMap<String, Ref<SiONVoice>>::ConstIterator cached = _voice_map.find(p_key);
+	if (cached) {
+		return cached->value;
+	}
+
+	HashMap<String, PresetEntry>::ConstIterator preset = _preset_map.find(p_key);
+	ERR_FAIL_COND_V_MSG(!preset, Ref<SiONVoice>(), vformat("SiONVoicePresetUtil: Nonexistent voice preset '%s'.", p_key));
+
+	// Voices are only built the first time they are requested.
+	Ref<SiONVoice> voice = _build_voice(preset->value);
+	if (voice.is_valid()) {
+		_voice_map[p_key] = voice;
+	}
 
-	return _voice_map[p_key];
+	return voice;
 }
 
 //
@@ -949,6 +1115,8 @@ Ref<SiONVoice> SiONVoicePresetUtil::get_voice_preset(const String &p_key) const
 void SiONVoicePresetUtil::_bind_methods() {
 	ClassDB::bind_static_method("SiONVoicePresetUtil", D_METHOD("generate_voices", "flags"), &SiONVoicePresetUtil::generate_voices, DEFVAL(GeneratorFlags::INCLUDE_ALL));
 	ClassDB::bind_method(D_METHOD("get_voice_preset_keys"), &SiONVoicePresetUtil::get_voice_preset_keys);
+	ClassDB::bind_method(D_METHOD("get_voice_preset_categories"), &SiONVoicePresetUtil::get_voice_preset_categories);
+	ClassDB::bind_method(D_METHOD("get_category_voice_preset_keys", "category"), &SiONVoicePresetUtil::get_category_voice_preset_keys);
 	ClassDB::bind_method(D_METHOD("get_voice_preset", "key"), &SiONVoicePresetUtil::get_voice_preset);
 
 	BIND_ENUM_CONSTANT(INCLUDE_DEFAULT);
@@ -961,8 +1129,7 @@ void SiONVoicePresetUtil::_bind_methods() {
 }
 
 SiONVoicePresetUtil::~SiONVoicePresetUtil() {
-	_current_category.clear();
 	_category_map.clear();
+	_preset_map.clear();
 	_voice_map.clear();
-	_wave_tables.clear();
 }
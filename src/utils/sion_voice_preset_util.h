@@ -7,10 +7,10 @@
 #ifndef SION_VOICE_PRESET_UTIL_H
 #define SION_VOICE_PRESET_UTIL_H
 
+#include <cstdint>
 #include <godot_cpp/core/binder_common.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
-#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/string.hpp>
@@ -22,6 +22,7 @@ class SiOPMWaveTable;
 
 // A utility class for generating voice presets.
 // 650 voices are available at this time (default:16, valsound:258, GM:128x2, GMdrum:60x2).
+// Generating only registers the keys, each voice is built the first time it is requested.
 class SiONVoicePresetUtil : public Object {
 	GDCLASS(SiONVoicePresetUtil, Object)
 
@@ -38,10 +39,37 @@ public:
 	};
 
 private:
-	List<Ref<SiONVoice>> _current_category;
-	HashMap<String, List<Ref<SiONVoice>>> _category_map;
-	HashMap<String, Ref<SiONVoice>> _voice_map;
-	List<Ref<SiOPMWaveTable>> _wave_tables;
+	enum PresetType {
+		PRESET_BASIC,
+		PRESET_PERCUSSIVE,
+		PRESET_ANALOG,
+		PRESET_OPN,
+		PRESET_MA3,
+		PRESET_WAVE_TABLE,
+		PRESET_SINGLE_DRUM,
+	};
+
+	static const int OPN_PARAM_COUNT = 42;
+	static const int MA3_PARAM_COUNT = 50;
+	static const int WAVE_TABLE_LENGTH = 32;
+
+	// Static preset definitions, see the implementation file.
+	struct SimplePreset;
+	struct FMPreset;
+
+	struct PresetEntry {
+		PresetType type = PRESET_BASIC;
+		const SimplePreset *simple = nullptr;
+		const FMPreset *fm = nullptr;
+	};
+
+	// Keys and categories are registered upfront, voices are built on first request and cached.
+	HashMap<String, PackedStringArray> _category_map;
+	HashMap<String, PresetEntry> _preset_map;
+	mutable HashMap<String, Ref<SiONVoice>> _voice_map;
+
+	const int16_t (*_wave_table_wavelets)[WAVE_TABLE_LENGTH] = nullptr;
+	int _wave_table_count = 0;
 
 	void _generate_voices(uint32_t p_flags);
 	void _generate_default_voices();
@@ -51,17 +79,21 @@ private:
 	void _generate_wave_table_voices();
 	void _generate_single_drum_voices();
 
-	void _create_basic_voice(const String &p_key, const String &p_name, int p_channel_num);
-	void _create_percussive_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_release_rate, int p_release_sweep, int p_cutoff = 128, int p_resonance = 0);
-	void _create_analog_voice(const String &p_key, const String &p_name, int p_connection_type, int p_wave_shape1 = 0, int p_wave_shape2 = 0, int p_balance = 0, int p_pitch_diff = 0);
-	void _create_opn_voice(const String &p_key, const String &p_name, Vector<int> p_params);
-	void _create_ma3_voice(const String &p_key, const String &p_name, Vector<int> p_params);
-	void _create_wave_table_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_multiple = 1);
-	void _create_single_drum_voice(const String &p_key, const String &p_name, int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_release_sweep = 0, double p_fine_multiple = 1);
+	Ref<SiONVoice> _create_basic_voice(int p_channel_num) const;
+	Ref<SiONVoice> _create_percussive_voice(int p_wave_shape, int p_attack_rate, int p_release_rate, int p_release_sweep, int p_cutoff, int p_resonance) const;
+	Ref<SiONVoice> _create_analog_voice(int p_connection_type, int p_wave_shape1, int p_wave_shape2, int p_balance, int p_pitch_diff) const;
+	Ref<SiONVoice> _create_opn_voice(const uint8_t *p_params) const;
+	Ref<SiONVoice> _create_ma3_voice(const uint8_t *p_params) const;
+	Ref<SiONVoice> _create_wave_table_voice(int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_multiple) const;
+	Ref<SiONVoice> _create_single_drum_voice(int p_wave_shape, int p_attack_rate, int p_decay_rate, int p_sustain_rate, int p_release_rate, int p_sustain_level, int p_total_level, int p_release_sweep, double p_fine_multiple) const;
+
+	Ref<SiOPMWaveTable> _get_wave_table(int p_index) const;
+	Ref<SiONVoice> _build_voice(const PresetEntry &p_entry) const;
 
-	void _begin_category(const String &p_key);
-	void _register_voice(const String &p_key, const Ref<SiONVoice> &p_voice);
-	void _register_wave_table(Vector<int> p_wavelet);
+	void _register_preset(const String &p_category, const String &p_key, const PresetEntry &p_entry);
+	void _register_simple_presets(const String &p_category, const SimplePreset *p_presets, int p_count);
+	void _register_fm_presets(const String &p_category, PresetType p_type, const FMPreset *p_presets, int p_count);
+	void _register_wave_tables(const int16_t (*p_wavelets)[WAVE_TABLE_LENGTH], int p_count);
 
 protected:
 	static void _bind_methods();
@@ -69,6 +101,8 @@ protected:
 public:
 	static SiONVoicePresetUtil *generate_voices(uint32_t p_flags = GeneratorFlags::INCLUDE_ALL);
 	PackedStringArray get_voice_preset_keys() const;
+	PackedStringArray get_voice_preset_categories() const;
+	PackedStringArray get_category_voice_preset_keys(const String &p_category) const;
 	Ref<SiONVoice> get_voice_preset(const String &p_key) const;
 
 	SiONVoicePresetUtil() {}
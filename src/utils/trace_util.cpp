@@ -0,0 +1,109 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#include "trace_util.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include "utils/profiler_util.h"
+
+std::atomic<TraceUtil::ThreadRing *> TraceUtil::_rings = { nullptr };
+
+TraceUtil::ThreadRing *TraceUtil::_get_thread_ring() {
+	thread_local ThreadRing *ring = nullptr;
+	if (ring) {
+		return ring;
+	}
+
+	ring = memnew(ThreadRing);
+	ring->thread_id = OS::get_singleton()->get_thread_caller_id();
+
+	// Push to the front of the list.
+	ThreadRing *head = _rings.load(std::memory_order_acquire);
+	do {
+		ring->next = head;
+	} while (!_rings.compare_exchange_weak(head, ring, std::memory_order_acq_rel, std::memory_order_acquire));
+
+	return ring;
+}
+
+void TraceUtil::record(const char *p_name, uint64_t p_timestamp, uint64_t p_duration, int p_argument, bool p_is_instant) {
+	ThreadRing *ring = _get_thread_ring();
+
+	const uint64_t index = ring->write_count.load(std::memory_order_relaxed);
+	Event &event = ring->events[index & (RING_SIZE - 1)];
+	event.name = p_name;
+	event.timestamp = p_timestamp;
+	event.duration = p_duration;
+	event.argument = p_argument;
+	event.is_instant = p_is_instant;
+
+	ring->write_count.store(index + 1, std::memory_order_release);
+}
+
+void TraceUtil::record_instant(const char *p_name, int p_argument) {
+	record(p_name, ProfilerUtil::get_ticks_usec(), 0, p_argument, true);
+}
+
+Error TraceUtil::dump_chrome_trace(const String &p_path) {
+#ifndef SION_TRACE_ENABLED
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "TraceUtil: Tracing is not compiled in, build with sion_trace=yes.");
+#else
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("TraceUtil: Cannot open '%s' for writing.", p_path));
+
+	file->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	bool first = true;
+	for (ThreadRing *ring = _rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+		const uint64_t write_count = ring->write_count.load(std::memory_order_acquire);
+		const uint64_t first_index = (write_count > RING_SIZE ? write_count - RING_SIZE : 0);
+
+		for (uint64_t i = first_index; i < write_count; i++) {
+			const Event &event = ring->events[i & (RING_SIZE - 1)];
+
+			String line = vformat("{\"name\":\"%s\",\"pid\":1,\"tid\":%d,\"ts\":%d", event.name, (int64_t)ring->thread_id, (int64_t)event.timestamp);
+			if (event.is_instant) {
+				line += ",\"ph\":\"i\",\"s\":\"t\"";
+			} else {
+				line += vformat(",\"ph\":\"X\",\"dur\":%d", (int64_t)event.duration);
+			}
+			if (event.argument != NO_ARGUMENT) {
+				line += vformat(",\"args\":{\"value\":%d}", event.argument);
+			}
+			line += "}";
+
+			file->store_string(first ? line : ",\n" + line);
+			first = false;
+		}
+	}
+
+	file->store_string("\n]}\n");
+	return OK;
+#endif
+}
+
+void TraceUtil::clear() {
+	// Only resets the counters, writers may be recording concurrently.
+	for (ThreadRing *ring = _rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+		ring->write_count.store(0, std::memory_order_release);
+	}
+}
+
+// Scope.
+
+TraceUtil::Scope::Scope(const char *p_name, int p_argument) {
+	_name = p_name;
+	_argument = p_argument;
+	_start = ProfilerUtil::get_ticks_usec();
+}
+
+TraceUtil::Scope::~Scope() {
+	const uint64_t end = ProfilerUtil::get_ticks_usec();
+	record(_name, _start, end - _start, _argument, false);
+}
@@ -0,0 +1,93 @@
+/***************************************************/
+/* Part of GDSiON software synthesizer             */
+/* Copyright (c) 2024 Yuri Sizov and contributors  */
+/* Provided under MIT                              */
+/***************************************************/
+
+#ifndef SION_TRACE_UTIL_H
+#define SION_TRACE_UTIL_H
+
+#include <atomic>
+#include <cstdint>
+#include <godot_cpp/classes/global_constants.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+// Timeline of the audio pipeline, for investigating buffer underruns. Scoped markers and instant
+// events are recorded into a ring per thread, without locks, and can be dumped to a Chrome trace
+// JSON file on demand (chrome://tracing, or ui.perfetto.dev).
+//
+// Tracing is compiled in only with the sion_trace=yes build option. Otherwise the markers expand
+// to nothing, and dumping reports an error.
+class TraceUtil {
+public:
+	// Events per thread. Older events are overwritten.
+	static const int RING_SIZE = 1 << 16;
+	static const int NO_ARGUMENT = INT32_MIN;
+
+	struct Event {
+		// Must be a string literal, only the pointer is stored.
+		const char *name = nullptr;
+		uint64_t timestamp = 0; // usec
+		uint64_t duration = 0;  // usec, 0 for instant events
+		int argument = NO_ARGUMENT;
+		bool is_instant = false;
+	};
+
+	struct ThreadRing {
+		ThreadRing *next = nullptr;
+		uint64_t thread_id = 0;
+		// Only the owning thread writes. Readers may see an event that is being overwritten,
+		// which is acceptable for a debugging tool.
+		std::atomic<uint64_t> write_count;
+		Event events[RING_SIZE];
+
+		ThreadRing() { write_count.store(0); }
+	};
+
+private:
+	// Rings are never freed, threads can come and go while a dump is in progress.
+	static std::atomic<ThreadRing *> _rings;
+
+	static ThreadRing *_get_thread_ring();
+
+public:
+	static void record(const char *p_name, uint64_t p_timestamp, uint64_t p_duration, int p_argument, bool p_is_instant);
+	static void record_instant(const char *p_name, int p_argument = NO_ARGUMENT);
+
+	// Writes the recorded events of all threads as Chrome trace JSON.
+	static Error dump_chrome_trace(const String &p_path);
+	static void clear();
+
+	class Scope {
+		const char *_name = nullptr;
+		int _argument = NO_ARGUMENT;
+		uint64_t _start = 0;
+
+	public:
+		Scope(const char *p_name, int p_argument = NO_ARGUMENT);
+		~Scope();
+	};
+};
+
+#ifdef SION_TRACE_ENABLED
+
+#define SION_TRACE_CONCAT_IMPL(m_a, m_b) m_a##m_b
+#define SION_TRACE_CONCAT(m_a, m_b) SION_TRACE_CONCAT_IMPL(m_a, m_b)
+
+#define SION_TRACE_SCOPE(m_name) TraceUtil::Scope SION_TRACE_CONCAT(_trace_scope_, __LINE__)(m_name)
+#define SION_TRACE_SCOPE_ARG(m_name, m_argument) TraceUtil::Scope SION_TRACE_CONCAT(_trace_scope_, __LINE__)(m_name, m_argument)
+#define SION_TRACE_INSTANT(m_name) TraceUtil::record_instant(m_name)
+#define SION_TRACE_INSTANT_ARG(m_name, m_argument) TraceUtil::record_instant(m_name, m_argument)
+
+#else
+
+#define SION_TRACE_SCOPE(m_name)
+#define SION_TRACE_SCOPE_ARG(m_name, m_argument)
+#define SION_TRACE_INSTANT(m_name)
+#define SION_TRACE_INSTANT_ARG(m_name, m_argument)
+
+#endif // SION_TRACE_ENABLED
+
+#endif // SION_TRACE_UTIL_H
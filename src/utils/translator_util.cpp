@@ -19,6 +19,7 @@
 #include "chip/wave/siopm_wave_sampler_table.h"
 #include "sequencer/simml_ref_table.h"
 #include "utils/godot_util.h"
+#include "utils/intern_pool_util.h"
 
 // Channel params.
 
@@ -1680,10 +1681,25 @@ bool TranslatorUtil::parse_sampler_wave(const Ref<SiOPMWaveSamplerTable> &p_tabl
 	int start_point      = PARSE_ARGUMENT(4, -1);
 	int end_point        = PARSE_ARGUMENT(5, -1);
 	int loop_point       = PARSE_ARGUMENT(6, -1);
+	int root_note        = PARSE_ARGUMENT(7, -1);
+	int key_range_to     = PARSE_ARGUMENT(8, -1);
+	int quality          = PARSE_ARGUMENT(9, SAMPLER_QUALITY_MEDIUM);
 
-	Ref<SiOPMWaveSamplerData> sampler_data = memnew(SiOPMWaveSamplerData(p_sound_ref_table[wave_id], ignore_note_off, pan, 2, channel_count));
-	sampler_data->slice(start_point, end_point, loop_point);
-	p_table->set_sample(sampler_data, p_note_number);
+	ERR_FAIL_INDEX_V_MSG(quality, SAMPLER_QUALITY_MAX, false, vformat("Translator: Invalid sampler resampling quality %d.", quality));
+
+	// Identical definitions of the same sound share their data.
+	const Variant &source = p_sound_ref_table[wave_id];
+	const String pool_key = vformat("sampler:%s:%s:%d:%d:%d:%d:%d:%d:%d:%d:%d", wave_id, InternPoolUtil::get_source_key(source), ignore_note_off, pan, channel_count, start_point, end_point, loop_point, root_note, quality, SiOPMWaveSamplerData::get_default_format());
+
+	Ref<SiOPMWaveSamplerData> sampler_data = InternPoolUtil::find_sound_wave(pool_key, source);
+	if (sampler_data.is_null()) {
+		sampler_data = Ref<SiOPMWaveSamplerData>(memnew(SiOPMWaveSamplerData(source, ignore_note_off, pan, 2, channel_count)));
+		sampler_data->slice(start_point, end_point, loop_point);
+		sampler_data->set_root_note(root_note);
+		sampler_data->set_resampling_quality((SiONSamplerQuality)quality);
+		InternPoolUtil::add_sound_wave(pool_key, source, sampler_data);
+	}
+	p_table->set_sample(sampler_data, p_note_number, key_range_to);
 
 	return true;
 }
@@ -1705,8 +1721,16 @@ bool TranslatorUtil::parse_pcm_wave(const Ref<SiOPMWavePCMTable> &p_table, Strin
 	int end_point      = PARSE_ARGUMENT(6, -1);
 	int loop_point     = PARSE_ARGUMENT(7, -1);
 
-	Ref<SiOPMWavePCMData> pcm_data = memnew(SiOPMWavePCMData(p_sound_ref_table[wave_id], sampling_pitch, 2, channel_count));
-	pcm_data->slice(start_point, end_point, loop_point);
+	// Identical definitions of the same sound share their data.
+	const Variant &source = p_sound_ref_table[wave_id];
+	const String pool_key = vformat("pcm:%s:%s:%d:%d:%d:%d:%d", wave_id, InternPoolUtil::get_source_key(source), sampling_pitch, channel_count, start_point, end_point, loop_point);
+
+	Ref<SiOPMWavePCMData> pcm_data = InternPoolUtil::find_sound_wave(pool_key, source);
+	if (pcm_data.is_null()) {
+		pcm_data = Ref<SiOPMWavePCMData>(memnew(SiOPMWavePCMData(source, sampling_pitch, 2, channel_count)));
+		pcm_data->slice(start_point, end_point, loop_point);
+		InternPoolUtil::add_sound_wave(pool_key, source, pcm_data);
+	}
 	p_table->set_key_range_data(pcm_data, key_range_from, key_range_to);
 
 	return true;
@@ -0,0 +1,146 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+class_name BenchmarkBase extends RefCounted
+
+static var benchmark_counter: int = 0
+
+# Each measurement is repeated, and the fastest run is reported.
+var iterations: int = 3
+var results: Array[Dictionary] = []
+
+var _start_time: int = -1
+
+
+# Called automatically before run().
+func prepare() -> void:
+	benchmark_counter += 1
+
+	var benchmark_group: String = get("group")
+	if benchmark_group.is_empty():
+		benchmark_group = "General"
+
+	var benchmark_name: String = get("name")
+	if benchmark_name.is_empty():
+		benchmark_name = "Unnamed"
+
+	print_rich("[bgcolor=gray]%d. [%s] %s[/bgcolor]" % [ benchmark_counter, benchmark_group, benchmark_name ])
+	_start_time = Time.get_ticks_msec()
+
+
+# Called automatically. Must be implemented by individual benchmark scripts.
+func run(_scene_tree: SceneTree) -> void:
+	pass
+
+
+# Called automatically after run().
+func print_output() -> void:
+	var execution_time := Time.get_ticks_msec() - _start_time
+
+	for result in results:
+		var summary := "%.0f samples/sec" % [ result["samples_per_sec"] ] if result.has("samples_per_sec") else "%.0f chars/sec" % [ result["chars_per_sec"] ]
+		if result.get("ns_per_voice", 0.0) > 0.0:
+			summary += ", %.1f ns/voice" % [ result["ns_per_voice"] ]
+
+		print_rich("[color=blue]%s[/color]:\t%s" % [ result["name"], summary ])
+
+	print_rich("[color=gray]Finished in %.3f sec.[/color]" % [ execution_time / 1000.0 ])
+
+
+# Measurement helpers.
+
+# Renders the data for the given duration in stereo. Voices are the number of simultaneously
+# sounding channels, used to normalize the time per sample.
+func _measure_render(driver: SiONDriver, label: String, data: SiONData, seconds: float, voices: int, reset_effector: bool = true) -> Dictionary:
+	var sample_count := roundi(seconds * driver.get_sample_rate())
+	var best_usec := -1
+	var best_profile := {}
+
+	for i in iterations:
+		var start_usec := Time.get_ticks_usec()
+		driver.render(data, sample_count * 2, 2, reset_effector)
+		var elapsed_usec := Time.get_ticks_usec() - start_usec
+
+		if best_usec < 0 || elapsed_usec < best_usec:
+			best_usec = elapsed_usec
+			best_profile = driver.get_performance_profile()["totals"]
+
+	var result := {
+		"name": label,
+		"iterations": iterations,
+		"samples": sample_count,
+		"voices": voices,
+		"elapsed_usec": best_usec,
+		"samples_per_sec": sample_count * 1000000.0 / maxi(best_usec, 1),
+		"ns_per_voice": (best_usec * 1000.0 / (sample_count * voices)) if voices > 0 else 0.0,
+		"real_time_factor": best_usec / (seconds * 1000000.0),
+		"stages_usec": best_profile,
+	}
+
+	results.push_back(result)
+	return result
+
+
+func _measure_compile(driver: SiONDriver, label: String, mml_strings: PackedStringArray) -> Dictionary:
+	var char_count := 0
+	for mml in mml_strings:
+		char_count += mml.length()
+
+	var best_usec := -1
+	for i in iterations:
+		var start_usec := Time.get_ticks_usec()
+		for mml in mml_strings:
+			driver.compile(mml)
+		var elapsed_usec := Time.get_ticks_usec() - start_usec
+
+		if best_usec < 0 || elapsed_usec < best_usec:
+			best_usec = elapsed_usec
+
+	var result := {
+		"name": label,
+		"iterations": iterations,
+		"sources": mml_strings.size(),
+		"chars": char_count,
+		"elapsed_usec": best_usec,
+		"chars_per_sec": char_count * 1000000.0 / maxi(best_usec, 1),
+	}
+
+	results.push_back(result)
+	return result
+
+
+# MML helpers.
+
+# Returns a #@ (SiOPM) voice definition with the given operator count and algorithm.
+# The last operator is the loudest one, so every algorithm produces sound.
+func _make_fm_voice_mml(index: int, operator_count: int, algorithm: int) -> String:
+	var voice_mml := "#@%d{ %d, 3, 0,\n" % [ index, algorithm ]
+	for op_index in operator_count:
+		var total_level := 0 if op_index == operator_count - 1 else 24
+		# WS, AR, DR, SR, RR, SL, TL, KR, KL, ML, D1, D2, AM, PH, FN
+		voice_mml += "0, 63, 8, 0, 28, 2, %d, 0, 0, %d, 0, 0, 0, 0, 0,\n" % [ total_level, op_index + 1 ]
+	voice_mml += "};\n"
+
+	return voice_mml
+
+
+# Returns a sequence which holds one note for 32 seconds at the default tempo.
+func _make_held_note_mml(voice_index: int, octave: int, note: String) -> String:
+	return "%%6@%d o%d q8 l1 %s^1^1^1^1^1^1^1^1^1^1^1^1^1^1^1;\n" % [ voice_index, octave, note ]
+
+
+# Returns a song with busy sequences for every track, cycling through algorithms.
+func _make_synthetic_song_mml(track_count: int, bars: int) -> String:
+	var song_mml := "t140;\n"
+	for i in 4:
+		song_mml += _make_fm_voice_mml(i, 4, i * 3)
+
+	var phrases := [ "cdefgab<c>", "c<c>gec<c>ge", "a4e4a4<c4>", "e4r8f8g4r8a8" ]
+	for track_index in track_count:
+		var phrase: String = phrases[track_index % phrases.size()]
+		song_mml += "%%6@%d o%d l8 v%d [%s]%d;\n" % [ track_index % 4, 3 + track_index % 3, 8 + track_index % 8, phrase, bars ]
+
+	return song_mml
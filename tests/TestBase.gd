@@ -8,6 +8,20 @@ class_name TestBase extends RefCounted
 
 static var test_counter: int = 0
 
+# Performance mode state, set up by the runner. Measurements are compared against the baseline,
+# and fail when they are slower by more than the threshold (a fraction of the baseline value).
+static var perf_baseline: Dictionary = {}
+static var perf_threshold: float = 0.25
+static var perf_results: Dictionary = {}
+
+# Differences below these values are considered noise and never fail.
+const PERF_NOISE_FLOOR := {
+	"real_time_factor": 0.002,
+	"peak_usec": 100.0,
+}
+# Each render is repeated, and the best result is used.
+const PERF_RUNS := 3
+
 var asserts_total: int = 0
 var asserts_success: int = 0
 
@@ -149,6 +163,62 @@ func _assert_not_null(label: String, value: Object) -> bool:
 		return false
 
 
+func _assert_performance(label: String, key: String, measurement: Dictionary) -> bool:
+	asserts_total += 1
+	perf_results[key] = measurement
+
+	var summary := "rtf %.4f, peak %d usec" % [ measurement["real_time_factor"], measurement["peak_usec"] ]
+	if not perf_baseline.has(key):
+		asserts_success += 1
+		_print_ok(label, summary + " (no baseline)")
+		return true
+
+	var baseline: Dictionary = perf_baseline[key]
+	var regressions := PackedStringArray()
+	for metric: String in PERF_NOISE_FLOOR:
+		if not baseline.has(metric):
+			continue
+
+		var value: float = measurement[metric]
+		var against: float = baseline[metric]
+		if value > against * (1.0 + perf_threshold) && (value - against) > PERF_NOISE_FLOOR[metric]:
+			regressions.push_back("%s %.4f > %.4f" % [ metric, value, against ])
+
+	if regressions.is_empty():
+		asserts_success += 1
+		_print_ok(label, summary)
+		return true
+	else:
+		_print_fail(label, "regressed by more than %d%%: %s" % [ roundi(perf_threshold * 100), ", ".join(regressions) ])
+		return false
+
+
+# Performance helpers.
+
+# Renders the data offline and returns the real-time factor and the slowest buffer time.
+func _measure_render_performance(driver: SiONDriver, data: SiONData, seconds: float) -> Dictionary:
+	var sample_count := roundi(seconds * driver.get_sample_rate())
+	var measurement := {}
+
+	for i in PERF_RUNS:
+		driver.render(data, sample_count * 2, 2)
+
+		var profile := driver.get_performance_profile()
+		var totals: Dictionary = profile["totals"]
+		var rendered_usec: float = totals["buffer_count"] * profile["buffer_usec"]
+		var real_time_factor: float = (totals["total_usec"] / rendered_usec) if rendered_usec > 0 else 0.0
+		var peak_usec: float = totals["max_usec"]
+
+		if measurement.is_empty():
+			measurement["real_time_factor"] = real_time_factor
+			measurement["peak_usec"] = peak_usec
+		else:
+			measurement["real_time_factor"] = minf(measurement["real_time_factor"], real_time_factor)
+			measurement["peak_usec"] = minf(measurement["peak_usec"], peak_usec)
+
+	return measurement
+
+
 # Subroutine helpers.
 
 func _run_subscript(path: String, arguments: PackedStringArray) -> String:
@@ -0,0 +1,138 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends SceneTree
+
+const BenchmarkBase := preload("res://BenchmarkBase.gd")
+const BENCHMARK_ROOT := "./benchmark"
+const DEFAULT_OUTPUT_PATH := "./benchmark-results.json"
+
+var results: Array[Dictionary] = []
+
+var start_time: int = -1
+
+
+func _init():
+	# Delay everything by one frame so the initialization is complete before we run benchmarks.
+	await process_frame
+
+	print("")
+	print_rich("[color=gray]=========== RUNNING GDSION BENCHMARKS ===========[/color]")
+	print("")
+
+	var fs := DirAccess.open(BENCHMARK_ROOT)
+	if not fs:
+		_quit_fatal("Fatal Error: Unable to open the benchmark root at '%s' (code %d)." % [ BENCHMARK_ROOT, DirAccess.get_open_error() ])
+		return
+
+	# Passing `-- --case script_filename_sans_ext` should only run that one script.
+	# Multiple `--case script_filename_sans_ext` entries are also allowed.
+	# Passing `--output path` changes where results are written, `--iterations count` changes
+	# how many times each measurement is repeated.
+	var args := _get_args()
+	var selected_scripts: PackedStringArray = args["cases"]
+
+	start_time = Time.get_ticks_msec()
+
+	var benchmark_files := fs.get_files()
+	for file_name in benchmark_files:
+		if file_name.get_extension() != "gd":
+			continue
+
+		var script_base := file_name.get_basename()
+		if not selected_scripts.is_empty() && not selected_scripts.has(script_base):
+			continue
+
+		var script_name := BENCHMARK_ROOT.path_join(file_name)
+		var script: GDScript = load(script_name)
+		if not script:
+			printerr("Warning: Failed to load script at '%s'." % [ script_name ])
+			continue
+
+		var script_instance: BenchmarkBase = script.new()
+		script_instance.iterations = args["iterations"]
+		script_instance.prepare()
+		await script_instance.run(self)
+
+		script_instance.print_output()
+		print("")
+
+		for result in script_instance.results:
+			result["case"] = script_base
+			results.push_back(result)
+
+	_store_results(args["output"])
+	_quit_with_status(args["output"])
+
+
+func _get_args() -> Dictionary:
+	var args := {
+		"cases": PackedStringArray(),
+		"output": DEFAULT_OUTPUT_PATH,
+		"iterations": 3,
+	}
+
+	var user_args := OS.get_cmdline_user_args()
+	var i := 0
+	while i < user_args.size():
+		var arg_key := user_args[i]
+
+		if arg_key in [ "--case", "--output", "--iterations" ] && (i + 1) < user_args.size():
+			i += 1
+
+			var arg_value := user_args[i]
+			if not arg_value.begins_with("--"):
+				match arg_key:
+					"--case":
+						args["cases"].push_back(arg_value)
+					"--output":
+						args["output"] = arg_value
+					"--iterations":
+						args["iterations"] = maxi(1, arg_value.to_int())
+
+		i += 1
+
+	return args
+
+
+func _store_results(output_path: String) -> void:
+	var report := {
+		"engine_version": Engine.get_version_info()["string"],
+		"platform": OS.get_name(),
+		"processor": OS.get_processor_name(),
+		"timestamp": Time.get_datetime_string_from_system(true),
+		"results": results,
+	}
+
+	var file := FileAccess.open(output_path, FileAccess.WRITE)
+	if not file:
+		printerr("Error: Unable to write results to '%s' (code %d)." % [ output_path, FileAccess.get_open_error() ])
+		return
+
+	file.store_string(JSON.stringify(report, "\t"))
+
+
+func _quit_fatal(message: String) -> void:
+	print("")
+	print_rich("[color=gray]=========== FAILED GDSION BENCHMARKS ===========[/color]")
+	printerr(message)
+	print("")
+
+	quit(2)
+
+
+func _quit_with_status(output_path: String) -> void:
+	print_rich("[color=gray]=========== FINISHED GDSION BENCHMARKS ===========[/color]")
+	print("")
+
+	var execution_time := Time.get_ticks_msec() - start_time
+
+	print_rich("[color=blue]Measurements[/color]:\t[b]%d[/b]" % [ results.size() ])
+	print_rich("[color=blue]Results[/color]:\t[b]%s[/b]" % [ output_path ])
+	print_rich("[color=gray]Time:\t\t[b]%.3f sec[/b][/color]" % [ execution_time / 1000.0 ])
+
+	print("")
+	quit(0)
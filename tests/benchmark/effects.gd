@@ -0,0 +1,51 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://BenchmarkBase.gd"
+
+var group: String = "SiEffectBase"
+var name: String = "Effects"
+
+const RENDER_SECONDS := 10.0
+const VOICE_COUNT := 4
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var mml := _make_fm_voice_mml(0, 2, 0)
+	for i in VOICE_COUNT:
+		mml += _make_held_note_mml(0, 3 + i, "cegb"[i])
+	var data := driver.compile(mml)
+
+	# Baseline without any effects. This also resets the effector for the runs below.
+	_measure_render(driver, "effect-none", data, RENDER_SECONDS, VOICE_COUNT)
+
+	# Every concrete effect, with default settings, as the only master effect.
+	var effect_classes := _get_effect_classes()
+	for effect_class in effect_classes:
+		var effect: SiEffectBase = ClassDB.instantiate(effect_class)
+		driver.get_effector().add_slot_effect(0, effect)
+
+		_measure_render(driver, "effect-%s" % [ effect_class ], data, RENDER_SECONDS, VOICE_COUNT, false)
+		driver.get_effector().clear_slot_effects(0)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _get_effect_classes() -> PackedStringArray:
+	var effect_classes := PackedStringArray()
+	for effect_class in ClassDB.get_inheriters_from_class("SiEffectBase"):
+		if ClassDB.can_instantiate(effect_class):
+			effect_classes.push_back(effect_class)
+
+	effect_classes.sort()
+	return effect_classes
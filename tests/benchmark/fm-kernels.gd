@@ -0,0 +1,36 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://BenchmarkBase.gd"
+
+var group: String = "SiOPMChannelFM"
+var name: String = "FM Kernels"
+
+const RENDER_SECONDS := 10.0
+const VOICE_COUNT := 8
+
+# Number of algorithms available for each operator count, see SiOPMChannelFM::set_algorithm().
+const ALGORITHM_COUNTS := { 1: 1, 2: 3, 3: 7, 4: 13 }
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	for operator_count: int in ALGORITHM_COUNTS:
+		for algorithm in ALGORITHM_COUNTS[operator_count]:
+			var mml := _make_fm_voice_mml(0, operator_count, algorithm)
+			for i in VOICE_COUNT:
+				mml += _make_held_note_mml(0, 3 + i % 4, "cdefgab"[i % 7])
+
+			var data := driver.compile(mml)
+			_measure_render(driver, "fm-op%d-al%d" % [ operator_count, algorithm ], data, RENDER_SECONDS, VOICE_COUNT)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
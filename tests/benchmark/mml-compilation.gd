@@ -0,0 +1,50 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://BenchmarkBase.gd"
+
+var group: String = "MML"
+var name: String = "Compilation"
+
+# Tunes downloaded by the mml-compilation test, if it has been run before.
+const CORPUS_PATH := "./run/mml-compilation/inputs"
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var synthetic_mml := PackedStringArray([ _make_synthetic_song_mml(32, 256) ])
+	_measure_compile(driver, "compile-synthetic", synthetic_mml)
+
+	var corpus_mml := _load_corpus()
+	if not corpus_mml.is_empty():
+		_measure_compile(driver, "compile-corpus", corpus_mml)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _load_corpus() -> PackedStringArray:
+	var corpus_mml := PackedStringArray()
+
+	var fs := DirAccess.open(CORPUS_PATH)
+	if not fs:
+		print_rich("[color=gray]No MML corpus at '%s', run the mml-compilation test to download it.[/color]" % [ CORPUS_PATH ])
+		return corpus_mml
+
+	for file_name in fs.get_files():
+		if file_name.get_extension() != "mml":
+			continue
+
+		var file := FileAccess.open(CORPUS_PATH.path_join(file_name), FileAccess.READ)
+		if file:
+			corpus_mml.push_back(file.get_as_text(true))
+
+	return corpus_mml
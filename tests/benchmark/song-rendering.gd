@@ -0,0 +1,35 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://BenchmarkBase.gd"
+
+var group: String = "SiONDriver"
+var name: String = "Song Rendering"
+
+const RENDER_SECONDS := 30.0
+const TRACK_COUNT := 16
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	# Sequencing, synthesis, and mixing together, with frequent key on and off events.
+	var data := driver.compile(_make_synthetic_song_mml(TRACK_COUNT, 64))
+	_measure_render(driver, "song-synthetic", data, RENDER_SECONDS, TRACK_COUNT)
+
+	# Same song with the sequencer doing the heavy lifting, many short notes on every track.
+	var dense_mml := "t240;\n" + _make_fm_voice_mml(0, 2, 1)
+	for i in TRACK_COUNT:
+		dense_mml += "%%6@0 o%d l32 q4 [cdefgab<c>]256;\n" % [ 3 + i % 3 ]
+	data = driver.compile(dense_mml)
+	_measure_render(driver, "song-dense-events", data, RENDER_SECONDS, TRACK_COUNT)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
@@ -0,0 +1,33 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://BenchmarkBase.gd"
+
+var group: String = "SiOPMStream"
+var name: String = "Stream Mixing"
+
+const RENDER_SECONDS := 10.0
+const TRACK_COUNTS := [ 1, 4, 16, 32, 64 ]
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	# Cheapest voice, so the time is dominated by writing and mixing track streams.
+	for track_count: int in TRACK_COUNTS:
+		var mml := _make_fm_voice_mml(0, 1, 0)
+		for i in track_count:
+			mml += _make_held_note_mml(0, 2 + i % 6, "cdefgab"[i % 7])
+
+		var data := driver.compile(mml)
+		_measure_render(driver, "mixing-tracks%d" % [ track_count ], data, RENDER_SECONDS, track_count)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
@@ -0,0 +1,36 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "Performance"
+var name: String = "Songs Rendering"
+
+const SONGS_PATH := "./perf/songs"
+const RENDER_SECONDS := 20.0
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var fs := DirAccess.open(SONGS_PATH)
+	if _assert_not_null("songs folder", fs):
+		for file_name in fs.get_files():
+			if file_name.get_extension() != "mml":
+				continue
+
+			var file := FileAccess.open(SONGS_PATH.path_join(file_name), FileAccess.READ)
+			var data := driver.compile(file.get_as_text(true))
+
+			var measurement := _measure_render_performance(driver, data, RENDER_SECONDS)
+			_assert_performance("render song - %s" % [ file_name ], "song/%s" % [ file_name.get_basename() ], measurement)
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
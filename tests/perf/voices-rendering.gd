@@ -0,0 +1,41 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "Performance"
+var name: String = "Voices Rendering"
+
+const RENDER_SECONDS := 1.0
+
+# A chord of held notes on the same voice, so every preset is measured with a few channels.
+const VOICE_MML := "%6@0 o4 q8 l1 c^1; %6@0 o4 q8 l1 g^1; %6@0 o5 q8 l1 e^1;"
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var voice_preset_util := SiONVoicePresetUtil.generate_voices()
+	var voice_list := voice_preset_util.get_voice_preset_keys()
+
+	for voice_name in voice_list:
+		var voice := voice_preset_util.get_voice_preset(voice_name)
+		# Apply every setting of the voice, including the module type, like SiONDriver.note_on() does.
+		voice.update_track_parameters = true
+
+		var data := driver.compile(VOICE_MML)
+		data.set_fm_voice(0, voice)
+
+		var measurement := _measure_render_performance(driver, data, RENDER_SECONDS)
+		_assert_performance("render voice - %s" % [ voice_name ], "voice/%s" % [ voice_name ], measurement)
+
+	# Cleanup.
+
+	voice_preset_util.free()
+	driver.get_parent().remove_child(driver)
+	driver.free()
@@ -8,6 +8,8 @@ extends SceneTree
 
 const TestBase := preload("res://TestBase.gd")
 const RUN_ROOT := "./run"
+const PERF_ROOT := "./perf"
+const PERF_BASELINE_PATH := "./perf/baseline.json"
 
 var tests_total: int = 0
 var tests_success: int = 0
@@ -26,14 +28,23 @@ func _init():
 	print_rich("[color=gray]=========== RUNNING GDSION TESTS ===========[/color]")
 	print("")
 
-	var fs := DirAccess.open(RUN_ROOT)
+	# Passing `-- --perf` runs performance tests instead, which compare rendering speed against
+	# a baseline. See _get_args_perf() for other options.
+	var perf_settings := _get_args_perf()
+	var run_root: String = PERF_ROOT if perf_settings["enabled"] else RUN_ROOT
+
+	if perf_settings["enabled"]:
+		TestBase.perf_threshold = perf_settings["threshold"]
+		TestBase.perf_baseline = _load_perf_baseline(perf_settings["baseline"])
+
+	var fs := DirAccess.open(run_root)
 	if not fs:
-		_quit_fatal("Fatal Error: Unable to open the run root at '%s' (code %d)." % [ RUN_ROOT, DirAccess.get_open_error() ])
+		_quit_fatal("Fatal Error: Unable to open the run root at '%s' (code %d)." % [ run_root, DirAccess.get_open_error() ])
 		return
 
 	var error := fs.list_dir_begin()
 	if error != OK:
-		_quit_fatal("Fatal Error: Unable to list files at '%s' (code %d)." % [ RUN_ROOT, DirAccess.get_open_error() ])
+		_quit_fatal("Fatal Error: Unable to list files at '%s' (code %d)." % [ run_root, DirAccess.get_open_error() ])
 		return
 
 	# Passing `-- --case script_filename_sans_ext` should only run that one script.
@@ -45,13 +56,16 @@ func _init():
 
 	var run_files := fs.get_files()
 	for file_name in run_files:
+		if file_name.get_extension() != "gd":
+			continue
+
 		var script_base := file_name.get_basename()
 		if not selected_scripts.is_empty() && not selected_scripts.has(script_base):
 			continue
 
 		tests_total += 1
 
-		var script_name := RUN_ROOT.path_join(file_name)
+		var script_name := run_root.path_join(file_name)
 		var script: GDScript = load(script_name)
 		if not script:
 			printerr("Warning: Failed to load script at '%s'." % [ script_name ])
@@ -70,6 +84,10 @@ func _init():
 			tests_success += 1
 
 	fs.list_dir_end()
+
+	if perf_settings["enabled"] && perf_settings["update"]:
+		_store_perf_baseline(perf_settings["baseline"])
+
 	_quit_with_status()
 
 
@@ -93,6 +111,68 @@ func _get_args_scripts() -> PackedStringArray:
 	return scripts
 
 
+# Passing `--perf-baseline path` changes the baseline file, `--perf-threshold 0.25` changes
+# the allowed slowdown, and `--perf-update` stores the results as the new baseline.
+func _get_args_perf() -> Dictionary:
+	var settings := {
+		"enabled": false,
+		"baseline": PERF_BASELINE_PATH,
+		"threshold": 0.25,
+		"update": false,
+	}
+
+	var args := OS.get_cmdline_user_args()
+	var i := 0
+	while i < args.size():
+		var arg_key := args[i]
+
+		match arg_key:
+			"--perf":
+				settings["enabled"] = true
+			"--perf-update":
+				settings["update"] = true
+			"--perf-baseline", "--perf-threshold":
+				i += 1
+				if i < args.size() && not args[i].begins_with("--"):
+					if arg_key == "--perf-baseline":
+						settings["baseline"] = args[i]
+					else:
+						settings["threshold"] = maxf(0.0, args[i].to_float())
+
+		i += 1
+
+	return settings
+
+
+func _load_perf_baseline(path: String) -> Dictionary:
+	var file := FileAccess.open(path, FileAccess.READ)
+	if not file:
+		print_rich("[color=gray]No performance baseline at '%s', nothing to compare against.[/color]" % [ path ])
+		print("")
+		return {}
+
+	var data: Variant = JSON.parse_string(file.get_as_text(true))
+	if typeof(data) != TYPE_DICTIONARY:
+		printerr("Warning: Invalid performance baseline at '%s'." % [ path ])
+		return {}
+
+	return data
+
+
+func _store_perf_baseline(path: String) -> void:
+	# Keep entries which weren't measured this time, e.g. when running with --case.
+	var baseline := _load_perf_baseline(path)
+	baseline.merge(TestBase.perf_results, true)
+
+	var file := FileAccess.open(path, FileAccess.WRITE)
+	if not file:
+		printerr("Warning: Unable to write the performance baseline to '%s' (code %d)." % [ path, FileAccess.get_open_error() ])
+		return
+
+	file.store_string(JSON.stringify(baseline, "\t", true))
+	print_rich("[color=gray]Performance baseline stored at '%s'.[/color]" % [ path ])
+
+
 func _quit_fatal(message: String) -> void:
 	print("")
 	print_rich("[color=gray]=========== FAILED GDSION TESTS ===========[/color]")
@@ -0,0 +1,95 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "SiONDriver"
+var name: String = "Analysis Taps"
+
+const TRACK_ID := 1
+# A4, played with the default voice, which is a plain sine wave.
+const NOTE := 69
+const NOTE_FREQUENCY := 440.0
+const FFT_SIZE := 2048
+# Buffers played before measuring, so the attack and the FFT window are past.
+const SETTLE_BUFFERS := 8
+
+# A spectrum bin is about 21.5 Hz wide at this size, reading interleaved samples as mono halves the frequency.
+const FREQUENCY_TOLERANCE := 3 * 44100.0 / FFT_SIZE
+# Tolerances for the level relations of a centered sine.
+const LEVEL_TOLERANCE := 0.1
+
+
+func run(scene_tree: SceneTree) -> void:
+	await _test_driver(scene_tree, 2, "stereo")
+	await _test_driver(scene_tree, 1, "mono")
+
+
+func _test_driver(scene_tree: SceneTree, channel_num: int, label: String) -> void:
+	var driver := SiONDriver.create(2048, channel_num)
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var master_tap := SiONAnalysisTap.new()
+	master_tap.fft_size = FFT_SIZE
+	driver.attach_analysis_tap(master_tap, SiONAnalysisTap.TARGET_MASTER)
+
+	var track_tap := SiONAnalysisTap.new()
+	track_tap.fft_size = FFT_SIZE
+	driver.attach_analysis_tap(track_tap, SiONAnalysisTap.TARGET_TRACK, TRACK_ID)
+
+	driver.set_stream_event_enabled(true)
+	driver.stream()
+	await driver.stream_started
+
+	driver.note_on(NOTE, SiONVoice.new(), 0, 0, 0, TRACK_ID)
+	for i in SETTLE_BUFFERS:
+		await driver.streaming
+
+	_check_tap("%s master" % [ label ], master_tap)
+	_check_tap("%s track" % [ label ], track_tap)
+
+	# Cleanup.
+
+	driver.note_off(NOTE, TRACK_ID, 0, 0, true)
+	driver.stop()
+	driver.detach_analysis_tap(track_tap)
+	driver.detach_analysis_tap(master_tap)
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _check_tap(label: String, tap: SiONAnalysisTap) -> void:
+	var levels := tap.get_levels()
+	_assert_equal("%s: level count" % [ label ], levels.size(), 4)
+	if levels.size() < 4:
+		return
+
+	# Peak left, peak right, RMS left, RMS right.
+	_assert_equal("%s: signal present" % [ label ], levels[0] > 0.01 && levels[1] > 0.01, true)
+	_assert_equal("%s: peaks match" % [ label ], _is_equal_approx_relative(levels[0], levels[1]), true)
+	_assert_equal("%s: RMS matches" % [ label ], _is_equal_approx_relative(levels[2], levels[3]), true)
+	_assert_equal("%s: RMS of a sine" % [ label ], _is_equal_approx_relative(levels[2], levels[0] / sqrt(2.0)), true)
+
+	var spectrum := tap.get_spectrum()
+	_assert_equal("%s: spectrum size" % [ label ], spectrum.size(), (FFT_SIZE >> 1) + 1)
+
+	var peak_bin := 0
+	for i in spectrum.size():
+		if spectrum[i] > spectrum[peak_bin]:
+			peak_bin = i
+
+	var peak_frequency := peak_bin * 44100.0 / FFT_SIZE
+	asserts_total += 1
+	if absf(peak_frequency - NOTE_FREQUENCY) <= FREQUENCY_TOLERANCE:
+		asserts_success += 1
+		_print_ok("%s: spectrum peak" % [ label ], "%.1f Hz" % [ peak_frequency ])
+	else:
+		_print_fail("%s: spectrum peak" % [ label ], "%.1f Hz, expected %.1f Hz" % [ peak_frequency, NOTE_FREQUENCY ])
+
+
+func _is_equal_approx_relative(value: float, expected: float) -> bool:
+	return absf(value - expected) <= absf(expected) * LEVEL_TOLERANCE
@@ -0,0 +1,112 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "SiONDriver"
+var name: String = "Batched Track Events"
+
+# Frame events are requested for both note on and note off.
+const SEQUENCE_MML := "%t1,1,1 t240 o5 l8 cdef"
+const SEQUENCE_NOTES := [ 60, 62, 64, 65 ]
+const MAX_WAIT_FRAMES := 600
+
+var _batch_count: int = 0
+var _batched_events: PackedInt32Array = []
+var _individual_event_count: int = 0
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	driver.batched_track_events_enabled = true
+	driver.set_beat_event_enabled(true)
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	driver.track_events_batched.connect(_collect_batched_events)
+	driver.note_on_frame.connect(_count_individual_event)
+	driver.note_off_frame.connect(_count_individual_event)
+	driver.streaming_beat.connect(_count_individual_event)
+
+	var data := driver.compile(SEQUENCE_MML)
+	driver.play(data)
+
+	var wait_frames := 0
+	while _count_events(SiONDriver.BATCHED_NOTE_OFF) < SEQUENCE_NOTES.size() && wait_frames < MAX_WAIT_FRAMES:
+		await scene_tree.process_frame
+		wait_frames += 1
+
+	_assert_equal("events are batched", _batch_count > 0, true)
+	_assert_equal("no individual events", _individual_event_count, 0)
+	_assert_equal("batch is packed by 4", _batched_events.size() % 4, 0)
+
+	# Every event is packed as its type, track ID, note or beat counter, and buffer offset.
+
+	var note_sequence: PackedInt32Array = []
+	var expected_sequence: PackedInt32Array = []
+	for note in SEQUENCE_NOTES:
+		expected_sequence.append_array([ SiONDriver.BATCHED_NOTE_ON, note, SiONDriver.BATCHED_NOTE_OFF, note ])
+
+	var note_track_id := -2
+	var note_tracks_valid := true
+	var beat_counter := -1
+	var beats_valid := true
+	var offsets_valid := true
+
+	for i in range(0, _batched_events.size(), 4):
+		var type := _batched_events[i]
+		var track_id := _batched_events[i + 1]
+		var value := _batched_events[i + 2]
+		var offset := _batched_events[i + 3]
+
+		if offset < 0 || offset >= driver.get_buffer_length():
+			offsets_valid = false
+
+		if type == SiONDriver.BATCHED_NOTE_ON || type == SiONDriver.BATCHED_NOTE_OFF:
+			note_sequence.append_array([ type, value ])
+
+			# All notes come from the same sequence track.
+			if note_track_id == -2:
+				note_track_id = track_id
+			if track_id < 0 || track_id != note_track_id:
+				note_tracks_valid = false
+
+		elif type == SiONDriver.BATCHED_BEAT:
+			if track_id != -1 || value <= beat_counter:
+				beats_valid = false
+			beat_counter = value
+
+	_assert_equal("notes in playback order", note_sequence, expected_sequence)
+	_assert_equal("notes on the sequence track", note_tracks_valid, true)
+	_assert_equal("beats counted up without a track", beats_valid && beat_counter >= 0, true)
+	_assert_equal("offsets within the buffer", offsets_valid, true)
+
+	# Cleanup.
+
+	driver.track_events_batched.disconnect(_collect_batched_events)
+	driver.note_on_frame.disconnect(_count_individual_event)
+	driver.note_off_frame.disconnect(_count_individual_event)
+	driver.streaming_beat.disconnect(_count_individual_event)
+	driver.stop()
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _collect_batched_events(events: PackedInt32Array) -> void:
+	_batch_count += 1
+	_batched_events.append_array(events)
+
+
+func _count_individual_event(_event: SiONTrackEvent) -> void:
+	_individual_event_count += 1
+
+
+func _count_events(type: int) -> int:
+	var count := 0
+	for i in range(0, _batched_events.size(), 4):
+		if _batched_events[i] == type:
+			count += 1
+	return count
@@ -0,0 +1,89 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "SiONDriver"
+var name: String = "Command Queue"
+
+const NOTE_COMMAND_COUNT := 64
+# Streaming starts on the first frame and executes commands one buffer later, so this is plenty.
+const MAX_WAIT_FRAMES := 300
+
+var _executed_ids: PackedInt32Array = []
+var _executed_notes: PackedInt32Array = []
+var _executed_tracks: Array[SiMMLTrack] = []
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	driver.command_executed.connect(_collect_executed_command)
+	driver.stream()
+	await driver.stream_started
+
+	# Queue everything within one frame, mixing all kinds of commands.
+	var voice := SiONVoice.new()
+	var data := driver.compile("l4 cdef")
+	var queued_ids: PackedInt32Array = []
+	var queued_notes: PackedInt32Array = []
+
+	queued_ids.push_back(driver.queue_bpm(150))
+	queued_notes.push_back(0)
+	for i in NOTE_COMMAND_COUNT:
+		var note := 36 + i
+		queued_ids.push_back(driver.queue_note_on(note, voice, 1, 0, 0, 100 + i))
+		queued_notes.push_back(note)
+	queued_ids.push_back(driver.queue_sequence_on(data, voice, 0, 0, 0, 200))
+	queued_notes.push_back(0)
+	queued_ids.push_back(driver.queue_volume(0.25))
+	queued_notes.push_back(0)
+	# Later commands must win over earlier ones.
+	queued_ids.push_back(driver.queue_bpm(90))
+	queued_notes.push_back(0)
+	queued_ids.push_back(driver.queue_volume(0.75))
+	queued_notes.push_back(0)
+
+	# Drop our own references, so the queue holds the last ones.
+	voice = null
+	data = null
+
+	_assert_equal("all commands queued", queued_ids.has(-1), false)
+
+	var wait_frames := 0
+	while _executed_ids.size() < queued_ids.size() && wait_frames < MAX_WAIT_FRAMES:
+		await scene_tree.process_frame
+		wait_frames += 1
+
+	_assert_equal("executed command count", _executed_ids.size(), queued_ids.size())
+	_assert_equal("executed in queue order", _executed_ids, queued_ids)
+	_assert_equal("executed with queued notes", _executed_notes, queued_notes)
+
+	var note_tracks_valid := true
+	for i in NOTE_COMMAND_COUNT:
+		var track: SiMMLTrack = _executed_tracks[1 + i] if _executed_tracks.size() > 1 + i else null
+		if not track || track.get_track_id() != 100 + i:
+			note_tracks_valid = false
+			break
+	_assert_equal("note tracks created", note_tracks_valid, true)
+
+	_assert_equal("last bpm applied", driver.get_bpm(), 90.0)
+	_assert_equal("last volume applied", driver.get_volume(), 0.75)
+
+	# Cleanup.
+
+	driver.command_executed.disconnect(_collect_executed_command)
+	driver.stop()
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _collect_executed_command(event: SiONTrackEvent) -> void:
+	_executed_ids.push_back(event.get_event_trigger_id())
+	_executed_notes.push_back(event.get_note())
+	_executed_tracks.push_back(event.get_track())
@@ -0,0 +1,154 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "SiONDriver"
+var name: String = "Output Buses"
+
+const ROUTED_TRACK_ID := 1
+const MAIN_TRACK_ID := 2
+const NOTE := 60
+
+# Streams keep a few rendered buffers ahead, so this many frames are skipped after every change.
+const SETTLE_FRAMES := 2048 * 4
+# Frames captured from each bus before measuring, and how long to wait for them.
+const CAPTURE_FRAMES := 2048
+const MAX_WAIT_FRAMES := 300
+# RMS levels of a playing note, and of silence.
+const ACTIVE_LEVEL := 0.01
+const SILENT_LEVEL := 0.0005
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	driver.output_mode = SiONDriver.OUTPUT_EXTERNAL
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var routed_stream := driver.create_output_stream()
+	_assert_equal("output stream count", driver.get_output_stream_count(), 2)
+	_assert_equal("output stream bus", routed_stream.get_bus(), 1)
+
+	driver.set_track_output_bus(ROUTED_TRACK_ID, routed_stream.get_bus())
+	_assert_equal("routed track bus", driver.get_track_output_bus(ROUTED_TRACK_ID), 1)
+	_assert_equal("main track bus", driver.get_track_output_bus(MAIN_TRACK_ID), 0)
+
+	# Each output stream is played into its own engine bus, where it is captured.
+	var main_capture := _add_capture_bus("SiONTestMain")
+	var routed_capture := _add_capture_bus("SiONTestRouted")
+	var main_player := _add_player(scene_tree, driver.get_output_stream(0), "SiONTestMain")
+	var routed_player := _add_player(scene_tree, routed_stream, "SiONTestRouted")
+
+	driver.stream()
+	await driver.stream_started
+
+	# A note on the routed track is only heard on its bus.
+
+	driver.note_on(NOTE, null, 0, 0, 0, ROUTED_TRACK_ID)
+	var levels := await _capture_levels(scene_tree, main_capture, routed_capture)
+	_assert_level("routed note - main bus", levels[0], false)
+	_assert_level("routed note - routed bus", levels[1], true)
+
+	driver.note_off(NOTE, ROUTED_TRACK_ID, 0, 0, true)
+
+	# Other tracks stay on the main output.
+
+	driver.note_on(NOTE, null, 0, 0, 0, MAIN_TRACK_ID)
+	levels = await _capture_levels(scene_tree, main_capture, routed_capture)
+	_assert_level("main note - main bus", levels[0], true)
+	_assert_level("main note - routed bus", levels[1], false)
+
+	driver.note_off(NOTE, MAIN_TRACK_ID, 0, 0, true)
+
+	# Tracks which are already playing are rerouted.
+
+	driver.note_on(NOTE, null, 0, 0, 0, MAIN_TRACK_ID)
+	driver.set_track_output_bus(MAIN_TRACK_ID, routed_stream.get_bus())
+	levels = await _capture_levels(scene_tree, main_capture, routed_capture)
+	_assert_level("rerouted note - main bus", levels[0], false)
+	_assert_level("rerouted note - routed bus", levels[1], true)
+
+	# Cleanup.
+
+	driver.stop()
+	main_player.stop()
+	routed_player.stop()
+	main_player.queue_free()
+	routed_player.queue_free()
+	AudioServer.remove_bus(AudioServer.get_bus_index("SiONTestRouted"))
+	AudioServer.remove_bus(AudioServer.get_bus_index("SiONTestMain"))
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _add_capture_bus(bus_name: String) -> AudioEffectCapture:
+	var bus_index := AudioServer.bus_count
+	AudioServer.add_bus(bus_index)
+	AudioServer.set_bus_name(bus_index, bus_name)
+
+	var capture := AudioEffectCapture.new()
+	capture.buffer_length = 0.5
+	AudioServer.add_bus_effect(bus_index, capture)
+	return capture
+
+
+func _add_player(scene_tree: SceneTree, stream: AudioStream, bus_name: String) -> AudioStreamPlayer:
+	var player := AudioStreamPlayer.new()
+	player.stream = stream
+	player.bus = bus_name
+	scene_tree.root.add_child(player)
+	player.play()
+	return player
+
+
+# Skips frames rendered before the last change, e.g. the release of previous notes, and returns the RMS of both buses.
+func _capture_levels(scene_tree: SceneTree, main_capture: AudioEffectCapture, routed_capture: AudioEffectCapture) -> PackedFloat32Array:
+	var skipped_frames := 0
+	var wait_frames := 0
+	while skipped_frames < SETTLE_FRAMES && wait_frames < MAX_WAIT_FRAMES:
+		await scene_tree.process_frame
+		wait_frames += 1
+
+		skipped_frames += mini(main_capture.get_frames_available(), routed_capture.get_frames_available())
+		main_capture.clear_buffer()
+		routed_capture.clear_buffer()
+
+	wait_frames = 0
+	while (main_capture.get_frames_available() < CAPTURE_FRAMES || routed_capture.get_frames_available() < CAPTURE_FRAMES) && wait_frames < MAX_WAIT_FRAMES:
+		await scene_tree.process_frame
+		wait_frames += 1
+
+	return PackedFloat32Array([ _get_rms(main_capture), _get_rms(routed_capture) ])
+
+
+func _get_rms(capture: AudioEffectCapture) -> float:
+	var frame_count := mini(capture.get_frames_available(), CAPTURE_FRAMES)
+	if frame_count == 0:
+		return 0.0
+
+	var frames := capture.get_buffer(frame_count)
+	var sum := 0.0
+	for frame in frames:
+		sum += frame.x * frame.x + frame.y * frame.y
+	return sqrt(sum / (frame_count * 2))
+
+
+func _assert_level(label: String, value: float, active: bool) -> bool:
+	asserts_total += 1
+
+	if active && value >= ACTIVE_LEVEL:
+		asserts_success += 1
+		_print_ok(label, "%.5f >= %.5f" % [ value, ACTIVE_LEVEL ])
+		return true
+	elif not active && value <= SILENT_LEVEL:
+		asserts_success += 1
+		_print_ok(label, "%.5f <= %.5f" % [ value, SILENT_LEVEL ])
+		return true
+	else:
+		_print_fail(label, "%.5f is %s" % [ value, "too quiet" if active else "too loud" ])
+		return false
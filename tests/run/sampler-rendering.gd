@@ -0,0 +1,130 @@
+###################################################
+# Part of GDSiON tests                            #
+# Copyright (c) 2024 Yuri Sizov and contributors  #
+# Provided under MIT                              #
+###################################################
+
+extends "res://TestBase.gd"
+
+var group: String = "Sampler"
+var name: String = "Sampler Rendering"
+
+const SAMPLE_RATE := 44100
+const SAMPLE_FREQUENCY := 441.0 # 100 frames per period.
+const SAMPLE_SECONDS := 2.0
+const RENDER_SECONDS := 0.5
+# Skip the attack, so measurements only include the steady tone.
+const MEASURE_OFFSET := 2048
+
+const ROOT_NOTE := 69 # o5a
+const FREQUENCY_TOLERANCE := 0.01 # A fraction of the expected frequency.
+const FORMAT_TOLERANCE := 0.001 # Int16 quantization error, with some headroom.
+
+
+func run(scene_tree: SceneTree) -> void:
+	var driver := SiONDriver.create()
+	scene_tree.root.add_child(driver)
+	await scene_tree.process_frame
+
+	var sample := _generate_sine(SAMPLE_FREQUENCY, SAMPLE_SECONDS)
+
+	# Without a root note, every note plays the sample at its original rate.
+	driver.set_sampler_wave(0, sample, false, 0, 1, 1, -1, 127)
+	_assert_frequency("unpitched - root", _render_frequency(driver, "%10 o5 a1"), SAMPLE_FREQUENCY)
+	_assert_frequency("unpitched - octave up", _render_frequency(driver, "%10 o6 a1"), SAMPLE_FREQUENCY)
+
+	# With a root note, other notes are pitch-shifted from it.
+	for quality in [ SiONDriver.SAMPLER_QUALITY_LINEAR, SiONDriver.SAMPLER_QUALITY_MEDIUM, SiONDriver.SAMPLER_QUALITY_HIGH ]:
+		driver.set_sampler_wave(0, sample, false, 0, 1, 1, ROOT_NOTE, 127, quality)
+
+		_assert_frequency("pitched %d - root" % [ quality ], _render_frequency(driver, "%10 o5 a1"), SAMPLE_FREQUENCY)
+		_assert_frequency("pitched %d - octave up" % [ quality ], _render_frequency(driver, "%10 o6 a1"), SAMPLE_FREQUENCY * 2.0)
+		_assert_frequency("pitched %d - octave down" % [ quality ], _render_frequency(driver, "%10 o4 a1"), SAMPLE_FREQUENCY * 0.5)
+		_assert_frequency("pitched %d - fifth up" % [ quality ], _render_frequency(driver, "%10 o6 e1"), SAMPLE_FREQUENCY * pow(2.0, 7.0 / 12.0))
+
+	# Both storage formats render the same output, within the precision of 16-bit samples.
+	var format_renders: Array[PackedFloat32Array] = []
+	for format in [ SiONDriver.SAMPLE_FORMAT_FLOAT32, SiONDriver.SAMPLE_FORMAT_INT16 ]:
+		driver.sample_format = format
+		driver.set_sampler_wave(0, sample, false, 0, 1, 1, ROOT_NOTE, 127)
+		format_renders.push_back(driver.render("%10 o5 a4 o6 e4", roundi(RENDER_SECONDS * SAMPLE_RATE) * 2, 2))
+
+	driver.sample_format = SiONDriver.SAMPLE_FORMAT_FLOAT32
+	_assert_buffers_match("float32 and int16 formats", format_renders[0], format_renders[1])
+
+	# Cleanup.
+
+	driver.get_parent().remove_child(driver)
+	driver.free()
+
+
+func _generate_sine(frequency: float, seconds: float) -> PackedFloat32Array:
+	var data := PackedFloat32Array()
+	data.resize(roundi(seconds * SAMPLE_RATE))
+
+	for i in data.size():
+		data[i] = sin(TAU * frequency * i / SAMPLE_RATE) * 0.5
+
+	return data
+
+
+# Renders the MML and returns the frequency of the left channel, estimated from rising zero crossings.
+func _render_frequency(driver: SiONDriver, mml: String) -> float:
+	var frame_count := roundi(RENDER_SECONDS * SAMPLE_RATE)
+	var buffer := driver.render(mml, frame_count * 2, 2)
+
+	var first_crossing := -1.0
+	var last_crossing := -1.0
+	var crossing_count := 0
+
+	for i in range(MEASURE_OFFSET, frame_count - 1):
+		var value: float = buffer[i * 2]
+		var next_value: float = buffer[(i + 1) * 2]
+		if value >= 0.0 || next_value < 0.0:
+			continue
+
+		# Interpolate the exact position of the crossing.
+		var crossing := i + value / (value - next_value)
+		if first_crossing < 0:
+			first_crossing = crossing
+		else:
+			crossing_count += 1
+		last_crossing = crossing
+
+	if crossing_count == 0:
+		return 0.0
+	return crossing_count * SAMPLE_RATE / (last_crossing - first_crossing)
+
+
+func _assert_frequency(label: String, value: float, against: float) -> bool:
+	asserts_total += 1
+
+	if absf(value - against) <= against * FREQUENCY_TOLERANCE:
+		asserts_success += 1
+		_print_ok(label, "%.2f Hz ~= %.2f Hz" % [ value, against ])
+		return true
+	else:
+		_print_fail(label, "%.2f Hz != %.2f Hz" % [ value, against ])
+		return false
+
+
+func _assert_buffers_match(label: String, value: PackedFloat32Array, against: PackedFloat32Array) -> bool:
+	asserts_total += 1
+
+	if value.size() != against.size():
+		_print_fail(label, "size %d != %d" % [ value.size(), against.size() ])
+		return false
+
+	var max_difference := 0.0
+	var max_value := 0.0
+	for i in value.size():
+		max_difference = maxf(max_difference, absf(value[i] - against[i]))
+		max_value = maxf(max_value, absf(against[i]))
+
+	if max_value > 0.0 && max_difference <= FORMAT_TOLERANCE:
+		asserts_success += 1
+		_print_ok(label, "max difference %.5f" % [ max_difference ])
+		return true
+	else:
+		_print_fail(label, "max difference %.5f, max value %.5f" % [ max_difference, max_value ])
+		return false